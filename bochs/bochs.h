@@ -113,6 +113,9 @@ extern "C" {
 // prototypes
 int  bx_begin_simulation(int argc, char *argv[]);
 void bx_stop_simulation();
+void bx_sr_before_save_state(void);
+void bx_before_fork(void);
+void bx_after_fork(bool child);
 char *bx_find_bochsrc(void);
 const char *get_builtin_variable(const char *varname);
 int  bx_parse_cmdline(int arg, int argc, char *argv[]);
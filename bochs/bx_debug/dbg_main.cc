@@ -31,6 +31,10 @@ extern "C" {
 
 #if BX_DEBUGGER
 
+#if BX_HAVE_FORK
+#include <fcntl.h>
+#endif
+
 #define LOG_THIS genlog->
 
 #if HAVE_LIBREADLINE
@@ -1500,13 +1504,18 @@ void bx_dbg_tlb_lookup(bx_lin_address laddr)
 {
   char cpu_param_name[16];
 
+  // show all ways of the TLB set
   Bit32u index = BX_CPU(dbg_cpu)->ITLB.get_index_of(laddr);
-  sprintf(cpu_param_name, "ITLB.entry%d", index);
-  bx_dbg_show_param_command(cpu_param_name, 0);
+  for (unsigned way=0; way < BX_TLB_WAYS; way++) {
+    sprintf(cpu_param_name, "ITLB.entry%d", index + way);
+    bx_dbg_show_param_command(cpu_param_name, 0);
+  }
 
   index = BX_CPU(dbg_cpu)->DTLB.get_index_of(laddr);
-  sprintf(cpu_param_name, "DTLB.entry%d", index);
-  bx_dbg_show_param_command(cpu_param_name, 0);
+  for (unsigned way=0; way < BX_TLB_WAYS; way++) {
+    sprintf(cpu_param_name, "DTLB.entry%d", index + way);
+    bx_dbg_show_param_command(cpu_param_name, 0);
+  }
 }
 
 unsigned dbg_show_mask = 0;
@@ -2793,6 +2802,33 @@ void bx_dbg_restore_command(const char *param_name, const char *restore_path)
   }
 }
 
+void bx_dbg_fork_command(void)
+{
+#if BX_HAVE_FORK
+  // both processes append their output to the debugger log
+  if (debugger_log != NULL) {
+    int fd = fileno(debugger_log);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_APPEND);
+  }
+#endif
+  int pid = SIM->fork_simulation();
+  if (pid < 0) {
+    dbg_printf("Error: could not fork the simulation\n");
+  }
+  else if (pid > 0) {
+    dbg_printf("forked simulation, child process %d\n", pid);
+  }
+  else {
+    // the console input stays with the parent, the child quits when
+    // it returns to the debugger prompt
+    if (freopen("/dev/null", "r", stdin) == NULL) {
+      bx_dbg_quit_command();
+    }
+    dbg_printf("running forked simulation\n");
+    bx_dbg_continue_command(1);
+  }
+}
+
 void bx_dbg_disassemble_current(const char *format)
 {
   Bit64u addr = BX_CPU(dbg_cpu)->get_laddr(BX_SEG_REG_CS, BX_CPU(dbg_cpu)->get_instruction_pointer());
@@ -3602,7 +3638,7 @@ void bx_dbg_print_help(void)
   dbg_printf("    r|reg|regs|registers, fp|fpu, mmx, sse, sreg, dreg, creg,\n");
   dbg_printf("    page, set, ptime, print-stack, bt, ?|calc\n");
   dbg_printf("-*- Working with bochs param tree -*-\n");
-  dbg_printf("    show \"param\", restore\n");
+  dbg_printf("    show \"param\", restore, fork\n");
 }
 
 extern Bit64u eval_value;
@@ -186,6 +186,7 @@ void bx_dbg_check_memory_watchpoints(unsigned cpu, bx_phy_address phy, unsigned
 
 // commands that work with Bochs param tree
 void bx_dbg_restore_command(const char *param_name, const char *path);
+void bx_dbg_fork_command(void);
 void bx_dbg_show_param_command(const char *param, bool xml);
 
 int bx_dbg_show_symbolic(void);
@@ -2301,7 +2301,7 @@ YY_RULE_SETUP
 case 208:
 YY_RULE_SETUP
 #line 267 "lexer.l"
-{ bxlval.sval = strdup(bxtext); return(BX_TOKEN_GENERIC); }
+{ bxlval.sval = strdup(bxtext); return(strcmp(bxtext, "fork") ? BX_TOKEN_GENERIC : BX_TOKEN_FORK); }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
@@ -181,66 +181,67 @@ extern int bxdebug;
     BX_TOKEN_XFORMAT = 309,        /* BX_TOKEN_XFORMAT  */
     BX_TOKEN_DISFORMAT = 310,      /* BX_TOKEN_DISFORMAT  */
     BX_TOKEN_RESTORE = 311,        /* BX_TOKEN_RESTORE  */
-    BX_TOKEN_WRITEMEM = 312,       /* BX_TOKEN_WRITEMEM  */
-    BX_TOKEN_SETPMEM = 313,        /* BX_TOKEN_SETPMEM  */
-    BX_TOKEN_SYMBOLNAME = 314,     /* BX_TOKEN_SYMBOLNAME  */
-    BX_TOKEN_QUERY = 315,          /* BX_TOKEN_QUERY  */
-    BX_TOKEN_PENDING = 316,        /* BX_TOKEN_PENDING  */
-    BX_TOKEN_TAKE = 317,           /* BX_TOKEN_TAKE  */
-    BX_TOKEN_DMA = 318,            /* BX_TOKEN_DMA  */
-    BX_TOKEN_IRQ = 319,            /* BX_TOKEN_IRQ  */
-    BX_TOKEN_SMI = 320,            /* BX_TOKEN_SMI  */
-    BX_TOKEN_NMI = 321,            /* BX_TOKEN_NMI  */
-    BX_TOKEN_TLB = 322,            /* BX_TOKEN_TLB  */
-    BX_TOKEN_DISASM = 323,         /* BX_TOKEN_DISASM  */
-    BX_TOKEN_INSTRUMENT = 324,     /* BX_TOKEN_INSTRUMENT  */
-    BX_TOKEN_STRING = 325,         /* BX_TOKEN_STRING  */
-    BX_TOKEN_STOP = 326,           /* BX_TOKEN_STOP  */
-    BX_TOKEN_DOIT = 327,           /* BX_TOKEN_DOIT  */
-    BX_TOKEN_CRC = 328,            /* BX_TOKEN_CRC  */
-    BX_TOKEN_TRACE = 329,          /* BX_TOKEN_TRACE  */
-    BX_TOKEN_TRACEREG = 330,       /* BX_TOKEN_TRACEREG  */
-    BX_TOKEN_TRACEMEM = 331,       /* BX_TOKEN_TRACEMEM  */
-    BX_TOKEN_SWITCH_MODE = 332,    /* BX_TOKEN_SWITCH_MODE  */
-    BX_TOKEN_SIZE = 333,           /* BX_TOKEN_SIZE  */
-    BX_TOKEN_PTIME = 334,          /* BX_TOKEN_PTIME  */
-    BX_TOKEN_TIMEBP_ABSOLUTE = 335, /* BX_TOKEN_TIMEBP_ABSOLUTE  */
-    BX_TOKEN_TIMEBP = 336,         /* BX_TOKEN_TIMEBP  */
-    BX_TOKEN_MODEBP = 337,         /* BX_TOKEN_MODEBP  */
-    BX_TOKEN_VMEXITBP = 338,       /* BX_TOKEN_VMEXITBP  */
-    BX_TOKEN_PRINT_STACK = 339,    /* BX_TOKEN_PRINT_STACK  */
-    BX_TOKEN_BT = 340,             /* BX_TOKEN_BT  */
-    BX_TOKEN_WATCH = 341,          /* BX_TOKEN_WATCH  */
-    BX_TOKEN_UNWATCH = 342,        /* BX_TOKEN_UNWATCH  */
-    BX_TOKEN_READ = 343,           /* BX_TOKEN_READ  */
-    BX_TOKEN_WRITE = 344,          /* BX_TOKEN_WRITE  */
-    BX_TOKEN_SHOW = 345,           /* BX_TOKEN_SHOW  */
-    BX_TOKEN_LOAD_SYMBOLS = 346,   /* BX_TOKEN_LOAD_SYMBOLS  */
-    BX_TOKEN_SYMBOLS = 347,        /* BX_TOKEN_SYMBOLS  */
-    BX_TOKEN_LIST_SYMBOLS = 348,   /* BX_TOKEN_LIST_SYMBOLS  */
-    BX_TOKEN_GLOBAL = 349,         /* BX_TOKEN_GLOBAL  */
-    BX_TOKEN_WHERE = 350,          /* BX_TOKEN_WHERE  */
-    BX_TOKEN_PRINT_STRING = 351,   /* BX_TOKEN_PRINT_STRING  */
-    BX_TOKEN_NUMERIC = 352,        /* BX_TOKEN_NUMERIC  */
-    BX_TOKEN_PAGE = 353,           /* BX_TOKEN_PAGE  */
-    BX_TOKEN_HELP = 354,           /* BX_TOKEN_HELP  */
-    BX_TOKEN_XML = 355,            /* BX_TOKEN_XML  */
-    BX_TOKEN_CALC = 356,           /* BX_TOKEN_CALC  */
-    BX_TOKEN_DEVICE = 357,         /* BX_TOKEN_DEVICE  */
-    BX_TOKEN_GENERIC = 358,        /* BX_TOKEN_GENERIC  */
-    BX_TOKEN_RSHIFT = 359,         /* BX_TOKEN_RSHIFT  */
-    BX_TOKEN_LSHIFT = 360,         /* BX_TOKEN_LSHIFT  */
-    BX_TOKEN_EQ = 361,             /* BX_TOKEN_EQ  */
-    BX_TOKEN_NE = 362,             /* BX_TOKEN_NE  */
-    BX_TOKEN_LE = 363,             /* BX_TOKEN_LE  */
-    BX_TOKEN_GE = 364,             /* BX_TOKEN_GE  */
-    BX_TOKEN_REG_IP = 365,         /* BX_TOKEN_REG_IP  */
-    BX_TOKEN_REG_EIP = 366,        /* BX_TOKEN_REG_EIP  */
-    BX_TOKEN_REG_RIP = 367,        /* BX_TOKEN_REG_RIP  */
-    BX_TOKEN_REG_SSP = 368,        /* BX_TOKEN_REG_SSP  */
-    NOT = 369,                     /* NOT  */
-    NEG = 370,                     /* NEG  */
-    INDIRECT = 371                 /* INDIRECT  */
+    BX_TOKEN_FORK = 312,           /* BX_TOKEN_FORK  */
+    BX_TOKEN_WRITEMEM = 313,       /* BX_TOKEN_WRITEMEM  */
+    BX_TOKEN_SETPMEM = 314,        /* BX_TOKEN_SETPMEM  */
+    BX_TOKEN_SYMBOLNAME = 315,     /* BX_TOKEN_SYMBOLNAME  */
+    BX_TOKEN_QUERY = 316,          /* BX_TOKEN_QUERY  */
+    BX_TOKEN_PENDING = 317,        /* BX_TOKEN_PENDING  */
+    BX_TOKEN_TAKE = 318,           /* BX_TOKEN_TAKE  */
+    BX_TOKEN_DMA = 319,            /* BX_TOKEN_DMA  */
+    BX_TOKEN_IRQ = 320,            /* BX_TOKEN_IRQ  */
+    BX_TOKEN_SMI = 321,            /* BX_TOKEN_SMI  */
+    BX_TOKEN_NMI = 322,            /* BX_TOKEN_NMI  */
+    BX_TOKEN_TLB = 323,            /* BX_TOKEN_TLB  */
+    BX_TOKEN_DISASM = 324,         /* BX_TOKEN_DISASM  */
+    BX_TOKEN_INSTRUMENT = 325,     /* BX_TOKEN_INSTRUMENT  */
+    BX_TOKEN_STRING = 326,         /* BX_TOKEN_STRING  */
+    BX_TOKEN_STOP = 327,           /* BX_TOKEN_STOP  */
+    BX_TOKEN_DOIT = 328,           /* BX_TOKEN_DOIT  */
+    BX_TOKEN_CRC = 329,            /* BX_TOKEN_CRC  */
+    BX_TOKEN_TRACE = 330,          /* BX_TOKEN_TRACE  */
+    BX_TOKEN_TRACEREG = 331,       /* BX_TOKEN_TRACEREG  */
+    BX_TOKEN_TRACEMEM = 332,       /* BX_TOKEN_TRACEMEM  */
+    BX_TOKEN_SWITCH_MODE = 333,    /* BX_TOKEN_SWITCH_MODE  */
+    BX_TOKEN_SIZE = 334,           /* BX_TOKEN_SIZE  */
+    BX_TOKEN_PTIME = 335,          /* BX_TOKEN_PTIME  */
+    BX_TOKEN_TIMEBP_ABSOLUTE = 336, /* BX_TOKEN_TIMEBP_ABSOLUTE  */
+    BX_TOKEN_TIMEBP = 337,         /* BX_TOKEN_TIMEBP  */
+    BX_TOKEN_MODEBP = 338,         /* BX_TOKEN_MODEBP  */
+    BX_TOKEN_VMEXITBP = 339,       /* BX_TOKEN_VMEXITBP  */
+    BX_TOKEN_PRINT_STACK = 340,    /* BX_TOKEN_PRINT_STACK  */
+    BX_TOKEN_BT = 341,             /* BX_TOKEN_BT  */
+    BX_TOKEN_WATCH = 342,          /* BX_TOKEN_WATCH  */
+    BX_TOKEN_UNWATCH = 343,        /* BX_TOKEN_UNWATCH  */
+    BX_TOKEN_READ = 344,           /* BX_TOKEN_READ  */
+    BX_TOKEN_WRITE = 345,          /* BX_TOKEN_WRITE  */
+    BX_TOKEN_SHOW = 346,           /* BX_TOKEN_SHOW  */
+    BX_TOKEN_LOAD_SYMBOLS = 347,   /* BX_TOKEN_LOAD_SYMBOLS  */
+    BX_TOKEN_SYMBOLS = 348,        /* BX_TOKEN_SYMBOLS  */
+    BX_TOKEN_LIST_SYMBOLS = 349,   /* BX_TOKEN_LIST_SYMBOLS  */
+    BX_TOKEN_GLOBAL = 350,         /* BX_TOKEN_GLOBAL  */
+    BX_TOKEN_WHERE = 351,          /* BX_TOKEN_WHERE  */
+    BX_TOKEN_PRINT_STRING = 352,   /* BX_TOKEN_PRINT_STRING  */
+    BX_TOKEN_NUMERIC = 353,        /* BX_TOKEN_NUMERIC  */
+    BX_TOKEN_PAGE = 354,           /* BX_TOKEN_PAGE  */
+    BX_TOKEN_HELP = 355,           /* BX_TOKEN_HELP  */
+    BX_TOKEN_XML = 356,            /* BX_TOKEN_XML  */
+    BX_TOKEN_CALC = 357,           /* BX_TOKEN_CALC  */
+    BX_TOKEN_DEVICE = 358,         /* BX_TOKEN_DEVICE  */
+    BX_TOKEN_GENERIC = 359,        /* BX_TOKEN_GENERIC  */
+    BX_TOKEN_RSHIFT = 360,         /* BX_TOKEN_RSHIFT  */
+    BX_TOKEN_LSHIFT = 361,         /* BX_TOKEN_LSHIFT  */
+    BX_TOKEN_EQ = 362,             /* BX_TOKEN_EQ  */
+    BX_TOKEN_NE = 363,             /* BX_TOKEN_NE  */
+    BX_TOKEN_LE = 364,             /* BX_TOKEN_LE  */
+    BX_TOKEN_GE = 365,             /* BX_TOKEN_GE  */
+    BX_TOKEN_REG_IP = 366,         /* BX_TOKEN_REG_IP  */
+    BX_TOKEN_REG_EIP = 367,        /* BX_TOKEN_REG_EIP  */
+    BX_TOKEN_REG_RIP = 368,        /* BX_TOKEN_REG_RIP  */
+    BX_TOKEN_REG_SSP = 369,        /* BX_TOKEN_REG_SSP  */
+    NOT = 370,                     /* NOT  */
+    NEG = 371,                     /* NEG  */
+    INDIRECT = 372                 /* INDIRECT  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -303,66 +304,67 @@ extern int bxdebug;
 #define BX_TOKEN_XFORMAT 309
 #define BX_TOKEN_DISFORMAT 310
 #define BX_TOKEN_RESTORE 311
-#define BX_TOKEN_WRITEMEM 312
-#define BX_TOKEN_SETPMEM 313
-#define BX_TOKEN_SYMBOLNAME 314
-#define BX_TOKEN_QUERY 315
-#define BX_TOKEN_PENDING 316
-#define BX_TOKEN_TAKE 317
-#define BX_TOKEN_DMA 318
-#define BX_TOKEN_IRQ 319
-#define BX_TOKEN_SMI 320
-#define BX_TOKEN_NMI 321
-#define BX_TOKEN_TLB 322
-#define BX_TOKEN_DISASM 323
-#define BX_TOKEN_INSTRUMENT 324
-#define BX_TOKEN_STRING 325
-#define BX_TOKEN_STOP 326
-#define BX_TOKEN_DOIT 327
-#define BX_TOKEN_CRC 328
-#define BX_TOKEN_TRACE 329
-#define BX_TOKEN_TRACEREG 330
-#define BX_TOKEN_TRACEMEM 331
-#define BX_TOKEN_SWITCH_MODE 332
-#define BX_TOKEN_SIZE 333
-#define BX_TOKEN_PTIME 334
-#define BX_TOKEN_TIMEBP_ABSOLUTE 335
-#define BX_TOKEN_TIMEBP 336
-#define BX_TOKEN_MODEBP 337
-#define BX_TOKEN_VMEXITBP 338
-#define BX_TOKEN_PRINT_STACK 339
-#define BX_TOKEN_BT 340
-#define BX_TOKEN_WATCH 341
-#define BX_TOKEN_UNWATCH 342
-#define BX_TOKEN_READ 343
-#define BX_TOKEN_WRITE 344
-#define BX_TOKEN_SHOW 345
-#define BX_TOKEN_LOAD_SYMBOLS 346
-#define BX_TOKEN_SYMBOLS 347
-#define BX_TOKEN_LIST_SYMBOLS 348
-#define BX_TOKEN_GLOBAL 349
-#define BX_TOKEN_WHERE 350
-#define BX_TOKEN_PRINT_STRING 351
-#define BX_TOKEN_NUMERIC 352
-#define BX_TOKEN_PAGE 353
-#define BX_TOKEN_HELP 354
-#define BX_TOKEN_XML 355
-#define BX_TOKEN_CALC 356
-#define BX_TOKEN_DEVICE 357
-#define BX_TOKEN_GENERIC 358
-#define BX_TOKEN_RSHIFT 359
-#define BX_TOKEN_LSHIFT 360
-#define BX_TOKEN_EQ 361
-#define BX_TOKEN_NE 362
-#define BX_TOKEN_LE 363
-#define BX_TOKEN_GE 364
-#define BX_TOKEN_REG_IP 365
-#define BX_TOKEN_REG_EIP 366
-#define BX_TOKEN_REG_RIP 367
-#define BX_TOKEN_REG_SSP 368
-#define NOT 369
-#define NEG 370
-#define INDIRECT 371
+#define BX_TOKEN_FORK 312
+#define BX_TOKEN_WRITEMEM 313
+#define BX_TOKEN_SETPMEM 314
+#define BX_TOKEN_SYMBOLNAME 315
+#define BX_TOKEN_QUERY 316
+#define BX_TOKEN_PENDING 317
+#define BX_TOKEN_TAKE 318
+#define BX_TOKEN_DMA 319
+#define BX_TOKEN_IRQ 320
+#define BX_TOKEN_SMI 321
+#define BX_TOKEN_NMI 322
+#define BX_TOKEN_TLB 323
+#define BX_TOKEN_DISASM 324
+#define BX_TOKEN_INSTRUMENT 325
+#define BX_TOKEN_STRING 326
+#define BX_TOKEN_STOP 327
+#define BX_TOKEN_DOIT 328
+#define BX_TOKEN_CRC 329
+#define BX_TOKEN_TRACE 330
+#define BX_TOKEN_TRACEREG 331
+#define BX_TOKEN_TRACEMEM 332
+#define BX_TOKEN_SWITCH_MODE 333
+#define BX_TOKEN_SIZE 334
+#define BX_TOKEN_PTIME 335
+#define BX_TOKEN_TIMEBP_ABSOLUTE 336
+#define BX_TOKEN_TIMEBP 337
+#define BX_TOKEN_MODEBP 338
+#define BX_TOKEN_VMEXITBP 339
+#define BX_TOKEN_PRINT_STACK 340
+#define BX_TOKEN_BT 341
+#define BX_TOKEN_WATCH 342
+#define BX_TOKEN_UNWATCH 343
+#define BX_TOKEN_READ 344
+#define BX_TOKEN_WRITE 345
+#define BX_TOKEN_SHOW 346
+#define BX_TOKEN_LOAD_SYMBOLS 347
+#define BX_TOKEN_SYMBOLS 348
+#define BX_TOKEN_LIST_SYMBOLS 349
+#define BX_TOKEN_GLOBAL 350
+#define BX_TOKEN_WHERE 351
+#define BX_TOKEN_PRINT_STRING 352
+#define BX_TOKEN_NUMERIC 353
+#define BX_TOKEN_PAGE 354
+#define BX_TOKEN_HELP 355
+#define BX_TOKEN_XML 356
+#define BX_TOKEN_CALC 357
+#define BX_TOKEN_DEVICE 358
+#define BX_TOKEN_GENERIC 359
+#define BX_TOKEN_RSHIFT 360
+#define BX_TOKEN_LSHIFT 361
+#define BX_TOKEN_EQ 362
+#define BX_TOKEN_NE 363
+#define BX_TOKEN_LE 364
+#define BX_TOKEN_GE 365
+#define BX_TOKEN_REG_IP 366
+#define BX_TOKEN_REG_EIP 367
+#define BX_TOKEN_REG_RIP 368
+#define BX_TOKEN_REG_SSP 369
+#define NOT 370
+#define NEG 371
+#define INDIRECT 372
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -374,7 +376,7 @@ union YYSTYPE
   Bit64u   uval;
   unsigned bval;
 
-#line 378 "y.tab.c"
+#line 380 "y.tab.c"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -451,141 +453,143 @@ enum yysymbol_kind_t
   YYSYMBOL_BX_TOKEN_XFORMAT = 54,          /* BX_TOKEN_XFORMAT  */
   YYSYMBOL_BX_TOKEN_DISFORMAT = 55,        /* BX_TOKEN_DISFORMAT  */
   YYSYMBOL_BX_TOKEN_RESTORE = 56,          /* BX_TOKEN_RESTORE  */
-  YYSYMBOL_BX_TOKEN_WRITEMEM = 57,         /* BX_TOKEN_WRITEMEM  */
-  YYSYMBOL_BX_TOKEN_SETPMEM = 58,          /* BX_TOKEN_SETPMEM  */
-  YYSYMBOL_BX_TOKEN_SYMBOLNAME = 59,       /* BX_TOKEN_SYMBOLNAME  */
-  YYSYMBOL_BX_TOKEN_QUERY = 60,            /* BX_TOKEN_QUERY  */
-  YYSYMBOL_BX_TOKEN_PENDING = 61,          /* BX_TOKEN_PENDING  */
-  YYSYMBOL_BX_TOKEN_TAKE = 62,             /* BX_TOKEN_TAKE  */
-  YYSYMBOL_BX_TOKEN_DMA = 63,              /* BX_TOKEN_DMA  */
-  YYSYMBOL_BX_TOKEN_IRQ = 64,              /* BX_TOKEN_IRQ  */
-  YYSYMBOL_BX_TOKEN_SMI = 65,              /* BX_TOKEN_SMI  */
-  YYSYMBOL_BX_TOKEN_NMI = 66,              /* BX_TOKEN_NMI  */
-  YYSYMBOL_BX_TOKEN_TLB = 67,              /* BX_TOKEN_TLB  */
-  YYSYMBOL_BX_TOKEN_DISASM = 68,           /* BX_TOKEN_DISASM  */
-  YYSYMBOL_BX_TOKEN_INSTRUMENT = 69,       /* BX_TOKEN_INSTRUMENT  */
-  YYSYMBOL_BX_TOKEN_STRING = 70,           /* BX_TOKEN_STRING  */
-  YYSYMBOL_BX_TOKEN_STOP = 71,             /* BX_TOKEN_STOP  */
-  YYSYMBOL_BX_TOKEN_DOIT = 72,             /* BX_TOKEN_DOIT  */
-  YYSYMBOL_BX_TOKEN_CRC = 73,              /* BX_TOKEN_CRC  */
-  YYSYMBOL_BX_TOKEN_TRACE = 74,            /* BX_TOKEN_TRACE  */
-  YYSYMBOL_BX_TOKEN_TRACEREG = 75,         /* BX_TOKEN_TRACEREG  */
-  YYSYMBOL_BX_TOKEN_TRACEMEM = 76,         /* BX_TOKEN_TRACEMEM  */
-  YYSYMBOL_BX_TOKEN_SWITCH_MODE = 77,      /* BX_TOKEN_SWITCH_MODE  */
-  YYSYMBOL_BX_TOKEN_SIZE = 78,             /* BX_TOKEN_SIZE  */
-  YYSYMBOL_BX_TOKEN_PTIME = 79,            /* BX_TOKEN_PTIME  */
-  YYSYMBOL_BX_TOKEN_TIMEBP_ABSOLUTE = 80,  /* BX_TOKEN_TIMEBP_ABSOLUTE  */
-  YYSYMBOL_BX_TOKEN_TIMEBP = 81,           /* BX_TOKEN_TIMEBP  */
-  YYSYMBOL_BX_TOKEN_MODEBP = 82,           /* BX_TOKEN_MODEBP  */
-  YYSYMBOL_BX_TOKEN_VMEXITBP = 83,         /* BX_TOKEN_VMEXITBP  */
-  YYSYMBOL_BX_TOKEN_PRINT_STACK = 84,      /* BX_TOKEN_PRINT_STACK  */
-  YYSYMBOL_BX_TOKEN_BT = 85,               /* BX_TOKEN_BT  */
-  YYSYMBOL_BX_TOKEN_WATCH = 86,            /* BX_TOKEN_WATCH  */
-  YYSYMBOL_BX_TOKEN_UNWATCH = 87,          /* BX_TOKEN_UNWATCH  */
-  YYSYMBOL_BX_TOKEN_READ = 88,             /* BX_TOKEN_READ  */
-  YYSYMBOL_BX_TOKEN_WRITE = 89,            /* BX_TOKEN_WRITE  */
-  YYSYMBOL_BX_TOKEN_SHOW = 90,             /* BX_TOKEN_SHOW  */
-  YYSYMBOL_BX_TOKEN_LOAD_SYMBOLS = 91,     /* BX_TOKEN_LOAD_SYMBOLS  */
-  YYSYMBOL_BX_TOKEN_SYMBOLS = 92,          /* BX_TOKEN_SYMBOLS  */
-  YYSYMBOL_BX_TOKEN_LIST_SYMBOLS = 93,     /* BX_TOKEN_LIST_SYMBOLS  */
-  YYSYMBOL_BX_TOKEN_GLOBAL = 94,           /* BX_TOKEN_GLOBAL  */
-  YYSYMBOL_BX_TOKEN_WHERE = 95,            /* BX_TOKEN_WHERE  */
-  YYSYMBOL_BX_TOKEN_PRINT_STRING = 96,     /* BX_TOKEN_PRINT_STRING  */
-  YYSYMBOL_BX_TOKEN_NUMERIC = 97,          /* BX_TOKEN_NUMERIC  */
-  YYSYMBOL_BX_TOKEN_PAGE = 98,             /* BX_TOKEN_PAGE  */
-  YYSYMBOL_BX_TOKEN_HELP = 99,             /* BX_TOKEN_HELP  */
-  YYSYMBOL_BX_TOKEN_XML = 100,             /* BX_TOKEN_XML  */
-  YYSYMBOL_BX_TOKEN_CALC = 101,            /* BX_TOKEN_CALC  */
-  YYSYMBOL_BX_TOKEN_DEVICE = 102,          /* BX_TOKEN_DEVICE  */
-  YYSYMBOL_BX_TOKEN_GENERIC = 103,         /* BX_TOKEN_GENERIC  */
-  YYSYMBOL_BX_TOKEN_RSHIFT = 104,          /* BX_TOKEN_RSHIFT  */
-  YYSYMBOL_BX_TOKEN_LSHIFT = 105,          /* BX_TOKEN_LSHIFT  */
-  YYSYMBOL_BX_TOKEN_EQ = 106,              /* BX_TOKEN_EQ  */
-  YYSYMBOL_BX_TOKEN_NE = 107,              /* BX_TOKEN_NE  */
-  YYSYMBOL_BX_TOKEN_LE = 108,              /* BX_TOKEN_LE  */
-  YYSYMBOL_BX_TOKEN_GE = 109,              /* BX_TOKEN_GE  */
-  YYSYMBOL_BX_TOKEN_REG_IP = 110,          /* BX_TOKEN_REG_IP  */
-  YYSYMBOL_BX_TOKEN_REG_EIP = 111,         /* BX_TOKEN_REG_EIP  */
-  YYSYMBOL_BX_TOKEN_REG_RIP = 112,         /* BX_TOKEN_REG_RIP  */
-  YYSYMBOL_BX_TOKEN_REG_SSP = 113,         /* BX_TOKEN_REG_SSP  */
-  YYSYMBOL_114_ = 114,                     /* '+'  */
-  YYSYMBOL_115_ = 115,                     /* '-'  */
-  YYSYMBOL_116_ = 116,                     /* '|'  */
-  YYSYMBOL_117_ = 117,                     /* '^'  */
-  YYSYMBOL_118_ = 118,                     /* '<'  */
-  YYSYMBOL_119_ = 119,                     /* '>'  */
-  YYSYMBOL_120_ = 120,                     /* '*'  */
-  YYSYMBOL_121_ = 121,                     /* '/'  */
-  YYSYMBOL_122_ = 122,                     /* '&'  */
-  YYSYMBOL_NOT = 123,                      /* NOT  */
-  YYSYMBOL_NEG = 124,                      /* NEG  */
-  YYSYMBOL_INDIRECT = 125,                 /* INDIRECT  */
-  YYSYMBOL_126_n_ = 126,                   /* '\n'  */
-  YYSYMBOL_127_ = 127,                     /* '='  */
-  YYSYMBOL_128_ = 128,                     /* ':'  */
-  YYSYMBOL_129_ = 129,                     /* '!'  */
-  YYSYMBOL_130_ = 130,                     /* '('  */
-  YYSYMBOL_131_ = 131,                     /* ')'  */
-  YYSYMBOL_132_ = 132,                     /* '@'  */
-  YYSYMBOL_YYACCEPT = 133,                 /* $accept  */
-  YYSYMBOL_commands = 134,                 /* commands  */
-  YYSYMBOL_command = 135,                  /* command  */
-  YYSYMBOL_BX_TOKEN_TOGGLE_ON_OFF = 136,   /* BX_TOKEN_TOGGLE_ON_OFF  */
-  YYSYMBOL_BX_TOKEN_REGISTERS = 137,       /* BX_TOKEN_REGISTERS  */
-  YYSYMBOL_BX_TOKEN_SEGREG = 138,          /* BX_TOKEN_SEGREG  */
-  YYSYMBOL_timebp_command = 139,           /* timebp_command  */
-  YYSYMBOL_modebp_command = 140,           /* modebp_command  */
-  YYSYMBOL_vmexitbp_command = 141,         /* vmexitbp_command  */
-  YYSYMBOL_show_command = 142,             /* show_command  */
-  YYSYMBOL_page_command = 143,             /* page_command  */
-  YYSYMBOL_tlb_command = 144,              /* tlb_command  */
-  YYSYMBOL_ptime_command = 145,            /* ptime_command  */
-  YYSYMBOL_trace_command = 146,            /* trace_command  */
-  YYSYMBOL_trace_reg_command = 147,        /* trace_reg_command  */
-  YYSYMBOL_trace_mem_command = 148,        /* trace_mem_command  */
-  YYSYMBOL_print_stack_command = 149,      /* print_stack_command  */
-  YYSYMBOL_backtrace_command = 150,        /* backtrace_command  */
-  YYSYMBOL_watch_point_command = 151,      /* watch_point_command  */
-  YYSYMBOL_symbol_command = 152,           /* symbol_command  */
-  YYSYMBOL_where_command = 153,            /* where_command  */
-  YYSYMBOL_print_string_command = 154,     /* print_string_command  */
-  YYSYMBOL_continue_command = 155,         /* continue_command  */
-  YYSYMBOL_stepN_command = 156,            /* stepN_command  */
-  YYSYMBOL_step_over_command = 157,        /* step_over_command  */
-  YYSYMBOL_set_command = 158,              /* set_command  */
-  YYSYMBOL_breakpoint_command = 159,       /* breakpoint_command  */
-  YYSYMBOL_blist_command = 160,            /* blist_command  */
-  YYSYMBOL_slist_command = 161,            /* slist_command  */
-  YYSYMBOL_info_command = 162,             /* info_command  */
-  YYSYMBOL_optional_numeric = 163,         /* optional_numeric  */
-  YYSYMBOL_regs_command = 164,             /* regs_command  */
-  YYSYMBOL_fpu_regs_command = 165,         /* fpu_regs_command  */
-  YYSYMBOL_mmx_regs_command = 166,         /* mmx_regs_command  */
-  YYSYMBOL_xmm_regs_command = 167,         /* xmm_regs_command  */
-  YYSYMBOL_ymm_regs_command = 168,         /* ymm_regs_command  */
-  YYSYMBOL_zmm_regs_command = 169,         /* zmm_regs_command  */
-  YYSYMBOL_segment_regs_command = 170,     /* segment_regs_command  */
-  YYSYMBOL_control_regs_command = 171,     /* control_regs_command  */
-  YYSYMBOL_debug_regs_command = 172,       /* debug_regs_command  */
-  YYSYMBOL_delete_command = 173,           /* delete_command  */
-  YYSYMBOL_bpe_command = 174,              /* bpe_command  */
-  YYSYMBOL_bpd_command = 175,              /* bpd_command  */
-  YYSYMBOL_quit_command = 176,             /* quit_command  */
-  YYSYMBOL_examine_command = 177,          /* examine_command  */
-  YYSYMBOL_restore_command = 178,          /* restore_command  */
-  YYSYMBOL_writemem_command = 179,         /* writemem_command  */
-  YYSYMBOL_setpmem_command = 180,          /* setpmem_command  */
-  YYSYMBOL_query_command = 181,            /* query_command  */
-  YYSYMBOL_take_command = 182,             /* take_command  */
-  YYSYMBOL_disassemble_command = 183,      /* disassemble_command  */
-  YYSYMBOL_instrument_command = 184,       /* instrument_command  */
-  YYSYMBOL_doit_command = 185,             /* doit_command  */
-  YYSYMBOL_crc_command = 186,              /* crc_command  */
-  YYSYMBOL_help_command = 187,             /* help_command  */
-  YYSYMBOL_calc_command = 188,             /* calc_command  */
-  YYSYMBOL_if_command = 189,               /* if_command  */
-  YYSYMBOL_vexpression = 190,              /* vexpression  */
-  YYSYMBOL_expression = 191                /* expression  */
+  YYSYMBOL_BX_TOKEN_FORK = 57,             /* BX_TOKEN_FORK  */
+  YYSYMBOL_BX_TOKEN_WRITEMEM = 58,         /* BX_TOKEN_WRITEMEM  */
+  YYSYMBOL_BX_TOKEN_SETPMEM = 59,          /* BX_TOKEN_SETPMEM  */
+  YYSYMBOL_BX_TOKEN_SYMBOLNAME = 60,       /* BX_TOKEN_SYMBOLNAME  */
+  YYSYMBOL_BX_TOKEN_QUERY = 61,            /* BX_TOKEN_QUERY  */
+  YYSYMBOL_BX_TOKEN_PENDING = 62,          /* BX_TOKEN_PENDING  */
+  YYSYMBOL_BX_TOKEN_TAKE = 63,             /* BX_TOKEN_TAKE  */
+  YYSYMBOL_BX_TOKEN_DMA = 64,              /* BX_TOKEN_DMA  */
+  YYSYMBOL_BX_TOKEN_IRQ = 65,              /* BX_TOKEN_IRQ  */
+  YYSYMBOL_BX_TOKEN_SMI = 66,              /* BX_TOKEN_SMI  */
+  YYSYMBOL_BX_TOKEN_NMI = 67,              /* BX_TOKEN_NMI  */
+  YYSYMBOL_BX_TOKEN_TLB = 68,              /* BX_TOKEN_TLB  */
+  YYSYMBOL_BX_TOKEN_DISASM = 69,           /* BX_TOKEN_DISASM  */
+  YYSYMBOL_BX_TOKEN_INSTRUMENT = 70,       /* BX_TOKEN_INSTRUMENT  */
+  YYSYMBOL_BX_TOKEN_STRING = 71,           /* BX_TOKEN_STRING  */
+  YYSYMBOL_BX_TOKEN_STOP = 72,             /* BX_TOKEN_STOP  */
+  YYSYMBOL_BX_TOKEN_DOIT = 73,             /* BX_TOKEN_DOIT  */
+  YYSYMBOL_BX_TOKEN_CRC = 74,              /* BX_TOKEN_CRC  */
+  YYSYMBOL_BX_TOKEN_TRACE = 75,            /* BX_TOKEN_TRACE  */
+  YYSYMBOL_BX_TOKEN_TRACEREG = 76,         /* BX_TOKEN_TRACEREG  */
+  YYSYMBOL_BX_TOKEN_TRACEMEM = 77,         /* BX_TOKEN_TRACEMEM  */
+  YYSYMBOL_BX_TOKEN_SWITCH_MODE = 78,      /* BX_TOKEN_SWITCH_MODE  */
+  YYSYMBOL_BX_TOKEN_SIZE = 79,             /* BX_TOKEN_SIZE  */
+  YYSYMBOL_BX_TOKEN_PTIME = 80,            /* BX_TOKEN_PTIME  */
+  YYSYMBOL_BX_TOKEN_TIMEBP_ABSOLUTE = 81,  /* BX_TOKEN_TIMEBP_ABSOLUTE  */
+  YYSYMBOL_BX_TOKEN_TIMEBP = 82,           /* BX_TOKEN_TIMEBP  */
+  YYSYMBOL_BX_TOKEN_MODEBP = 83,           /* BX_TOKEN_MODEBP  */
+  YYSYMBOL_BX_TOKEN_VMEXITBP = 84,         /* BX_TOKEN_VMEXITBP  */
+  YYSYMBOL_BX_TOKEN_PRINT_STACK = 85,      /* BX_TOKEN_PRINT_STACK  */
+  YYSYMBOL_BX_TOKEN_BT = 86,               /* BX_TOKEN_BT  */
+  YYSYMBOL_BX_TOKEN_WATCH = 87,            /* BX_TOKEN_WATCH  */
+  YYSYMBOL_BX_TOKEN_UNWATCH = 88,          /* BX_TOKEN_UNWATCH  */
+  YYSYMBOL_BX_TOKEN_READ = 89,             /* BX_TOKEN_READ  */
+  YYSYMBOL_BX_TOKEN_WRITE = 90,            /* BX_TOKEN_WRITE  */
+  YYSYMBOL_BX_TOKEN_SHOW = 91,             /* BX_TOKEN_SHOW  */
+  YYSYMBOL_BX_TOKEN_LOAD_SYMBOLS = 92,     /* BX_TOKEN_LOAD_SYMBOLS  */
+  YYSYMBOL_BX_TOKEN_SYMBOLS = 93,          /* BX_TOKEN_SYMBOLS  */
+  YYSYMBOL_BX_TOKEN_LIST_SYMBOLS = 94,     /* BX_TOKEN_LIST_SYMBOLS  */
+  YYSYMBOL_BX_TOKEN_GLOBAL = 95,           /* BX_TOKEN_GLOBAL  */
+  YYSYMBOL_BX_TOKEN_WHERE = 96,            /* BX_TOKEN_WHERE  */
+  YYSYMBOL_BX_TOKEN_PRINT_STRING = 97,     /* BX_TOKEN_PRINT_STRING  */
+  YYSYMBOL_BX_TOKEN_NUMERIC = 98,          /* BX_TOKEN_NUMERIC  */
+  YYSYMBOL_BX_TOKEN_PAGE = 99,             /* BX_TOKEN_PAGE  */
+  YYSYMBOL_BX_TOKEN_HELP = 100,            /* BX_TOKEN_HELP  */
+  YYSYMBOL_BX_TOKEN_XML = 101,             /* BX_TOKEN_XML  */
+  YYSYMBOL_BX_TOKEN_CALC = 102,            /* BX_TOKEN_CALC  */
+  YYSYMBOL_BX_TOKEN_DEVICE = 103,          /* BX_TOKEN_DEVICE  */
+  YYSYMBOL_BX_TOKEN_GENERIC = 104,         /* BX_TOKEN_GENERIC  */
+  YYSYMBOL_BX_TOKEN_RSHIFT = 105,          /* BX_TOKEN_RSHIFT  */
+  YYSYMBOL_BX_TOKEN_LSHIFT = 106,          /* BX_TOKEN_LSHIFT  */
+  YYSYMBOL_BX_TOKEN_EQ = 107,              /* BX_TOKEN_EQ  */
+  YYSYMBOL_BX_TOKEN_NE = 108,              /* BX_TOKEN_NE  */
+  YYSYMBOL_BX_TOKEN_LE = 109,              /* BX_TOKEN_LE  */
+  YYSYMBOL_BX_TOKEN_GE = 110,              /* BX_TOKEN_GE  */
+  YYSYMBOL_BX_TOKEN_REG_IP = 111,          /* BX_TOKEN_REG_IP  */
+  YYSYMBOL_BX_TOKEN_REG_EIP = 112,         /* BX_TOKEN_REG_EIP  */
+  YYSYMBOL_BX_TOKEN_REG_RIP = 113,         /* BX_TOKEN_REG_RIP  */
+  YYSYMBOL_BX_TOKEN_REG_SSP = 114,         /* BX_TOKEN_REG_SSP  */
+  YYSYMBOL_115_ = 115,                     /* '+'  */
+  YYSYMBOL_116_ = 116,                     /* '-'  */
+  YYSYMBOL_117_ = 117,                     /* '|'  */
+  YYSYMBOL_118_ = 118,                     /* '^'  */
+  YYSYMBOL_119_ = 119,                     /* '<'  */
+  YYSYMBOL_120_ = 120,                     /* '>'  */
+  YYSYMBOL_121_ = 121,                     /* '*'  */
+  YYSYMBOL_122_ = 122,                     /* '/'  */
+  YYSYMBOL_123_ = 123,                     /* '&'  */
+  YYSYMBOL_NOT = 124,                      /* NOT  */
+  YYSYMBOL_NEG = 125,                      /* NEG  */
+  YYSYMBOL_INDIRECT = 126,                 /* INDIRECT  */
+  YYSYMBOL_127_n_ = 127,                   /* '\n'  */
+  YYSYMBOL_128_ = 128,                     /* '='  */
+  YYSYMBOL_129_ = 129,                     /* ':'  */
+  YYSYMBOL_130_ = 130,                     /* '!'  */
+  YYSYMBOL_131_ = 131,                     /* '('  */
+  YYSYMBOL_132_ = 132,                     /* ')'  */
+  YYSYMBOL_133_ = 133,                     /* '@'  */
+  YYSYMBOL_YYACCEPT = 134,                 /* $accept  */
+  YYSYMBOL_commands = 135,                 /* commands  */
+  YYSYMBOL_command = 136,                  /* command  */
+  YYSYMBOL_BX_TOKEN_TOGGLE_ON_OFF = 137,   /* BX_TOKEN_TOGGLE_ON_OFF  */
+  YYSYMBOL_BX_TOKEN_REGISTERS = 138,       /* BX_TOKEN_REGISTERS  */
+  YYSYMBOL_BX_TOKEN_SEGREG = 139,          /* BX_TOKEN_SEGREG  */
+  YYSYMBOL_timebp_command = 140,           /* timebp_command  */
+  YYSYMBOL_modebp_command = 141,           /* modebp_command  */
+  YYSYMBOL_vmexitbp_command = 142,         /* vmexitbp_command  */
+  YYSYMBOL_show_command = 143,             /* show_command  */
+  YYSYMBOL_page_command = 144,             /* page_command  */
+  YYSYMBOL_tlb_command = 145,              /* tlb_command  */
+  YYSYMBOL_ptime_command = 146,            /* ptime_command  */
+  YYSYMBOL_trace_command = 147,            /* trace_command  */
+  YYSYMBOL_trace_reg_command = 148,        /* trace_reg_command  */
+  YYSYMBOL_trace_mem_command = 149,        /* trace_mem_command  */
+  YYSYMBOL_print_stack_command = 150,      /* print_stack_command  */
+  YYSYMBOL_backtrace_command = 151,        /* backtrace_command  */
+  YYSYMBOL_watch_point_command = 152,      /* watch_point_command  */
+  YYSYMBOL_symbol_command = 153,           /* symbol_command  */
+  YYSYMBOL_where_command = 154,            /* where_command  */
+  YYSYMBOL_print_string_command = 155,     /* print_string_command  */
+  YYSYMBOL_continue_command = 156,         /* continue_command  */
+  YYSYMBOL_stepN_command = 157,            /* stepN_command  */
+  YYSYMBOL_step_over_command = 158,        /* step_over_command  */
+  YYSYMBOL_set_command = 159,              /* set_command  */
+  YYSYMBOL_breakpoint_command = 160,       /* breakpoint_command  */
+  YYSYMBOL_blist_command = 161,            /* blist_command  */
+  YYSYMBOL_slist_command = 162,            /* slist_command  */
+  YYSYMBOL_info_command = 163,             /* info_command  */
+  YYSYMBOL_optional_numeric = 164,         /* optional_numeric  */
+  YYSYMBOL_regs_command = 165,             /* regs_command  */
+  YYSYMBOL_fpu_regs_command = 166,         /* fpu_regs_command  */
+  YYSYMBOL_mmx_regs_command = 167,         /* mmx_regs_command  */
+  YYSYMBOL_xmm_regs_command = 168,         /* xmm_regs_command  */
+  YYSYMBOL_ymm_regs_command = 169,         /* ymm_regs_command  */
+  YYSYMBOL_zmm_regs_command = 170,         /* zmm_regs_command  */
+  YYSYMBOL_segment_regs_command = 171,     /* segment_regs_command  */
+  YYSYMBOL_control_regs_command = 172,     /* control_regs_command  */
+  YYSYMBOL_debug_regs_command = 173,       /* debug_regs_command  */
+  YYSYMBOL_delete_command = 174,           /* delete_command  */
+  YYSYMBOL_bpe_command = 175,              /* bpe_command  */
+  YYSYMBOL_bpd_command = 176,              /* bpd_command  */
+  YYSYMBOL_quit_command = 177,             /* quit_command  */
+  YYSYMBOL_examine_command = 178,          /* examine_command  */
+  YYSYMBOL_restore_command = 179,          /* restore_command  */
+  YYSYMBOL_fork_command = 180,             /* fork_command  */
+  YYSYMBOL_writemem_command = 181,         /* writemem_command  */
+  YYSYMBOL_setpmem_command = 182,          /* setpmem_command  */
+  YYSYMBOL_query_command = 183,            /* query_command  */
+  YYSYMBOL_take_command = 184,             /* take_command  */
+  YYSYMBOL_disassemble_command = 185,      /* disassemble_command  */
+  YYSYMBOL_instrument_command = 186,       /* instrument_command  */
+  YYSYMBOL_doit_command = 187,             /* doit_command  */
+  YYSYMBOL_crc_command = 188,              /* crc_command  */
+  YYSYMBOL_help_command = 189,             /* help_command  */
+  YYSYMBOL_calc_command = 190,             /* calc_command  */
+  YYSYMBOL_if_command = 191,               /* if_command  */
+  YYSYMBOL_vexpression = 192,              /* vexpression  */
+  YYSYMBOL_expression = 193                /* expression  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -911,21 +915,21 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  310
+#define YYFINAL  314
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   2460
+#define YYLAST   2396
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  133
+#define YYNTOKENS  134
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  59
+#define YYNNTS  60
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  302
+#define YYNRULES  305
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  589
+#define YYNSTATES  594
 
 /* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK   371
+#define YYMAXUTOK   372
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -940,18 +944,18 @@ union yyalloc
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     126,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     127,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   129,     2,     2,     2,     2,   122,     2,
-     130,   131,   120,   114,     2,   115,     2,   121,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   128,     2,
-     118,   127,   119,     2,   132,     2,     2,     2,     2,     2,
+       2,     2,     2,   130,     2,     2,     2,     2,   123,     2,
+     131,   132,   121,   115,     2,   116,     2,   122,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   129,     2,
+     119,   128,   120,     2,   133,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   117,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   118,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,   116,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   117,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -975,45 +979,45 @@ static const yytype_uint8 yytranslate[] =
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
       85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
       95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   123,
-     124,   125
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     124,   125,   126
 };
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   149,   149,   150,   154,   155,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   212,   213,   218,
-     219,   224,   225,   226,   227,   228,   229,   234,   239,   247,
-     255,   263,   268,   273,   278,   283,   288,   296,   304,   312,
-     320,   328,   336,   344,   349,   357,   362,   370,   375,   380,
-     385,   390,   395,   400,   405,   410,   415,   420,   428,   433,
-     438,   443,   451,   459,   467,   472,   480,   485,   490,   495,
-     503,   511,   516,   521,   525,   529,   533,   537,   541,   545,
-     549,   556,   561,   566,   571,   576,   581,   586,   591,   596,
-     601,   606,   611,   616,   624,   632,   637,   645,   650,   655,
-     660,   665,   670,   675,   680,   685,   690,   695,   700,   705,
-     710,   715,   720,   725,   733,   734,   737,   745,   753,   761,
-     769,   777,   785,   793,   801,   809,   817,   824,   832,   840,
-     845,   850,   855,   863,   871,   879,   887,   895,   900,   905,
-     910,   915,   923,   928,   933,   938,   943,   948,   953,   958,
-     966,   972,   977,   985,   993,  1001,  1006,  1012,  1019,  1024,
-    1030,  1036,  1042,  1047,  1052,  1057,  1062,  1067,  1072,  1077,
-    1083,  1089,  1095,  1103,  1108,  1113,  1118,  1123,  1128,  1133,
+       0,   150,   150,   151,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,   214,   215,
+     220,   221,   226,   227,   228,   229,   230,   231,   236,   241,
+     249,   257,   265,   270,   275,   280,   285,   290,   298,   306,
+     314,   322,   330,   338,   346,   351,   359,   364,   372,   377,
+     382,   387,   392,   397,   402,   407,   412,   417,   422,   430,
+     435,   440,   445,   453,   461,   469,   474,   482,   487,   492,
+     497,   505,   513,   518,   523,   527,   531,   535,   539,   543,
+     547,   551,   558,   563,   568,   573,   578,   583,   588,   593,
+     598,   603,   608,   613,   618,   626,   634,   639,   647,   652,
+     657,   662,   667,   672,   677,   682,   687,   692,   697,   702,
+     707,   712,   717,   722,   727,   735,   736,   739,   747,   755,
+     763,   771,   779,   787,   795,   803,   811,   819,   826,   834,
+     842,   847,   852,   857,   865,   873,   881,   889,   897,   905,
+     910,   915,   920,   925,   933,   938,   943,   948,   953,   958,
+     963,   968,   976,   982,   987,   995,  1003,  1011,  1016,  1022,
+    1029,  1034,  1040,  1046,  1052,  1057,  1062,  1067,  1072,  1077,
+    1082,  1087,  1093,  1099,  1105,  1113,  1118,  1123,  1128,  1133,
     1138,  1143,  1148,  1153,  1158,  1163,  1168,  1173,  1178,  1183,
-    1188,  1198,  1209,  1215,  1228,  1233,  1244,  1249,  1265,  1281,
-    1291,  1296,  1304,  1313,  1323,  1324,  1325,  1326,  1327,  1328,
-    1329,  1330,  1331,  1332,  1333,  1334,  1335,  1336,  1337,  1338,
-    1339,  1340,  1341,  1342,  1343,  1344,  1345,  1346,  1347,  1353,
-    1354,  1355,  1356,  1357,  1358,  1359,  1360,  1361,  1362,  1363,
-    1364,  1365,  1366,  1367,  1368,  1369,  1370,  1371,  1372,  1373,
-    1374,  1375,  1376,  1377,  1378,  1379,  1380,  1381,  1382,  1383,
-    1384,  1385,  1386
+    1188,  1193,  1198,  1203,  1213,  1224,  1230,  1243,  1248,  1259,
+    1264,  1280,  1296,  1306,  1311,  1319,  1328,  1338,  1339,  1340,
+    1341,  1342,  1343,  1344,  1345,  1346,  1347,  1348,  1349,  1350,
+    1351,  1352,  1353,  1354,  1355,  1356,  1357,  1358,  1359,  1360,
+    1361,  1362,  1368,  1369,  1370,  1371,  1372,  1373,  1374,  1375,
+    1376,  1377,  1378,  1379,  1380,  1381,  1382,  1383,  1384,  1385,
+    1386,  1387,  1388,  1389,  1390,  1391,  1392,  1393,  1394,  1395,
+    1396,  1397,  1398,  1399,  1400,  1401
 };
 #endif
 
@@ -1045,39 +1049,40 @@ static const char *const yytname[] =
   "BX_TOKEN_LDT", "BX_TOKEN_TSS", "BX_TOKEN_TAB", "BX_TOKEN_ALL",
   "BX_TOKEN_LINUX", "BX_TOKEN_DEBUG_REGS", "BX_TOKEN_CONTROL_REGS",
   "BX_TOKEN_SEGMENT_REGS", "BX_TOKEN_EXAMINE", "BX_TOKEN_XFORMAT",
-  "BX_TOKEN_DISFORMAT", "BX_TOKEN_RESTORE", "BX_TOKEN_WRITEMEM",
-  "BX_TOKEN_SETPMEM", "BX_TOKEN_SYMBOLNAME", "BX_TOKEN_QUERY",
-  "BX_TOKEN_PENDING", "BX_TOKEN_TAKE", "BX_TOKEN_DMA", "BX_TOKEN_IRQ",
-  "BX_TOKEN_SMI", "BX_TOKEN_NMI", "BX_TOKEN_TLB", "BX_TOKEN_DISASM",
-  "BX_TOKEN_INSTRUMENT", "BX_TOKEN_STRING", "BX_TOKEN_STOP",
-  "BX_TOKEN_DOIT", "BX_TOKEN_CRC", "BX_TOKEN_TRACE", "BX_TOKEN_TRACEREG",
-  "BX_TOKEN_TRACEMEM", "BX_TOKEN_SWITCH_MODE", "BX_TOKEN_SIZE",
-  "BX_TOKEN_PTIME", "BX_TOKEN_TIMEBP_ABSOLUTE", "BX_TOKEN_TIMEBP",
-  "BX_TOKEN_MODEBP", "BX_TOKEN_VMEXITBP", "BX_TOKEN_PRINT_STACK",
-  "BX_TOKEN_BT", "BX_TOKEN_WATCH", "BX_TOKEN_UNWATCH", "BX_TOKEN_READ",
-  "BX_TOKEN_WRITE", "BX_TOKEN_SHOW", "BX_TOKEN_LOAD_SYMBOLS",
-  "BX_TOKEN_SYMBOLS", "BX_TOKEN_LIST_SYMBOLS", "BX_TOKEN_GLOBAL",
-  "BX_TOKEN_WHERE", "BX_TOKEN_PRINT_STRING", "BX_TOKEN_NUMERIC",
-  "BX_TOKEN_PAGE", "BX_TOKEN_HELP", "BX_TOKEN_XML", "BX_TOKEN_CALC",
-  "BX_TOKEN_DEVICE", "BX_TOKEN_GENERIC", "BX_TOKEN_RSHIFT",
-  "BX_TOKEN_LSHIFT", "BX_TOKEN_EQ", "BX_TOKEN_NE", "BX_TOKEN_LE",
-  "BX_TOKEN_GE", "BX_TOKEN_REG_IP", "BX_TOKEN_REG_EIP", "BX_TOKEN_REG_RIP",
-  "BX_TOKEN_REG_SSP", "'+'", "'-'", "'|'", "'^'", "'<'", "'>'", "'*'",
-  "'/'", "'&'", "NOT", "NEG", "INDIRECT", "'\\n'", "'='", "':'", "'!'",
-  "'('", "')'", "'@'", "$accept", "commands", "command",
-  "BX_TOKEN_TOGGLE_ON_OFF", "BX_TOKEN_REGISTERS", "BX_TOKEN_SEGREG",
-  "timebp_command", "modebp_command", "vmexitbp_command", "show_command",
-  "page_command", "tlb_command", "ptime_command", "trace_command",
-  "trace_reg_command", "trace_mem_command", "print_stack_command",
-  "backtrace_command", "watch_point_command", "symbol_command",
-  "where_command", "print_string_command", "continue_command",
-  "stepN_command", "step_over_command", "set_command",
-  "breakpoint_command", "blist_command", "slist_command", "info_command",
-  "optional_numeric", "regs_command", "fpu_regs_command",
-  "mmx_regs_command", "xmm_regs_command", "ymm_regs_command",
-  "zmm_regs_command", "segment_regs_command", "control_regs_command",
-  "debug_regs_command", "delete_command", "bpe_command", "bpd_command",
-  "quit_command", "examine_command", "restore_command", "writemem_command",
+  "BX_TOKEN_DISFORMAT", "BX_TOKEN_RESTORE", "BX_TOKEN_FORK",
+  "BX_TOKEN_WRITEMEM", "BX_TOKEN_SETPMEM", "BX_TOKEN_SYMBOLNAME",
+  "BX_TOKEN_QUERY", "BX_TOKEN_PENDING", "BX_TOKEN_TAKE", "BX_TOKEN_DMA",
+  "BX_TOKEN_IRQ", "BX_TOKEN_SMI", "BX_TOKEN_NMI", "BX_TOKEN_TLB",
+  "BX_TOKEN_DISASM", "BX_TOKEN_INSTRUMENT", "BX_TOKEN_STRING",
+  "BX_TOKEN_STOP", "BX_TOKEN_DOIT", "BX_TOKEN_CRC", "BX_TOKEN_TRACE",
+  "BX_TOKEN_TRACEREG", "BX_TOKEN_TRACEMEM", "BX_TOKEN_SWITCH_MODE",
+  "BX_TOKEN_SIZE", "BX_TOKEN_PTIME", "BX_TOKEN_TIMEBP_ABSOLUTE",
+  "BX_TOKEN_TIMEBP", "BX_TOKEN_MODEBP", "BX_TOKEN_VMEXITBP",
+  "BX_TOKEN_PRINT_STACK", "BX_TOKEN_BT", "BX_TOKEN_WATCH",
+  "BX_TOKEN_UNWATCH", "BX_TOKEN_READ", "BX_TOKEN_WRITE", "BX_TOKEN_SHOW",
+  "BX_TOKEN_LOAD_SYMBOLS", "BX_TOKEN_SYMBOLS", "BX_TOKEN_LIST_SYMBOLS",
+  "BX_TOKEN_GLOBAL", "BX_TOKEN_WHERE", "BX_TOKEN_PRINT_STRING",
+  "BX_TOKEN_NUMERIC", "BX_TOKEN_PAGE", "BX_TOKEN_HELP", "BX_TOKEN_XML",
+  "BX_TOKEN_CALC", "BX_TOKEN_DEVICE", "BX_TOKEN_GENERIC",
+  "BX_TOKEN_RSHIFT", "BX_TOKEN_LSHIFT", "BX_TOKEN_EQ", "BX_TOKEN_NE",
+  "BX_TOKEN_LE", "BX_TOKEN_GE", "BX_TOKEN_REG_IP", "BX_TOKEN_REG_EIP",
+  "BX_TOKEN_REG_RIP", "BX_TOKEN_REG_SSP", "'+'", "'-'", "'|'", "'^'",
+  "'<'", "'>'", "'*'", "'/'", "'&'", "NOT", "NEG", "INDIRECT", "'\\n'",
+  "'='", "':'", "'!'", "'('", "')'", "'@'", "$accept", "commands",
+  "command", "BX_TOKEN_TOGGLE_ON_OFF", "BX_TOKEN_REGISTERS",
+  "BX_TOKEN_SEGREG", "timebp_command", "modebp_command",
+  "vmexitbp_command", "show_command", "page_command", "tlb_command",
+  "ptime_command", "trace_command", "trace_reg_command",
+  "trace_mem_command", "print_stack_command", "backtrace_command",
+  "watch_point_command", "symbol_command", "where_command",
+  "print_string_command", "continue_command", "stepN_command",
+  "step_over_command", "set_command", "breakpoint_command",
+  "blist_command", "slist_command", "info_command", "optional_numeric",
+  "regs_command", "fpu_regs_command", "mmx_regs_command",
+  "xmm_regs_command", "ymm_regs_command", "zmm_regs_command",
+  "segment_regs_command", "control_regs_command", "debug_regs_command",
+  "delete_command", "bpe_command", "bpd_command", "quit_command",
+  "examine_command", "restore_command", "fork_command", "writemem_command",
   "setpmem_command", "query_command", "take_command",
   "disassemble_command", "instrument_command", "doit_command",
   "crc_command", "help_command", "calc_command", "if_command",
@@ -1091,12 +1096,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-178)
+#define YYPACT_NINF (-180)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-301)
+#define YYTABLE_NINF (-304)
 
 #define yytable_value_is_error(Yyn) \
   0
@@ -1105,65 +1110,66 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     557,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,    -9,  1442,   -36,  -124,   700,  -113,    19,
-     296,  1170,   -38,   -35,   -27,   878,   -60,  -178,  -178,   -55,
-     -53,   -44,   -41,   -40,   -39,   -34,   -33,  1036,    26,    29,
-    1442,    58,   105,  1442,  1075,   -52,  -178,  1442,  1442,    40,
-      40,    40,    -6,  1442,  1442,     1,     2,   -63,   -62,    50,
-    1206,   -12,    18,   -32,     7,  1442,  -178,  1442,  1555,  1442,
-    -178,  -178,  -178,  -178,  1442,  1442,  -178,  1442,  1442,  1442,
-     427,  -178,    10,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  2332,  1442,  -178,   947,    43,   -45,
-    -178,  -178,    -1,    14,    15,    20,    23,    37,    40,    45,
-      46,    48,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,    97,  -178,    97,    97,  -178,
-     814,    -8,  -178,   253,  1442,  -178,   630,    11,    55,    56,
-      72,    74,    76,  1442,  1442,  1442,  1442,    77,    78,    85,
-     -31,   -54,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  1240,  -178,  1582,   144,  1442,  1007,    89,   -42,    90,
-      95,    98,  1607,  1370,    99,    96,  -178,   148,   102,   107,
-     108,  1632,  1007,  -178,  -178,   113,   116,   117,  -178,  1657,
-    1682,  -178,  -178,   118,  -178,   121,  -178,   122,  1442,   123,
-    1442,  1442,  -178,  -178,  1707,   125,   145,   -50,   147,  -178,
-    1394,   205,   153,  -178,  -178,  1732,  1757,   155,   156,   157,
-     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
-     168,   169,   170,   171,   172,   185,   186,   203,   204,   206,
-     207,   214,   218,   229,   230,   237,   238,   239,   250,   251,
-     252,   254,   256,   257,   260,   265,   266,   268,   269,   270,
-     271,   272,  -178,   277,  1782,   276,   276,   276,  1554,   276,
-    -178,  -178,  -178,  1442,  1442,  1442,  1442,  1442,  1442,  1442,
-    1442,  1442,  1442,  1442,  1442,  1442,  1442,  1442,  1442,  1807,
-    -178,   279,   284,  -178,  1442,  1442,  1442,  1442,  1442,  1442,
-     286,  1442,  1442,  1442,  -178,  -178,   115,    97,    97,    97,
-      97,    97,    97,    97,    97,    97,    97,   261,  -178,   343,
-    -178,   -13,   344,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    1442,  2332,  1442,  1442,  1442,  -178,  -178,  -178,   289,  -178,
-     -29,   -28,  -178,  -178,  1832,  -178,   292,  1007,  1442,  1442,
-    1007,  -178,   295,  -178,  -178,  -178,  -178,  -178,  -178,   687,
-    -178,    49,  -178,  1857,  -178,  -178,  -178,  -178,  1882,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,   717,  -178,   847,
-     877,  -178,  -178,  -178,   297,  -178,  -178,  -178,  1907,  1418,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,    16,    16,   276,   276,   276,   276,  1151,  1151,  1151,
-    1151,  1151,  1151,    16,    16,    16,  2332,  -178,  -178,  -178,
-    1932,  1957,  1982,  2007,  2032,  2057,  -178,  2082,  2107,  2132,
-    -178,  -178,  -178,   280,   280,   280,   280,  -178,  -178,  -178,
-     656,   298,   316,   373,  -178,   318,   324,   336,   342,   345,
-    -178,   346,  -178,   347,  -178,  -178,  -178,  2157,  1236,    71,
-    2182,  -178,  -178,  2207,   348,  -178,  -178,  -178,  2232,  -178,
-    2257,  -178,  2282,  -178,  -178,  -178,  2307,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,   399,  -178,  -178,  -178,
-     349,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,   350,  -178,  -178
+     562,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,    15,  1328,   -38,   -77,   115,   -75,  1352,
+     299,   987,   -36,   -35,   -25,  1479,   -68,  -180,  -180,   -44,
+     -43,   -42,   -27,   -15,     7,     9,    12,   935,    17,    14,
+      74,  1328,    86,   105,  1328,    19,   -53,  -180,  1328,  1328,
+      30,    30,    30,    24,  1328,  1328,    46,    47,   -62,   -58,
+     111,  1066,    39,   -18,   -60,    50,  1328,  -180,  1328,  1518,
+    1328,  -180,  -180,  -180,  -180,  1328,  1328,  -180,  1328,  1328,
+    1328,   431,  -180,    51,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  1183,  1328,  -180,  1517,
+      81,   -56,  -180,  -180,    52,    53,    54,    68,    87,    91,
+      30,    94,    95,    96,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  1404,  -180,  1404,
+    1404,  -180,  1314,    20,  -180,   -14,  1328,  -180,   256,    75,
+     102,   104,   109,   110,   113,  1328,  1328,  1328,  1328,   118,
+     119,   120,   -55,   -69,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  1118,  -180,  1542,   143,  -180,  1328,   907,
+     122,   -41,   123,   124,   125,  1567,  1142,   127,   114,  -180,
+     150,   147,   149,   151,  1592,   907,  -180,  -180,   155,   157,
+     158,  -180,  1617,  1642,  -180,  -180,   159,  -180,   160,  -180,
+     161,  1328,   162,  1328,  1328,  -180,  -180,  1667,   163,   164,
+     -63,   165,  -180,  1197,   168,   166,  -180,  -180,  1692,  1717,
+     167,   169,   170,   171,   172,   173,   174,   187,   188,   189,
+     206,   207,   208,   209,   210,   217,   221,   232,   233,   240,
+     241,   242,   253,   254,   255,   257,   259,   260,   261,   268,
+     269,   271,   277,   281,   282,   287,   290,   291,   292,   295,
+     298,   300,   301,   319,   320,   321,  -180,   327,  1742,   101,
+     101,   101,  1052,   101,  -180,  -180,  -180,  1328,  1328,  1328,
+    1328,  1328,  1328,  1328,  1328,  1328,  1328,  1328,  1328,  1328,
+    1328,  1328,  1328,  1767,  -180,   339,   345,  -180,  1328,  1328,
+    1328,  1328,  1328,  1328,   346,  1328,  1328,  1328,  -180,  -180,
+     284,  1404,  1404,  1404,  1404,  1404,  1404,  1404,  1404,  1404,
+    1404,   224,  -180,   403,  -180,   -13,   404,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  1328,  1183,  1328,  1328,  1328,  -180,
+    -180,  -180,   349,  -180,   -28,    11,  -180,  -180,  1792,  -180,
+     350,   907,  1328,  1328,   907,  -180,   351,  -180,  -180,  -180,
+    -180,  -180,  -180,   693,  -180,   381,  -180,  1817,  -180,  -180,
+    -180,  -180,  1842,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,   723,  -180,   776,   854,  -180,  -180,  -180,   353,  -180,
+    -180,  -180,  1867,  1273,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,    97,    97,   101,   101,
+     101,   101,   636,   636,   636,   636,   636,   636,    97,    97,
+      97,  1183,  -180,  -180,  -180,  1892,  1917,  1942,  1967,  1992,
+    2017,  -180,  2042,  2067,  2092,  -180,  -180,  -180,   112,   112,
+     112,   112,  -180,  -180,  -180,   633,   358,   359,   420,  -180,
+     366,   368,   369,   370,   371,  -180,   376,  -180,   382,  -180,
+    -180,  -180,  2117,   983,   103,  2142,  -180,  -180,  2167,   383,
+    -180,  -180,  -180,  2192,  -180,  2217,  -180,  2242,  -180,  -180,
+    -180,  2267,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,   449,  -180,  -180,  -180,   394,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,   397,  -180,  -180
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1171,87 +1177,88 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-      55,   272,   271,   273,   274,   275,    61,    62,    63,    64,
-      65,    66,   276,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    59,    60,     0,
+      56,   275,   274,   276,   277,   278,    62,    63,    64,    65,
+      66,    67,   279,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    60,    61,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   273,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   270,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   272,     0,     0,
+       0,   281,   282,   283,   284,     0,     0,    57,     0,     0,
+       0,     0,     3,     0,   280,    40,    41,    42,    48,    46,
+      47,    39,    36,    37,    38,    43,    44,    45,    49,    50,
+      51,     4,     5,     6,     7,     8,    19,    20,     9,    10,
+      11,    12,    13,    14,    15,    16,    18,    17,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    52,    53,    54,    55,     0,   105,     0,
+       0,     0,   107,   111,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   250,   249,   251,   252,   253,
+     254,   248,   247,   256,   257,   258,   259,     0,   122,     0,
+       0,   255,     0,   273,   125,     0,     0,   130,     0,     0,
+       0,     0,     0,     0,     0,   155,   155,   155,   155,     0,
+       0,     0,     0,     0,   169,   158,   159,   160,   161,   162,
+     165,   164,   163,     0,   173,     0,     0,   175,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   184,
+       0,     0,     0,     0,     0,     0,    58,    59,     0,     0,
+       0,    80,     0,     0,    70,    71,     0,    84,     0,    86,
+       0,     0,     0,     0,     0,    90,    97,     0,     0,     0,
+       0,     0,    77,     0,     0,     0,   136,   103,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   269,     0,     0,     0,
-     278,   279,   280,   281,     0,     0,    56,     0,     0,     0,
-       0,     3,     0,   277,    39,    40,    41,    47,    45,    46,
-      38,    35,    36,    37,    42,    43,    44,    48,    49,    50,
-       4,     5,     6,     7,     8,    19,    20,     9,    10,    11,
-      12,    13,    14,    15,    16,    18,    17,    21,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    51,    52,    53,    54,     0,   104,     0,     0,     0,
-     106,   110,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   134,   247,   246,   248,   249,   250,   251,   245,
-     244,   253,   254,   255,   256,     0,   121,     0,     0,   252,
-       0,   270,   124,     0,     0,   129,     0,     0,     0,     0,
-       0,     0,     0,   154,   154,   154,   154,     0,     0,     0,
-       0,     0,   168,   157,   158,   159,   160,   161,   164,   163,
-     162,     0,   172,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   182,     0,     0,     0,
-       0,     0,     0,    57,    58,     0,     0,     0,    79,     0,
-       0,    69,    70,     0,    83,     0,    85,     0,     0,     0,
-       0,     0,    89,    96,     0,     0,     0,     0,     0,    76,
-       0,     0,     0,   135,   102,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   244,     0,     0,   302,
+     303,   301,     0,   304,     1,     2,   157,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   241,     0,     0,   299,   300,   298,     0,   301,
-       1,     2,   156,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   246,     0,     0,   108,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   270,   269,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     243,     0,     0,   107,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   267,   266,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   127,     0,
-     125,   300,     0,   130,   165,   166,   167,   145,   137,   138,
-     154,   155,   154,   154,   154,   144,   143,   146,     0,   147,
-       0,     0,   149,   170,     0,   171,     0,     0,     0,     0,
-       0,   176,     0,   177,   179,   180,   181,    78,   185,     0,
-     188,     0,   183,     0,   191,   190,   192,   193,     0,    80,
-      81,    82,    68,    67,    84,    86,    88,     0,    87,     0,
-       0,    97,    73,    72,     0,    74,    71,    98,     0,     0,
-     136,   103,    77,   196,   197,   198,   235,   205,   199,   200,
-     201,   202,   203,   204,   237,   195,   220,   221,   222,   223,
-     224,   227,   226,   225,   233,   212,   228,   229,   230,   234,
-     208,   209,   210,   211,   213,   215,   214,   206,   207,   216,
-     231,   232,   238,   217,   218,   236,   240,   239,   219,   242,
-     302,   287,   288,   294,   295,   296,   297,   283,   284,   289,
-     290,   293,   292,   285,   286,   291,   282,   105,   108,   109,
-       0,     0,     0,     0,     0,     0,   111,     0,     0,     0,
-     268,   261,   262,   257,   258,   263,   264,   259,   260,   265,
-       0,     0,     0,     0,   132,     0,     0,     0,     0,     0,
-     148,     0,   152,     0,   150,   169,   173,     0,   284,   285,
-       0,   178,   186,     0,     0,   184,   194,    90,     0,    91,
-       0,    92,     0,    75,    99,   100,     0,   114,   113,   115,
-     116,   117,   112,   118,   119,   120,     0,   122,   128,   126,
-       0,   131,   139,   140,   141,   142,   153,   151,   174,   175,
-     187,   189,    93,    94,    95,   101,     0,   133,   123
+       0,     0,   128,     0,   126,   303,     0,   131,   166,   167,
+     168,   146,   138,   139,   155,   156,   155,   155,   155,   145,
+     144,   147,     0,   148,     0,     0,   150,   171,     0,   172,
+       0,     0,     0,     0,     0,   178,     0,   179,   181,   182,
+     183,    79,   187,     0,   190,     0,   185,     0,   193,   192,
+     194,   195,     0,    81,    82,    83,    69,    68,    85,    87,
+      89,     0,    88,     0,     0,    98,    74,    73,     0,    75,
+      72,    99,     0,     0,   137,   104,    78,   198,   199,   200,
+     238,   207,   201,   202,   203,   204,   205,   206,   240,   197,
+     223,   224,   225,   226,   227,   230,   229,   228,   236,   214,
+     215,   231,   232,   233,   237,   210,   211,   212,   213,   216,
+     218,   217,   208,   209,   219,   234,   235,   241,   220,   221,
+     239,   243,   242,   222,   245,   305,   290,   291,   297,   298,
+     299,   300,   286,   287,   292,   293,   296,   295,   288,   289,
+     294,   285,   106,   109,   110,     0,     0,     0,     0,     0,
+       0,   112,     0,     0,     0,   271,   264,   265,   260,   261,
+     266,   267,   262,   263,   268,     0,     0,     0,     0,   133,
+       0,     0,     0,     0,     0,   149,     0,   153,     0,   151,
+     170,   174,     0,   287,   288,     0,   180,   188,     0,     0,
+     186,   196,    91,     0,    92,     0,    93,     0,    76,   100,
+     101,     0,   115,   114,   116,   117,   118,   113,   119,   120,
+     121,     0,   123,   129,   127,     0,   132,   140,   141,   142,
+     143,   154,   152,   176,   177,   189,   191,    94,    95,    96,
+     102,     0,   134,   124
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -178,  -178,   390,    -5,   413,    -2,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -177,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,  -178,
-    -178,  -178,  -178,  -178,  -178,  -178,  -178,  -164,     0
+    -180,  -180,   445,   -39,   463,    -2,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -179,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,
+    -180,  -180,  -180,  -180,  -180,  -180,  -180,  -180,  -166,     0
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    80,    81,   225,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
-     370,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   170,   371
+       0,    81,    82,   228,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     374,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   172,   375
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1259,504 +1266,490 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     134,   344,   141,   345,   346,   245,   523,   372,   373,   374,
-     135,   357,   138,   152,   137,   151,   380,   169,   218,   219,
-     173,   176,   153,   154,   155,   156,   157,     6,     7,     8,
-       9,    10,    11,   158,   233,   235,   246,   203,   252,   378,
-     206,   531,   533,   212,   217,   226,   227,   221,   222,   381,
-     424,   220,   332,   229,   230,   392,   223,   224,   247,   177,
-     244,   139,   178,   234,   236,   255,   192,   256,   237,   304,
-     179,   193,   382,   194,   305,   306,   425,   307,   308,   309,
-     134,   333,   195,   238,   393,   196,   197,   198,   250,   159,
-     140,   248,   199,   200,   253,   379,   204,   532,   534,   205,
-     153,   154,   155,   156,   157,     6,     7,     8,     9,    10,
-      11,   158,   251,   524,   249,   328,   160,   136,   358,   207,
-     228,   239,   315,   316,   317,   318,   334,   231,   232,   161,
-     162,   163,   164,   254,   165,   329,   312,   364,   240,   241,
-     331,   335,   336,   340,   328,   166,   544,   337,   167,   168,
-     338,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,   169,   339,   169,   169,   159,   208,   209,
-     210,   211,   341,   342,   361,   343,   242,  -300,  -300,  -300,
-    -300,   365,   366,   511,   512,   513,   514,   515,   516,   517,
-     518,   519,   520,   526,   160,   527,   528,   529,   367,   328,
-     368,   384,   369,   375,   376,   387,   390,   161,   162,   163,
-     164,   377,   165,   399,   386,   391,   394,   403,    46,   347,
-     348,   395,   408,   401,   396,   400,   167,   168,   404,   349,
-     350,   351,   352,   405,   406,   353,   354,   355,   417,   409,
-     419,   420,   410,   411,   414,    66,   510,   415,   416,   418,
-     428,   422,   313,   314,   315,   316,   317,   318,    70,    71,
-      72,    73,   319,   388,   321,   322,   323,   324,   389,   326,
-     327,   423,   359,   426,   402,   429,   328,    77,    78,   430,
-      79,   433,   434,   435,   436,   437,   438,   439,   440,   441,
-     442,   443,   444,   445,   446,   447,   448,   449,   450,     1,
-       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,   451,   452,   481,   482,   483,   484,   485,   486,   487,
-     488,   489,   490,   491,   492,   493,   494,   495,   496,   453,
-     454,   521,   455,   456,   500,   501,   502,   503,   504,   505,
-     457,   507,   508,   509,   458,   169,   169,   169,   169,   169,
-     169,   169,   169,   169,   169,   459,   460,   313,   314,   315,
-     316,   317,   318,   461,   462,   463,   171,   319,   320,   321,
-     322,   323,   324,   325,   326,   327,   464,   465,   466,   360,
-     467,   328,   468,   469,   347,   348,   470,   537,   538,   539,
-     540,   471,   472,    66,   473,   474,   475,   476,   477,   543,
-     353,   354,   355,   478,   328,   498,    70,    71,    72,    73,
-     499,    74,   506,   522,   525,   530,    75,   548,   536,   550,
-     552,   541,   172,   553,   568,    77,    78,   310,    79,   556,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,   569,   570,   571,    13,    14,    15,    16,    17,
-     572,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,   573,    29,    30,    31,    32,    33,   574,   586,
-     311,   575,   576,   577,   581,   587,   588,    34,    35,    36,
-      37,   303,     0,    38,    39,    40,     0,    41,     0,    42,
-       0,     0,     0,     0,    43,    44,    45,    46,     0,    47,
-      48,    49,    50,    51,     0,     0,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,     0,     0,    61,    62,     0,
-      63,     0,    64,    65,    66,    67,    68,     0,    69,     0,
-       0,     0,     0,     0,     0,     0,     0,    70,    71,    72,
-      73,     0,    74,     0,     0,     0,     0,    75,     0,     0,
-       0,     0,     0,    76,     0,     0,    77,    78,     0,    79,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,     0,     0,    13,    14,    15,    16,    17,
-       0,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,     0,    29,    30,    31,    32,    33,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    34,    35,    36,
-      37,     0,     0,    38,    39,    40,     0,    41,     0,    42,
-       0,     0,     0,     0,    43,    44,    45,    46,     0,    47,
-      48,    49,    50,    51,     0,     0,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,     0,     0,    61,    62,   362,
-      63,     0,    64,    65,    66,    67,    68,     0,    69,     0,
-       0,     0,     0,     0,     0,     0,     0,    70,    71,    72,
-      73,     0,    74,     0,     0,   566,     0,    75,     0,     0,
-       0,     0,     0,    76,     0,     0,    77,    78,     0,    79,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,   142,   143,   144,   145,   146,     6,     7,
-       8,     9,    10,    11,     0,     0,     0,     0,     0,     0,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,     0,   313,   314,   315,   316,   317,   318,
-       0,     0,     0,     0,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,     0,     0,     0,   363,    46,   328,   147,
-     347,   348,     0,     0,     0,     0,     0,     0,   148,     0,
-     349,   350,   351,   352,     0,     0,   353,   354,   355,     0,
-       0,     0,   567,     0,    66,     0,     0,    46,     0,     0,
-       0,   313,   314,   315,   316,   317,   318,    70,    71,    72,
-      73,   319,   388,   321,   322,   323,   324,   389,   326,   327,
-       0,   149,   150,   542,    66,   328,    77,    78,     0,    79,
-       0,   313,   314,   315,   316,   317,   318,    70,    71,    72,
-      73,   319,   388,   321,   322,   323,   324,   389,   326,   327,
-       0,     0,     0,   547,     0,   328,    77,    78,     0,    79,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,     0,     0,     0,     0,     0,     0,     0,
+     136,   348,   384,   349,   350,   363,   528,   376,   377,   378,
+     140,   255,   229,   230,   139,   153,   382,   171,   221,   222,
+     175,   178,     1,     2,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,   137,   385,   236,   205,   428,   361,
+     238,   209,   336,   536,   215,   220,   226,   227,   224,   225,
+     143,   223,   154,   253,   232,   233,   248,   396,   386,   194,
+     141,   247,   179,   180,   429,   237,   258,   256,   259,   239,
+     308,   337,   383,   181,   216,   309,   310,   254,   311,   312,
+     313,   136,   538,   195,   196,   197,   397,   249,   206,   142,
+      47,   317,   318,   319,   320,   321,   322,   217,   218,   537,
+     198,   323,   324,   325,   326,   327,   328,   329,   330,   331,
+     250,   344,   199,   364,   529,   332,   332,    67,   144,   145,
+     146,   147,   148,     6,     7,     8,     9,    10,    11,   240,
+      71,    72,    73,    74,   200,    75,   201,   333,   539,   202,
+      76,   207,   138,   251,   241,   208,   219,   362,   210,    78,
+      79,   231,    80,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,   171,   252,   171,   171,   211,
+     212,   213,   214,   234,   235,   149,   365,   257,   316,   335,
+     338,   339,   340,   242,   150,   516,   517,   518,   519,   520,
+     521,   522,   523,   524,   525,   531,   341,   532,   533,   534,
+     243,   244,   368,   388,   319,   320,   321,   322,   391,   394,
+    -303,  -303,  -303,  -303,   390,   342,   403,   351,   352,   343,
+     407,    47,   345,   346,   347,   412,   332,   151,   152,   369,
+     332,   370,   332,   357,   358,   359,   371,   372,   245,   433,
+     373,   421,   405,   423,   424,   379,   380,   381,    67,   395,
+     398,   399,   400,   432,   404,   317,   318,   319,   320,   321,
+     322,    71,    72,    73,    74,   323,   392,   325,   326,   327,
+     328,   393,   330,   331,   408,   366,   409,   406,   410,   332,
+      78,    79,   413,    80,   414,   415,   418,   419,   420,   422,
+     426,   427,   430,   434,   437,   526,   438,   439,   440,   441,
+     442,   443,     1,     2,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,   444,   445,   446,   486,   487,   488,
+     489,   490,   491,   492,   493,   494,   495,   496,   497,   498,
+     499,   500,   501,   447,   448,   449,   450,   451,   505,   506,
+     507,   508,   509,   510,   452,   512,   513,   514,   453,   171,
+     171,   171,   171,   171,   171,   171,   171,   171,   171,   454,
+     455,   317,   318,   319,   320,   321,   322,   456,   457,   458,
+     173,   323,   324,   325,   326,   327,   328,   329,   330,   331,
+     459,   460,   461,   367,   462,   332,   463,   464,   465,   351,
+     352,   542,   543,   544,   545,   466,   467,    67,   468,   353,
+     354,   355,   356,   548,   469,   357,   358,   359,   470,   471,
+      71,    72,    73,    74,   472,    75,   515,   473,   474,   475,
+      76,   553,   476,   555,   557,   477,   174,   478,   479,    78,
+      79,   314,    80,   561,     1,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,   480,   481,   482,    13,
+      14,    15,    16,    17,   483,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,   503,    29,    30,    31,
+      32,    33,   504,   511,   527,   530,   535,   541,   546,   549,
+     558,    34,    35,    36,    37,   573,   574,    38,    39,    40,
+      41,   575,    42,   576,    43,   577,   578,   579,   580,    44,
+      45,    46,    47,   581,    48,    49,    50,    51,    52,   582,
+     586,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+     591,   592,    62,    63,   593,    64,   315,    65,    66,    67,
+      68,    69,   307,    70,     0,     0,     0,     0,     0,     0,
+       0,     0,    71,    72,    73,    74,     0,    75,     0,     0,
+       0,     0,    76,     0,     0,     0,     0,     0,    77,     0,
+       0,    78,    79,     0,    80,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,     0,     0,     0,
+      13,    14,    15,    16,    17,     0,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,     0,    29,    30,
+      31,    32,    33,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    34,    35,    36,    37,     0,     0,    38,    39,
+      40,    41,     0,    42,     0,    43,     0,     0,     0,     0,
+      44,    45,    46,    47,     0,    48,    49,    50,    51,    52,
+       0,     0,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,     0,   571,    62,    63,     0,    64,     0,    65,    66,
+      67,    68,    69,     0,    70,     0,     0,     0,     0,     0,
+       0,     0,     0,    71,    72,    73,    74,     0,    75,     0,
+       0,     0,     0,    76,     0,     0,     0,     0,     0,    77,
+       0,     0,    78,    79,     0,    80,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,   180,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   181,     0,     0,     0,     0,
-       0,     0,     0,   182,     0,     0,     0,    46,   347,   348,
-     183,   184,   185,   186,   187,   188,     0,   189,   349,   350,
-     351,   352,     0,     0,   353,   354,   355,     0,     0,     0,
-       0,     0,   356,     0,    66,     0,     0,    46,     0,     0,
-       0,   313,   314,   315,   316,   317,   318,    70,    71,    72,
-      73,   319,   388,   321,   322,   323,   324,   389,   326,   327,
-     190,     0,     0,   549,    66,   328,    77,    78,     0,    79,
-     191,   313,   314,   315,   316,   317,   318,    70,    71,    72,
-      73,   319,   388,   321,   322,   323,   324,   389,   326,   327,
-       0,     0,     0,   551,     0,   328,    77,    78,     0,    79,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,   351,   352,
+       0,   317,   318,   319,   320,   321,   322,     0,   353,   354,
+     355,   356,     0,     0,   357,   358,   359,   329,   330,   331,
+     572,     0,     0,     0,    47,   332,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     1,
        2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   330,     0,   328,     0,    46,     1,     2,
+      12,    67,     0,     0,    47,     0,     0,     0,   317,   318,
+     319,   320,   321,   322,    71,    72,    73,    74,   323,   392,
+     325,   326,   327,   328,   393,   330,   331,     0,     0,     0,
+     547,    67,   332,    78,    79,     0,    80,     0,   317,   318,
+     319,   320,   321,   322,    71,    72,    73,    74,   323,   392,
+     325,   326,   327,   328,   393,   330,   331,    47,     0,     0,
+     552,     0,   332,    78,    79,     0,    80,     1,     2,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
+       0,     0,     0,     0,    67,     0,     0,     0,     0,     0,
+       0,   317,   318,   319,   320,   321,   322,    71,    72,    73,
+      74,   323,   392,   325,   326,   327,   328,   393,   330,   331,
+       0,     0,     0,   554,     0,   332,    78,    79,     0,    80,
+       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,     0,     0,     0,    47,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     1,     2,
        3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-     201,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    66,     0,    46,     0,     0,     0,
-       0,   313,   314,   315,   316,   317,   318,    70,    71,    72,
-      73,   319,   388,   321,   322,   323,   324,   389,   326,   327,
-     213,     0,     0,    66,     0,   328,    77,    78,     0,    79,
-       0,     0,     0,     0,     0,    46,    70,    71,    72,    73,
-       0,    74,   214,   215,     0,     0,    75,     0,     0,     0,
-       0,     0,   202,     0,     0,    77,    78,     0,    79,     0,
-       0,     0,    66,     1,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    70,    71,    72,    73,     0,
-      74,     0,     0,     0,     0,    75,     0,     0,     0,     0,
-       0,   216,     0,     0,    77,    78,     0,    79,     0,     1,
+       0,     0,    67,     0,     0,     0,     0,     0,     0,   317,
+     318,   319,   320,   321,   322,    71,    72,    73,    74,   323,
+     392,   325,   326,   327,   328,   393,   330,   331,    47,     0,
+       0,   556,     0,   332,    78,    79,     0,    80,     0,   203,
+       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,     0,     0,     0,    67,    47,     0,     0,     0,
+       0,     0,   317,   318,   319,   320,   321,   322,    71,    72,
+      73,    74,   323,   392,   325,   326,   327,   328,   393,   330,
+     331,     0,     0,    67,     0,     0,   332,    78,    79,     0,
+      80,     0,     0,     0,     0,     0,    71,    72,    73,    74,
+       0,    75,     0,     0,     0,     0,    76,     0,    47,     0,
+       0,     0,   204,     0,     0,    78,    79,     0,    80,     1,
        2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      46,     0,     0,     1,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,   313,   314,   315,   316,   317,
-     318,     0,     0,     0,     0,     0,     0,    66,     0,     0,
-       0,   325,   326,   327,     0,     0,    46,     0,     0,   328,
-      70,    71,    72,    73,     0,    74,     0,     0,     0,     0,
-     174,     0,     0,     0,     0,     0,   175,     0,     0,    77,
-      78,     0,    79,    66,     0,     0,     0,     0,     0,     0,
-      46,     0,     0,     0,     0,     0,    70,    71,    72,    73,
-       0,    74,     0,     0,     0,     0,    75,     0,     0,     0,
-       0,     0,   243,     0,     0,    77,    78,    66,    79,     0,
-    -299,  -299,  -299,  -299,  -299,  -299,     0,     0,     0,     0,
-      70,    71,    72,    73,     0,    74,  -299,  -299,  -299,     0,
-      75,     0,     0,     0,   328,     0,   383,     0,     0,    77,
-      78,     0,    79,     1,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,     0,     0,     0,     0,     0,     0,     0,
-      46,     0,     0,     0,     0,     1,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,     0,     0,     0,
-       0,     0,     0,     0,    46,     0,     0,    66,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      70,    71,    72,    73,     0,    74,     0,     0,    46,     0,
-      75,    66,     0,     0,     0,     0,   398,     0,     0,    77,
-      78,     0,    79,     0,    70,    71,    72,    73,     0,    74,
-       0,     0,    46,     0,    75,    66,     0,     0,     0,     0,
-     427,     0,     0,    77,    78,     0,    79,     0,    70,    71,
-      72,    73,     0,    74,     0,     0,     0,     0,    75,    66,
-       0,     0,     0,     0,   555,     0,     0,    77,    78,     0,
-      79,     0,    70,    71,    72,    73,     0,    74,     0,     0,
-       0,     0,    75,     0,     0,     0,     0,     0,     0,     0,
-       0,    77,    78,   257,    79,   258,   259,   260,     0,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,    27,    28,
-       0,   270,   271,   272,   273,   274,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   275,   276,   277,   278,     0,
-       0,   279,   280,   281,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   282,   283,     0,     0,     0,   284,   285,
-     286,   287,     0,     0,   288,   289,   290,   291,   292,   293,
-       0,   294,   295,     0,     0,   296,   297,     0,   298,     0,
-       0,     0,     0,   299,   300,     0,   301,     0,   313,   314,
-     315,   316,   317,   318,     0,     0,     0,     0,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,     0,     0,     0,
-       0,   302,   328,     0,     0,   480,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   385,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   397,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   407,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   412,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   413,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   421,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   431,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   432,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   479,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   497,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   535,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   545,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   546,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   554,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   557,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   558,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   559,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   560,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   561,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   562,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   563,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   564,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   565,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   578,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   579,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   580,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   582,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   583,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,   584,     0,
-     328,   313,   314,   315,   316,   317,   318,     0,     0,     0,
-       0,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-       0,     0,     0,   585,     0,   328,   313,   314,   315,   316,
-     317,   318,     0,     0,     0,     0,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,     0,     0,     0,     0,     0,
-     328
+      12,     0,     0,     0,     0,    67,     0,     0,  -302,  -302,
+    -302,  -302,  -302,  -302,     0,     0,     0,     0,    71,    72,
+      73,    74,     0,    75,  -302,  -302,  -302,     0,   176,     0,
+       0,     0,   332,     0,   177,     0,     0,    78,    79,     0,
+      80,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,     0,     0,     0,    47,     0,     0,
+       0,     0,     0,     0,     0,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,   317,   318,   319,
+     320,   321,   322,     0,    67,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,    71,    72,    73,
+      74,   332,    75,     0,   485,     0,     0,    76,     0,    47,
+       0,     0,     0,   246,     0,     0,    78,    79,     0,    80,
+       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,     0,    47,     0,     0,    67,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    71,
+      72,    73,    74,     0,    75,     0,     0,     0,     0,    76,
+      67,     0,     0,     0,     0,   387,     0,     0,    78,    79,
+       0,    80,     0,    71,    72,    73,    74,     0,    75,     0,
+       0,     0,     0,    76,     0,     0,     0,     0,    47,   402,
+       0,     0,    78,    79,     0,    80,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,   317,   318,
+     319,   320,   321,   322,     0,    67,     0,     0,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,     0,    71,    72,
+      73,    74,   332,    75,     0,     0,     0,     0,    76,     0,
+       0,     0,     0,     0,   431,     0,     0,    78,    79,     0,
+      80,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    47,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   155,   156,   157,   158,   159,
+       6,     7,     8,     9,    10,    11,   160,     0,     0,     0,
+       0,    67,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    71,    72,    73,    74,     0,    75,
+       0,     0,     0,     0,    76,     0,     0,     0,     0,    47,
+     560,     0,     0,    78,    79,     0,    80,   155,   156,   157,
+     158,   159,     6,     7,     8,     9,    10,    11,   160,   351,
+     352,     0,     0,   161,     0,     0,    67,     0,     0,   353,
+     354,   355,   356,     0,     0,   357,   358,   359,     0,    71,
+      72,    73,    74,   360,    75,     0,     0,     0,     0,    76,
+     162,     0,     0,     0,     0,     0,     0,     0,    78,    79,
+       0,    80,     0,   163,   164,   165,   166,     0,   167,     0,
+       0,     0,     0,     0,     0,   161,     0,     0,     0,   168,
+       0,     0,   169,   170,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   182,     0,     0,     0,     0,     0,
+       0,     0,   162,     0,     0,     0,   183,     0,     0,     0,
+       0,     0,     0,     0,   184,   163,   164,   165,   166,     0,
+     167,   185,   186,   187,   188,   189,   190,     0,   191,     0,
+       0,     0,     0,     0,   169,   170,   260,     0,   261,   262,
+     263,     0,   264,   265,   266,   267,   268,   269,   270,   271,
+     272,    27,    28,     0,   273,   274,   275,   276,   277,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   278,   279,
+     280,   281,   192,     0,   282,   283,   284,   285,     0,     0,
+       0,     0,   193,     0,     0,     0,     0,   286,   287,     0,
+       0,     0,   288,   289,   290,   291,     0,     0,   292,   293,
+     294,   295,   296,   297,     0,   298,   299,     0,     0,   300,
+     301,     0,   302,     0,     0,     0,     0,   303,   304,     0,
+     305,     0,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   334,   306,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   389,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   401,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   411,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   416,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   417,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   425,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   435,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   436,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   484,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   502,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   540,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   550,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   551,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   559,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   562,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   563,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   564,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   565,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   566,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   567,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   568,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   569,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   570,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   583,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   584,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   585,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   587,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   588,     0,   332,   317,   318,   319,
+     320,   321,   322,     0,     0,     0,     0,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,     0,     0,     0,   589,
+       0,   332,   317,   318,   319,   320,   321,   322,     0,     0,
+       0,     0,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,   590,     0,   332
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,   165,   126,   167,   168,    17,    19,   184,   185,   186,
-      19,    19,    48,   126,    14,    17,    70,    19,    70,    71,
+       0,   167,    71,   169,   170,    19,    19,   186,   187,   188,
+      48,    71,    51,    52,    14,    17,    71,    19,    71,    72,
       20,    21,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    97,    97,    48,    37,    70,    70,
-      40,    70,    70,    43,    44,    50,    51,    47,    48,   103,
-     100,   103,    97,    53,    54,    97,    16,    17,    70,    97,
-      60,    97,    97,   126,   126,    65,   126,    67,    18,    69,
-      97,   126,   126,   126,    74,    75,   126,    77,    78,    79,
-      80,   126,   126,    33,   126,   126,   126,   126,    70,    70,
-     126,   103,   126,   126,   126,   126,    70,   126,   126,    70,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    94,   126,   126,   128,    97,   126,   126,    61,
-     126,    71,   106,   107,   108,   109,   127,   126,   126,   110,
-     111,   112,   113,   126,   115,   135,   126,   126,    88,    89,
-      97,   127,   127,   148,   128,   126,    97,   127,   129,   130,
-     127,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,   165,   127,   167,   168,    70,    63,    64,
-      65,    66,   127,   127,   174,   127,   126,   106,   107,   108,
-     109,   126,   126,   347,   348,   349,   350,   351,   352,   353,
-     354,   355,   356,   370,    97,   372,   373,   374,   126,   128,
-     126,   201,   126,   126,   126,   205,   206,   110,   111,   112,
-     113,   126,   115,   213,    70,   126,   126,   217,    70,   104,
-     105,   126,   222,   127,   126,   126,   129,   130,   126,   114,
-     115,   116,   117,   126,   126,   120,   121,   122,   238,   126,
-     240,   241,   126,   126,   126,    97,   131,   126,   126,   126,
-     250,   126,   104,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
-     122,   126,    19,   126,   126,    70,   128,   129,   130,   126,
-     132,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,   126,   126,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   325,   326,   327,   328,   126,
-     126,    70,   126,   126,   334,   335,   336,   337,   338,   339,
-     126,   341,   342,   343,   126,   347,   348,   349,   350,   351,
-     352,   353,   354,   355,   356,   126,   126,   104,   105,   106,
-     107,   108,   109,   126,   126,   126,    70,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   126,   126,   126,   126,
-     126,   128,   126,   126,   104,   105,   126,   387,   388,   389,
-     390,   126,   126,    97,   126,   126,   126,   126,   126,   399,
-     120,   121,   122,   126,   128,   126,   110,   111,   112,   113,
-     126,   115,   126,    70,    70,   126,   120,   417,   126,   419,
-     420,   126,   126,   126,   126,   129,   130,     0,   132,   429,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,   126,    70,   126,    18,    19,    20,    21,    22,
-     126,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,   126,    36,    37,    38,    39,    40,   126,    70,
-      80,   126,   126,   126,   126,   126,   126,    50,    51,    52,
-      53,    68,    -1,    56,    57,    58,    -1,    60,    -1,    62,
-      -1,    -1,    -1,    -1,    67,    68,    69,    70,    -1,    72,
-      73,    74,    75,    76,    -1,    -1,    79,    80,    81,    82,
-      83,    84,    85,    86,    87,    -1,    -1,    90,    91,    -1,
-      93,    -1,    95,    96,    97,    98,    99,    -1,   101,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,   111,   112,
-     113,    -1,   115,    -1,    -1,    -1,    -1,   120,    -1,    -1,
-      -1,    -1,    -1,   126,    -1,    -1,   129,   130,    -1,   132,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,    -1,    -1,    18,    19,    20,    21,    22,
-      -1,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    -1,    36,    37,    38,    39,    40,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,    52,
-      53,    -1,    -1,    56,    57,    58,    -1,    60,    -1,    62,
-      -1,    -1,    -1,    -1,    67,    68,    69,    70,    -1,    72,
-      73,    74,    75,    76,    -1,    -1,    79,    80,    81,    82,
-      83,    84,    85,    86,    87,    -1,    -1,    90,    91,    19,
-      93,    -1,    95,    96,    97,    98,    99,    -1,   101,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,   111,   112,
-     113,    -1,   115,    -1,    -1,    19,    -1,   120,    -1,    -1,
-      -1,    -1,    -1,   126,    -1,    -1,   129,   130,    -1,   132,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    -1,    -1,    -1,    -1,    -1,    -1,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,    -1,   104,   105,   106,   107,   108,   109,
-      -1,    -1,    -1,    -1,   114,   115,   116,   117,   118,   119,
-     120,   121,   122,    -1,    -1,    -1,   126,    70,   128,    59,
-     104,   105,    -1,    -1,    -1,    -1,    -1,    -1,    68,    -1,
-     114,   115,   116,   117,    -1,    -1,   120,   121,   122,    -1,
-      -1,    -1,   126,    -1,    97,    -1,    -1,    70,    -1,    -1,
-      -1,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,   111,   112,   126,    97,   128,   129,   130,    -1,   132,
-      -1,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   129,   130,    -1,   132,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      11,    12,    13,    14,    19,   104,    98,    37,   101,    19,
+      98,    41,    98,    71,    44,    45,    16,    17,    48,    49,
+     127,   104,   127,    71,    54,    55,    17,    98,   127,   127,
+      98,    61,    98,    98,   127,   127,    66,   127,    68,   127,
+      70,   127,   127,    98,    55,    75,    76,    95,    78,    79,
+      80,    81,    71,   127,   127,   127,   127,    48,    71,   127,
+      71,   105,   106,   107,   108,   109,   110,    78,    79,   127,
+     127,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      71,   150,   127,   127,   127,   129,   129,    98,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    18,
+     111,   112,   113,   114,   127,   116,   127,   137,   127,   127,
+     121,   127,   127,   104,    33,    71,   127,   127,    62,   130,
+     131,   127,   133,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   167,   127,   169,   170,    64,
+      65,    66,    67,   127,   127,    60,   176,   127,   127,    98,
+     128,   128,   128,    72,    69,   351,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   374,   128,   376,   377,   378,
+      89,    90,   127,   203,   107,   108,   109,   110,   208,   209,
+     107,   108,   109,   110,    71,   128,   216,   105,   106,   128,
+     220,    71,   128,   128,   128,   225,   129,   112,   113,   127,
+     129,   127,   129,   121,   122,   123,   127,   127,   127,    71,
+     127,   241,   128,   243,   244,   127,   127,   127,    98,   127,
+     127,   127,   127,   253,   127,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   127,    19,   127,   127,   127,   129,
+     130,   131,   127,   133,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,    71,   127,   127,   127,   127,
+     127,   127,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,   127,   127,   127,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   127,   127,   127,   127,   127,   338,   339,
+     340,   341,   342,   343,   127,   345,   346,   347,   127,   351,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   127,
+     127,   105,   106,   107,   108,   109,   110,   127,   127,   127,
+      71,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     127,   127,   127,   127,   127,   129,   127,   127,   127,   105,
+     106,   391,   392,   393,   394,   127,   127,    98,   127,   115,
+     116,   117,   118,   403,   127,   121,   122,   123,   127,   127,
+     111,   112,   113,   114,   127,   116,   132,   127,   127,   127,
+     121,   421,   127,   423,   424,   127,   127,   127,   127,   130,
+     131,     0,   133,   433,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,   127,   127,   127,    18,
+      19,    20,    21,    22,   127,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,   127,    36,    37,    38,
+      39,    40,   127,   127,    71,    71,   127,   127,   127,    98,
+     127,    50,    51,    52,    53,   127,   127,    56,    57,    58,
+      59,    71,    61,   127,    63,   127,   127,   127,   127,    68,
+      69,    70,    71,   127,    73,    74,    75,    76,    77,   127,
+     127,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      71,   127,    91,    92,   127,    94,    81,    96,    97,    98,
+      99,   100,    69,   102,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   111,   112,   113,   114,    -1,   116,    -1,    -1,
+      -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,   127,    -1,
+      -1,   130,   131,    -1,   133,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
+      18,    19,    20,    21,    22,    -1,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    -1,    36,    37,
+      38,    39,    40,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    50,    51,    52,    53,    -1,    -1,    56,    57,
+      58,    59,    -1,    61,    -1,    63,    -1,    -1,    -1,    -1,
+      68,    69,    70,    71,    -1,    73,    74,    75,    76,    77,
+      -1,    -1,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    -1,    19,    91,    92,    -1,    94,    -1,    96,    97,
+      98,    99,   100,    -1,   102,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   111,   112,   113,   114,    -1,   116,    -1,
+      -1,    -1,    -1,   121,    -1,    -1,    -1,    -1,    -1,   127,
+      -1,    -1,   130,   131,    -1,   133,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    35,    -1,    -1,    -1,    70,   104,   105,
-      42,    43,    44,    45,    46,    47,    -1,    49,   114,   115,
-     116,   117,    -1,    -1,   120,   121,   122,    -1,    -1,    -1,
-      -1,    -1,   128,    -1,    97,    -1,    -1,    70,    -1,    -1,
-      -1,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      92,    -1,    -1,   126,    97,   128,   129,   130,    -1,   132,
-     102,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   129,   130,    -1,   132,
-       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,   105,   106,
+      -1,   105,   106,   107,   108,   109,   110,    -1,   115,   116,
+     117,   118,    -1,    -1,   121,   122,   123,   121,   122,   123,
+     127,    -1,    -1,    -1,    71,   129,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
        4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,    -1,    70,     3,     4,
+      14,    98,    -1,    -1,    71,    -1,    -1,    -1,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    -1,    -1,    -1,
+     127,    98,   129,   130,   131,    -1,   133,    -1,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    71,    -1,    -1,
+     127,    -1,   129,   130,   131,    -1,   133,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
+      -1,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+      -1,    -1,    -1,   127,    -1,   129,   130,   131,    -1,   133,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    -1,    -1,    -1,    71,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      54,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    97,    -1,    70,    -1,    -1,    -1,
-      -1,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,    71,    -1,
+      -1,   127,    -1,   129,   130,   131,    -1,   133,    -1,    54,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    -1,    -1,    -1,    98,    71,    -1,    -1,    -1,
+      -1,    -1,   105,   106,   107,   108,   109,   110,   111,   112,
      113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      55,    -1,    -1,    97,    -1,   128,   129,   130,    -1,   132,
-      -1,    -1,    -1,    -1,    -1,    70,   110,   111,   112,   113,
-      -1,   115,    77,    78,    -1,    -1,   120,    -1,    -1,    -1,
-      -1,    -1,   126,    -1,    -1,   129,   130,    -1,   132,    -1,
-      -1,    -1,    97,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,   110,   111,   112,   113,    -1,
-     115,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,    -1,
-      -1,   126,    -1,    -1,   129,   130,    -1,   132,    -1,     3,
+     123,    -1,    -1,    98,    -1,    -1,   129,   130,   131,    -1,
+     133,    -1,    -1,    -1,    -1,    -1,   111,   112,   113,   114,
+      -1,   116,    -1,    -1,    -1,    -1,   121,    -1,    71,    -1,
+      -1,    -1,   127,    -1,    -1,   130,   131,    -1,   133,     3,
        4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      70,    -1,    -1,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,   104,   105,   106,   107,   108,
-     109,    -1,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
-      -1,   120,   121,   122,    -1,    -1,    70,    -1,    -1,   128,
-     110,   111,   112,   113,    -1,   115,    -1,    -1,    -1,    -1,
-     120,    -1,    -1,    -1,    -1,    -1,   126,    -1,    -1,   129,
-     130,    -1,   132,    97,    -1,    -1,    -1,    -1,    -1,    -1,
-      70,    -1,    -1,    -1,    -1,    -1,   110,   111,   112,   113,
-      -1,   115,    -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,
-      -1,    -1,   126,    -1,    -1,   129,   130,    97,   132,    -1,
-     104,   105,   106,   107,   108,   109,    -1,    -1,    -1,    -1,
-     110,   111,   112,   113,    -1,   115,   120,   121,   122,    -1,
-     120,    -1,    -1,    -1,   128,    -1,   126,    -1,    -1,   129,
-     130,    -1,   132,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      70,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
+      14,    -1,    -1,    -1,    -1,    98,    -1,    -1,   105,   106,
+     107,   108,   109,   110,    -1,    -1,    -1,    -1,   111,   112,
+     113,   114,    -1,   116,   121,   122,   123,    -1,   121,    -1,
+      -1,    -1,   129,    -1,   127,    -1,    -1,   130,   131,    -1,
+     133,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    -1,    -1,    -1,    -1,    71,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,   105,   106,   107,
+     108,   109,   110,    -1,    98,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,   111,   112,   113,
+     114,   129,   116,    -1,   132,    -1,    -1,   121,    -1,    71,
+      -1,    -1,    -1,   127,    -1,    -1,   130,   131,    -1,   133,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    -1,    71,    -1,    -1,    98,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   111,
+     112,   113,   114,    -1,   116,    -1,    -1,    -1,    -1,   121,
+      98,    -1,    -1,    -1,    -1,   127,    -1,    -1,   130,   131,
+      -1,   133,    -1,   111,   112,   113,   114,    -1,   116,    -1,
+      -1,    -1,    -1,   121,    -1,    -1,    -1,    -1,    71,   127,
+      -1,    -1,   130,   131,    -1,   133,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,   105,   106,
+     107,   108,   109,   110,    -1,    98,    -1,    -1,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,    -1,   111,   112,
+     113,   114,   129,   116,    -1,    -1,    -1,    -1,   121,    -1,
+      -1,    -1,    -1,    -1,   127,    -1,    -1,   130,   131,    -1,
+     133,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    -1,    71,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
        8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    70,    -1,    -1,    97,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     110,   111,   112,   113,    -1,   115,    -1,    -1,    70,    -1,
-     120,    97,    -1,    -1,    -1,    -1,   126,    -1,    -1,   129,
-     130,    -1,   132,    -1,   110,   111,   112,   113,    -1,   115,
-      -1,    -1,    70,    -1,   120,    97,    -1,    -1,    -1,    -1,
-     126,    -1,    -1,   129,   130,    -1,   132,    -1,   110,   111,
-     112,   113,    -1,   115,    -1,    -1,    -1,    -1,   120,    97,
-      -1,    -1,    -1,    -1,   126,    -1,    -1,   129,   130,    -1,
-     132,    -1,   110,   111,   112,   113,    -1,   115,    -1,    -1,
-      -1,    -1,   120,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   129,   130,    18,   132,    20,    21,    22,    -1,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      -1,    36,    37,    38,    39,    40,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    50,    51,    52,    53,    -1,
-      -1,    56,    57,    58,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    68,    69,    -1,    -1,    -1,    73,    74,
-      75,    76,    -1,    -1,    79,    80,    81,    82,    83,    84,
-      -1,    86,    87,    -1,    -1,    90,    91,    -1,    93,    -1,
-      -1,    -1,    -1,    98,    99,    -1,   101,    -1,   104,   105,
-     106,   107,   108,   109,    -1,    -1,    -1,    -1,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,    -1,    -1,    -1,
-      -1,   126,   128,    -1,    -1,   131,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,   126,    -1,
-     128,   104,   105,   106,   107,   108,   109,    -1,    -1,    -1,
-      -1,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-      -1,    -1,    -1,   126,    -1,   128,   104,   105,   106,   107,
-     108,   109,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,    -1,    -1,    -1,    -1,    -1,
-     128
+      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   111,   112,   113,   114,    -1,   116,
+      -1,    -1,    -1,    -1,   121,    -1,    -1,    -1,    -1,    71,
+     127,    -1,    -1,   130,   131,    -1,   133,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,   105,
+     106,    -1,    -1,    71,    -1,    -1,    98,    -1,    -1,   115,
+     116,   117,   118,    -1,    -1,   121,   122,   123,    -1,   111,
+     112,   113,   114,   129,   116,    -1,    -1,    -1,    -1,   121,
+      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   130,   131,
+      -1,   133,    -1,   111,   112,   113,   114,    -1,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    71,    -1,    -1,    -1,   127,
+      -1,    -1,   130,   131,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    98,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    35,   111,   112,   113,   114,    -1,
+     116,    42,    43,    44,    45,    46,    47,    -1,    49,    -1,
+      -1,    -1,    -1,    -1,   130,   131,    18,    -1,    20,    21,
+      22,    -1,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    -1,    36,    37,    38,    39,    40,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,
+      52,    53,    93,    -1,    56,    57,    58,    59,    -1,    -1,
+      -1,    -1,   103,    -1,    -1,    -1,    -1,    69,    70,    -1,
+      -1,    -1,    74,    75,    76,    77,    -1,    -1,    80,    81,
+      82,    83,    84,    85,    -1,    87,    88,    -1,    -1,    91,
+      92,    -1,    94,    -1,    -1,    -1,    -1,    99,   100,    -1,
+     102,    -1,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,   127,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129,   105,   106,   107,
+     108,   109,   110,    -1,    -1,    -1,    -1,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,    -1,    -1,    -1,   127,
+      -1,   129,   105,   106,   107,   108,   109,   110,    -1,    -1,
+      -1,    -1,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,    -1,    -1,    -1,   127,    -1,   129
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1767,97 +1760,98 @@ static const yytype_uint8 yystos[] =
       12,    13,    14,    18,    19,    20,    21,    22,    24,    25,
       26,    27,    28,    29,    30,    31,    32,    33,    34,    36,
       37,    38,    39,    40,    50,    51,    52,    53,    56,    57,
-      58,    60,    62,    67,    68,    69,    70,    72,    73,    74,
-      75,    76,    79,    80,    81,    82,    83,    84,    85,    86,
-      87,    90,    91,    93,    95,    96,    97,    98,    99,   101,
-     110,   111,   112,   113,   115,   120,   126,   129,   130,   132,
-     134,   135,   137,   138,   139,   140,   141,   142,   143,   144,
+      58,    59,    61,    63,    68,    69,    70,    71,    73,    74,
+      75,    76,    77,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    91,    92,    94,    96,    97,    98,    99,   100,
+     102,   111,   112,   113,   114,   116,   121,   127,   130,   131,
+     133,   135,   136,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162,   164,   165,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   165,
      166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
      176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   191,    19,   126,   191,    48,    97,
-     126,   126,     3,     4,     5,     6,     7,    59,    68,   111,
-     112,   138,   126,     3,     4,     5,     6,     7,    14,    70,
-      97,   110,   111,   112,   113,   115,   126,   129,   130,   138,
-     190,    70,   126,   191,   120,   126,   191,    97,    97,    97,
-      15,    27,    35,    42,    43,    44,    45,    46,    47,    49,
-      92,   102,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,    54,   126,   191,    70,    70,   191,    61,    63,    64,
-      65,    66,   191,    55,    77,    78,   126,   191,    70,    71,
-     103,   191,   191,    16,    17,   136,   136,   136,   126,   191,
-     191,   126,   126,    97,   126,    97,   126,    18,    33,    71,
-      88,    89,   126,   126,   191,    17,    48,    70,   103,   126,
-      70,    94,    70,   126,   126,   191,   191,    18,    20,    21,
-      22,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      36,    37,    38,    39,    40,    50,    51,    52,    53,    56,
-      57,    58,    68,    69,    73,    74,    75,    76,    79,    80,
-      81,    82,    83,    84,    86,    87,    90,    91,    93,    98,
-      99,   101,   126,   137,   191,   191,   191,   191,   191,   191,
-       0,   135,   126,   104,   105,   106,   107,   108,   109,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   128,   191,
-     126,    97,    97,   126,   127,   127,   127,   127,   127,   127,
-     136,   127,   127,   127,   190,   190,   190,   104,   105,   114,
-     115,   116,   117,   120,   121,   122,   128,    19,   126,    19,
-     126,   191,    19,   126,   126,   126,   126,   126,   126,   126,
-     163,   191,   163,   163,   163,   126,   126,   126,    70,   126,
-      70,   103,   126,   126,   191,   126,    70,   191,   115,   120,
-     191,   126,    97,   126,   126,   126,   126,   126,   126,   191,
-     126,   127,   126,   191,   126,   126,   126,   126,   191,   126,
-     126,   126,   126,   126,   126,   126,   126,   191,   126,   191,
-     191,   126,   126,   126,   100,   126,   126,   126,   191,    70,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     131,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     191,   191,   191,   191,   191,   191,   191,   126,   126,   126,
-     191,   191,   191,   191,   191,   191,   126,   191,   191,   191,
-     131,   190,   190,   190,   190,   190,   190,   190,   190,   190,
-     190,    70,    70,    19,   126,    70,   163,   163,   163,   163,
-     126,    70,   126,    70,   126,   126,   126,   191,   191,   191,
-     191,   126,   126,   191,    97,   126,   126,   126,   191,   126,
-     191,   126,   191,   126,   126,   126,   191,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,    19,   126,   126,   126,
-      70,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,    70,   126,   126
+     186,   187,   188,   189,   190,   191,   193,    19,   127,   193,
+      48,    98,   127,   127,     3,     4,     5,     6,     7,    60,
+      69,   112,   113,   139,   127,     3,     4,     5,     6,     7,
+      14,    71,    98,   111,   112,   113,   114,   116,   127,   130,
+     131,   139,   192,    71,   127,   193,   121,   127,   193,    98,
+      98,    98,    15,    27,    35,    42,    43,    44,    45,    46,
+      47,    49,    93,   103,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,    54,   127,   193,    71,   127,    71,   193,
+      62,    64,    65,    66,    67,   193,    55,    78,    79,   127,
+     193,    71,    72,   104,   193,   193,    16,    17,   137,   137,
+     137,   127,   193,   193,   127,   127,    98,   127,    98,   127,
+      18,    33,    72,    89,    90,   127,   127,   193,    17,    48,
+      71,   104,   127,    71,    95,    71,   127,   127,   193,   193,
+      18,    20,    21,    22,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    36,    37,    38,    39,    40,    50,    51,
+      52,    53,    56,    57,    58,    59,    69,    70,    74,    75,
+      76,    77,    80,    81,    82,    83,    84,    85,    87,    88,
+      91,    92,    94,    99,   100,   102,   127,   138,   193,   193,
+     193,   193,   193,   193,     0,   136,   127,   105,   106,   107,
+     108,   109,   110,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   129,   193,   127,    98,    98,   127,   128,   128,
+     128,   128,   128,   128,   137,   128,   128,   128,   192,   192,
+     192,   105,   106,   115,   116,   117,   118,   121,   122,   123,
+     129,    19,   127,    19,   127,   193,    19,   127,   127,   127,
+     127,   127,   127,   127,   164,   193,   164,   164,   164,   127,
+     127,   127,    71,   127,    71,   104,   127,   127,   193,   127,
+      71,   193,   116,   121,   193,   127,    98,   127,   127,   127,
+     127,   127,   127,   193,   127,   128,   127,   193,   127,   127,
+     127,   127,   193,   127,   127,   127,   127,   127,   127,   127,
+     127,   193,   127,   193,   193,   127,   127,   127,   101,   127,
+     127,   127,   193,    71,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   132,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   127,   127,   127,   193,   193,   193,   193,   193,
+     193,   127,   193,   193,   193,   132,   192,   192,   192,   192,
+     192,   192,   192,   192,   192,   192,    71,    71,    19,   127,
+      71,   164,   164,   164,   164,   127,    71,   127,    71,   127,
+     127,   127,   193,   193,   193,   193,   127,   127,   193,    98,
+     127,   127,   127,   193,   127,   193,   127,   193,   127,   127,
+     127,   193,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,    19,   127,   127,   127,    71,   127,   127,   127,   127,
+     127,   127,   127,   127,   127,   127,   127,   127,   127,   127,
+     127,    71,   127,   127
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,   133,   134,   134,   135,   135,   135,   135,   135,   135,
-     135,   135,   135,   135,   135,   135,   135,   135,   135,   135,
-     135,   135,   135,   135,   135,   135,   135,   135,   135,   135,
-     135,   135,   135,   135,   135,   135,   135,   135,   135,   135,
-     135,   135,   135,   135,   135,   135,   135,   135,   135,   135,
-     135,   135,   135,   135,   135,   135,   135,   136,   136,   137,
-     137,   138,   138,   138,   138,   138,   138,   139,   139,   140,
-     141,   142,   142,   142,   142,   142,   142,   143,   144,   145,
-     146,   147,   148,   149,   149,   150,   150,   151,   151,   151,
-     151,   151,   151,   151,   151,   151,   151,   151,   152,   152,
-     152,   152,   153,   154,   155,   155,   156,   156,   156,   156,
-     157,   158,   158,   158,   158,   158,   158,   158,   158,   158,
-     158,   159,   159,   159,   159,   159,   159,   159,   159,   159,
-     159,   159,   159,   159,   160,   161,   161,   162,   162,   162,
-     162,   162,   162,   162,   162,   162,   162,   162,   162,   162,
-     162,   162,   162,   162,   163,   163,   164,   165,   166,   167,
+       0,   134,   135,   135,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   137,   137,
+     138,   138,   139,   139,   139,   139,   139,   139,   140,   140,
+     141,   142,   143,   143,   143,   143,   143,   143,   144,   145,
+     146,   147,   148,   149,   150,   150,   151,   151,   152,   152,
+     152,   152,   152,   152,   152,   152,   152,   152,   152,   153,
+     153,   153,   153,   154,   155,   156,   156,   157,   157,   157,
+     157,   158,   159,   159,   159,   159,   159,   159,   159,   159,
+     159,   159,   160,   160,   160,   160,   160,   160,   160,   160,
+     160,   160,   160,   160,   160,   161,   162,   162,   163,   163,
+     163,   163,   163,   163,   163,   163,   163,   163,   163,   163,
+     163,   163,   163,   163,   163,   164,   164,   165,   166,   167,
      168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
-     177,   177,   177,   178,   179,   180,   181,   182,   182,   182,
-     182,   182,   183,   183,   183,   183,   183,   183,   183,   183,
-     184,   184,   184,   185,   186,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
-     187,   187,   188,   189,   190,   190,   190,   190,   190,   190,
-     190,   190,   190,   190,   190,   190,   190,   190,   190,   190,
-     190,   190,   190,   190,   190,   190,   190,   190,   190,   191,
-     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     191,   191,   191
+     178,   178,   178,   178,   179,   180,   181,   182,   183,   184,
+     184,   184,   184,   184,   185,   185,   185,   185,   185,   185,
+     185,   185,   186,   186,   186,   187,   188,   189,   189,   189,
+     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+     189,   189,   189,   189,   189,   190,   191,   192,   192,   192,
+     192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+     192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+     192,   192,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1868,32 +1862,32 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     3,     2,
-       2,     3,     3,     3,     3,     4,     2,     3,     3,     2,
-       3,     3,     3,     2,     3,     2,     3,     3,     3,     2,
-       4,     4,     4,     5,     5,     5,     2,     3,     3,     4,
-       4,     5,     2,     3,     2,     4,     2,     3,     4,     4,
-       2,     4,     5,     5,     5,     5,     5,     5,     5,     5,
-       5,     2,     5,     7,     2,     3,     5,     3,     5,     2,
-       3,     5,     4,     6,     2,     2,     3,     3,     3,     5,
-       5,     5,     5,     3,     3,     3,     3,     3,     4,     3,
-       4,     5,     4,     5,     0,     1,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     3,     3,     3,     2,     4,
-       3,     3,     2,     4,     5,     5,     3,     3,     4,     3,
-       3,     3,     2,     3,     4,     3,     4,     5,     3,     5,
-       3,     3,     3,     3,     4,     3,     3,     3,     3,     3,
+       1,     1,     1,     1,     1,     1,     0,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     3,
+       2,     2,     3,     3,     3,     3,     4,     2,     3,     3,
+       2,     3,     3,     3,     2,     3,     2,     3,     3,     3,
+       2,     4,     4,     4,     5,     5,     5,     2,     3,     3,
+       4,     4,     5,     2,     3,     2,     4,     2,     3,     4,
+       4,     2,     4,     5,     5,     5,     5,     5,     5,     5,
+       5,     5,     2,     5,     7,     2,     3,     5,     3,     5,
+       2,     3,     5,     4,     6,     2,     2,     3,     3,     3,
+       5,     5,     5,     5,     3,     3,     3,     3,     3,     4,
+       3,     4,     5,     4,     5,     0,     1,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     3,     3,     3,     2,
+       4,     3,     3,     2,     4,     2,     5,     5,     3,     3,
+       4,     3,     3,     3,     2,     3,     4,     3,     4,     5,
+       3,     5,     3,     3,     3,     3,     4,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     2,     3,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     2,     2,     3,     1,
+       3,     3,     3,     3,     2,     3,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     2,     2,
-       2,     2,     3
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     2,
+       2,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     2,     2,     2,     2,     3
 };
 
 
@@ -2356,1333 +2350,1342 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 54: /* command: expression  */
-#line 204 "parser.y"
+  case 55: /* command: expression  */
+#line 206 "parser.y"
                  { eval_value = (yyvsp[0].uval); }
-#line 2363 "y.tab.c"
+#line 2357 "y.tab.c"
     break;
 
-  case 56: /* command: '\n'  */
-#line 207 "parser.y"
+  case 57: /* command: '\n'  */
+#line 209 "parser.y"
       {
       }
-#line 2370 "y.tab.c"
+#line 2364 "y.tab.c"
     break;
 
-  case 58: /* BX_TOKEN_TOGGLE_ON_OFF: BX_TOKEN_OFF  */
-#line 214 "parser.y"
+  case 59: /* BX_TOKEN_TOGGLE_ON_OFF: BX_TOKEN_OFF  */
+#line 216 "parser.y"
     { (yyval.bval)=(yyvsp[0].bval); }
-#line 2376 "y.tab.c"
+#line 2370 "y.tab.c"
     break;
 
-  case 60: /* BX_TOKEN_REGISTERS: BX_TOKEN_REGS  */
-#line 220 "parser.y"
+  case 61: /* BX_TOKEN_REGISTERS: BX_TOKEN_REGS  */
+#line 222 "parser.y"
     { (yyval.sval)=(yyvsp[0].sval); }
-#line 2382 "y.tab.c"
+#line 2376 "y.tab.c"
     break;
 
-  case 66: /* BX_TOKEN_SEGREG: BX_TOKEN_GS  */
-#line 230 "parser.y"
+  case 67: /* BX_TOKEN_SEGREG: BX_TOKEN_GS  */
+#line 232 "parser.y"
     { (yyval.uval)=(yyvsp[0].uval); }
-#line 2388 "y.tab.c"
+#line 2382 "y.tab.c"
     break;
 
-  case 67: /* timebp_command: BX_TOKEN_TIMEBP expression '\n'  */
-#line 235 "parser.y"
+  case 68: /* timebp_command: BX_TOKEN_TIMEBP expression '\n'  */
+#line 237 "parser.y"
       {
           bx_dbg_timebp_command(0, (yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2397 "y.tab.c"
+#line 2391 "y.tab.c"
     break;
 
-  case 68: /* timebp_command: BX_TOKEN_TIMEBP_ABSOLUTE expression '\n'  */
-#line 240 "parser.y"
+  case 69: /* timebp_command: BX_TOKEN_TIMEBP_ABSOLUTE expression '\n'  */
+#line 242 "parser.y"
       {
           bx_dbg_timebp_command(1, (yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2406 "y.tab.c"
+#line 2400 "y.tab.c"
     break;
 
-  case 69: /* modebp_command: BX_TOKEN_MODEBP '\n'  */
-#line 248 "parser.y"
+  case 70: /* modebp_command: BX_TOKEN_MODEBP '\n'  */
+#line 250 "parser.y"
       {
           bx_dbg_modebp_command();
           free((yyvsp[-1].sval));
       }
-#line 2415 "y.tab.c"
+#line 2409 "y.tab.c"
     break;
 
-  case 70: /* vmexitbp_command: BX_TOKEN_VMEXITBP '\n'  */
-#line 256 "parser.y"
+  case 71: /* vmexitbp_command: BX_TOKEN_VMEXITBP '\n'  */
+#line 258 "parser.y"
       {
           bx_dbg_vmexitbp_command();
           free((yyvsp[-1].sval));
       }
-#line 2424 "y.tab.c"
+#line 2418 "y.tab.c"
     break;
 
-  case 71: /* show_command: BX_TOKEN_SHOW BX_TOKEN_GENERIC '\n'  */
-#line 264 "parser.y"
+  case 72: /* show_command: BX_TOKEN_SHOW BX_TOKEN_GENERIC '\n'  */
+#line 266 "parser.y"
       {
           bx_dbg_show_command((yyvsp[-1].sval));
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2433 "y.tab.c"
+#line 2427 "y.tab.c"
     break;
 
-  case 72: /* show_command: BX_TOKEN_SHOW BX_TOKEN_ALL '\n'  */
-#line 269 "parser.y"
+  case 73: /* show_command: BX_TOKEN_SHOW BX_TOKEN_ALL '\n'  */
+#line 271 "parser.y"
       {
           bx_dbg_show_command("all");
           free((yyvsp[-2].sval));
       }
-#line 2442 "y.tab.c"
+#line 2436 "y.tab.c"
     break;
 
-  case 73: /* show_command: BX_TOKEN_SHOW BX_TOKEN_OFF '\n'  */
-#line 274 "parser.y"
+  case 74: /* show_command: BX_TOKEN_SHOW BX_TOKEN_OFF '\n'  */
+#line 276 "parser.y"
       {
           bx_dbg_show_command("off");
           free((yyvsp[-2].sval));
       }
-#line 2451 "y.tab.c"
+#line 2445 "y.tab.c"
     break;
 
-  case 74: /* show_command: BX_TOKEN_SHOW BX_TOKEN_STRING '\n'  */
-#line 279 "parser.y"
+  case 75: /* show_command: BX_TOKEN_SHOW BX_TOKEN_STRING '\n'  */
+#line 281 "parser.y"
       {
           bx_dbg_show_param_command((yyvsp[-1].sval), 0);
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2460 "y.tab.c"
+#line 2454 "y.tab.c"
     break;
 
-  case 75: /* show_command: BX_TOKEN_SHOW BX_TOKEN_STRING BX_TOKEN_XML '\n'  */
-#line 284 "parser.y"
+  case 76: /* show_command: BX_TOKEN_SHOW BX_TOKEN_STRING BX_TOKEN_XML '\n'  */
+#line 286 "parser.y"
       {
           bx_dbg_show_param_command((yyvsp[-2].sval), 1);
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2469 "y.tab.c"
+#line 2463 "y.tab.c"
     break;
 
-  case 76: /* show_command: BX_TOKEN_SHOW '\n'  */
-#line 289 "parser.y"
+  case 77: /* show_command: BX_TOKEN_SHOW '\n'  */
+#line 291 "parser.y"
       {
           bx_dbg_show_command(0);
           free((yyvsp[-1].sval));
       }
-#line 2478 "y.tab.c"
+#line 2472 "y.tab.c"
     break;
 
-  case 77: /* page_command: BX_TOKEN_PAGE expression '\n'  */
-#line 297 "parser.y"
+  case 78: /* page_command: BX_TOKEN_PAGE expression '\n'  */
+#line 299 "parser.y"
       {
           bx_dbg_xlate_address((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2487 "y.tab.c"
+#line 2481 "y.tab.c"
     break;
 
-  case 78: /* tlb_command: BX_TOKEN_TLB expression '\n'  */
-#line 305 "parser.y"
+  case 79: /* tlb_command: BX_TOKEN_TLB expression '\n'  */
+#line 307 "parser.y"
       {
           bx_dbg_tlb_lookup((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2496 "y.tab.c"
+#line 2490 "y.tab.c"
     break;
 
-  case 79: /* ptime_command: BX_TOKEN_PTIME '\n'  */
-#line 313 "parser.y"
+  case 80: /* ptime_command: BX_TOKEN_PTIME '\n'  */
+#line 315 "parser.y"
       {
           bx_dbg_ptime_command();
           free((yyvsp[-1].sval));
       }
-#line 2505 "y.tab.c"
+#line 2499 "y.tab.c"
     break;
 
-  case 80: /* trace_command: BX_TOKEN_TRACE BX_TOKEN_TOGGLE_ON_OFF '\n'  */
-#line 321 "parser.y"
+  case 81: /* trace_command: BX_TOKEN_TRACE BX_TOKEN_TOGGLE_ON_OFF '\n'  */
+#line 323 "parser.y"
       {
           bx_dbg_trace_command((yyvsp[-1].bval));
           free((yyvsp[-2].sval));
       }
-#line 2514 "y.tab.c"
+#line 2508 "y.tab.c"
     break;
 
-  case 81: /* trace_reg_command: BX_TOKEN_TRACEREG BX_TOKEN_TOGGLE_ON_OFF '\n'  */
-#line 329 "parser.y"
+  case 82: /* trace_reg_command: BX_TOKEN_TRACEREG BX_TOKEN_TOGGLE_ON_OFF '\n'  */
+#line 331 "parser.y"
       {
           bx_dbg_trace_reg_command((yyvsp[-1].bval));
           free((yyvsp[-2].sval));
       }
-#line 2523 "y.tab.c"
+#line 2517 "y.tab.c"
     break;
 
-  case 82: /* trace_mem_command: BX_TOKEN_TRACEMEM BX_TOKEN_TOGGLE_ON_OFF '\n'  */
-#line 337 "parser.y"
+  case 83: /* trace_mem_command: BX_TOKEN_TRACEMEM BX_TOKEN_TOGGLE_ON_OFF '\n'  */
+#line 339 "parser.y"
       {
           bx_dbg_trace_mem_command((yyvsp[-1].bval));
           free((yyvsp[-2].sval));
       }
-#line 2532 "y.tab.c"
+#line 2526 "y.tab.c"
     break;
 
-  case 83: /* print_stack_command: BX_TOKEN_PRINT_STACK '\n'  */
-#line 345 "parser.y"
+  case 84: /* print_stack_command: BX_TOKEN_PRINT_STACK '\n'  */
+#line 347 "parser.y"
       {
           bx_dbg_print_stack_command(16);
           free((yyvsp[-1].sval));
       }
-#line 2541 "y.tab.c"
+#line 2535 "y.tab.c"
     break;
 
-  case 84: /* print_stack_command: BX_TOKEN_PRINT_STACK BX_TOKEN_NUMERIC '\n'  */
-#line 350 "parser.y"
+  case 85: /* print_stack_command: BX_TOKEN_PRINT_STACK BX_TOKEN_NUMERIC '\n'  */
+#line 352 "parser.y"
       {
           bx_dbg_print_stack_command((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2550 "y.tab.c"
+#line 2544 "y.tab.c"
     break;
 
-  case 85: /* backtrace_command: BX_TOKEN_BT '\n'  */
-#line 358 "parser.y"
+  case 86: /* backtrace_command: BX_TOKEN_BT '\n'  */
+#line 360 "parser.y"
       {
         bx_dbg_bt_command(16);
         free((yyvsp[-1].sval));
       }
-#line 2559 "y.tab.c"
+#line 2553 "y.tab.c"
     break;
 
-  case 86: /* backtrace_command: BX_TOKEN_BT BX_TOKEN_NUMERIC '\n'  */
-#line 363 "parser.y"
+  case 87: /* backtrace_command: BX_TOKEN_BT BX_TOKEN_NUMERIC '\n'  */
+#line 365 "parser.y"
       {
         bx_dbg_bt_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 2568 "y.tab.c"
+#line 2562 "y.tab.c"
     break;
 
-  case 87: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_STOP '\n'  */
-#line 371 "parser.y"
+  case 88: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_STOP '\n'  */
+#line 373 "parser.y"
       {
           bx_dbg_watchpoint_continue(0);
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2577 "y.tab.c"
+#line 2571 "y.tab.c"
     break;
 
-  case 88: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_CONTINUE '\n'  */
-#line 376 "parser.y"
+  case 89: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_CONTINUE '\n'  */
+#line 378 "parser.y"
       {
           bx_dbg_watchpoint_continue(1);
           free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2586 "y.tab.c"
+#line 2580 "y.tab.c"
     break;
 
-  case 89: /* watch_point_command: BX_TOKEN_WATCH '\n'  */
-#line 381 "parser.y"
+  case 90: /* watch_point_command: BX_TOKEN_WATCH '\n'  */
+#line 383 "parser.y"
       {
           bx_dbg_print_watchpoints();
           free((yyvsp[-1].sval));
       }
-#line 2595 "y.tab.c"
+#line 2589 "y.tab.c"
     break;
 
-  case 90: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_R expression '\n'  */
-#line 386 "parser.y"
+  case 91: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_R expression '\n'  */
+#line 388 "parser.y"
       {
           bx_dbg_watch(0, (yyvsp[-1].uval), 1); /* BX_READ */
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2604 "y.tab.c"
+#line 2598 "y.tab.c"
     break;
 
-  case 91: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_READ expression '\n'  */
-#line 391 "parser.y"
+  case 92: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_READ expression '\n'  */
+#line 393 "parser.y"
       {
           bx_dbg_watch(0, (yyvsp[-1].uval), 1); /* BX_READ */
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2613 "y.tab.c"
+#line 2607 "y.tab.c"
     break;
 
-  case 92: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_WRITE expression '\n'  */
-#line 396 "parser.y"
+  case 93: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_WRITE expression '\n'  */
+#line 398 "parser.y"
       {
           bx_dbg_watch(1, (yyvsp[-1].uval), 1); /* BX_WRITE */
           free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2622 "y.tab.c"
+#line 2616 "y.tab.c"
     break;
 
-  case 93: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_R expression expression '\n'  */
-#line 401 "parser.y"
+  case 94: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_R expression expression '\n'  */
+#line 403 "parser.y"
       {
           bx_dbg_watch(0, (yyvsp[-2].uval), (yyvsp[-1].uval)); /* BX_READ */
           free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2631 "y.tab.c"
+#line 2625 "y.tab.c"
     break;
 
-  case 94: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_READ expression expression '\n'  */
-#line 406 "parser.y"
+  case 95: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_READ expression expression '\n'  */
+#line 408 "parser.y"
       {
           bx_dbg_watch(0, (yyvsp[-2].uval), (yyvsp[-1].uval)); /* BX_READ */
           free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2640 "y.tab.c"
+#line 2634 "y.tab.c"
     break;
 
-  case 95: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_WRITE expression expression '\n'  */
-#line 411 "parser.y"
+  case 96: /* watch_point_command: BX_TOKEN_WATCH BX_TOKEN_WRITE expression expression '\n'  */
+#line 413 "parser.y"
       {
           bx_dbg_watch(1, (yyvsp[-2].uval), (yyvsp[-1].uval)); /* BX_WRITE */
           free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2649 "y.tab.c"
+#line 2643 "y.tab.c"
     break;
 
-  case 96: /* watch_point_command: BX_TOKEN_UNWATCH '\n'  */
-#line 416 "parser.y"
+  case 97: /* watch_point_command: BX_TOKEN_UNWATCH '\n'  */
+#line 418 "parser.y"
       {
           bx_dbg_unwatch_all();
           free((yyvsp[-1].sval));
       }
-#line 2658 "y.tab.c"
+#line 2652 "y.tab.c"
     break;
 
-  case 97: /* watch_point_command: BX_TOKEN_UNWATCH expression '\n'  */
-#line 421 "parser.y"
+  case 98: /* watch_point_command: BX_TOKEN_UNWATCH expression '\n'  */
+#line 423 "parser.y"
       {
           bx_dbg_unwatch((yyvsp[-1].uval));
           free((yyvsp[-2].sval));
       }
-#line 2667 "y.tab.c"
+#line 2661 "y.tab.c"
     break;
 
-  case 98: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_STRING '\n'  */
-#line 429 "parser.y"
+  case 99: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_STRING '\n'  */
+#line 431 "parser.y"
       {
         bx_dbg_symbol_command((yyvsp[-1].sval), 0, 0);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2676 "y.tab.c"
+#line 2670 "y.tab.c"
     break;
 
-  case 99: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_STRING expression '\n'  */
-#line 434 "parser.y"
+  case 100: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_STRING expression '\n'  */
+#line 436 "parser.y"
       {
         bx_dbg_symbol_command((yyvsp[-2].sval), 0, (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2685 "y.tab.c"
+#line 2679 "y.tab.c"
     break;
 
-  case 100: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_GLOBAL BX_TOKEN_STRING '\n'  */
-#line 439 "parser.y"
+  case 101: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_GLOBAL BX_TOKEN_STRING '\n'  */
+#line 441 "parser.y"
       {
         bx_dbg_symbol_command((yyvsp[-1].sval), 1, 0);
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2694 "y.tab.c"
+#line 2688 "y.tab.c"
     break;
 
-  case 101: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_GLOBAL BX_TOKEN_STRING expression '\n'  */
-#line 444 "parser.y"
+  case 102: /* symbol_command: BX_TOKEN_LOAD_SYMBOLS BX_TOKEN_GLOBAL BX_TOKEN_STRING expression '\n'  */
+#line 446 "parser.y"
       {
         bx_dbg_symbol_command((yyvsp[-2].sval), 1, (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2703 "y.tab.c"
+#line 2697 "y.tab.c"
     break;
 
-  case 102: /* where_command: BX_TOKEN_WHERE '\n'  */
-#line 452 "parser.y"
+  case 103: /* where_command: BX_TOKEN_WHERE '\n'  */
+#line 454 "parser.y"
       {
         bx_dbg_where_command();
         free((yyvsp[-1].sval));
       }
-#line 2712 "y.tab.c"
+#line 2706 "y.tab.c"
     break;
 
-  case 103: /* print_string_command: BX_TOKEN_PRINT_STRING expression '\n'  */
-#line 460 "parser.y"
+  case 104: /* print_string_command: BX_TOKEN_PRINT_STRING expression '\n'  */
+#line 462 "parser.y"
       {
         bx_dbg_print_string_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 2721 "y.tab.c"
+#line 2715 "y.tab.c"
     break;
 
-  case 104: /* continue_command: BX_TOKEN_CONTINUE '\n'  */
-#line 468 "parser.y"
+  case 105: /* continue_command: BX_TOKEN_CONTINUE '\n'  */
+#line 470 "parser.y"
       {
         bx_dbg_continue_command(1);
         free((yyvsp[-1].sval));
       }
-#line 2730 "y.tab.c"
+#line 2724 "y.tab.c"
     break;
 
-  case 105: /* continue_command: BX_TOKEN_CONTINUE BX_TOKEN_IF expression '\n'  */
-#line 473 "parser.y"
+  case 106: /* continue_command: BX_TOKEN_CONTINUE BX_TOKEN_IF expression '\n'  */
+#line 475 "parser.y"
       {
         bx_dbg_continue_command((yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2739 "y.tab.c"
+#line 2733 "y.tab.c"
     break;
 
-  case 106: /* stepN_command: BX_TOKEN_STEPN '\n'  */
-#line 481 "parser.y"
+  case 107: /* stepN_command: BX_TOKEN_STEPN '\n'  */
+#line 483 "parser.y"
       {
         bx_dbg_stepN_command(dbg_cpu, 1);
         free((yyvsp[-1].sval));
       }
-#line 2748 "y.tab.c"
+#line 2742 "y.tab.c"
     break;
 
-  case 107: /* stepN_command: BX_TOKEN_STEPN BX_TOKEN_NUMERIC '\n'  */
-#line 486 "parser.y"
+  case 108: /* stepN_command: BX_TOKEN_STEPN BX_TOKEN_NUMERIC '\n'  */
+#line 488 "parser.y"
       {
         bx_dbg_stepN_command(dbg_cpu, (yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 2757 "y.tab.c"
+#line 2751 "y.tab.c"
     break;
 
-  case 108: /* stepN_command: BX_TOKEN_STEPN BX_TOKEN_ALL BX_TOKEN_NUMERIC '\n'  */
-#line 491 "parser.y"
+  case 109: /* stepN_command: BX_TOKEN_STEPN BX_TOKEN_ALL BX_TOKEN_NUMERIC '\n'  */
+#line 493 "parser.y"
       {
         bx_dbg_stepN_command(-1, (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2766 "y.tab.c"
+#line 2760 "y.tab.c"
     break;
 
-  case 109: /* stepN_command: BX_TOKEN_STEPN BX_TOKEN_NUMERIC BX_TOKEN_NUMERIC '\n'  */
-#line 496 "parser.y"
+  case 110: /* stepN_command: BX_TOKEN_STEPN BX_TOKEN_NUMERIC BX_TOKEN_NUMERIC '\n'  */
+#line 498 "parser.y"
       {
         bx_dbg_stepN_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval));
       }
-#line 2775 "y.tab.c"
+#line 2769 "y.tab.c"
     break;
 
-  case 110: /* step_over_command: BX_TOKEN_STEP_OVER '\n'  */
-#line 504 "parser.y"
+  case 111: /* step_over_command: BX_TOKEN_STEP_OVER '\n'  */
+#line 506 "parser.y"
       {
         bx_dbg_step_over_command();
         free((yyvsp[-1].sval));
       }
-#line 2784 "y.tab.c"
+#line 2778 "y.tab.c"
     break;
 
-  case 111: /* set_command: BX_TOKEN_SET BX_TOKEN_DISASM BX_TOKEN_TOGGLE_ON_OFF '\n'  */
-#line 512 "parser.y"
+  case 112: /* set_command: BX_TOKEN_SET BX_TOKEN_DISASM BX_TOKEN_TOGGLE_ON_OFF '\n'  */
+#line 514 "parser.y"
       {
         bx_dbg_set_auto_disassemble((yyvsp[-1].bval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 2793 "y.tab.c"
+#line 2787 "y.tab.c"
     break;
 
-  case 112: /* set_command: BX_TOKEN_SET BX_TOKEN_SYMBOLNAME '=' expression '\n'  */
-#line 517 "parser.y"
+  case 113: /* set_command: BX_TOKEN_SET BX_TOKEN_SYMBOLNAME '=' expression '\n'  */
+#line 519 "parser.y"
       {
         bx_dbg_set_symbol_command((yyvsp[-3].sval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 2802 "y.tab.c"
+#line 2796 "y.tab.c"
     break;
 
-  case 113: /* set_command: BX_TOKEN_SET BX_TOKEN_8BL_REG '=' expression '\n'  */
-#line 522 "parser.y"
+  case 114: /* set_command: BX_TOKEN_SET BX_TOKEN_8BL_REG '=' expression '\n'  */
+#line 524 "parser.y"
       { 
         bx_dbg_set_reg8l_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2810 "y.tab.c"
+#line 2804 "y.tab.c"
     break;
 
-  case 114: /* set_command: BX_TOKEN_SET BX_TOKEN_8BH_REG '=' expression '\n'  */
-#line 526 "parser.y"
+  case 115: /* set_command: BX_TOKEN_SET BX_TOKEN_8BH_REG '=' expression '\n'  */
+#line 528 "parser.y"
       { 
         bx_dbg_set_reg8h_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2818 "y.tab.c"
+#line 2812 "y.tab.c"
     break;
 
-  case 115: /* set_command: BX_TOKEN_SET BX_TOKEN_16B_REG '=' expression '\n'  */
-#line 530 "parser.y"
+  case 116: /* set_command: BX_TOKEN_SET BX_TOKEN_16B_REG '=' expression '\n'  */
+#line 532 "parser.y"
       { 
         bx_dbg_set_reg16_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2826 "y.tab.c"
+#line 2820 "y.tab.c"
     break;
 
-  case 116: /* set_command: BX_TOKEN_SET BX_TOKEN_32B_REG '=' expression '\n'  */
-#line 534 "parser.y"
+  case 117: /* set_command: BX_TOKEN_SET BX_TOKEN_32B_REG '=' expression '\n'  */
+#line 536 "parser.y"
       { 
         bx_dbg_set_reg32_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2834 "y.tab.c"
+#line 2828 "y.tab.c"
     break;
 
-  case 117: /* set_command: BX_TOKEN_SET BX_TOKEN_64B_REG '=' expression '\n'  */
-#line 538 "parser.y"
+  case 118: /* set_command: BX_TOKEN_SET BX_TOKEN_64B_REG '=' expression '\n'  */
+#line 540 "parser.y"
       { 
         bx_dbg_set_reg64_value((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2842 "y.tab.c"
+#line 2836 "y.tab.c"
     break;
 
-  case 118: /* set_command: BX_TOKEN_SET BX_TOKEN_REG_EIP '=' expression '\n'  */
-#line 542 "parser.y"
+  case 119: /* set_command: BX_TOKEN_SET BX_TOKEN_REG_EIP '=' expression '\n'  */
+#line 544 "parser.y"
       { 
         bx_dbg_set_rip_value((yyvsp[-1].uval));
       }
-#line 2850 "y.tab.c"
+#line 2844 "y.tab.c"
     break;
 
-  case 119: /* set_command: BX_TOKEN_SET BX_TOKEN_REG_RIP '=' expression '\n'  */
-#line 546 "parser.y"
+  case 120: /* set_command: BX_TOKEN_SET BX_TOKEN_REG_RIP '=' expression '\n'  */
+#line 548 "parser.y"
       { 
         bx_dbg_set_rip_value((yyvsp[-1].uval));
       }
-#line 2858 "y.tab.c"
+#line 2852 "y.tab.c"
     break;
 
-  case 120: /* set_command: BX_TOKEN_SET BX_TOKEN_SEGREG '=' expression '\n'  */
-#line 550 "parser.y"
+  case 121: /* set_command: BX_TOKEN_SET BX_TOKEN_SEGREG '=' expression '\n'  */
+#line 552 "parser.y"
       { 
         bx_dbg_load_segreg((yyvsp[-3].uval), (yyvsp[-1].uval));
       }
-#line 2866 "y.tab.c"
+#line 2860 "y.tab.c"
     break;
 
-  case 121: /* breakpoint_command: BX_TOKEN_VBREAKPOINT '\n'  */
-#line 557 "parser.y"
+  case 122: /* breakpoint_command: BX_TOKEN_VBREAKPOINT '\n'  */
+#line 559 "parser.y"
       {
         bx_dbg_vbreakpoint_command(bkAtIP, 0, 0, NULL);
         free((yyvsp[-1].sval));
       }
-#line 2875 "y.tab.c"
+#line 2869 "y.tab.c"
     break;
 
-  case 122: /* breakpoint_command: BX_TOKEN_VBREAKPOINT vexpression ':' vexpression '\n'  */
-#line 562 "parser.y"
+  case 123: /* breakpoint_command: BX_TOKEN_VBREAKPOINT vexpression ':' vexpression '\n'  */
+#line 564 "parser.y"
       {
         bx_dbg_vbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].uval), NULL);
         free((yyvsp[-4].sval));
       }
-#line 2884 "y.tab.c"
+#line 2878 "y.tab.c"
     break;
 
-  case 123: /* breakpoint_command: BX_TOKEN_VBREAKPOINT vexpression ':' vexpression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
-#line 567 "parser.y"
+  case 124: /* breakpoint_command: BX_TOKEN_VBREAKPOINT vexpression ':' vexpression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
+#line 569 "parser.y"
       {
         bx_dbg_vbreakpoint_command(bkRegular, (yyvsp[-5].uval), (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-6].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2893 "y.tab.c"
+#line 2887 "y.tab.c"
     break;
 
-  case 124: /* breakpoint_command: BX_TOKEN_LBREAKPOINT '\n'  */
-#line 572 "parser.y"
+  case 125: /* breakpoint_command: BX_TOKEN_LBREAKPOINT '\n'  */
+#line 574 "parser.y"
       {
         bx_dbg_lbreakpoint_command(bkAtIP, 0, NULL);
         free((yyvsp[-1].sval));
       }
-#line 2902 "y.tab.c"
+#line 2896 "y.tab.c"
     break;
 
-  case 125: /* breakpoint_command: BX_TOKEN_LBREAKPOINT expression '\n'  */
-#line 577 "parser.y"
+  case 126: /* breakpoint_command: BX_TOKEN_LBREAKPOINT expression '\n'  */
+#line 579 "parser.y"
       {
         bx_dbg_lbreakpoint_command(bkRegular, (yyvsp[-1].uval), NULL);
         free((yyvsp[-2].sval));
       }
-#line 2911 "y.tab.c"
+#line 2905 "y.tab.c"
     break;
 
-  case 126: /* breakpoint_command: BX_TOKEN_LBREAKPOINT expression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
-#line 582 "parser.y"
+  case 127: /* breakpoint_command: BX_TOKEN_LBREAKPOINT expression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
+#line 584 "parser.y"
       {
         bx_dbg_lbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2920 "y.tab.c"
+#line 2914 "y.tab.c"
     break;
 
-  case 127: /* breakpoint_command: BX_TOKEN_LBREAKPOINT BX_TOKEN_STRING '\n'  */
-#line 587 "parser.y"
+  case 128: /* breakpoint_command: BX_TOKEN_LBREAKPOINT BX_TOKEN_STRING '\n'  */
+#line 589 "parser.y"
       {
         bx_dbg_lbreakpoint_symbol_command((yyvsp[-1].sval), NULL);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2929 "y.tab.c"
+#line 2923 "y.tab.c"
     break;
 
-  case 128: /* breakpoint_command: BX_TOKEN_LBREAKPOINT BX_TOKEN_STRING BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
-#line 592 "parser.y"
+  case 129: /* breakpoint_command: BX_TOKEN_LBREAKPOINT BX_TOKEN_STRING BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
+#line 594 "parser.y"
       {
         bx_dbg_lbreakpoint_symbol_command((yyvsp[-3].sval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2938 "y.tab.c"
+#line 2932 "y.tab.c"
     break;
 
-  case 129: /* breakpoint_command: BX_TOKEN_PBREAKPOINT '\n'  */
-#line 597 "parser.y"
+  case 130: /* breakpoint_command: BX_TOKEN_PBREAKPOINT '\n'  */
+#line 599 "parser.y"
       {
         bx_dbg_pbreakpoint_command(bkAtIP, 0, NULL);
         free((yyvsp[-1].sval));
       }
-#line 2947 "y.tab.c"
+#line 2941 "y.tab.c"
     break;
 
-  case 130: /* breakpoint_command: BX_TOKEN_PBREAKPOINT expression '\n'  */
-#line 602 "parser.y"
+  case 131: /* breakpoint_command: BX_TOKEN_PBREAKPOINT expression '\n'  */
+#line 604 "parser.y"
       {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-1].uval), NULL);
         free((yyvsp[-2].sval));
       }
-#line 2956 "y.tab.c"
+#line 2950 "y.tab.c"
     break;
 
-  case 131: /* breakpoint_command: BX_TOKEN_PBREAKPOINT expression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
-#line 607 "parser.y"
+  case 132: /* breakpoint_command: BX_TOKEN_PBREAKPOINT expression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
+#line 609 "parser.y"
       {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2965 "y.tab.c"
+#line 2959 "y.tab.c"
     break;
 
-  case 132: /* breakpoint_command: BX_TOKEN_PBREAKPOINT '*' expression '\n'  */
-#line 612 "parser.y"
+  case 133: /* breakpoint_command: BX_TOKEN_PBREAKPOINT '*' expression '\n'  */
+#line 614 "parser.y"
       {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-1].uval), NULL);
         free((yyvsp[-3].sval));
       }
-#line 2974 "y.tab.c"
+#line 2968 "y.tab.c"
     break;
 
-  case 133: /* breakpoint_command: BX_TOKEN_PBREAKPOINT '*' expression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
-#line 617 "parser.y"
+  case 134: /* breakpoint_command: BX_TOKEN_PBREAKPOINT '*' expression BX_TOKEN_IF BX_TOKEN_STRING '\n'  */
+#line 619 "parser.y"
       {
         bx_dbg_pbreakpoint_command(bkRegular, (yyvsp[-3].uval), (yyvsp[-1].sval));
         free((yyvsp[-5].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 2983 "y.tab.c"
+#line 2977 "y.tab.c"
     break;
 
-  case 134: /* blist_command: BX_TOKEN_LIST_BREAK '\n'  */
-#line 625 "parser.y"
+  case 135: /* blist_command: BX_TOKEN_LIST_BREAK '\n'  */
+#line 627 "parser.y"
       {
         bx_dbg_info_bpoints_command();
         free((yyvsp[-1].sval));
       }
-#line 2992 "y.tab.c"
+#line 2986 "y.tab.c"
     break;
 
-  case 135: /* slist_command: BX_TOKEN_LIST_SYMBOLS '\n'  */
-#line 633 "parser.y"
+  case 136: /* slist_command: BX_TOKEN_LIST_SYMBOLS '\n'  */
+#line 635 "parser.y"
       {
         bx_dbg_info_symbols_command(0);
         free((yyvsp[-1].sval));
       }
-#line 3001 "y.tab.c"
+#line 2995 "y.tab.c"
     break;
 
-  case 136: /* slist_command: BX_TOKEN_LIST_SYMBOLS BX_TOKEN_STRING '\n'  */
-#line 638 "parser.y"
+  case 137: /* slist_command: BX_TOKEN_LIST_SYMBOLS BX_TOKEN_STRING '\n'  */
+#line 640 "parser.y"
       {
         bx_dbg_info_symbols_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval));free((yyvsp[-1].sval));
       }
-#line 3010 "y.tab.c"
+#line 3004 "y.tab.c"
     break;
 
-  case 137: /* info_command: BX_TOKEN_INFO BX_TOKEN_PBREAKPOINT '\n'  */
-#line 646 "parser.y"
+  case 138: /* info_command: BX_TOKEN_INFO BX_TOKEN_PBREAKPOINT '\n'  */
+#line 648 "parser.y"
       {
         bx_dbg_info_bpoints_command();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3019 "y.tab.c"
+#line 3013 "y.tab.c"
     break;
 
-  case 138: /* info_command: BX_TOKEN_INFO BX_TOKEN_CPU '\n'  */
-#line 651 "parser.y"
+  case 139: /* info_command: BX_TOKEN_INFO BX_TOKEN_CPU '\n'  */
+#line 653 "parser.y"
       {
         bx_dbg_info_registers_command(-1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3028 "y.tab.c"
+#line 3022 "y.tab.c"
     break;
 
-  case 139: /* info_command: BX_TOKEN_INFO BX_TOKEN_IDT optional_numeric optional_numeric '\n'  */
-#line 656 "parser.y"
+  case 140: /* info_command: BX_TOKEN_INFO BX_TOKEN_IDT optional_numeric optional_numeric '\n'  */
+#line 658 "parser.y"
       {
         bx_dbg_info_idt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3037 "y.tab.c"
+#line 3031 "y.tab.c"
     break;
 
-  case 140: /* info_command: BX_TOKEN_INFO BX_TOKEN_IVT optional_numeric optional_numeric '\n'  */
-#line 661 "parser.y"
+  case 141: /* info_command: BX_TOKEN_INFO BX_TOKEN_IVT optional_numeric optional_numeric '\n'  */
+#line 663 "parser.y"
       {
         bx_dbg_info_ivt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3046 "y.tab.c"
+#line 3040 "y.tab.c"
     break;
 
-  case 141: /* info_command: BX_TOKEN_INFO BX_TOKEN_GDT optional_numeric optional_numeric '\n'  */
-#line 666 "parser.y"
+  case 142: /* info_command: BX_TOKEN_INFO BX_TOKEN_GDT optional_numeric optional_numeric '\n'  */
+#line 668 "parser.y"
       {
         bx_dbg_info_gdt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3055 "y.tab.c"
+#line 3049 "y.tab.c"
     break;
 
-  case 142: /* info_command: BX_TOKEN_INFO BX_TOKEN_LDT optional_numeric optional_numeric '\n'  */
-#line 671 "parser.y"
+  case 143: /* info_command: BX_TOKEN_INFO BX_TOKEN_LDT optional_numeric optional_numeric '\n'  */
+#line 673 "parser.y"
       {
         bx_dbg_info_ldt_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3064 "y.tab.c"
+#line 3058 "y.tab.c"
     break;
 
-  case 143: /* info_command: BX_TOKEN_INFO BX_TOKEN_TAB '\n'  */
-#line 676 "parser.y"
+  case 144: /* info_command: BX_TOKEN_INFO BX_TOKEN_TAB '\n'  */
+#line 678 "parser.y"
       {
         bx_dbg_dump_table();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3073 "y.tab.c"
+#line 3067 "y.tab.c"
     break;
 
-  case 144: /* info_command: BX_TOKEN_INFO BX_TOKEN_TSS '\n'  */
-#line 681 "parser.y"
+  case 145: /* info_command: BX_TOKEN_INFO BX_TOKEN_TSS '\n'  */
+#line 683 "parser.y"
       {
         bx_dbg_info_tss_command();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3082 "y.tab.c"
+#line 3076 "y.tab.c"
     break;
 
-  case 145: /* info_command: BX_TOKEN_INFO BX_TOKEN_FLAGS '\n'  */
-#line 686 "parser.y"
+  case 146: /* info_command: BX_TOKEN_INFO BX_TOKEN_FLAGS '\n'  */
+#line 688 "parser.y"
       {
         bx_dbg_info_flags();
         free((yyvsp[-2].sval));
       }
-#line 3091 "y.tab.c"
+#line 3085 "y.tab.c"
     break;
 
-  case 146: /* info_command: BX_TOKEN_INFO BX_TOKEN_LINUX '\n'  */
-#line 691 "parser.y"
+  case 147: /* info_command: BX_TOKEN_INFO BX_TOKEN_LINUX '\n'  */
+#line 693 "parser.y"
       {
         bx_dbg_info_linux_command();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3100 "y.tab.c"
+#line 3094 "y.tab.c"
     break;
 
-  case 147: /* info_command: BX_TOKEN_INFO BX_TOKEN_SYMBOLS '\n'  */
-#line 696 "parser.y"
+  case 148: /* info_command: BX_TOKEN_INFO BX_TOKEN_SYMBOLS '\n'  */
+#line 698 "parser.y"
       {
         bx_dbg_info_symbols_command(0);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3109 "y.tab.c"
+#line 3103 "y.tab.c"
     break;
 
-  case 148: /* info_command: BX_TOKEN_INFO BX_TOKEN_SYMBOLS BX_TOKEN_STRING '\n'  */
-#line 701 "parser.y"
+  case 149: /* info_command: BX_TOKEN_INFO BX_TOKEN_SYMBOLS BX_TOKEN_STRING '\n'  */
+#line 703 "parser.y"
       {
         bx_dbg_info_symbols_command((yyvsp[-1].sval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3118 "y.tab.c"
+#line 3112 "y.tab.c"
     break;
 
-  case 149: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE '\n'  */
-#line 706 "parser.y"
+  case 150: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE '\n'  */
+#line 708 "parser.y"
       {
         bx_dbg_info_device("", "");
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3127 "y.tab.c"
+#line 3121 "y.tab.c"
     break;
 
-  case 150: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_GENERIC '\n'  */
-#line 711 "parser.y"
+  case 151: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_GENERIC '\n'  */
+#line 713 "parser.y"
       {
         bx_dbg_info_device((yyvsp[-1].sval), "");
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3136 "y.tab.c"
+#line 3130 "y.tab.c"
     break;
 
-  case 151: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_GENERIC BX_TOKEN_STRING '\n'  */
-#line 716 "parser.y"
+  case 152: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_GENERIC BX_TOKEN_STRING '\n'  */
+#line 718 "parser.y"
       {
         bx_dbg_info_device((yyvsp[-2].sval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3145 "y.tab.c"
+#line 3139 "y.tab.c"
     break;
 
-  case 152: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_STRING '\n'  */
-#line 721 "parser.y"
+  case 153: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_STRING '\n'  */
+#line 723 "parser.y"
       {
         bx_dbg_info_device((yyvsp[-1].sval), "");
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3154 "y.tab.c"
+#line 3148 "y.tab.c"
     break;
 
-  case 153: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_STRING BX_TOKEN_STRING '\n'  */
-#line 726 "parser.y"
+  case 154: /* info_command: BX_TOKEN_INFO BX_TOKEN_DEVICE BX_TOKEN_STRING BX_TOKEN_STRING '\n'  */
+#line 728 "parser.y"
       {
         bx_dbg_info_device((yyvsp[-2].sval), (yyvsp[-1].sval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3163 "y.tab.c"
+#line 3157 "y.tab.c"
     break;
 
-  case 154: /* optional_numeric: %empty  */
-#line 733 "parser.y"
+  case 155: /* optional_numeric: %empty  */
+#line 735 "parser.y"
                { (yyval.uval) = EMPTY_ARG; }
-#line 3169 "y.tab.c"
+#line 3163 "y.tab.c"
     break;
 
-  case 156: /* regs_command: BX_TOKEN_REGISTERS '\n'  */
-#line 738 "parser.y"
+  case 157: /* regs_command: BX_TOKEN_REGISTERS '\n'  */
+#line 740 "parser.y"
       {
         bx_dbg_info_registers_command(BX_INFO_GENERAL_PURPOSE_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3178 "y.tab.c"
+#line 3172 "y.tab.c"
     break;
 
-  case 157: /* fpu_regs_command: BX_TOKEN_FPU '\n'  */
-#line 746 "parser.y"
+  case 158: /* fpu_regs_command: BX_TOKEN_FPU '\n'  */
+#line 748 "parser.y"
       {
         bx_dbg_info_registers_command(BX_INFO_FPU_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3187 "y.tab.c"
+#line 3181 "y.tab.c"
     break;
 
-  case 158: /* mmx_regs_command: BX_TOKEN_MMX '\n'  */
-#line 754 "parser.y"
+  case 159: /* mmx_regs_command: BX_TOKEN_MMX '\n'  */
+#line 756 "parser.y"
       {
         bx_dbg_info_registers_command(BX_INFO_MMX_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3196 "y.tab.c"
+#line 3190 "y.tab.c"
     break;
 
-  case 159: /* xmm_regs_command: BX_TOKEN_XMM '\n'  */
-#line 762 "parser.y"
+  case 160: /* xmm_regs_command: BX_TOKEN_XMM '\n'  */
+#line 764 "parser.y"
       {
         bx_dbg_info_registers_command(BX_INFO_SSE_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3205 "y.tab.c"
+#line 3199 "y.tab.c"
     break;
 
-  case 160: /* ymm_regs_command: BX_TOKEN_YMM '\n'  */
-#line 770 "parser.y"
+  case 161: /* ymm_regs_command: BX_TOKEN_YMM '\n'  */
+#line 772 "parser.y"
       {
         bx_dbg_info_registers_command(BX_INFO_YMM_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3214 "y.tab.c"
+#line 3208 "y.tab.c"
     break;
 
-  case 161: /* zmm_regs_command: BX_TOKEN_ZMM '\n'  */
-#line 778 "parser.y"
+  case 162: /* zmm_regs_command: BX_TOKEN_ZMM '\n'  */
+#line 780 "parser.y"
       {
         bx_dbg_info_registers_command(BX_INFO_ZMM_REGS);
         free((yyvsp[-1].sval));
       }
-#line 3223 "y.tab.c"
+#line 3217 "y.tab.c"
     break;
 
-  case 162: /* segment_regs_command: BX_TOKEN_SEGMENT_REGS '\n'  */
-#line 786 "parser.y"
+  case 163: /* segment_regs_command: BX_TOKEN_SEGMENT_REGS '\n'  */
+#line 788 "parser.y"
       {
         bx_dbg_info_segment_regs_command();
         free((yyvsp[-1].sval));
       }
-#line 3232 "y.tab.c"
+#line 3226 "y.tab.c"
     break;
 
-  case 163: /* control_regs_command: BX_TOKEN_CONTROL_REGS '\n'  */
-#line 794 "parser.y"
+  case 164: /* control_regs_command: BX_TOKEN_CONTROL_REGS '\n'  */
+#line 796 "parser.y"
       {
         bx_dbg_info_control_regs_command();
         free((yyvsp[-1].sval));
       }
-#line 3241 "y.tab.c"
+#line 3235 "y.tab.c"
     break;
 
-  case 164: /* debug_regs_command: BX_TOKEN_DEBUG_REGS '\n'  */
-#line 802 "parser.y"
+  case 165: /* debug_regs_command: BX_TOKEN_DEBUG_REGS '\n'  */
+#line 804 "parser.y"
       {
         bx_dbg_info_debug_regs_command();
         free((yyvsp[-1].sval));
       }
-#line 3250 "y.tab.c"
+#line 3244 "y.tab.c"
     break;
 
-  case 165: /* delete_command: BX_TOKEN_DEL_BREAKPOINT BX_TOKEN_NUMERIC '\n'  */
-#line 810 "parser.y"
+  case 166: /* delete_command: BX_TOKEN_DEL_BREAKPOINT BX_TOKEN_NUMERIC '\n'  */
+#line 812 "parser.y"
       {
         bx_dbg_del_breakpoint_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 3259 "y.tab.c"
+#line 3253 "y.tab.c"
     break;
 
-  case 166: /* bpe_command: BX_TOKEN_ENABLE_BREAKPOINT BX_TOKEN_NUMERIC '\n'  */
-#line 818 "parser.y"
+  case 167: /* bpe_command: BX_TOKEN_ENABLE_BREAKPOINT BX_TOKEN_NUMERIC '\n'  */
+#line 820 "parser.y"
       {
         bx_dbg_en_dis_breakpoint_command((yyvsp[-1].uval), 1);
         free((yyvsp[-2].sval));
       }
-#line 3268 "y.tab.c"
+#line 3262 "y.tab.c"
     break;
 
-  case 167: /* bpd_command: BX_TOKEN_DISABLE_BREAKPOINT BX_TOKEN_NUMERIC '\n'  */
-#line 825 "parser.y"
+  case 168: /* bpd_command: BX_TOKEN_DISABLE_BREAKPOINT BX_TOKEN_NUMERIC '\n'  */
+#line 827 "parser.y"
       {
         bx_dbg_en_dis_breakpoint_command((yyvsp[-1].uval), 0);
         free((yyvsp[-2].sval));
       }
-#line 3277 "y.tab.c"
+#line 3271 "y.tab.c"
     break;
 
-  case 168: /* quit_command: BX_TOKEN_QUIT '\n'  */
-#line 833 "parser.y"
+  case 169: /* quit_command: BX_TOKEN_QUIT '\n'  */
+#line 835 "parser.y"
       {
         bx_dbg_quit_command();
         free((yyvsp[-1].sval));
       }
-#line 3286 "y.tab.c"
+#line 3280 "y.tab.c"
     break;
 
-  case 169: /* examine_command: BX_TOKEN_EXAMINE BX_TOKEN_XFORMAT expression '\n'  */
-#line 841 "parser.y"
+  case 170: /* examine_command: BX_TOKEN_EXAMINE BX_TOKEN_XFORMAT expression '\n'  */
+#line 843 "parser.y"
       {
         bx_dbg_examine_command((yyvsp[-3].sval), (yyvsp[-2].sval),1, (yyvsp[-1].uval), 1);
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3295 "y.tab.c"
+#line 3289 "y.tab.c"
     break;
 
-  case 170: /* examine_command: BX_TOKEN_EXAMINE BX_TOKEN_XFORMAT '\n'  */
-#line 846 "parser.y"
+  case 171: /* examine_command: BX_TOKEN_EXAMINE BX_TOKEN_XFORMAT '\n'  */
+#line 848 "parser.y"
       {
         bx_dbg_examine_command((yyvsp[-2].sval), (yyvsp[-1].sval),1, 0, 0);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3304 "y.tab.c"
+#line 3298 "y.tab.c"
     break;
 
-  case 171: /* examine_command: BX_TOKEN_EXAMINE expression '\n'  */
-#line 851 "parser.y"
+  case 172: /* examine_command: BX_TOKEN_EXAMINE expression '\n'  */
+#line 853 "parser.y"
       {
         bx_dbg_examine_command((yyvsp[-2].sval), NULL,0, (yyvsp[-1].uval), 1);
         free((yyvsp[-2].sval));
       }
-#line 3313 "y.tab.c"
+#line 3307 "y.tab.c"
     break;
 
-  case 172: /* examine_command: BX_TOKEN_EXAMINE '\n'  */
-#line 856 "parser.y"
+  case 173: /* examine_command: BX_TOKEN_EXAMINE '\n'  */
+#line 858 "parser.y"
       {
         bx_dbg_examine_command((yyvsp[-1].sval), NULL,0, 0, 0);
         free((yyvsp[-1].sval));
       }
-#line 3322 "y.tab.c"
+#line 3316 "y.tab.c"
     break;
 
-  case 173: /* restore_command: BX_TOKEN_RESTORE BX_TOKEN_STRING BX_TOKEN_STRING '\n'  */
-#line 864 "parser.y"
+  case 174: /* restore_command: BX_TOKEN_RESTORE BX_TOKEN_STRING BX_TOKEN_STRING '\n'  */
+#line 866 "parser.y"
       {
         bx_dbg_restore_command((yyvsp[-2].sval), (yyvsp[-1].sval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3331 "y.tab.c"
+#line 3325 "y.tab.c"
+    break;
+
+  case 175: /* fork_command: BX_TOKEN_FORK '\n'  */
+#line 874 "parser.y"
+      {
+        bx_dbg_fork_command();
+        free((yyvsp[-1].sval));
+      }
+#line 3334 "y.tab.c"
     break;
 
-  case 174: /* writemem_command: BX_TOKEN_WRITEMEM BX_TOKEN_STRING expression expression '\n'  */
-#line 872 "parser.y"
+  case 176: /* writemem_command: BX_TOKEN_WRITEMEM BX_TOKEN_STRING expression expression '\n'  */
+#line 882 "parser.y"
       {
         bx_dbg_writemem_command((yyvsp[-3].sval), (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3340 "y.tab.c"
+#line 3343 "y.tab.c"
     break;
 
-  case 175: /* setpmem_command: BX_TOKEN_SETPMEM expression expression expression '\n'  */
-#line 880 "parser.y"
+  case 177: /* setpmem_command: BX_TOKEN_SETPMEM expression expression expression '\n'  */
+#line 890 "parser.y"
       {
         bx_dbg_setpmem_command((yyvsp[-3].uval), (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval));
       }
-#line 3349 "y.tab.c"
+#line 3352 "y.tab.c"
     break;
 
-  case 176: /* query_command: BX_TOKEN_QUERY BX_TOKEN_PENDING '\n'  */
-#line 888 "parser.y"
+  case 178: /* query_command: BX_TOKEN_QUERY BX_TOKEN_PENDING '\n'  */
+#line 898 "parser.y"
       {
         bx_dbg_query_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3358 "y.tab.c"
+#line 3361 "y.tab.c"
     break;
 
-  case 177: /* take_command: BX_TOKEN_TAKE BX_TOKEN_DMA '\n'  */
-#line 896 "parser.y"
+  case 179: /* take_command: BX_TOKEN_TAKE BX_TOKEN_DMA '\n'  */
+#line 906 "parser.y"
       {
         bx_dbg_take_command((yyvsp[-1].sval), 1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3367 "y.tab.c"
+#line 3370 "y.tab.c"
     break;
 
-  case 178: /* take_command: BX_TOKEN_TAKE BX_TOKEN_DMA BX_TOKEN_NUMERIC '\n'  */
-#line 901 "parser.y"
+  case 180: /* take_command: BX_TOKEN_TAKE BX_TOKEN_DMA BX_TOKEN_NUMERIC '\n'  */
+#line 911 "parser.y"
       {
         bx_dbg_take_command((yyvsp[-2].sval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3376 "y.tab.c"
+#line 3379 "y.tab.c"
     break;
 
-  case 179: /* take_command: BX_TOKEN_TAKE BX_TOKEN_IRQ '\n'  */
-#line 906 "parser.y"
+  case 181: /* take_command: BX_TOKEN_TAKE BX_TOKEN_IRQ '\n'  */
+#line 916 "parser.y"
       {
         bx_dbg_take_command((yyvsp[-1].sval), 1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3385 "y.tab.c"
+#line 3388 "y.tab.c"
     break;
 
-  case 180: /* take_command: BX_TOKEN_TAKE BX_TOKEN_SMI '\n'  */
-#line 911 "parser.y"
+  case 182: /* take_command: BX_TOKEN_TAKE BX_TOKEN_SMI '\n'  */
+#line 921 "parser.y"
       {
         bx_dbg_take_command((yyvsp[-1].sval), 1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3394 "y.tab.c"
+#line 3397 "y.tab.c"
     break;
 
-  case 181: /* take_command: BX_TOKEN_TAKE BX_TOKEN_NMI '\n'  */
-#line 916 "parser.y"
+  case 183: /* take_command: BX_TOKEN_TAKE BX_TOKEN_NMI '\n'  */
+#line 926 "parser.y"
       {
         bx_dbg_take_command((yyvsp[-1].sval), 1);
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3403 "y.tab.c"
+#line 3406 "y.tab.c"
     break;
 
-  case 182: /* disassemble_command: BX_TOKEN_DISASM '\n'  */
-#line 924 "parser.y"
+  case 184: /* disassemble_command: BX_TOKEN_DISASM '\n'  */
+#line 934 "parser.y"
       {
         bx_dbg_disassemble_current(NULL);
         free((yyvsp[-1].sval));
       }
-#line 3412 "y.tab.c"
+#line 3415 "y.tab.c"
     break;
 
-  case 183: /* disassemble_command: BX_TOKEN_DISASM expression '\n'  */
-#line 929 "parser.y"
+  case 185: /* disassemble_command: BX_TOKEN_DISASM expression '\n'  */
+#line 939 "parser.y"
       {
         bx_dbg_disassemble_command(NULL, (yyvsp[-1].uval), (yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 3421 "y.tab.c"
+#line 3424 "y.tab.c"
     break;
 
-  case 184: /* disassemble_command: BX_TOKEN_DISASM expression expression '\n'  */
-#line 934 "parser.y"
+  case 186: /* disassemble_command: BX_TOKEN_DISASM expression expression '\n'  */
+#line 944 "parser.y"
       {
         bx_dbg_disassemble_command(NULL, (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval));
       }
-#line 3430 "y.tab.c"
+#line 3433 "y.tab.c"
     break;
 
-  case 185: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_DISFORMAT '\n'  */
-#line 939 "parser.y"
+  case 187: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_DISFORMAT '\n'  */
+#line 949 "parser.y"
       {
         bx_dbg_disassemble_current((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3439 "y.tab.c"
+#line 3442 "y.tab.c"
     break;
 
-  case 186: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_DISFORMAT expression '\n'  */
-#line 944 "parser.y"
+  case 188: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_DISFORMAT expression '\n'  */
+#line 954 "parser.y"
       {
         bx_dbg_disassemble_command((yyvsp[-2].sval), (yyvsp[-1].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval)); free((yyvsp[-2].sval));
       }
-#line 3448 "y.tab.c"
+#line 3451 "y.tab.c"
     break;
 
-  case 187: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_DISFORMAT expression expression '\n'  */
-#line 949 "parser.y"
+  case 189: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_DISFORMAT expression expression '\n'  */
+#line 959 "parser.y"
       {
         bx_dbg_disassemble_command((yyvsp[-3].sval), (yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3457 "y.tab.c"
+#line 3460 "y.tab.c"
     break;
 
-  case 188: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_SWITCH_MODE '\n'  */
-#line 954 "parser.y"
+  case 190: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_SWITCH_MODE '\n'  */
+#line 964 "parser.y"
       {
         bx_dbg_disassemble_switch_mode();
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3466 "y.tab.c"
+#line 3469 "y.tab.c"
     break;
 
-  case 189: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_SIZE '=' BX_TOKEN_NUMERIC '\n'  */
-#line 959 "parser.y"
+  case 191: /* disassemble_command: BX_TOKEN_DISASM BX_TOKEN_SIZE '=' BX_TOKEN_NUMERIC '\n'  */
+#line 969 "parser.y"
       {
         bx_dbg_set_disassemble_size((yyvsp[-1].uval));
         free((yyvsp[-4].sval)); free((yyvsp[-3].sval));
       }
-#line 3475 "y.tab.c"
+#line 3478 "y.tab.c"
     break;
 
-  case 190: /* instrument_command: BX_TOKEN_INSTRUMENT BX_TOKEN_STOP '\n'  */
-#line 967 "parser.y"
+  case 192: /* instrument_command: BX_TOKEN_INSTRUMENT BX_TOKEN_STOP '\n'  */
+#line 977 "parser.y"
       {
         bx_dbg_instrument_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3484 "y.tab.c"
+#line 3487 "y.tab.c"
     break;
 
-  case 191: /* instrument_command: BX_TOKEN_INSTRUMENT BX_TOKEN_STRING '\n'  */
-#line 973 "parser.y"
+  case 193: /* instrument_command: BX_TOKEN_INSTRUMENT BX_TOKEN_STRING '\n'  */
+#line 983 "parser.y"
       {
         bx_dbg_instrument_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3493 "y.tab.c"
+#line 3496 "y.tab.c"
     break;
 
-  case 192: /* instrument_command: BX_TOKEN_INSTRUMENT BX_TOKEN_GENERIC '\n'  */
-#line 978 "parser.y"
+  case 194: /* instrument_command: BX_TOKEN_INSTRUMENT BX_TOKEN_GENERIC '\n'  */
+#line 988 "parser.y"
       {
         bx_dbg_instrument_command((yyvsp[-1].sval));
         free((yyvsp[-2].sval)); free((yyvsp[-1].sval));
       }
-#line 3502 "y.tab.c"
+#line 3505 "y.tab.c"
     break;
 
-  case 193: /* doit_command: BX_TOKEN_DOIT expression '\n'  */
-#line 986 "parser.y"
+  case 195: /* doit_command: BX_TOKEN_DOIT expression '\n'  */
+#line 996 "parser.y"
       {
         bx_dbg_doit_command((yyvsp[-1].uval));
         free((yyvsp[-2].sval));
       }
-#line 3511 "y.tab.c"
+#line 3514 "y.tab.c"
     break;
 
-  case 194: /* crc_command: BX_TOKEN_CRC expression expression '\n'  */
-#line 994 "parser.y"
+  case 196: /* crc_command: BX_TOKEN_CRC expression expression '\n'  */
+#line 1004 "parser.y"
       {
         bx_dbg_crc_command((yyvsp[-2].uval), (yyvsp[-1].uval));
         free((yyvsp[-3].sval));
       }
-#line 3520 "y.tab.c"
+#line 3523 "y.tab.c"
     break;
 
-  case 195: /* help_command: BX_TOKEN_HELP BX_TOKEN_QUIT '\n'  */
-#line 1002 "parser.y"
+  case 197: /* help_command: BX_TOKEN_HELP BX_TOKEN_QUIT '\n'  */
+#line 1012 "parser.y"
        {
          dbg_printf("q|quit|exit - quit debugger and emulator execution\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3529 "y.tab.c"
+#line 3532 "y.tab.c"
     break;
 
-  case 196: /* help_command: BX_TOKEN_HELP BX_TOKEN_CONTINUE '\n'  */
-#line 1007 "parser.y"
+  case 198: /* help_command: BX_TOKEN_HELP BX_TOKEN_CONTINUE '\n'  */
+#line 1017 "parser.y"
        {
          dbg_printf("c|cont|continue - continue executing\n");
          dbg_printf("c|cont|continue if \"expression\" - continue executing only if expression is true\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3539 "y.tab.c"
+#line 3542 "y.tab.c"
     break;
 
-  case 197: /* help_command: BX_TOKEN_HELP BX_TOKEN_STEPN '\n'  */
-#line 1013 "parser.y"
+  case 199: /* help_command: BX_TOKEN_HELP BX_TOKEN_STEPN '\n'  */
+#line 1023 "parser.y"
        {
          dbg_printf("s|step [count] - execute #count instructions on current processor (default is one instruction)\n");
          dbg_printf("s|step [cpu] <count> - execute #count instructions on processor #cpu\n");
          dbg_printf("s|step all <count> - execute #count instructions on all the processors\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3550 "y.tab.c"
+#line 3553 "y.tab.c"
     break;
 
-  case 198: /* help_command: BX_TOKEN_HELP BX_TOKEN_STEP_OVER '\n'  */
-#line 1020 "parser.y"
+  case 200: /* help_command: BX_TOKEN_HELP BX_TOKEN_STEP_OVER '\n'  */
+#line 1030 "parser.y"
        {
          dbg_printf("n|next|p - execute instruction stepping over subroutines\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3559 "y.tab.c"
+#line 3562 "y.tab.c"
     break;
 
-  case 199: /* help_command: BX_TOKEN_HELP BX_TOKEN_VBREAKPOINT '\n'  */
-#line 1025 "parser.y"
+  case 201: /* help_command: BX_TOKEN_HELP BX_TOKEN_VBREAKPOINT '\n'  */
+#line 1035 "parser.y"
        {
          dbg_printf("vb|vbreak <seg:offset> - set a virtual address instruction breakpoint\n");
          dbg_printf("vb|vbreak <seg:offset> if \"expression\" - set a conditional virtual address instruction breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3569 "y.tab.c"
+#line 3572 "y.tab.c"
     break;
 
-  case 200: /* help_command: BX_TOKEN_HELP BX_TOKEN_LBREAKPOINT '\n'  */
-#line 1031 "parser.y"
+  case 202: /* help_command: BX_TOKEN_HELP BX_TOKEN_LBREAKPOINT '\n'  */
+#line 1041 "parser.y"
        {
          dbg_printf("lb|lbreak <addr> - set a linear address instruction breakpoint\n");
          dbg_printf("lb|lbreak <addr> if \"expression\" - set a conditional linear address instruction breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3579 "y.tab.c"
+#line 3582 "y.tab.c"
     break;
 
-  case 201: /* help_command: BX_TOKEN_HELP BX_TOKEN_PBREAKPOINT '\n'  */
-#line 1037 "parser.y"
+  case 203: /* help_command: BX_TOKEN_HELP BX_TOKEN_PBREAKPOINT '\n'  */
+#line 1047 "parser.y"
        {
          dbg_printf("p|pb|break|pbreak <addr> - set a physical address instruction breakpoint\n");
          dbg_printf("p|pb|break|pbreak <addr> if \"expression\" - set a conditional physical address instruction breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3589 "y.tab.c"
+#line 3592 "y.tab.c"
     break;
 
-  case 202: /* help_command: BX_TOKEN_HELP BX_TOKEN_DEL_BREAKPOINT '\n'  */
-#line 1043 "parser.y"
+  case 204: /* help_command: BX_TOKEN_HELP BX_TOKEN_DEL_BREAKPOINT '\n'  */
+#line 1053 "parser.y"
        {
          dbg_printf("d|del|delete <n> - delete a breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3598 "y.tab.c"
+#line 3601 "y.tab.c"
     break;
 
-  case 203: /* help_command: BX_TOKEN_HELP BX_TOKEN_ENABLE_BREAKPOINT '\n'  */
-#line 1048 "parser.y"
+  case 205: /* help_command: BX_TOKEN_HELP BX_TOKEN_ENABLE_BREAKPOINT '\n'  */
+#line 1058 "parser.y"
        {
          dbg_printf("bpe <n> - enable a breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3607 "y.tab.c"
+#line 3610 "y.tab.c"
     break;
 
-  case 204: /* help_command: BX_TOKEN_HELP BX_TOKEN_DISABLE_BREAKPOINT '\n'  */
-#line 1053 "parser.y"
+  case 206: /* help_command: BX_TOKEN_HELP BX_TOKEN_DISABLE_BREAKPOINT '\n'  */
+#line 1063 "parser.y"
        {
          dbg_printf("bpd <n> - disable a breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3616 "y.tab.c"
+#line 3619 "y.tab.c"
     break;
 
-  case 205: /* help_command: BX_TOKEN_HELP BX_TOKEN_LIST_BREAK '\n'  */
-#line 1058 "parser.y"
+  case 207: /* help_command: BX_TOKEN_HELP BX_TOKEN_LIST_BREAK '\n'  */
+#line 1068 "parser.y"
        {
          dbg_printf("blist - list all breakpoints (same as 'info break')\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3625 "y.tab.c"
+#line 3628 "y.tab.c"
     break;
 
-  case 206: /* help_command: BX_TOKEN_HELP BX_TOKEN_MODEBP '\n'  */
-#line 1063 "parser.y"
+  case 208: /* help_command: BX_TOKEN_HELP BX_TOKEN_MODEBP '\n'  */
+#line 1073 "parser.y"
        {
          dbg_printf("modebp - toggles mode switch breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3634 "y.tab.c"
+#line 3637 "y.tab.c"
     break;
 
-  case 207: /* help_command: BX_TOKEN_HELP BX_TOKEN_VMEXITBP '\n'  */
-#line 1068 "parser.y"
+  case 209: /* help_command: BX_TOKEN_HELP BX_TOKEN_VMEXITBP '\n'  */
+#line 1078 "parser.y"
        {
          dbg_printf("vmexitbp - toggles VMEXIT switch breakpoint\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3643 "y.tab.c"
+#line 3646 "y.tab.c"
     break;
 
-  case 208: /* help_command: BX_TOKEN_HELP BX_TOKEN_CRC '\n'  */
-#line 1073 "parser.y"
+  case 210: /* help_command: BX_TOKEN_HELP BX_TOKEN_CRC '\n'  */
+#line 1083 "parser.y"
        {
          dbg_printf("crc <addr1> <addr2> - show CRC32 for physical memory range addr1..addr2\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3652 "y.tab.c"
+#line 3655 "y.tab.c"
     break;
 
-  case 209: /* help_command: BX_TOKEN_HELP BX_TOKEN_TRACE '\n'  */
-#line 1078 "parser.y"
+  case 211: /* help_command: BX_TOKEN_HELP BX_TOKEN_TRACE '\n'  */
+#line 1088 "parser.y"
        {
          dbg_printf("trace on  - print disassembly for every executed instruction\n");
          dbg_printf("trace off - disable instruction tracing\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3662 "y.tab.c"
+#line 3665 "y.tab.c"
     break;
 
-  case 210: /* help_command: BX_TOKEN_HELP BX_TOKEN_TRACEREG '\n'  */
-#line 1084 "parser.y"
+  case 212: /* help_command: BX_TOKEN_HELP BX_TOKEN_TRACEREG '\n'  */
+#line 1094 "parser.y"
        {
          dbg_printf("trace-reg on  - print all registers before every executed instruction\n");
          dbg_printf("trace-reg off - disable registers state tracing\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3672 "y.tab.c"
+#line 3675 "y.tab.c"
     break;
 
-  case 211: /* help_command: BX_TOKEN_HELP BX_TOKEN_TRACEMEM '\n'  */
-#line 1090 "parser.y"
+  case 213: /* help_command: BX_TOKEN_HELP BX_TOKEN_TRACEMEM '\n'  */
+#line 1100 "parser.y"
        {
          dbg_printf("trace-mem on  - print all memory accesses occurred during instruction execution\n");
          dbg_printf("trace-mem off - disable memory accesses tracing\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3682 "y.tab.c"
+#line 3685 "y.tab.c"
     break;
 
-  case 212: /* help_command: BX_TOKEN_HELP BX_TOKEN_RESTORE '\n'  */
-#line 1096 "parser.y"
+  case 214: /* help_command: BX_TOKEN_HELP BX_TOKEN_RESTORE '\n'  */
+#line 1106 "parser.y"
        {
          dbg_printf("restore <param_name> [path] - restore bochs root param from the file\n");
          dbg_printf("for example:\n");
@@ -3690,164 +3693,173 @@ yyreduce:
          dbg_printf("restore \"cpu0\" \"/save\" - restore CPU #0 from file \"cpu0\" located in directory \"/save\"\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3694 "y.tab.c"
+#line 3697 "y.tab.c"
     break;
 
-  case 213: /* help_command: BX_TOKEN_HELP BX_TOKEN_PTIME '\n'  */
-#line 1104 "parser.y"
+  case 215: /* help_command: BX_TOKEN_HELP BX_TOKEN_FORK '\n'  */
+#line 1114 "parser.y"
+       {
+         dbg_printf("fork - fork the simulation, the child process continues with volatile disk images\n");
+         free((yyvsp[-2].sval));free((yyvsp[-1].sval));
+       }
+#line 3706 "y.tab.c"
+    break;
+
+  case 216: /* help_command: BX_TOKEN_HELP BX_TOKEN_PTIME '\n'  */
+#line 1119 "parser.y"
        {
          dbg_printf("ptime - print current time (number of ticks since start of simulation)\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3703 "y.tab.c"
+#line 3715 "y.tab.c"
     break;
 
-  case 214: /* help_command: BX_TOKEN_HELP BX_TOKEN_TIMEBP '\n'  */
-#line 1109 "parser.y"
+  case 217: /* help_command: BX_TOKEN_HELP BX_TOKEN_TIMEBP '\n'  */
+#line 1124 "parser.y"
        {
          dbg_printf("sb <delta> - insert a time breakpoint delta instructions into the future\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3712 "y.tab.c"
+#line 3724 "y.tab.c"
     break;
 
-  case 215: /* help_command: BX_TOKEN_HELP BX_TOKEN_TIMEBP_ABSOLUTE '\n'  */
-#line 1114 "parser.y"
+  case 218: /* help_command: BX_TOKEN_HELP BX_TOKEN_TIMEBP_ABSOLUTE '\n'  */
+#line 1129 "parser.y"
        {
          dbg_printf("sba <time> - insert breakpoint at specific time\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3721 "y.tab.c"
+#line 3733 "y.tab.c"
     break;
 
-  case 216: /* help_command: BX_TOKEN_HELP BX_TOKEN_PRINT_STACK '\n'  */
-#line 1119 "parser.y"
+  case 219: /* help_command: BX_TOKEN_HELP BX_TOKEN_PRINT_STACK '\n'  */
+#line 1134 "parser.y"
        {
          dbg_printf("print-stack [num_words] - print the num_words top 16 bit words on the stack\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3730 "y.tab.c"
+#line 3742 "y.tab.c"
     break;
 
-  case 217: /* help_command: BX_TOKEN_HELP BX_TOKEN_LOAD_SYMBOLS '\n'  */
-#line 1124 "parser.y"
+  case 220: /* help_command: BX_TOKEN_HELP BX_TOKEN_LOAD_SYMBOLS '\n'  */
+#line 1139 "parser.y"
        {
          dbg_printf("ldsym [global] <filename> [offset] - load symbols from file\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3739 "y.tab.c"
+#line 3751 "y.tab.c"
     break;
 
-  case 218: /* help_command: BX_TOKEN_HELP BX_TOKEN_LIST_SYMBOLS '\n'  */
-#line 1129 "parser.y"
+  case 221: /* help_command: BX_TOKEN_HELP BX_TOKEN_LIST_SYMBOLS '\n'  */
+#line 1144 "parser.y"
        {
          dbg_printf("slist [string] - list symbols whose preffix is string (same as 'info symbols')\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3748 "y.tab.c"
+#line 3760 "y.tab.c"
     break;
 
-  case 219: /* help_command: BX_TOKEN_HELP BX_TOKEN_REGISTERS '\n'  */
-#line 1134 "parser.y"
+  case 222: /* help_command: BX_TOKEN_HELP BX_TOKEN_REGISTERS '\n'  */
+#line 1149 "parser.y"
        {
          dbg_printf("r|reg|regs|registers - list of CPU registers and their contents (same as 'info registers')\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3757 "y.tab.c"
+#line 3769 "y.tab.c"
     break;
 
-  case 220: /* help_command: BX_TOKEN_HELP BX_TOKEN_FPU '\n'  */
-#line 1139 "parser.y"
+  case 223: /* help_command: BX_TOKEN_HELP BX_TOKEN_FPU '\n'  */
+#line 1154 "parser.y"
        {
          dbg_printf("fp|fpu - print FPU state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3766 "y.tab.c"
+#line 3778 "y.tab.c"
     break;
 
-  case 221: /* help_command: BX_TOKEN_HELP BX_TOKEN_MMX '\n'  */
-#line 1144 "parser.y"
+  case 224: /* help_command: BX_TOKEN_HELP BX_TOKEN_MMX '\n'  */
+#line 1159 "parser.y"
        {
          dbg_printf("mmx - print MMX state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3775 "y.tab.c"
+#line 3787 "y.tab.c"
     break;
 
-  case 222: /* help_command: BX_TOKEN_HELP BX_TOKEN_XMM '\n'  */
-#line 1149 "parser.y"
+  case 225: /* help_command: BX_TOKEN_HELP BX_TOKEN_XMM '\n'  */
+#line 1164 "parser.y"
        {
          dbg_printf("xmm|sse - print SSE state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3784 "y.tab.c"
+#line 3796 "y.tab.c"
     break;
 
-  case 223: /* help_command: BX_TOKEN_HELP BX_TOKEN_YMM '\n'  */
-#line 1154 "parser.y"
+  case 226: /* help_command: BX_TOKEN_HELP BX_TOKEN_YMM '\n'  */
+#line 1169 "parser.y"
        {
          dbg_printf("ymm - print AVX state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3793 "y.tab.c"
+#line 3805 "y.tab.c"
     break;
 
-  case 224: /* help_command: BX_TOKEN_HELP BX_TOKEN_ZMM '\n'  */
-#line 1159 "parser.y"
+  case 227: /* help_command: BX_TOKEN_HELP BX_TOKEN_ZMM '\n'  */
+#line 1174 "parser.y"
        {
          dbg_printf("zmm - print AVX-512 state\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3802 "y.tab.c"
+#line 3814 "y.tab.c"
     break;
 
-  case 225: /* help_command: BX_TOKEN_HELP BX_TOKEN_SEGMENT_REGS '\n'  */
-#line 1164 "parser.y"
+  case 228: /* help_command: BX_TOKEN_HELP BX_TOKEN_SEGMENT_REGS '\n'  */
+#line 1179 "parser.y"
        {
          dbg_printf("sreg - show segment registers\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3811 "y.tab.c"
+#line 3823 "y.tab.c"
     break;
 
-  case 226: /* help_command: BX_TOKEN_HELP BX_TOKEN_CONTROL_REGS '\n'  */
-#line 1169 "parser.y"
+  case 229: /* help_command: BX_TOKEN_HELP BX_TOKEN_CONTROL_REGS '\n'  */
+#line 1184 "parser.y"
        {
          dbg_printf("creg - show control registers\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3820 "y.tab.c"
+#line 3832 "y.tab.c"
     break;
 
-  case 227: /* help_command: BX_TOKEN_HELP BX_TOKEN_DEBUG_REGS '\n'  */
-#line 1174 "parser.y"
+  case 230: /* help_command: BX_TOKEN_HELP BX_TOKEN_DEBUG_REGS '\n'  */
+#line 1189 "parser.y"
        {
          dbg_printf("dreg - show debug registers\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3829 "y.tab.c"
+#line 3841 "y.tab.c"
     break;
 
-  case 228: /* help_command: BX_TOKEN_HELP BX_TOKEN_WRITEMEM '\n'  */
-#line 1179 "parser.y"
+  case 231: /* help_command: BX_TOKEN_HELP BX_TOKEN_WRITEMEM '\n'  */
+#line 1194 "parser.y"
        {
          dbg_printf("writemem <filename> <laddr> <len> - dump 'len' bytes of virtual memory starting from the linear address 'laddr' into the file\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3838 "y.tab.c"
+#line 3850 "y.tab.c"
     break;
 
-  case 229: /* help_command: BX_TOKEN_HELP BX_TOKEN_SETPMEM '\n'  */
-#line 1184 "parser.y"
+  case 232: /* help_command: BX_TOKEN_HELP BX_TOKEN_SETPMEM '\n'  */
+#line 1199 "parser.y"
        {
          dbg_printf("setpmem <addr> <datasize> <val> - set physical memory location of size 'datasize' to value 'val'\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3847 "y.tab.c"
+#line 3859 "y.tab.c"
     break;
 
-  case 230: /* help_command: BX_TOKEN_HELP BX_TOKEN_DISASM '\n'  */
-#line 1189 "parser.y"
+  case 233: /* help_command: BX_TOKEN_HELP BX_TOKEN_DISASM '\n'  */
+#line 1204 "parser.y"
        {
          dbg_printf("u|disasm [/count] <start> <end> - disassemble instructions for given linear address\n");
          dbg_printf("    Optional 'count' is the number of disassembled instructions\n");
@@ -3857,11 +3869,11 @@ yyreduce:
          dbg_printf("       when \"disassemble\" command is used.\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3861 "y.tab.c"
+#line 3873 "y.tab.c"
     break;
 
-  case 231: /* help_command: BX_TOKEN_HELP BX_TOKEN_WATCH '\n'  */
-#line 1199 "parser.y"
+  case 234: /* help_command: BX_TOKEN_HELP BX_TOKEN_WATCH '\n'  */
+#line 1214 "parser.y"
        {
          dbg_printf("watch - print current watch point status\n");
          dbg_printf("watch stop - stop simulation when a watchpoint is encountred\n");
@@ -3872,21 +3884,21 @@ yyreduce:
          dbg_printf("watch w|write addr <len> - insert a write watch point at physical address addr with range <len>\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3876 "y.tab.c"
+#line 3888 "y.tab.c"
     break;
 
-  case 232: /* help_command: BX_TOKEN_HELP BX_TOKEN_UNWATCH '\n'  */
-#line 1210 "parser.y"
+  case 235: /* help_command: BX_TOKEN_HELP BX_TOKEN_UNWATCH '\n'  */
+#line 1225 "parser.y"
        {
          dbg_printf("unwatch      - remove all watch points\n");
          dbg_printf("unwatch addr - remove a watch point\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3886 "y.tab.c"
+#line 3898 "y.tab.c"
     break;
 
-  case 233: /* help_command: BX_TOKEN_HELP BX_TOKEN_EXAMINE '\n'  */
-#line 1216 "parser.y"
+  case 236: /* help_command: BX_TOKEN_HELP BX_TOKEN_EXAMINE '\n'  */
+#line 1231 "parser.y"
        {
          dbg_printf("x  /nuf <addr> - examine memory at linear address\n");
          dbg_printf("xp /nuf <addr> - examine memory at physical address\n");
@@ -3899,20 +3911,20 @@ yyreduce:
          dbg_printf("    m selects an alternative output format (memory dump)\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3903 "y.tab.c"
+#line 3915 "y.tab.c"
     break;
 
-  case 234: /* help_command: BX_TOKEN_HELP BX_TOKEN_INSTRUMENT '\n'  */
-#line 1229 "parser.y"
+  case 237: /* help_command: BX_TOKEN_HELP BX_TOKEN_INSTRUMENT '\n'  */
+#line 1244 "parser.y"
        {
          dbg_printf("instrument <command|\"string command\"> - calls BX_INSTR_DEBUG_CMD instrumentation callback with <command|\"string command\">\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3912 "y.tab.c"
+#line 3924 "y.tab.c"
     break;
 
-  case 235: /* help_command: BX_TOKEN_HELP BX_TOKEN_SET '\n'  */
-#line 1234 "parser.y"
+  case 238: /* help_command: BX_TOKEN_HELP BX_TOKEN_SET '\n'  */
+#line 1249 "parser.y"
        {
          dbg_printf("set <regname> = <expr> - set register value to expression\n");
          dbg_printf("set eflags = <expr> - set eflags value to expression, not all flags can be modified\n");
@@ -3923,20 +3935,20 @@ yyreduce:
          dbg_printf("set u|disasm|disassemble off - same as 'set $auto_disassemble = 0'\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3927 "y.tab.c"
+#line 3939 "y.tab.c"
     break;
 
-  case 236: /* help_command: BX_TOKEN_HELP BX_TOKEN_PAGE '\n'  */
-#line 1245 "parser.y"
+  case 239: /* help_command: BX_TOKEN_HELP BX_TOKEN_PAGE '\n'  */
+#line 1260 "parser.y"
        {
          dbg_printf("page <laddr> - show linear to physical xlation for linear address laddr\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3936 "y.tab.c"
+#line 3948 "y.tab.c"
     break;
 
-  case 237: /* help_command: BX_TOKEN_HELP BX_TOKEN_INFO '\n'  */
-#line 1250 "parser.y"
+  case 240: /* help_command: BX_TOKEN_HELP BX_TOKEN_INFO '\n'  */
+#line 1265 "parser.y"
        {
          dbg_printf("info break - show information about current breakpoint status\n");
          dbg_printf("info cpu - show dump of all cpu registers\n");
@@ -3952,11 +3964,11 @@ yyreduce:
          dbg_printf("info device [string] [string] - show state of device with options\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3956 "y.tab.c"
+#line 3968 "y.tab.c"
     break;
 
-  case 238: /* help_command: BX_TOKEN_HELP BX_TOKEN_SHOW '\n'  */
-#line 1266 "parser.y"
+  case 241: /* help_command: BX_TOKEN_HELP BX_TOKEN_SHOW '\n'  */
+#line 1281 "parser.y"
        {
          dbg_printf("show <command> - toggles show symbolic info (calls to begin with)\n");
          dbg_printf("show - shows current show mode\n");
@@ -3972,11 +3984,11 @@ yyreduce:
          dbg_printf("show dbg_none - turn off all bx_dbg flags\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3976 "y.tab.c"
+#line 3988 "y.tab.c"
     break;
 
-  case 239: /* help_command: BX_TOKEN_HELP BX_TOKEN_CALC '\n'  */
-#line 1282 "parser.y"
+  case 242: /* help_command: BX_TOKEN_HELP BX_TOKEN_CALC '\n'  */
+#line 1297 "parser.y"
        {
          dbg_printf("calc|? <expr> - calculate a expression and display the result.\n");
          dbg_printf("    'expr' can reference any general-purpose, opmask and segment\n");
@@ -3986,403 +3998,403 @@ yyreduce:
          dbg_printf("    a selector:offset (in protected mode) pair.\n");
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3990 "y.tab.c"
+#line 4002 "y.tab.c"
     break;
 
-  case 240: /* help_command: BX_TOKEN_HELP BX_TOKEN_HELP '\n'  */
-#line 1292 "parser.y"
+  case 243: /* help_command: BX_TOKEN_HELP BX_TOKEN_HELP '\n'  */
+#line 1307 "parser.y"
        {
          bx_dbg_print_help();
          free((yyvsp[-2].sval));free((yyvsp[-1].sval));
        }
-#line 3999 "y.tab.c"
+#line 4011 "y.tab.c"
     break;
 
-  case 241: /* help_command: BX_TOKEN_HELP '\n'  */
-#line 1297 "parser.y"
+  case 244: /* help_command: BX_TOKEN_HELP '\n'  */
+#line 1312 "parser.y"
        {
          bx_dbg_print_help();
          free((yyvsp[-1].sval));
        }
-#line 4008 "y.tab.c"
+#line 4020 "y.tab.c"
     break;
 
-  case 242: /* calc_command: BX_TOKEN_CALC expression '\n'  */
-#line 1305 "parser.y"
+  case 245: /* calc_command: BX_TOKEN_CALC expression '\n'  */
+#line 1320 "parser.y"
    {
      eval_value = (yyvsp[-1].uval);
      bx_dbg_calc_command((yyvsp[-1].uval));
      free((yyvsp[-2].sval));
    }
-#line 4018 "y.tab.c"
+#line 4030 "y.tab.c"
     break;
 
-  case 243: /* if_command: BX_TOKEN_IF expression '\n'  */
-#line 1314 "parser.y"
+  case 246: /* if_command: BX_TOKEN_IF expression '\n'  */
+#line 1329 "parser.y"
    {
      eval_value = (yyvsp[-1].uval) != 0;
      bx_dbg_calc_command((yyvsp[-1].uval));
      free((yyvsp[-2].sval));
    }
-#line 4028 "y.tab.c"
+#line 4040 "y.tab.c"
     break;
 
-  case 244: /* vexpression: BX_TOKEN_NUMERIC  */
-#line 1323 "parser.y"
+  case 247: /* vexpression: BX_TOKEN_NUMERIC  */
+#line 1338 "parser.y"
                                      { (yyval.uval) = (yyvsp[0].uval); }
-#line 4034 "y.tab.c"
+#line 4046 "y.tab.c"
     break;
 
-  case 245: /* vexpression: BX_TOKEN_STRING  */
-#line 1324 "parser.y"
+  case 248: /* vexpression: BX_TOKEN_STRING  */
+#line 1339 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_symbol_value((yyvsp[0].sval)); free((yyvsp[0].sval));}
-#line 4040 "y.tab.c"
+#line 4052 "y.tab.c"
     break;
 
-  case 246: /* vexpression: BX_TOKEN_8BL_REG  */
-#line 1325 "parser.y"
+  case 249: /* vexpression: BX_TOKEN_8BL_REG  */
+#line 1340 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg8l_value((yyvsp[0].uval)); }
-#line 4046 "y.tab.c"
+#line 4058 "y.tab.c"
     break;
 
-  case 247: /* vexpression: BX_TOKEN_8BH_REG  */
-#line 1326 "parser.y"
+  case 250: /* vexpression: BX_TOKEN_8BH_REG  */
+#line 1341 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg8h_value((yyvsp[0].uval)); }
-#line 4052 "y.tab.c"
+#line 4064 "y.tab.c"
     break;
 
-  case 248: /* vexpression: BX_TOKEN_16B_REG  */
-#line 1327 "parser.y"
+  case 251: /* vexpression: BX_TOKEN_16B_REG  */
+#line 1342 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg16_value((yyvsp[0].uval)); }
-#line 4058 "y.tab.c"
+#line 4070 "y.tab.c"
     break;
 
-  case 249: /* vexpression: BX_TOKEN_32B_REG  */
-#line 1328 "parser.y"
+  case 252: /* vexpression: BX_TOKEN_32B_REG  */
+#line 1343 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg32_value((yyvsp[0].uval)); }
-#line 4064 "y.tab.c"
+#line 4076 "y.tab.c"
     break;
 
-  case 250: /* vexpression: BX_TOKEN_64B_REG  */
-#line 1329 "parser.y"
+  case 253: /* vexpression: BX_TOKEN_64B_REG  */
+#line 1344 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg64_value((yyvsp[0].uval)); }
-#line 4070 "y.tab.c"
+#line 4082 "y.tab.c"
     break;
 
-  case 251: /* vexpression: BX_TOKEN_OPMASK_REG  */
-#line 1330 "parser.y"
+  case 254: /* vexpression: BX_TOKEN_OPMASK_REG  */
+#line 1345 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_opmask_value((yyvsp[0].uval)); }
-#line 4076 "y.tab.c"
+#line 4088 "y.tab.c"
     break;
 
-  case 252: /* vexpression: BX_TOKEN_SEGREG  */
-#line 1331 "parser.y"
+  case 255: /* vexpression: BX_TOKEN_SEGREG  */
+#line 1346 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_selector_value((yyvsp[0].uval)); }
-#line 4082 "y.tab.c"
+#line 4094 "y.tab.c"
     break;
 
-  case 253: /* vexpression: BX_TOKEN_REG_IP  */
-#line 1332 "parser.y"
+  case 256: /* vexpression: BX_TOKEN_REG_IP  */
+#line 1347 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_ip (); }
-#line 4088 "y.tab.c"
+#line 4100 "y.tab.c"
     break;
 
-  case 254: /* vexpression: BX_TOKEN_REG_EIP  */
-#line 1333 "parser.y"
+  case 257: /* vexpression: BX_TOKEN_REG_EIP  */
+#line 1348 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_eip(); }
-#line 4094 "y.tab.c"
+#line 4106 "y.tab.c"
     break;
 
-  case 255: /* vexpression: BX_TOKEN_REG_RIP  */
-#line 1334 "parser.y"
+  case 258: /* vexpression: BX_TOKEN_REG_RIP  */
+#line 1349 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_rip(); }
-#line 4100 "y.tab.c"
+#line 4112 "y.tab.c"
     break;
 
-  case 256: /* vexpression: BX_TOKEN_REG_SSP  */
-#line 1335 "parser.y"
+  case 259: /* vexpression: BX_TOKEN_REG_SSP  */
+#line 1350 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_ssp(); }
-#line 4106 "y.tab.c"
+#line 4118 "y.tab.c"
     break;
 
-  case 257: /* vexpression: vexpression '+' vexpression  */
-#line 1336 "parser.y"
+  case 260: /* vexpression: vexpression '+' vexpression  */
+#line 1351 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) + (yyvsp[0].uval); }
-#line 4112 "y.tab.c"
+#line 4124 "y.tab.c"
     break;
 
-  case 258: /* vexpression: vexpression '-' vexpression  */
-#line 1337 "parser.y"
+  case 261: /* vexpression: vexpression '-' vexpression  */
+#line 1352 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) - (yyvsp[0].uval); }
-#line 4118 "y.tab.c"
+#line 4130 "y.tab.c"
     break;
 
-  case 259: /* vexpression: vexpression '*' vexpression  */
-#line 1338 "parser.y"
+  case 262: /* vexpression: vexpression '*' vexpression  */
+#line 1353 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) * (yyvsp[0].uval); }
-#line 4124 "y.tab.c"
+#line 4136 "y.tab.c"
     break;
 
-  case 260: /* vexpression: vexpression '/' vexpression  */
-#line 1339 "parser.y"
+  case 263: /* vexpression: vexpression '/' vexpression  */
+#line 1354 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) / (yyvsp[0].uval); }
-#line 4130 "y.tab.c"
+#line 4142 "y.tab.c"
     break;
 
-  case 261: /* vexpression: vexpression BX_TOKEN_RSHIFT vexpression  */
-#line 1340 "parser.y"
+  case 264: /* vexpression: vexpression BX_TOKEN_RSHIFT vexpression  */
+#line 1355 "parser.y"
                                              { (yyval.uval) = (yyvsp[-2].uval) >> (yyvsp[0].uval); }
-#line 4136 "y.tab.c"
+#line 4148 "y.tab.c"
     break;
 
-  case 262: /* vexpression: vexpression BX_TOKEN_LSHIFT vexpression  */
-#line 1341 "parser.y"
+  case 265: /* vexpression: vexpression BX_TOKEN_LSHIFT vexpression  */
+#line 1356 "parser.y"
                                              { (yyval.uval) = (yyvsp[-2].uval) << (yyvsp[0].uval); }
-#line 4142 "y.tab.c"
+#line 4154 "y.tab.c"
     break;
 
-  case 263: /* vexpression: vexpression '|' vexpression  */
-#line 1342 "parser.y"
+  case 266: /* vexpression: vexpression '|' vexpression  */
+#line 1357 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) | (yyvsp[0].uval); }
-#line 4148 "y.tab.c"
+#line 4160 "y.tab.c"
     break;
 
-  case 264: /* vexpression: vexpression '^' vexpression  */
-#line 1343 "parser.y"
+  case 267: /* vexpression: vexpression '^' vexpression  */
+#line 1358 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) ^ (yyvsp[0].uval); }
-#line 4154 "y.tab.c"
+#line 4166 "y.tab.c"
     break;
 
-  case 265: /* vexpression: vexpression '&' vexpression  */
-#line 1344 "parser.y"
+  case 268: /* vexpression: vexpression '&' vexpression  */
+#line 1359 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) & (yyvsp[0].uval); }
-#line 4160 "y.tab.c"
+#line 4172 "y.tab.c"
     break;
 
-  case 266: /* vexpression: '!' vexpression  */
-#line 1345 "parser.y"
+  case 269: /* vexpression: '!' vexpression  */
+#line 1360 "parser.y"
                                      { (yyval.uval) = !(yyvsp[0].uval); }
-#line 4166 "y.tab.c"
+#line 4178 "y.tab.c"
     break;
 
-  case 267: /* vexpression: '-' vexpression  */
-#line 1346 "parser.y"
+  case 270: /* vexpression: '-' vexpression  */
+#line 1361 "parser.y"
                                      { (yyval.uval) = -(yyvsp[0].uval); }
-#line 4172 "y.tab.c"
+#line 4184 "y.tab.c"
     break;
 
-  case 268: /* vexpression: '(' vexpression ')'  */
-#line 1347 "parser.y"
+  case 271: /* vexpression: '(' vexpression ')'  */
+#line 1362 "parser.y"
                                      { (yyval.uval) = (yyvsp[-1].uval); }
-#line 4178 "y.tab.c"
+#line 4190 "y.tab.c"
     break;
 
-  case 269: /* expression: BX_TOKEN_NUMERIC  */
-#line 1353 "parser.y"
+  case 272: /* expression: BX_TOKEN_NUMERIC  */
+#line 1368 "parser.y"
                                      { (yyval.uval) = (yyvsp[0].uval); }
-#line 4184 "y.tab.c"
+#line 4196 "y.tab.c"
     break;
 
-  case 270: /* expression: BX_TOKEN_STRING  */
-#line 1354 "parser.y"
+  case 273: /* expression: BX_TOKEN_STRING  */
+#line 1369 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_symbol_value((yyvsp[0].sval)); free((yyvsp[0].sval));}
-#line 4190 "y.tab.c"
+#line 4202 "y.tab.c"
     break;
 
-  case 271: /* expression: BX_TOKEN_8BL_REG  */
-#line 1355 "parser.y"
+  case 274: /* expression: BX_TOKEN_8BL_REG  */
+#line 1370 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg8l_value((yyvsp[0].uval)); }
-#line 4196 "y.tab.c"
+#line 4208 "y.tab.c"
     break;
 
-  case 272: /* expression: BX_TOKEN_8BH_REG  */
-#line 1356 "parser.y"
+  case 275: /* expression: BX_TOKEN_8BH_REG  */
+#line 1371 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg8h_value((yyvsp[0].uval)); }
-#line 4202 "y.tab.c"
+#line 4214 "y.tab.c"
     break;
 
-  case 273: /* expression: BX_TOKEN_16B_REG  */
-#line 1357 "parser.y"
+  case 276: /* expression: BX_TOKEN_16B_REG  */
+#line 1372 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg16_value((yyvsp[0].uval)); }
-#line 4208 "y.tab.c"
+#line 4220 "y.tab.c"
     break;
 
-  case 274: /* expression: BX_TOKEN_32B_REG  */
-#line 1358 "parser.y"
+  case 277: /* expression: BX_TOKEN_32B_REG  */
+#line 1373 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg32_value((yyvsp[0].uval)); }
-#line 4214 "y.tab.c"
+#line 4226 "y.tab.c"
     break;
 
-  case 275: /* expression: BX_TOKEN_64B_REG  */
-#line 1359 "parser.y"
+  case 278: /* expression: BX_TOKEN_64B_REG  */
+#line 1374 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_reg64_value((yyvsp[0].uval)); }
-#line 4220 "y.tab.c"
+#line 4232 "y.tab.c"
     break;
 
-  case 276: /* expression: BX_TOKEN_OPMASK_REG  */
-#line 1360 "parser.y"
+  case 279: /* expression: BX_TOKEN_OPMASK_REG  */
+#line 1375 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_opmask_value((yyvsp[0].uval)); }
-#line 4226 "y.tab.c"
+#line 4238 "y.tab.c"
     break;
 
-  case 277: /* expression: BX_TOKEN_SEGREG  */
-#line 1361 "parser.y"
+  case 280: /* expression: BX_TOKEN_SEGREG  */
+#line 1376 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_selector_value((yyvsp[0].uval)); }
-#line 4232 "y.tab.c"
+#line 4244 "y.tab.c"
     break;
 
-  case 278: /* expression: BX_TOKEN_REG_IP  */
-#line 1362 "parser.y"
+  case 281: /* expression: BX_TOKEN_REG_IP  */
+#line 1377 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_ip (); }
-#line 4238 "y.tab.c"
+#line 4250 "y.tab.c"
     break;
 
-  case 279: /* expression: BX_TOKEN_REG_EIP  */
-#line 1363 "parser.y"
+  case 282: /* expression: BX_TOKEN_REG_EIP  */
+#line 1378 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_eip(); }
-#line 4244 "y.tab.c"
+#line 4256 "y.tab.c"
     break;
 
-  case 280: /* expression: BX_TOKEN_REG_RIP  */
-#line 1364 "parser.y"
+  case 283: /* expression: BX_TOKEN_REG_RIP  */
+#line 1379 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_rip(); }
-#line 4250 "y.tab.c"
+#line 4262 "y.tab.c"
     break;
 
-  case 281: /* expression: BX_TOKEN_REG_SSP  */
-#line 1365 "parser.y"
+  case 284: /* expression: BX_TOKEN_REG_SSP  */
+#line 1380 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_ssp(); }
-#line 4256 "y.tab.c"
+#line 4268 "y.tab.c"
     break;
 
-  case 282: /* expression: expression ':' expression  */
-#line 1366 "parser.y"
+  case 285: /* expression: expression ':' expression  */
+#line 1381 "parser.y"
                                      { (yyval.uval) = bx_dbg_get_laddr ((yyvsp[-2].uval), (yyvsp[0].uval)); }
-#line 4262 "y.tab.c"
+#line 4274 "y.tab.c"
     break;
 
-  case 283: /* expression: expression '+' expression  */
-#line 1367 "parser.y"
+  case 286: /* expression: expression '+' expression  */
+#line 1382 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) + (yyvsp[0].uval); }
-#line 4268 "y.tab.c"
+#line 4280 "y.tab.c"
     break;
 
-  case 284: /* expression: expression '-' expression  */
-#line 1368 "parser.y"
+  case 287: /* expression: expression '-' expression  */
+#line 1383 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) - (yyvsp[0].uval); }
-#line 4274 "y.tab.c"
+#line 4286 "y.tab.c"
     break;
 
-  case 285: /* expression: expression '*' expression  */
-#line 1369 "parser.y"
+  case 288: /* expression: expression '*' expression  */
+#line 1384 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) * (yyvsp[0].uval); }
-#line 4280 "y.tab.c"
+#line 4292 "y.tab.c"
     break;
 
-  case 286: /* expression: expression '/' expression  */
-#line 1370 "parser.y"
+  case 289: /* expression: expression '/' expression  */
+#line 1385 "parser.y"
                                      { (yyval.uval) = ((yyvsp[0].uval) != 0) ? (yyvsp[-2].uval) / (yyvsp[0].uval) : 0; }
-#line 4286 "y.tab.c"
+#line 4298 "y.tab.c"
     break;
 
-  case 287: /* expression: expression BX_TOKEN_RSHIFT expression  */
-#line 1371 "parser.y"
+  case 290: /* expression: expression BX_TOKEN_RSHIFT expression  */
+#line 1386 "parser.y"
                                            { (yyval.uval) = (yyvsp[-2].uval) >> (yyvsp[0].uval); }
-#line 4292 "y.tab.c"
+#line 4304 "y.tab.c"
     break;
 
-  case 288: /* expression: expression BX_TOKEN_LSHIFT expression  */
-#line 1372 "parser.y"
+  case 291: /* expression: expression BX_TOKEN_LSHIFT expression  */
+#line 1387 "parser.y"
                                            { (yyval.uval) = (yyvsp[-2].uval) << (yyvsp[0].uval); }
-#line 4298 "y.tab.c"
+#line 4310 "y.tab.c"
     break;
 
-  case 289: /* expression: expression '|' expression  */
-#line 1373 "parser.y"
+  case 292: /* expression: expression '|' expression  */
+#line 1388 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) | (yyvsp[0].uval); }
-#line 4304 "y.tab.c"
+#line 4316 "y.tab.c"
     break;
 
-  case 290: /* expression: expression '^' expression  */
-#line 1374 "parser.y"
+  case 293: /* expression: expression '^' expression  */
+#line 1389 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) ^ (yyvsp[0].uval); }
-#line 4310 "y.tab.c"
+#line 4322 "y.tab.c"
     break;
 
-  case 291: /* expression: expression '&' expression  */
-#line 1375 "parser.y"
+  case 294: /* expression: expression '&' expression  */
+#line 1390 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) & (yyvsp[0].uval); }
-#line 4316 "y.tab.c"
+#line 4328 "y.tab.c"
     break;
 
-  case 292: /* expression: expression '>' expression  */
-#line 1376 "parser.y"
+  case 295: /* expression: expression '>' expression  */
+#line 1391 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) > (yyvsp[0].uval); }
-#line 4322 "y.tab.c"
+#line 4334 "y.tab.c"
     break;
 
-  case 293: /* expression: expression '<' expression  */
-#line 1377 "parser.y"
+  case 296: /* expression: expression '<' expression  */
+#line 1392 "parser.y"
                                      { (yyval.uval) = (yyvsp[-2].uval) < (yyvsp[0].uval); }
-#line 4328 "y.tab.c"
+#line 4340 "y.tab.c"
     break;
 
-  case 294: /* expression: expression BX_TOKEN_EQ expression  */
-#line 1378 "parser.y"
+  case 297: /* expression: expression BX_TOKEN_EQ expression  */
+#line 1393 "parser.y"
                                        { (yyval.uval) = (yyvsp[-2].uval) == (yyvsp[0].uval); }
-#line 4334 "y.tab.c"
+#line 4346 "y.tab.c"
     break;
 
-  case 295: /* expression: expression BX_TOKEN_NE expression  */
-#line 1379 "parser.y"
+  case 298: /* expression: expression BX_TOKEN_NE expression  */
+#line 1394 "parser.y"
                                        { (yyval.uval) = (yyvsp[-2].uval) != (yyvsp[0].uval); }
-#line 4340 "y.tab.c"
+#line 4352 "y.tab.c"
     break;
 
-  case 296: /* expression: expression BX_TOKEN_LE expression  */
-#line 1380 "parser.y"
+  case 299: /* expression: expression BX_TOKEN_LE expression  */
+#line 1395 "parser.y"
                                        { (yyval.uval) = (yyvsp[-2].uval) <= (yyvsp[0].uval); }
-#line 4346 "y.tab.c"
+#line 4358 "y.tab.c"
     break;
 
-  case 297: /* expression: expression BX_TOKEN_GE expression  */
-#line 1381 "parser.y"
+  case 300: /* expression: expression BX_TOKEN_GE expression  */
+#line 1396 "parser.y"
                                        { (yyval.uval) = (yyvsp[-2].uval) >= (yyvsp[0].uval); }
-#line 4352 "y.tab.c"
+#line 4364 "y.tab.c"
     break;
 
-  case 298: /* expression: '!' expression  */
-#line 1382 "parser.y"
+  case 301: /* expression: '!' expression  */
+#line 1397 "parser.y"
                                      { (yyval.uval) = !(yyvsp[0].uval); }
-#line 4358 "y.tab.c"
+#line 4370 "y.tab.c"
     break;
 
-  case 299: /* expression: '-' expression  */
-#line 1383 "parser.y"
+  case 302: /* expression: '-' expression  */
+#line 1398 "parser.y"
                                      { (yyval.uval) = -(yyvsp[0].uval); }
-#line 4364 "y.tab.c"
+#line 4376 "y.tab.c"
     break;
 
-  case 300: /* expression: '*' expression  */
-#line 1384 "parser.y"
+  case 303: /* expression: '*' expression  */
+#line 1399 "parser.y"
                                      { (yyval.uval) = bx_dbg_lin_indirect((yyvsp[0].uval)); }
-#line 4370 "y.tab.c"
+#line 4382 "y.tab.c"
     break;
 
-  case 301: /* expression: '@' expression  */
-#line 1385 "parser.y"
+  case 304: /* expression: '@' expression  */
+#line 1400 "parser.y"
                                      { (yyval.uval) = bx_dbg_phy_indirect((yyvsp[0].uval)); }
-#line 4376 "y.tab.c"
+#line 4388 "y.tab.c"
     break;
 
-  case 302: /* expression: '(' expression ')'  */
-#line 1386 "parser.y"
+  case 305: /* expression: '(' expression ')'  */
+#line 1401 "parser.y"
                                      { (yyval.uval) = (yyvsp[-1].uval); }
-#line 4382 "y.tab.c"
+#line 4394 "y.tab.c"
     break;
 
 
-#line 4386 "y.tab.c"
+#line 4398 "y.tab.c"
 
       default: break;
     }
@@ -4575,7 +4587,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 1389 "parser.y"
+#line 1404 "parser.y"
 
 #endif  /* if BX_DEBUGGER */
 /* The #endif is appended by the makefile after running yacc. */
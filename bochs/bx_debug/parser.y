@@ -76,6 +76,7 @@ Bit64u eval_value;
 %token <sval> BX_TOKEN_XFORMAT
 %token <sval> BX_TOKEN_DISFORMAT
 %token <sval> BX_TOKEN_RESTORE
+%token <sval> BX_TOKEN_FORK
 %token <sval> BX_TOKEN_WRITEMEM
 %token <sval> BX_TOKEN_SETPMEM
 %token <sval> BX_TOKEN_SYMBOLNAME
@@ -174,6 +175,7 @@ command:
     | quit_command
     | examine_command
     | restore_command
+    | fork_command
     | writemem_command
     | setpmem_command
     | query_command
@@ -867,6 +869,14 @@ restore_command:
       }
     ;
 
+fork_command:
+      BX_TOKEN_FORK '\n'
+      {
+        bx_dbg_fork_command();
+        free($1);
+      }
+    ;
+
 writemem_command:
       BX_TOKEN_WRITEMEM BX_TOKEN_STRING expression expression '\n'
       {
@@ -1100,6 +1110,11 @@ help_command:
          dbg_printf("restore \"cpu0\" \"/save\" - restore CPU #0 from file \"cpu0\" located in directory \"/save\"\n");
          free($1);free($2);
        }
+     | BX_TOKEN_HELP BX_TOKEN_FORK '\n'
+       {
+         dbg_printf("fork - fork the simulation, the child process continues with volatile disk images\n");
+         free($1);free($2);
+       }
      | BX_TOKEN_HELP BX_TOKEN_PTIME '\n'
        {
          dbg_printf("ptime - print current time (number of ticks since start of simulation)\n");
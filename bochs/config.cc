@@ -465,6 +465,15 @@ void bx_init_options()
       "Unlock disk images",
       "Unlock disk images leftover previous from Bochs session",
       0);
+  // format of the saved simulation state, set in bochsrc
+  static const char *save_format_names[] = { "text", "binary", NULL };
+  new bx_param_enum_c(menu,
+      "save_format",
+      "Save state format",
+      "Format of the saved simulation state",
+      save_format_names,
+      BX_SAVE_FORMAT_TEXT,
+      BX_SAVE_FORMAT_TEXT);
 
   // subtree for setting up log actions by device in bochsrc
   bx_list_c *logfn = new bx_list_c(menu, "logfn", "Logfunctions");
@@ -532,13 +541,24 @@ void bx_init_options()
       "Emulated instructions per second, used to calibrate bochs emulated time with wall clock time.",
       BX_MIN_IPS, BX_MAX_BIT32U,
       4000000);
-#if BX_SUPPORT_SMP
+#if BX_SMP_HOST_THREADS
+  new bx_param_num_c(cpu_param,
+      "quantum", "Quantum ticks in SMP simulation",
+      "Amount of instructions every CPU thread executes between the synchronization points of the emulated time.",
+      BX_SMP_HOST_THREADS_QUANTUM_MIN, BX_SMP_HOST_THREADS_QUANTUM_MAX,
+      BX_SMP_HOST_THREADS_QUANTUM_DEFAULT);
+#elif BX_SUPPORT_SMP
   new bx_param_num_c(cpu_param,
       "quantum", "Quantum ticks in SMP simulation",
       "Maximum amount of instructions allowed to execute before returning control to another CPU.",
       BX_SMP_QUANTUM_MIN, BX_SMP_QUANTUM_MAX,
       16);
 #endif
+  new bx_param_num_c(cpu_param,
+      "icache_size", "Trace cache size (K entries)",
+      "Number of trace cache entries per processor in K, must be power of 2",
+      4, 256,
+      64);
   new bx_param_bool_c(cpu_param,
       "reset_on_triple_fault", "Enable CPU reset on triple fault",
       "Enable CPU reset if triple fault occurred (highly recommended)",
@@ -823,6 +843,31 @@ void bx_init_options()
       4, 8192,
       128);
   mem_block_size->set_ask_format("Enter memory block size (KB): [%d] ");
+
+  bx_param_bool_c *mem_mmap = new bx_param_bool_c(ram,
+      "mmap",
+      "Map guest RAM",
+      "Map guest RAM using mmap() instead of allocating it from the heap",
+      0);
+  deplist = new bx_list_c(NULL);
+  deplist->add(new bx_param_bool_c(ram,
+      "hugepages",
+      "Use huge pages",
+      "Back mapped guest RAM with huge pages if the host supports them",
+      0));
+  path = new bx_param_filename_c(ram,
+      "file",
+      "Guest RAM image",
+      "Pathname of the file mapped copy-on-write as initial guest RAM contents",
+      "", BX_PATHNAME_LEN);
+  path->set_format("Name of guest RAM image: %s");
+  deplist->add(path);
+  mem_mmap->set_dependent_list(deplist);
+  new bx_param_bool_c(ram,
+      "incremental_save",
+      "Incremental RAM save",
+      "Save only the RAM pages modified since the previous checkpoint",
+      0);
   ram->set_options(ram->SERIES_ASK);
 
   path = new bx_param_filename_c(rom,
@@ -1509,6 +1554,18 @@ void bx_init_options()
         BX_ATA_TRANSLATION_NONE);
       translation->set_ask_format("Enter translation type: [%s]");
 
+      new bx_param_bool_c(menu,
+        "async",
+        "Asynchronous I/O",
+        "Access the disk image from host I/O threads",
+        0);
+
+      new bx_param_bool_c(menu,
+        "commit",
+        "Commit redolog at exit",
+        "Write the changes of an undoable disk to the base image at exit",
+        0);
+
       // the master/slave menu depends on the ATA channel's enabled flag
       enabled->get_dependent_list()->add(menu);
       // the type selector depends on the ATA channel's enabled flag
@@ -1516,7 +1573,7 @@ void bx_init_options()
 
       // all items depend on the drive type
       type->set_dependent_list(menu->clone(), 0);
-      type->set_dependent_bitmap(BX_ATA_DEVICE_DISK, 0xfe6);
+      type->set_dependent_bitmap(BX_ATA_DEVICE_DISK, 0x3fe6);
       type->set_dependent_bitmap(BX_ATA_DEVICE_CDROM, 0x60a);
 
       type->set_handler(bx_param_handler);
@@ -2724,6 +2781,12 @@ static int parse_line_formatted(const char *context, int num_params, char *param
       PARSE_ERR(("%s: logprefix directive has wrong # args.", context));
     }
     SIM->get_param_string(BXPN_LOG_PREFIX)->set(params[1]);
+  } else if (!strcmp(params[0], "save_format")) {
+    if (num_params != 2) {
+      PARSE_ERR(("%s: save_format directive: wrong # args.", context));
+    }
+    if (!SIM->get_param_enum(BXPN_SAVE_FORMAT)->set_by_name(params[1]))
+      PARSE_ERR(("%s: save_format '%s' not available", context, params[1]));
   } else if (!strcmp(params[0], "debugger_log")) {
     if (num_params != 2) {
       PARSE_ERR(("%s: debugger_log directive has wrong # args.", context));
@@ -2804,6 +2867,14 @@ static int parse_line_formatted(const char *context, int num_params, char *param
         SIM->get_param_num(BXPN_MEM_SIZE)->set(atol(&params[i][6]));
       } else if (!strncmp(params[i], "block_size=", 11)) {
         SIM->get_param_num(BXPN_MEM_BLOCK_SIZE)->set(atol(&params[i][11]));
+      } else if (!strncmp(params[i], "mmap=", 5)) {
+        SIM->get_param_bool(BXPN_MEM_MMAP)->set(atol(&params[i][5]));
+      } else if (!strncmp(params[i], "hugepages=", 10)) {
+        SIM->get_param_bool(BXPN_MEM_HUGEPAGES)->set(atol(&params[i][10]));
+      } else if (!strncmp(params[i], "file=", 5)) {
+        SIM->get_param_string(BXPN_MEM_FILE)->set(&params[i][5]);
+      } else if (!strncmp(params[i], "incremental_save=", 17)) {
+        SIM->get_param_bool(BXPN_MEM_INCREMENTAL_SAVE)->set(atol(&params[i][17]));
       } else {
         PARSE_ERR(("%s: memory directive malformed.", context));
       }
@@ -3425,8 +3496,18 @@ int bx_write_configuration(const char *rc, int overwrite)
     fprintf(fp, ", options=\"%s\"\n", sparam->getptr());
   else
     fprintf(fp, "\n");
-  fprintf(fp, "memory: host=%d, guest=%d\n", SIM->get_param_num(BXPN_HOST_MEM_SIZE)->get(),
+  fprintf(fp, "memory: host=%d, guest=%d", SIM->get_param_num(BXPN_HOST_MEM_SIZE)->get(),
     SIM->get_param_num(BXPN_MEM_SIZE)->get());
+  if (SIM->get_param_bool(BXPN_MEM_MMAP)->get()) {
+    fprintf(fp, ", mmap=1, hugepages=%d", SIM->get_param_bool(BXPN_MEM_HUGEPAGES)->get());
+    sparam = SIM->get_param_string(BXPN_MEM_FILE);
+    if (!sparam->isempty())
+      fprintf(fp, ", file=\"%s\"", sparam->getptr());
+  }
+  if (SIM->get_param_bool(BXPN_MEM_INCREMENTAL_SAVE)->get()) {
+    fprintf(fp, ", incremental_save=1");
+  }
+  fprintf(fp, "\n");
 
   bx_write_param_list(fp, (bx_list_c*) SIM->get_param(BXPN_ROMIMAGE), "romimage", 0);
   bx_write_param_list(fp, (bx_list_c*) SIM->get_param(BXPN_VGA_ROMIMAGE), "vgaromimage", 0);
@@ -3495,8 +3576,9 @@ int bx_write_configuration(const char *rc, int overwrite)
 #else
   fprintf(fp, "cpu: count=1, ips=%u, ", SIM->get_param_num(BXPN_IPS)->get());
 #endif
-  fprintf(fp, "model=%s, reset_on_triple_fault=%d, cpuid_limit_winnt=%d",
+  fprintf(fp, "model=%s, icache_size=%u, reset_on_triple_fault=%d, cpuid_limit_winnt=%d",
     SIM->get_param_enum(BXPN_CPU_MODEL)->get_selected(),
+    SIM->get_param_num(BXPN_ICACHE_SIZE)->get(),
     SIM->get_param_bool(BXPN_RESET_ON_TRIPLE_FAULT)->get(),
     SIM->get_param_bool(BXPN_CPUID_LIMIT_WINNT)->get());
 #if BX_CPU_LEVEL >= 5
@@ -3520,6 +3602,7 @@ int bx_write_configuration(const char *rc, int overwrite)
 #endif
 
   fprintf(fp, "print_timestamps: enabled=%d\n", bx_dbg.print_timestamps);
+  fprintf(fp, "save_format: %s\n", SIM->get_param_enum(BXPN_SAVE_FORMAT)->get_selected());
   bx_write_debugger_options(fp);
   fprintf(fp, "port_e9_hack: enabled=%d\n", SIM->get_param_bool(BXPN_PORT_E9_HACK)->get());
   fprintf(fp, "private_colormap: enabled=%d\n", SIM->get_param_bool(BXPN_PRIVATE_COLORMAP)->get());
@@ -605,6 +605,24 @@ BX_CPU_C::read_linear_zmmword_aligned(unsigned s, bx_address laddr, BxPackedZmmR
 // address translation info is kept across read/write calls //
 //////////////////////////////////////////////////////////////
 
+#if BX_SMP_HOST_THREADS
+// Another processor thread might have modified the operand since it was
+// read, the instruction is restarted in this case. Misaligned operands are
+// written without atomicity guarantee.
+#define BX_WRITE_RMW_HOST(type, hostAddr, val) {                               \
+  if (BX_CPU_THIS_PTR address_xlation.rmw_atomic &&                             \
+     ((bx_ptr_equiv_t)(hostAddr) & (sizeof(type) - 1)) == 0) {                  \
+    type expected = (type) BX_CPU_THIS_PTR address_xlation.rmw_data[0];         \
+    if (! __atomic_compare_exchange_n((hostAddr), &expected, (val), false,      \
+                      __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))                      \
+      restart_instruction();                                                    \
+  }                                                                             \
+  else {                                                                        \
+    *(hostAddr) = (val);                                                        \
+  }                                                                             \
+}
+#endif
+
   Bit8u BX_CPP_AttrRegparmN(2)
 BX_CPU_C::read_RMW_linear_byte(unsigned s, bx_address laddr)
 {
@@ -624,6 +642,10 @@ BX_CPU_C::read_RMW_linear_byte(unsigned s, bx_address laddr)
       BX_CPU_THIS_PTR address_xlation.paddress1 = pAddr;
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
+#endif
+#if BX_SMP_HOST_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_data[0] = data;
+      BX_CPU_THIS_PTR address_xlation.rmw_atomic = true;
 #endif
       BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 1, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
       return data;
@@ -633,6 +655,14 @@ BX_CPU_C::read_RMW_linear_byte(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 1, CPL, BX_RW, 0x0, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+#if BX_SMP_HOST_THREADS
+  // the translation is in the TLB now, access the memory through the host
+  // pointer so the write could be done atomically
+  tlbEntry = BX_DTLB_ENTRY_OF(laddr, 0);
+  if (tlbEntry->lpf == lpf && isWriteOK(tlbEntry, USER_PL))
+    return read_RMW_linear_byte(s, laddr);
+#endif
+
   return data;
 }
 
@@ -659,6 +689,10 @@ BX_CPU_C::read_RMW_linear_word(unsigned s, bx_address laddr)
       BX_CPU_THIS_PTR address_xlation.paddress1 = pAddr;
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
+#endif
+#if BX_SMP_HOST_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_data[0] = data;
+      BX_CPU_THIS_PTR address_xlation.rmw_atomic = true;
 #endif
       BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 2, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
       return data;
@@ -668,6 +702,14 @@ BX_CPU_C::read_RMW_linear_word(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 2, CPL, BX_RW, 0x1, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+#if BX_SMP_HOST_THREADS
+  // the translation is in the TLB now, access the memory through the host
+  // pointer so the write could be done atomically
+  tlbEntry = BX_DTLB_ENTRY_OF(laddr, 1);
+  if (tlbEntry->lpf == lpf && isWriteOK(tlbEntry, USER_PL))
+    return read_RMW_linear_word(s, laddr);
+#endif
+
   return data;
 }
 
@@ -694,6 +736,10 @@ BX_CPU_C::read_RMW_linear_dword(unsigned s, bx_address laddr)
       BX_CPU_THIS_PTR address_xlation.paddress1 = pAddr;
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
+#endif
+#if BX_SMP_HOST_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_data[0] = data;
+      BX_CPU_THIS_PTR address_xlation.rmw_atomic = true;
 #endif
       BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 4, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
       return data;
@@ -703,6 +749,14 @@ BX_CPU_C::read_RMW_linear_dword(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 4, CPL, BX_RW, 0x3, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+#if BX_SMP_HOST_THREADS
+  // the translation is in the TLB now, access the memory through the host
+  // pointer so the write could be done atomically
+  tlbEntry = BX_DTLB_ENTRY_OF(laddr, 3);
+  if (tlbEntry->lpf == lpf && isWriteOK(tlbEntry, USER_PL))
+    return read_RMW_linear_dword(s, laddr);
+#endif
+
   return data;
 }
 
@@ -729,6 +783,10 @@ BX_CPU_C::read_RMW_linear_qword(unsigned s, bx_address laddr)
       BX_CPU_THIS_PTR address_xlation.paddress1 = pAddr;
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
+#endif
+#if BX_SMP_HOST_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_data[0] = data;
+      BX_CPU_THIS_PTR address_xlation.rmw_atomic = true;
 #endif
       BX_NOTIFY_LIN_MEMORY_ACCESS(laddr, pAddr, 8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) &data);
       return data;
@@ -738,6 +796,14 @@ BX_CPU_C::read_RMW_linear_qword(unsigned s, bx_address laddr)
   if (access_read_linear(laddr, 8, CPL, BX_RW, 0x7, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+#if BX_SMP_HOST_THREADS
+  // the translation is in the TLB now, access the memory through the host
+  // pointer so the write could be done atomically
+  tlbEntry = BX_DTLB_ENTRY_OF(laddr, 7);
+  if (tlbEntry->lpf == lpf && isWriteOK(tlbEntry, USER_PL))
+    return read_RMW_linear_qword(s, laddr);
+#endif
+
   return data;
 }
 
@@ -750,7 +816,11 @@ BX_CPU_C::write_RMW_linear_byte(Bit8u val8)
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit8u *hostAddr = (Bit8u *) BX_CPU_THIS_PTR address_xlation.pages;
+#if BX_SMP_HOST_THREADS
+    BX_WRITE_RMW_HOST(Bit8u, hostAddr, val8);
+#else
     *hostAddr = val8;
+#endif
   }
   else {
     // address_xlation.pages must be 1
@@ -764,7 +834,11 @@ BX_CPU_C::write_RMW_linear_word(Bit16u val16)
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit16u *hostAddr = (Bit16u *) BX_CPU_THIS_PTR address_xlation.pages;
+#if BX_SMP_HOST_THREADS
+    BX_WRITE_RMW_HOST(Bit16u, hostAddr, val16);
+#else
     WriteHostWordToLittleEndian(hostAddr, val16);
+#endif
     BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
         BX_CPU_THIS_PTR address_xlation.paddress1, 2, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1),
         BX_WRITE, 0, (Bit8u*) &val16);
@@ -804,7 +878,11 @@ BX_CPU_C::write_RMW_linear_dword(Bit32u val32)
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit32u *hostAddr = (Bit32u *) BX_CPU_THIS_PTR address_xlation.pages;
+#if BX_SMP_HOST_THREADS
+    BX_WRITE_RMW_HOST(Bit32u, hostAddr, val32);
+#else
     WriteHostDWordToLittleEndian(hostAddr, val32);
+#endif
     BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
         BX_CPU_THIS_PTR address_xlation.paddress1, 4, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1),
         BX_WRITE, 0, (Bit8u*) &val32);
@@ -854,7 +932,11 @@ BX_CPU_C::write_RMW_linear_qword(Bit64u val64)
   if (BX_CPU_THIS_PTR address_xlation.pages > 2) {
     // Pages > 2 means it stores a host address for direct access.
     Bit64u *hostAddr = (Bit64u *) BX_CPU_THIS_PTR address_xlation.pages;
+#if BX_SMP_HOST_THREADS
+    BX_WRITE_RMW_HOST(Bit64u, hostAddr, val64);
+#else
     WriteHostQWordToLittleEndian(hostAddr, val64);
+#endif
     BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
         BX_CPU_THIS_PTR address_xlation.paddress1, 8, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1),
         BX_WRITE, 0, (Bit8u*) &val64);
@@ -918,6 +1000,11 @@ void BX_CPU_C::read_RMW_linear_dqword_aligned_64(unsigned s, bx_address laddr, B
       BX_CPU_THIS_PTR address_xlation.paddress1 = pAddr;
 #if BX_SUPPORT_MEMTYPE
       BX_CPU_THIS_PTR address_xlation.memtype1 = tlbEntry->get_memtype();
+#endif
+#if BX_SMP_HOST_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_data[0] = *lo;
+      BX_CPU_THIS_PTR address_xlation.rmw_data[1] = *hi;
+      BX_CPU_THIS_PTR address_xlation.rmw_atomic = true;
 #endif
       BX_NOTIFY_LIN_MEMORY_ACCESS(laddr,     pAddr,     8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) lo);
       BX_NOTIFY_LIN_MEMORY_ACCESS(laddr + 8, pAddr + 8, 8, tlbEntry->get_memtype(), BX_RW, (Bit8u*) hi);
@@ -934,12 +1021,43 @@ void BX_CPU_C::read_RMW_linear_dqword_aligned_64(unsigned s, bx_address laddr, B
   if (access_read_linear(laddr, 16, CPL, BX_RW, 0x0, (void *) &data) < 0)
     exception(int_number(s), 0);
 
+#if BX_SMP_HOST_THREADS
+  tlbEntry = BX_DTLB_ENTRY_OF(laddr, 0);
+  if (tlbEntry->lpf == lpf && isWriteOK(tlbEntry, USER_PL)) {
+    read_RMW_linear_dqword_aligned_64(s, laddr, hi, lo);
+    return;
+  }
+#endif
+
   *lo = data.xmm64u(0);
   *hi = data.xmm64u(1);
 }
 
 void BX_CPU_C::write_RMW_linear_dqword(Bit64u hi, Bit64u lo)
 {
+#if BX_SMP_HOST_THREADS
+  if (BX_CPU_THIS_PTR address_xlation.pages > 2 && BX_CPU_THIS_PTR address_xlation.rmw_atomic) {
+    // the operand is 16-byte aligned, replace it with a single cmpxchg16b
+    Bit64u *hostAddr = (Bit64u *) BX_CPU_THIS_PTR address_xlation.pages;
+    Bit64u expected_lo = BX_CPU_THIS_PTR address_xlation.rmw_data[0];
+    Bit64u expected_hi = BX_CPU_THIS_PTR address_xlation.rmw_data[1];
+    bool ok;
+    __asm__ __volatile__ ("lock; cmpxchg16b %1; setz %0"
+      : "=q" (ok), "+m" (*(volatile Bit64u (*)[2]) hostAddr), "+a" (expected_lo), "+d" (expected_hi)
+      : "b" (lo), "c" (hi)
+      : "memory", "cc");
+    if (! ok)
+      restart_instruction();
+    BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
+        BX_CPU_THIS_PTR address_xlation.paddress1, 8, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1),
+        BX_WRITE, 0, (Bit8u*) &lo);
+    BX_DBG_PHY_MEMORY_ACCESS(BX_CPU_ID,
+        BX_CPU_THIS_PTR address_xlation.paddress1 + 8, 8, MEMTYPE(BX_CPU_THIS_PTR address_xlation.memtype1),
+        BX_WRITE, 0, (Bit8u*) &hi);
+    return;
+  }
+#endif
+
   write_RMW_linear_qword(lo);
 
   BX_CPU_THIS_PTR address_xlation.paddress1 += 8;
@@ -28,7 +28,7 @@
 #include "pc_system.h"
 #include "cpustats.h"
 
-#if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
+#if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS || BX_LAZY_TIME_ACCOUNTING
 
 #define BX_SYNC_TIME_IF_SINGLE_PROCESSOR(allowed_delta) {                               \
   if (BX_SMP_PROCESSORS == 1) {                                                         \
@@ -47,7 +47,40 @@
 
 #endif
 
+#if BX_SMP_HOST_THREADS == 0
 jmp_buf BX_CPU_C::jmp_buf_env;
+#endif
+
+#if BX_SUPPORT_DBT
+
+// Execute the trace using its translated host code, the trace is translated
+// once it was executed BX_DBT_HOT_TRACE_THRESHOLD times. Returns false when
+// the trace has to be interpreted.
+BX_CPP_INLINE bool BX_CPU_C::executeTranslatedTrace(bxICacheEntry_c *entry)
+{
+  if (entry->dbtCode == NULL) {
+    if (++entry->execCount < BX_DBT_HOT_TRACE_THRESHOLD) return false;
+    if (! translateTrace(entry)) return false;
+  }
+
+#if BX_LAZY_TIME_ACCOUNTING
+  // translated code doesn't advance emulated time, let the interpreter
+  // execute the trace if a timer might fire in the middle of it
+  if (BX_SMP_PROCESSORS == 1 && entry->tlen >= bx_pc_system.getNumCpuTicksLeftNextEvent())
+    return false;
+#endif
+
+  INC_ICACHE_STAT(dbtExecutions);
+
+  entry->dbtCode(BX_CPU_THIS);
+
+#if BX_LAZY_TIME_ACCOUNTING
+  BX_SYNC_TIME_IF_SINGLE_PROCESSOR(0);
+#endif
+  return true;
+}
+
+#endif
 
 void BX_CPU_C::cpu_loop(void)
 {
@@ -113,8 +146,22 @@ void BX_CPU_C::cpu_loop(void)
     }
 #else // BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS == 0
 
+#if BX_SUPPORT_DBT
+    if (executeTranslatedTrace(entry)) {
+      // clear stop trace magic indication that probably was set by repeat or branch32/64
+      BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
+      continue;
+    }
+#endif
+
     bxInstruction_c *last = i + (entry->tlen);
 
+#if BX_LAZY_TIME_ACCOUNTING
+    // emulated time is charged once for the whole trace when no timer
+    // could fire before the trace end
+    bool lazyTime = (entry->tlen < bx_pc_system.getNumCpuTicksLeftNextEvent());
+#endif
+
     for(;;) {
 
 #if BX_DEBUGGER
@@ -130,7 +177,10 @@ void BX_CPU_C::cpu_loop(void)
       BX_INSTR_AFTER_EXECUTION(BX_CPU_ID, i);
       BX_CPU_THIS_PTR icount++;
 
-      BX_SYNC_TIME_IF_SINGLE_PROCESSOR(0);
+#if BX_LAZY_TIME_ACCOUNTING
+      if (! lazyTime)
+#endif
+        BX_SYNC_TIME_IF_SINGLE_PROCESSOR(0);
 
       // note instructions generating exceptions never reach this point
 #if BX_DEBUGGER || BX_GDBSTUB
@@ -140,15 +190,30 @@ void BX_CPU_C::cpu_loop(void)
       if (BX_CPU_THIS_PTR async_event) break;
 
       if (++i == last) {
+#if BX_SUPPORT_DBT
+        // the next trace might be already translated, dispatch it from the main loop
+        break;
+#else
+#if BX_LAZY_TIME_ACCOUNTING
+        BX_SYNC_TIME_IF_SINGLE_PROCESSOR(0);
+#endif
         entry = getICacheEntry();
         i = entry->i;
         last = i + (entry->tlen);
+#if BX_LAZY_TIME_ACCOUNTING
+        lazyTime = (entry->tlen < bx_pc_system.getNumCpuTicksLeftNextEvent());
+#endif
+#endif
       }
     }
+
+#if BX_LAZY_TIME_ACCOUNTING
+    BX_SYNC_TIME_IF_SINGLE_PROCESSOR(0);
+#endif
 #endif
 
     // clear stop trace magic indication that probably was set by repeat or branch32/64
-    BX_CPU_THIS_PTR async_event &= ~BX_ASYNC_EVENT_STOP_TRACE;
+    BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
 
   }  // while (1)
 }
@@ -178,9 +243,18 @@ void BX_CPU_C::cpu_run_trace(void)
 
   if (BX_CPU_THIS_PTR async_event) {
     // clear stop trace magic indication that probably was set by repeat or branch32/64
-    BX_CPU_THIS_PTR async_event &= ~BX_ASYNC_EVENT_STOP_TRACE;
+    BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
   }
 #else
+
+#if BX_SUPPORT_DBT
+  if (executeTranslatedTrace(entry)) {
+    // clear stop trace magic indication that probably was set by repeat or branch32/64
+    BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
+    return;
+  }
+#endif
+
   bxInstruction_c *last = i + (entry->tlen);
 
   for(;;) {
@@ -194,7 +268,7 @@ void BX_CPU_C::cpu_run_trace(void)
 
     if (BX_CPU_THIS_PTR async_event) {
       // clear stop trace magic indication that probably was set by repeat or branch32/64
-      BX_CPU_THIS_PTR async_event &= ~BX_ASYNC_EVENT_STOP_TRACE;
+      BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
       break;
     }
 
@@ -205,6 +279,63 @@ void BX_CPU_C::cpu_run_trace(void)
 
 #endif
 
+#if BX_SMP_HOST_THREADS
+
+// Executes the processor in its own host thread until it runs the quantum
+// of instructions, returns the number of instructions to account for the
+// emulated time. A halted processor accounts for the whole quantum.
+Bit32u BX_CPU_C::cpu_run_quantum(Bit32u quantum)
+{
+  int ret = setjmp(BX_CPU_THIS_PTR jmp_buf_env);
+  if (ret) {
+    // can get here only from exception function, VMEXIT or restarted
+    // instruction, the simulator lock is not released by them
+    bx_pc_system.sim_unlock_all();
+    if (ret == 1)
+      BX_CPU_THIS_PTR icount++;
+  }
+  else {
+    // check for the events and the requests posted since the last
+    // synchronization point
+    signal_async_event();
+  }
+
+  BX_CPU_THIS_PTR prev_rip = RIP; // commit new EIP
+  BX_CPU_THIS_PTR speculative_rsp = false;
+
+  while ((BX_CPU_THIS_PTR icount - BX_CPU_THIS_PTR icount_last_sync) < quantum) {
+    if (bx_pc_system.kill_bochs_request || bx_pc_system.reset_request)
+      break;
+
+    Bit64u prev_icount = BX_CPU_THIS_PTR icount;
+    cpu_run_trace();
+    if (BX_CPU_THIS_PTR icount == prev_icount)
+      break; // the processor is halted
+  }
+
+  Bit32u executed = (Bit32u)(BX_CPU_THIS_PTR icount - BX_CPU_THIS_PTR icount_last_sync);
+  BX_CPU_THIS_PTR icount_last_sync = BX_CPU_THIS_PTR icount;
+  return BX_MAX(executed, quantum);
+}
+
+// The operand of the atomic instruction was modified by another processor
+// thread, the instruction is executed again from the beginning
+void BX_CPU_C::restart_instruction(void)
+{
+  RIP = BX_CPU_THIS_PTR prev_rip;
+  if (BX_CPU_THIS_PTR speculative_rsp) {
+    RSP = BX_CPU_THIS_PTR prev_rsp;
+#if BX_SUPPORT_CET
+    SSP = BX_CPU_THIS_PTR prev_ssp;
+#endif
+  }
+  BX_CPU_THIS_PTR speculative_rsp = false;
+
+  longjmp(BX_CPU_THIS_PTR jmp_buf_env, 2); // go back to main decode loop
+}
+
+#endif
+
 #include "decoder/ia_opcodes.h"
 
 bxICacheEntry_c* BX_CPU_C::getICacheEntry(void)
@@ -217,6 +348,7 @@ bxICacheEntry_c* BX_CPU_C::getICacheEntry(void)
   }
 
   INC_ICACHE_STAT(iCacheLookups);
+  INC_ICACHE_STAT(iCacheTraceDispatches);
 
   bx_phy_address pAddr = BX_CPU_THIS_PTR pAddrFetchPage + eipBiased;
   bxICacheEntry_c *entry = BX_CPU_THIS_PTR iCache.find_entry(pAddr, BX_CPU_THIS_PTR fetchModeMask);
@@ -273,6 +405,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::linkTrace(bxInstruction_c *i)
 
   bxInstruction_c *next = i->getNextTrace(BX_CPU_THIS_PTR iCache.traceLinkTimeStamp);
   if (next) {
+    INC_ICACHE_STAT(iCacheTraceDispatches);
     BX_EXECUTE_INSTRUCTION(next);
     return;
   }
@@ -291,6 +424,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::linkTrace(bxInstruction_c *i)
   if (entry != NULL) // link traces - handle only hit cases
   {
     i->setNextTrace(entry->i, BX_CPU_THIS_PTR iCache.traceLinkTimeStamp);
+    INC_ICACHE_STAT(iCacheTraceDispatches);
     i = entry->i;
     BX_EXECUTE_INSTRUCTION(i);
   }
@@ -381,7 +515,7 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::repeat(bxInstruction_c *i, BxRepIterationP
   RIP = BX_CPU_THIS_PTR prev_rip; // repeat loop not done, restore RIP
 
   // assert magic async_event to stop trace execution
-  BX_CPU_THIS_PTR async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+  BX_EVENT_SET_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
 }
 
 void BX_CPP_AttrRegparmN(2) BX_CPU_C::repeat_ZF(bxInstruction_c *i, BxRepIterationPtr_tR execute)
@@ -532,7 +666,7 @@ void BX_CPP_AttrRegparmN(2) BX_CPU_C::repeat_ZF(bxInstruction_c *i, BxRepIterati
   RIP = BX_CPU_THIS_PTR prev_rip; // repeat loop not done, restore RIP
 
   // assert magic async_event to stop trace execution
-  BX_CPU_THIS_PTR async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+  BX_EVENT_SET_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
 }
 
 // boundaries of consideration:
@@ -30,6 +30,10 @@
 
 #include "instrument.h"
 
+#if BX_SMP_HOST_THREADS
+#include "pc_system.h"
+#endif
+
 const Bit64u BX_PHY_ADDRESS_MASK = ((((Bit64u)(1)) << BX_PHY_ADDRESS_WIDTH) - 1);
 
 const Bit64u BX_PHY_ADDRESS_RESERVED_BITS = (~BX_PHY_ADDRESS_MASK);
@@ -442,6 +446,10 @@ typedef void (BX_CPU_C::*BxRepIterationPtr_tR)(bxInstruction_c *) BX_CPP_AttrReg
 #if BX_SUPPORT_SMP
 // multiprocessor simulation, we need an array of cpus and memories
 BOCHSAPI extern BX_CPU_C **bx_cpu_array;
+#if BX_SMP_HOST_THREADS
+// the processor executed by the calling host thread, NULL in the other threads
+BOCHSAPI extern __thread BX_CPU_C *bx_current_cpu;
+#endif
 #else
 // single processor simulation, so there's one of everything
 BOCHSAPI extern BX_CPU_C   bx_cpu;
@@ -671,6 +679,7 @@ typedef struct
 #include "decoder/instr.h"
 #include "lazy_flags.h"
 #include "tlb.h"
+#include "dbt.h"
 #include "icache.h"
 
 // general purpose register
@@ -1077,21 +1086,38 @@ public: // for now...
   Bit32u  event_mask;
   Bit32u  async_event; // keep 32-bit because of BX_ASYNC_EVENT_STOP_TRACE
 
+#if BX_SMP_HOST_THREADS
+// the events are signalled by the other processor threads as well
+#define BX_EVENT_SET_BITS(var, bits)   __atomic_or_fetch(&(var), (bits), __ATOMIC_SEQ_CST)
+#define BX_EVENT_CLEAR_BITS(var, bits) __atomic_and_fetch(&(var), ~(bits), __ATOMIC_SEQ_CST)
+#else
+#define BX_EVENT_SET_BITS(var, bits)   (var) |= (bits)
+#define BX_EVENT_CLEAR_BITS(var, bits) (var) &= ~(bits)
+#endif
+
+  BX_SMF BX_CPP_INLINE void signal_async_event(void) {
+#if BX_SMP_HOST_THREADS
+    BX_EVENT_SET_BITS(BX_CPU_THIS_PTR async_event, 1);
+#else
+    BX_CPU_THIS_PTR async_event = 1;
+#endif
+  }
+
   BX_SMF BX_CPP_INLINE void signal_event(Bit32u event) {
-    BX_CPU_THIS_PTR pending_event |= event;
-    if (! is_masked_event(event)) BX_CPU_THIS_PTR async_event = 1;
+    BX_EVENT_SET_BITS(BX_CPU_THIS_PTR pending_event, event);
+    if (! is_masked_event(event)) signal_async_event();
   }
 
   BX_SMF BX_CPP_INLINE void clear_event(Bit32u event) {
-    BX_CPU_THIS_PTR pending_event &= ~event;
+    BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR pending_event, event);
   }
 
   BX_SMF BX_CPP_INLINE void mask_event(Bit32u event) {
-    BX_CPU_THIS_PTR event_mask |= event;
+    BX_EVENT_SET_BITS(BX_CPU_THIS_PTR event_mask, event);
   }
   BX_SMF BX_CPP_INLINE void unmask_event(Bit32u event) {
-    BX_CPU_THIS_PTR event_mask &= ~event;
-    if (is_pending(event)) BX_CPU_THIS_PTR async_event = 1;
+    BX_EVENT_CLEAR_BITS(BX_CPU_THIS_PTR event_mask, event);
+    if (is_pending(event)) signal_async_event();
   }
 
   BX_SMF BX_CPP_INLINE bool is_masked_event(Bit32u event) {
@@ -1109,8 +1135,50 @@ public: // for now...
     return (BX_CPU_THIS_PTR pending_event & ~BX_CPU_THIS_PTR event_mask);
   }
 
+  BX_SMF BX_CPP_INLINE void clear_async_event(void) {
+#if BX_SMP_HOST_THREADS
+    // an event signalled by another processor thread must not get lost
+    __atomic_store_n(&BX_CPU_THIS_PTR async_event, 0, __ATOMIC_SEQ_CST);
+    if (unmasked_events_pending() || BX_CPU_THIS_PTR remote.request)
+      signal_async_event();
+#else
+    BX_CPU_THIS_PTR async_event = 0;
+#endif
+  }
+
 #define BX_ASYNC_EVENT_STOP_TRACE (1<<31)
 
+#if BX_SMP_HOST_THREADS
+  // Requests posted by the other processor threads. The processor handles
+  // them itself on its next instruction boundary, at the latest on the
+  // next synchronization point of the emulated time.
+#define BX_REMOTE_REQUEST_TLB_FLUSH    (1 << 0)
+#define BX_REMOTE_REQUEST_ICACHE_FLUSH (1 << 1)
+#define BX_REMOTE_REQUEST_SMC          (1 << 2)
+#define BX_REMOTE_REQUEST_SIPI         (1 << 3)
+
+  // the whole trace cache is flushed when the queue overflows
+#define BX_REMOTE_SMC_QUEUE_SIZE 16
+
+  struct {
+    Bit32u lock;
+    Bit32u request;
+    unsigned smc_count;
+    bx_phy_address smc_addr[BX_REMOTE_SMC_QUEUE_SIZE];
+    Bit32u smc_mask[BX_REMOTE_SMC_QUEUE_SIZE];
+    unsigned sipi_vector;
+  } remote;
+
+  // the processor runs in parallel with the calling thread
+  BX_SMF BX_CPP_INLINE bool is_running_remotely(void) {
+    return bx_pc_system.cpu_threads_running && bx_current_cpu != BX_CPU_THIS;
+  }
+
+  BX_SMF void post_remote_request(Bit32u request);
+  BX_SMF void post_remote_smc(bx_phy_address pAddr, Bit32u mask);
+  BX_SMF void handle_remote_requests(void);
+#endif
+
 #if BX_X86_DEBUGGER
   bool  in_repeat;
 #endif
@@ -1132,7 +1200,11 @@ public: // for now...
 #endif
 
   // for exceptions
+#if BX_SMP_HOST_THREADS
+  jmp_buf jmp_buf_env; // every processor runs in its own host thread
+#else
   static jmp_buf jmp_buf_env;
+#endif
   unsigned last_exception_type;
 
   // Boundaries of current code page, based on EIP
@@ -1232,6 +1304,12 @@ public: // for now...
 #if BX_SUPPORT_MEMTYPE
     BxMemtype memtype1;       // memory type of the page 1
     BxMemtype memtype2;       // memory type of the page 2
+#endif
+#if BX_SMP_HOST_THREADS
+    Bit64u rmw_data[2];       // data read through the native host pointer, the
+                              // write fails when another processor thread
+                              // modified it meanwhile
+    bool rmw_atomic;          // false when the write has not to be atomic
 #endif
   } address_xlation;
 
@@ -1561,6 +1639,26 @@ public: // for now...
   BX_SMF void JLE_Jd(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void JNLE_Jd(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
 
+#if BX_SUPPORT_SUPERBLOCKS
+  BX_SMF void JMP_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JO_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNO_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JB_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNB_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JZ_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNZ_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JBE_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNBE_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JS_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNS_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JP_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNP_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JL_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNL_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JLE_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNLE_Jd_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+
   BX_SMF void SETO_EbR(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void SETNO_EbR(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void SETB_EbR(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
@@ -4047,6 +4145,26 @@ public: // for now...
   BX_SMF void JLE_Jq(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void JNLE_Jq(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
 
+#if BX_SUPPORT_SUPERBLOCKS
+  BX_SMF void JMP_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JO_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNO_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JB_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNB_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JZ_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNZ_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JBE_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNBE_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JS_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNS_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JP_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNP_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JL_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNL_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JLE_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+  BX_SMF void JNLE_Jq_Superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+
   BX_SMF void ENTER64_IwIb(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void LEAVE64(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
   BX_SMF void IRET64(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
@@ -4304,6 +4422,10 @@ public: // for now...
   BX_SMF void cpu_loop(void);
 #if BX_SUPPORT_SMP
   BX_SMF void cpu_run_trace(void);
+#endif
+#if BX_SMP_HOST_THREADS
+  BX_SMF Bit32u cpu_run_quantum(Bit32u quantum);
+  BX_SMF void restart_instruction(void) BX_CPP_AttrNoReturn();
 #endif
   BX_SMF bool handleAsyncEvent(void);
   BX_SMF bool handleWaitForEvent(void);
@@ -4314,8 +4436,15 @@ public: // for now...
   BX_SMF bxICacheEntry_c *serveICacheMiss(Bit32u eipBiased, bx_phy_address pAddr);
   BX_SMF bxICacheEntry_c* getICacheEntry(void);
   BX_SMF bool mergeTraces(bxICacheEntry_c *entry, bxInstruction_c *i, bx_phy_address pAddr);
+#if BX_SUPPORT_SUPERBLOCKS
+  BX_SMF bool genSuperblockBranch(bxInstruction_c *i, unsigned remainingInPage);
+#endif
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS && BX_ENABLE_TRACE_LINKING
   BX_SMF void linkTrace(bxInstruction_c *i) BX_CPP_AttrRegparmN(1);
+#endif
+#if BX_SUPPORT_DBT
+  BX_SMF BX_CPP_INLINE bool executeTranslatedTrace(bxICacheEntry_c *entry);
+  BX_SMF bool translateTrace(bxICacheEntry_c *entry);
 #endif
   BX_SMF void prefetch(void);
   BX_SMF void updateFetchModeMask(void);
@@ -4491,21 +4620,30 @@ public: // for now...
   BX_SMF void branch_near32(Bit32u new_EIP) BX_CPP_AttrRegparmN(1);
 #if BX_SUPPORT_X86_64
   BX_SMF void branch_near64(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
+#if BX_SUPPORT_SUPERBLOCKS
+  BX_SMF void branch_near32_superblock(Bit32u new_EIP) BX_CPP_AttrRegparmN(1);
+#if BX_SUPPORT_X86_64
+  BX_SMF void branch_near64_superblock(bxInstruction_c *) BX_CPP_AttrRegparmN(1);
+#endif
 #endif
   BX_SMF void branch_far(bx_selector_t *selector,
        bx_descriptor_t *descriptor, bx_address rip, unsigned cpl);
 
 #if BX_SUPPORT_REPEAT_SPEEDUPS
+  BX_SMF Bit32u FastRepSegAccess(unsigned seg, Bit32u offset, bool write, bx_address *laddr);
+
   BX_SMF Bit32u FastRepMOVSB(unsigned srcSeg, Bit32u srcOff, unsigned dstSeg, Bit32u dstOff, Bit32u byteCount, Bit32u granularity);
   BX_SMF Bit32u FastRepMOVSB(bx_address laddrSrc, bx_address laddrDst, Bit64u byteCount, Bit32u granularity);
 
-  BX_SMF Bit32u FastRepSTOSB(unsigned dstSeg, Bit32u dstOff, Bit8u  val, Bit32u  byteCount);
-  BX_SMF Bit32u FastRepSTOSW(unsigned dstSeg, Bit32u dstOff, Bit16u val, Bit32u  wordCount);
-  BX_SMF Bit32u FastRepSTOSD(unsigned dstSeg, Bit32u dstOff, Bit32u val, Bit32u dwordCount);
+  BX_SMF Bit32u FastRepSTOS(unsigned dstSeg, Bit32u dstOff, Bit64u val, unsigned len, Bit32u count);
+  BX_SMF Bit32u FastRepSTOS(bx_address laddrDst, Bit64u val, unsigned len, Bit32u count);
 
-  BX_SMF Bit32u FastRepSTOSB(bx_address laddrDst, Bit8u  val, Bit32u  byteCount);
-  BX_SMF Bit32u FastRepSTOSW(bx_address laddrDst, Bit16u val, Bit32u  wordCount);
-  BX_SMF Bit32u FastRepSTOSD(bx_address laddrDst, Bit32u val, Bit32u dwordCount);
+  BX_SMF Bit32u FastRepCMPS(unsigned srcSeg, Bit32u srcOff, unsigned dstSeg, Bit32u dstOff, unsigned len, Bit32u count, bool repe);
+  BX_SMF Bit32u FastRepCMPS(bx_address laddrSrc, bx_address laddrDst, unsigned len, Bit32u count, bool repe);
+
+  BX_SMF Bit32u FastRepSCAS(unsigned dstSeg, Bit32u dstOff, Bit64u val, unsigned len, Bit32u count, bool repe);
+  BX_SMF Bit32u FastRepSCAS(bx_address laddrDst, Bit64u val, unsigned len, Bit32u count, bool repe);
 
   BX_SMF Bit32u FastRepINSW(Bit32u dstOff, Bit16u port, Bit32u wordCount);
   BX_SMF Bit32u FastRepOUTSW(unsigned srcSeg, Bit32u srcOff, Bit16u port, Bit32u wordCount);
@@ -4528,6 +4666,7 @@ public: // for now...
   BX_SMF bx_phy_address translate_linear(bx_TLB_entry *entry, bx_address laddr, unsigned user, unsigned rw);
   BX_SMF bx_phy_address translate_linear_legacy(bx_address laddr, Bit32u &lpf_mask, unsigned user, unsigned rw);
   BX_SMF void update_access_dirty(bx_phy_address *entry_addr, Bit32u *entry, BxMemtype *entry_memtype, unsigned leaf, unsigned write);
+  BX_SMF void write_paging_entry_bits(bx_phy_address entry_addr, unsigned len, void *entry, Bit32u bits);
 #if BX_CPU_LEVEL >= 6
   BX_SMF bx_phy_address translate_linear_load_PDPTR(bx_address laddr, unsigned user, unsigned rw);
   BX_SMF bx_phy_address translate_linear_PAE(bx_address laddr, Bit32u &lpf_mask, unsigned user, unsigned rw);
@@ -4561,6 +4700,13 @@ public: // for now...
 #endif
   BX_SMF void TLB_flush(void);
   BX_SMF void TLB_invlpg(bx_address laddr);
+#if BX_TLB_CONTEXTS > 1
+  BX_SMF void TLB_flush(Bit32u tag, Bit32u mask);
+  BX_SMF void TLB_flushNonGlobal(Bit32u tag, Bit32u mask);
+  BX_SMF void TLB_invlpg(bx_address laddr, Bit32u tag, Bit32u mask);
+  BX_SMF Bit32u get_TLB_tag(void);
+  BX_SMF void TLB_switchContext(void);
+#endif
   BX_SMF void inhibit_interrupts(unsigned mask);
   BX_SMF bool interrupts_inhibited(unsigned mask);
   BX_SMF const char *strseg(bx_segment_reg_t *seg);
@@ -4577,7 +4723,7 @@ public: // for now...
 
   BX_SMF bool SetCR0(bxInstruction_c *i, bx_address val);
   BX_SMF bool check_CR0(bx_address val) BX_CPP_AttrRegparmN(1);
-  BX_SMF bool SetCR3(bx_address val) BX_CPP_AttrRegparmN(1);
+  BX_SMF bool SetCR3(bx_address val, bool noflush = false) BX_CPP_AttrRegparmN(2);
 #if BX_CPU_LEVEL >= 5
   BX_SMF bool SetCR4(bxInstruction_c *i, bx_address val);
   BX_SMF bool check_CR4(bx_address val) BX_CPP_AttrRegparmN(1);
@@ -4606,7 +4752,7 @@ public: // for now...
   BX_SMF void shutdown(void);
   BX_SMF void enter_sleep_state(unsigned state);
   BX_SMF void handleCpuModeChange(void);
-  BX_SMF void handleCpuContextChange(void);
+  BX_SMF void handleCpuContextChange(bool flushTLB = true);
   BX_SMF void handleInterruptMaskChange(void);
 #if BX_CPU_LEVEL >= 4
   BX_SMF void handleAlignmentCheck(void);
@@ -5675,4 +5821,24 @@ class bxInstruction_c;
 
 #endif
 
+#if BX_SUPPORT_SUPERBLOCKS
+
+// leave superblock trace on the not predicted path of followed branch,
+// the next instruction in the trace belongs to the branch target
+#if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
+#define BX_SUPERBLOCK_SIDE_EXIT(i) {                   \
+  INC_ICACHE_STAT(iCacheSideExits);                    \
+  BX_LINK_TRACE(i);                                    \
+}
+#else
+#define BX_SUPERBLOCK_SIDE_EXIT(i) {                   \
+  INC_ICACHE_STAT(iCacheSideExits);                    \
+  /* assert magic async_event to stop trace execution */ \
+  BX_EVENT_SET_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE); \
+  BX_LINK_TRACE(i);                                    \
+}
+#endif
+
+#endif
+
 #endif  // #ifndef BX_CPU_H
@@ -39,6 +39,10 @@ struct bx_cpu_statistics
   Bit64u iCacheLookups;
   Bit64u iCachePrefetch;
   Bit64u iCacheMisses;
+  Bit64u iCacheTraceDispatches;
+  Bit64u iCacheSideExits;
+  Bit64u dbtTranslations;
+  Bit64u dbtExecutions;
 
   // tlb lookup statistics
   Bit64u tlbLookups;
@@ -47,10 +51,14 @@ struct bx_cpu_statistics
   Bit64u tlbMisses;
   Bit64u tlbExecuteMisses;
   Bit64u tlbWriteMisses;
+  Bit64u tlbEvictions;
+  Bit64u tlbLargeHits;
 
   // tlb flush statistics
   Bit64u tlbGlobalFlushes;
   Bit64u tlbNonGlobalFlushes;
+  Bit64u tlbContextSwitches;
+  Bit64u tlbContextHits;
 
   // stack prefetch statistics
   Bit64u stackPrefetch;
@@ -60,9 +68,13 @@ struct bx_cpu_statistics
 
   bx_cpu_statistics():
       iCacheLookups(0), iCachePrefetch(0), iCacheMisses(0),
+      iCacheTraceDispatches(0), iCacheSideExits(0),
+      dbtTranslations(0), dbtExecutions(0),
       tlbLookups(0), tlbExecuteLookups(0), tlbWriteLookups(0),
       tlbMisses(0), tlbExecuteMisses(0), tlbWriteMisses(0),
+      tlbEvictions(0), tlbLargeHits(0),
       tlbGlobalFlushes(0), tlbNonGlobalFlushes(0),
+      tlbContextSwitches(0), tlbContextHits(0),
       stackPrefetch(0), smc(0) {}
   
 };
@@ -26,6 +26,8 @@
 #include "cpu.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
+#include "pc_system.h"
+
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOV_DdRd(bxInstruction_c *i)
 {
 #if BX_SUPPORT_VMX
@@ -708,12 +710,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOV_CR3Rq(bxInstruction_c *i)
 #endif
 
   // allow bit 63 (hint that TLB doesn't need to be cleared) to be set when
-  // PCIDE is set, but ignore the hint if given
+  // PCIDE is set
+  bool noflush = false;
   if (BX_CPU_THIS_PTR cr4.get_PCIDE()) {
+    noflush = (val_64 >> 63) != 0;
     val_64 &= ~(BX_CONST64(1)<<63);
   }
 
-  if (! SetCR3(val_64))
+  if (! SetCR3(val_64, noflush))
     exception(BX_GP_EXCEPTION, 0);
 
   BX_INSTR_TLB_CNTRL(BX_CPU_ID, BX_INSTR_MOV_CR3, val_64);
@@ -1359,6 +1363,11 @@ bool BX_CPU_C::SetCR4(bxInstruction_c *i, bx_address val)
 
   BX_CPU_THIS_PTR cr4.set32((Bit32u) val);
 
+#if BX_TLB_CONTEXTS > 1
+  // CR4.PCIDE modification changes the address space tag
+  TLB_switchContext();
+#endif
+
 #if BX_CPU_LEVEL >= 6
   handleSseModeChange();
 #if BX_SUPPORT_AVX
@@ -1375,7 +1384,7 @@ bool BX_CPU_C::SetCR4(bxInstruction_c *i, bx_address val)
 }
 #endif // BX_CPU_LEVEL >= 5
 
-bool BX_CPP_AttrRegparmN(1) BX_CPU_C::SetCR3(bx_address val)
+bool BX_CPP_AttrRegparmN(2) BX_CPU_C::SetCR3(bx_address val, bool noflush)
 {
 #if BX_SUPPORT_X86_64
   if (long_mode()) {
@@ -1388,6 +1397,17 @@ bool BX_CPP_AttrRegparmN(1) BX_CPU_C::SetCR3(bx_address val)
 
   BX_CPU_THIS_PTR cr3 = val;
 
+#if BX_TLB_CONTEXTS > 1
+  if (BX_CPU_THIS_PTR cr4.get_PCIDE()) {
+    // mappings of the previous PCID are kept in the TLB
+    TLB_switchContext();
+    // unless bit 63 was set invalidate all non-global mappings of the new PCID
+    if (! noflush)
+      TLB_flushNonGlobal();
+    return 1;
+  }
+#endif
+
   // flush TLB even if value does not change
 #if BX_CPU_LEVEL >= 6
   if (BX_CPU_THIS_PTR cr4.get_PGE())
@@ -1473,7 +1493,9 @@ void BX_CPU_C::WriteCR8(bxInstruction_c *i, bx_address val)
   }
 #endif
 
+  BX_SIM_LOCK();
   BX_CPU_THIS_PTR lapic.set_tpr(tpr);
+  BX_SIM_UNLOCK();
 }
 
 Bit32u BX_CPU_C::ReadCR8(bxInstruction_c *i)
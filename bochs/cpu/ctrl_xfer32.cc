@@ -22,6 +22,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "bochs.h"
 #include "cpu.h"
+#include "cpustats.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
 #if BX_CPU_LEVEL >= 3
@@ -41,7 +42,7 @@ BX_CPP_INLINE void BX_CPP_AttrRegparmN(1) BX_CPU_C::branch_near32(Bit32u new_EIP
 
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS == 0
   // assert magic async_event to stop trace execution
-  BX_CPU_THIS_PTR async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+  BX_EVENT_SET_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
 #endif
 }
 
@@ -765,4 +766,69 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOOP32_Jb(bxInstruction_c *i)
   BX_NEXT_TRACE(i);
 }
 
+#if BX_SUPPORT_SUPERBLOCKS
+
+// Superblock versions of the near branches. The trace builder followed the
+// branch and continued decoding at its target, so the predicted path only
+// updates EIP and continues with the next instruction of the same trace.
+// The not predicted path of a conditional branch leaves the trace.
+
+BX_CPP_INLINE void BX_CPP_AttrRegparmN(1) BX_CPU_C::branch_near32_superblock(Bit32u new_EIP)
+{
+  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
+
+  // check always, not only in protected mode
+  if (new_EIP > BX_CPU_THIS_PTR sregs[BX_SEG_REG_CS].cache.u.segment.limit_scaled)
+  {
+    BX_ERROR(("branch_near32: offset outside of CS limits"));
+    exception(BX_GP_EXCEPTION, 0);
+  }
+
+  EIP = new_EIP;
+}
+
+void BX_CPP_AttrRegparmN(1) BX_CPU_C::JMP_Jd_Superblock(bxInstruction_c *i)
+{
+  Bit32u new_EIP = EIP + (Bit32s) i->Id();
+  branch_near32_superblock(new_EIP);
+  BX_INSTR_UCNEAR_BRANCH(BX_CPU_ID, BX_INSTR_IS_JMP, PREV_RIP, new_EIP);
+
+  BX_NEXT_INSTR(i); // trace continues at the branch target
+}
+
+// conditional branches differ only by the tested condition
+
+#define BX_JCC_SUPERBLOCK32(name, cond)                           \
+void BX_CPP_AttrRegparmN(1) BX_CPU_C::name(bxInstruction_c *i)  \
+{                                                                 \
+  if (cond) {                                                     \
+    Bit32u new_EIP = EIP + (Bit32s) i->Id();                      \
+    branch_near32_superblock(new_EIP);                            \
+    BX_INSTR_CNEAR_BRANCH_TAKEN(BX_CPU_ID, PREV_RIP, new_EIP);    \
+    BX_NEXT_INSTR(i); /* trace continues at the branch target */  \
+  }                                                               \
+                                                                  \
+  BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(BX_CPU_ID, PREV_RIP);           \
+  BX_SUPERBLOCK_SIDE_EXIT(i);                                     \
+}
+
+BX_JCC_SUPERBLOCK32(JO_Jd_Superblock,   get_OF())
+BX_JCC_SUPERBLOCK32(JNO_Jd_Superblock,  ! get_OF())
+BX_JCC_SUPERBLOCK32(JB_Jd_Superblock,   get_CF())
+BX_JCC_SUPERBLOCK32(JNB_Jd_Superblock,  ! get_CF())
+BX_JCC_SUPERBLOCK32(JZ_Jd_Superblock,   get_ZF())
+BX_JCC_SUPERBLOCK32(JNZ_Jd_Superblock,  ! get_ZF())
+BX_JCC_SUPERBLOCK32(JBE_Jd_Superblock,  get_CF() || get_ZF())
+BX_JCC_SUPERBLOCK32(JNBE_Jd_Superblock, ! (get_CF() || get_ZF()))
+BX_JCC_SUPERBLOCK32(JS_Jd_Superblock,   get_SF())
+BX_JCC_SUPERBLOCK32(JNS_Jd_Superblock,  ! get_SF())
+BX_JCC_SUPERBLOCK32(JP_Jd_Superblock,   get_PF())
+BX_JCC_SUPERBLOCK32(JNP_Jd_Superblock,  ! get_PF())
+BX_JCC_SUPERBLOCK32(JL_Jd_Superblock,   getB_SF() != getB_OF())
+BX_JCC_SUPERBLOCK32(JNL_Jd_Superblock,  getB_SF() == getB_OF())
+BX_JCC_SUPERBLOCK32(JLE_Jd_Superblock,  get_ZF() || (getB_SF() != getB_OF()))
+BX_JCC_SUPERBLOCK32(JNLE_Jd_Superblock, ! get_ZF() && (getB_SF() == getB_OF()))
+
+#endif // BX_SUPPORT_SUPERBLOCKS
+
 #endif
@@ -22,6 +22,7 @@
 #define NEED_CPU_REG_SHORTCUTS 1
 #include "bochs.h"
 #include "cpu.h"
+#include "cpustats.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
 #if BX_SUPPORT_X86_64
@@ -39,7 +40,7 @@ BX_CPP_INLINE void BX_CPP_AttrRegparmN(1) BX_CPU_C::branch_near64(bxInstruction_
 
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS == 0
   // assert magic async_event to stop trace execution
-  BX_CPU_THIS_PTR async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+  BX_EVENT_SET_BITS(BX_CPU_THIS_PTR async_event, BX_ASYNC_EVENT_STOP_TRACE);
 #endif
 }
 
@@ -633,4 +634,66 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::LOOP64_Jb(bxInstruction_c *i)
   BX_NEXT_TRACE(i);
 }
 
+#if BX_SUPPORT_SUPERBLOCKS
+
+// Superblock versions of the near branches. The trace builder followed the
+// branch and continued decoding at its target, so the predicted path only
+// updates RIP and continues with the next instruction of the same trace.
+// The not predicted path of a conditional branch leaves the trace.
+
+BX_CPP_INLINE void BX_CPP_AttrRegparmN(1) BX_CPU_C::branch_near64_superblock(bxInstruction_c *i)
+{
+  Bit64u new_RIP = RIP + (Bit32s) i->Id();
+
+  if (! IsCanonical(new_RIP)) {
+    BX_ERROR(("branch_near64: canonical RIP violation"));
+    exception(BX_GP_EXCEPTION, 0);
+  }
+
+  RIP = new_RIP;
+}
+
+void BX_CPP_AttrRegparmN(1) BX_CPU_C::JMP_Jq_Superblock(bxInstruction_c *i)
+{
+  branch_near64_superblock(i);
+
+  BX_INSTR_UCNEAR_BRANCH(BX_CPU_ID, BX_INSTR_IS_JMP, PREV_RIP, RIP);
+
+  BX_NEXT_INSTR(i); // trace continues at the branch target
+}
+
+// conditional branches differ only by the tested condition
+
+#define BX_JCC_SUPERBLOCK64(name, cond)                           \
+void BX_CPP_AttrRegparmN(1) BX_CPU_C::name(bxInstruction_c *i)  \
+{                                                                 \
+  if (cond) {                                                     \
+    branch_near64_superblock(i);                                  \
+    BX_INSTR_CNEAR_BRANCH_TAKEN(BX_CPU_ID, PREV_RIP, RIP);        \
+    BX_NEXT_INSTR(i); /* trace continues at the branch target */  \
+  }                                                               \
+                                                                  \
+  BX_INSTR_CNEAR_BRANCH_NOT_TAKEN(BX_CPU_ID, PREV_RIP);           \
+  BX_SUPERBLOCK_SIDE_EXIT(i);                                     \
+}
+
+BX_JCC_SUPERBLOCK64(JO_Jq_Superblock,   get_OF())
+BX_JCC_SUPERBLOCK64(JNO_Jq_Superblock,  ! get_OF())
+BX_JCC_SUPERBLOCK64(JB_Jq_Superblock,   get_CF())
+BX_JCC_SUPERBLOCK64(JNB_Jq_Superblock,  ! get_CF())
+BX_JCC_SUPERBLOCK64(JZ_Jq_Superblock,   get_ZF())
+BX_JCC_SUPERBLOCK64(JNZ_Jq_Superblock,  ! get_ZF())
+BX_JCC_SUPERBLOCK64(JBE_Jq_Superblock,  get_CF() || get_ZF())
+BX_JCC_SUPERBLOCK64(JNBE_Jq_Superblock, ! (get_CF() || get_ZF()))
+BX_JCC_SUPERBLOCK64(JS_Jq_Superblock,   get_SF())
+BX_JCC_SUPERBLOCK64(JNS_Jq_Superblock,  ! get_SF())
+BX_JCC_SUPERBLOCK64(JP_Jq_Superblock,   get_PF())
+BX_JCC_SUPERBLOCK64(JNP_Jq_Superblock,  ! get_PF())
+BX_JCC_SUPERBLOCK64(JL_Jq_Superblock,   getB_SF() != getB_OF())
+BX_JCC_SUPERBLOCK64(JNL_Jq_Superblock,  getB_SF() == getB_OF())
+BX_JCC_SUPERBLOCK64(JLE_Jq_Superblock,  get_ZF() || (getB_SF() != getB_OF()))
+BX_JCC_SUPERBLOCK64(JNLE_Jq_Superblock, ! get_ZF() && (getB_SF() == getB_OF()))
+
+#endif // BX_SUPPORT_SUPERBLOCKS
+
 #endif /* if BX_SUPPORT_X86_64 */
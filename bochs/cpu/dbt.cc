@@ -0,0 +1,534 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA B 02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#define NEED_CPU_REG_SHORTCUTS 1
+#include "bochs.h"
+#include "cpu.h"
+#define LOG_THIS BX_CPU_THIS_PTR
+
+#include "pc_system.h"
+#include "cpustats.h"
+
+#if BX_SUPPORT_DBT
+
+#include <sys/mman.h>
+
+bxDbtCodeBuffer::~bxDbtCodeBuffer()
+{
+  if (buffer != NULL)
+    munmap(buffer, BX_DBT_CODE_BUFFER_SIZE);
+}
+
+Bit8u *bxDbtCodeBuffer::alloc(Bit32u size)
+{
+  if (buffer == NULL) {
+    if (mapFailed) return NULL;
+
+    void *ptr = mmap(NULL, BX_DBT_CODE_BUFFER_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+      mapFailed = true;
+      return NULL;
+    }
+
+    buffer = (Bit8u *) ptr;
+    index = 0;
+  }
+
+  if ((index + size) > BX_DBT_CODE_BUFFER_SIZE)
+    return NULL;
+
+  return buffer + index;
+}
+
+// host registers used by the translated code, RBX holds the CPU object
+// and R12 points to the bx_pc_system countdown
+enum {
+  DBT_RAX = 0,
+  DBT_RCX = 1,
+  DBT_RDX = 2,
+  DBT_RBX = 3,
+  DBT_RSI = 6,
+  DBT_RDI = 7
+};
+
+// host ALU opcodes in 'op r/m, reg' form
+enum {
+  DBT_ADD = 0x01,
+  DBT_OR  = 0x09,
+  DBT_AND = 0x21,
+  DBT_SUB = 0x29,
+  DBT_XOR = 0x31,
+  DBT_MOV = 0x89
+};
+
+class bxDbtEmitter {
+  Bit8u *code;
+  Bit32u pos;
+
+public:
+  bxDbtEmitter(Bit8u *buffer): code(buffer), pos(0) {}
+
+  Bit32u size(void) const { return pos; }
+
+  void byte(Bit8u b) { code[pos++] = b; }
+  void dword(Bit32u d) { memcpy(code + pos, &d, 4); pos += 4; }
+  void qword(Bit64u q) { memcpy(code + pos, &q, 8); pos += 8; }
+
+  // ModRM for [rbx + disp32]
+  void rbx_disp(unsigned reg, Bit32u disp) {
+    byte(0x80 | (reg << 3) | DBT_RBX);
+    dword(disp);
+  }
+
+  void load64(unsigned reg, Bit32u disp) { byte(0x48); byte(0x8b); rbx_disp(reg, disp); }
+  // 32-bit load zero extends into the 64-bit register
+  void load32(unsigned reg, Bit32u disp) { byte(0x8b); rbx_disp(reg, disp); }
+  void store64(unsigned reg, Bit32u disp) { byte(0x48); byte(0x89); rbx_disp(reg, disp); }
+
+  void mov_imm64(unsigned reg, Bit64u imm) { byte(0x48); byte(0xb8 | reg); qword(imm); }
+
+  // 32-bit operations zero extend their result into the 64-bit register
+  void alu(Bit8u opcode, unsigned dst, unsigned src, bool w64) {
+    if (w64) byte(0x48);
+    byte(opcode);
+    byte(0xc0 | (src << 3) | dst);
+  }
+
+  void not_reg(unsigned reg, bool w64) {
+    if (w64) byte(0x48);
+    byte(0xf7);
+    byte(0xd0 | reg);
+  }
+
+  // immediate is sign extended for 64-bit operation
+  void and_imm32(unsigned reg, Bit32u imm, bool w64) {
+    if (w64) byte(0x48);
+    byte(0x81);
+    byte(0xe0 | reg);
+    dword(imm);
+  }
+
+  void shl64(unsigned reg, Bit8u count) { byte(0x48); byte(0xc1); byte(0xe0 | reg); byte(count); }
+  void shr64(unsigned reg, Bit8u count) { byte(0x48); byte(0xc1); byte(0xe8 | reg); byte(count); }
+
+  void movsxd(unsigned dst, unsigned src) { byte(0x48); byte(0x63); byte(0xc0 | (dst << 3) | src); }
+
+  void add_mem64_imm8(Bit32u disp, Bit8u imm) { byte(0x48); byte(0x83); rbx_disp(0, disp); byte(imm); }
+
+  void call(Bit64u target) {
+    mov_imm64(DBT_RAX, target);
+    byte(0xff); byte(0xd0); // call rax
+  }
+
+  // jne rel32 with target to be patched later, returns the patch location
+  Bit32u jne_rel32(void) {
+    byte(0x0f); byte(0x85); dword(0);
+    return pos - 4;
+  }
+
+  void patch_rel32(Bit32u at, Bit32u target) {
+    Bit32u rel = target - (at + 4);
+    memcpy(code + at, &rel, 4);
+  }
+};
+
+enum {
+  DBT_OP_MOV,
+  DBT_OP_ADD,
+  DBT_OP_SUB,
+  DBT_OP_CMP,
+  DBT_OP_AND,
+  DBT_OP_OR,
+  DBT_OP_XOR,
+  DBT_OP_TEST,
+  DBT_OP_INC,
+  DBT_OP_DEC,
+  DBT_OP_ZERO_IDIOM,
+  DBT_OP_NOP
+};
+
+enum {
+  DBT_SRC_NONE,
+  DBT_SRC_REG,
+  DBT_SRC_ID,  // imm32, sign extended for 64-bit operation
+  DBT_SRC_IQ   // imm64
+};
+
+// instruction handlers which are emitted inline
+static const struct bxDbtInlineOp {
+  BxExecutePtr_tR handler;
+  Bit8u op;
+  Bit8u src;
+  Bit8u size;
+} dbt_inline_ops[] = {
+  { &BX_CPU_C::NOP,            DBT_OP_NOP,        DBT_SRC_NONE, 0  },
+  { &BX_CPU_C::ZERO_IDIOM_GdR, DBT_OP_ZERO_IDIOM, DBT_SRC_NONE, 32 },
+
+  { &BX_CPU_C::MOV_GdEdR,      DBT_OP_MOV,  DBT_SRC_REG,  32 },
+  { &BX_CPU_C::MOV_EdIdR,      DBT_OP_MOV,  DBT_SRC_ID,   32 },
+  { &BX_CPU_C::ADD_GdEdR,      DBT_OP_ADD,  DBT_SRC_REG,  32 },
+  { &BX_CPU_C::ADD_EdIdR,      DBT_OP_ADD,  DBT_SRC_ID,   32 },
+  { &BX_CPU_C::SUB_GdEdR,      DBT_OP_SUB,  DBT_SRC_REG,  32 },
+  { &BX_CPU_C::SUB_EdIdR,      DBT_OP_SUB,  DBT_SRC_ID,   32 },
+  { &BX_CPU_C::CMP_GdEdR,      DBT_OP_CMP,  DBT_SRC_REG,  32 },
+  { &BX_CPU_C::CMP_EdIdR,      DBT_OP_CMP,  DBT_SRC_ID,   32 },
+  { &BX_CPU_C::AND_GdEdR,      DBT_OP_AND,  DBT_SRC_REG,  32 },
+  { &BX_CPU_C::AND_EdIdR,      DBT_OP_AND,  DBT_SRC_ID,   32 },
+  { &BX_CPU_C::OR_GdEdR,       DBT_OP_OR,   DBT_SRC_REG,  32 },
+  { &BX_CPU_C::OR_EdIdR,       DBT_OP_OR,   DBT_SRC_ID,   32 },
+  { &BX_CPU_C::XOR_GdEdR,      DBT_OP_XOR,  DBT_SRC_REG,  32 },
+  { &BX_CPU_C::XOR_EdIdR,      DBT_OP_XOR,  DBT_SRC_ID,   32 },
+  { &BX_CPU_C::TEST_EdGdR,     DBT_OP_TEST, DBT_SRC_REG,  32 },
+  { &BX_CPU_C::TEST_EdIdR,     DBT_OP_TEST, DBT_SRC_ID,   32 },
+  { &BX_CPU_C::INC_EdR,        DBT_OP_INC,  DBT_SRC_NONE, 32 },
+  { &BX_CPU_C::DEC_EdR,        DBT_OP_DEC,  DBT_SRC_NONE, 32 },
+
+  { &BX_CPU_C::MOV_GqEqR,      DBT_OP_MOV,  DBT_SRC_REG,  64 },
+  { &BX_CPU_C::MOV_EqIdR,      DBT_OP_MOV,  DBT_SRC_ID,   64 },
+  { &BX_CPU_C::MOV_RRXIq,      DBT_OP_MOV,  DBT_SRC_IQ,   64 },
+  { &BX_CPU_C::ADD_GqEqR,      DBT_OP_ADD,  DBT_SRC_REG,  64 },
+  { &BX_CPU_C::ADD_EqIdR,      DBT_OP_ADD,  DBT_SRC_ID,   64 },
+  { &BX_CPU_C::SUB_GqEqR,      DBT_OP_SUB,  DBT_SRC_REG,  64 },
+  { &BX_CPU_C::SUB_EqIdR,      DBT_OP_SUB,  DBT_SRC_ID,   64 },
+  { &BX_CPU_C::CMP_GqEqR,      DBT_OP_CMP,  DBT_SRC_REG,  64 },
+  { &BX_CPU_C::CMP_EqIdR,      DBT_OP_CMP,  DBT_SRC_ID,   64 },
+  { &BX_CPU_C::AND_GqEqR,      DBT_OP_AND,  DBT_SRC_REG,  64 },
+  { &BX_CPU_C::AND_EqIdR,      DBT_OP_AND,  DBT_SRC_ID,   64 },
+  { &BX_CPU_C::OR_GqEqR,       DBT_OP_OR,   DBT_SRC_REG,  64 },
+  { &BX_CPU_C::OR_EqIdR,       DBT_OP_OR,   DBT_SRC_ID,   64 },
+  { &BX_CPU_C::XOR_GqEqR,      DBT_OP_XOR,  DBT_SRC_REG,  64 },
+  { &BX_CPU_C::XOR_EqIdR,      DBT_OP_XOR,  DBT_SRC_ID,   64 },
+  { &BX_CPU_C::TEST_EqGqR,     DBT_OP_TEST, DBT_SRC_REG,  64 },
+  { &BX_CPU_C::TEST_EqIdR,     DBT_OP_TEST, DBT_SRC_ID,   64 },
+  { &BX_CPU_C::INC_EqR,        DBT_OP_INC,  DBT_SRC_NONE, 64 },
+  { &BX_CPU_C::DEC_EqR,        DBT_OP_DEC,  DBT_SRC_NONE, 64 },
+};
+
+static const bxDbtInlineOp *dbt_find_inline_op(bxInstruction_c *i)
+{
+  for (unsigned n=0; n < sizeof(dbt_inline_ops) / sizeof(dbt_inline_ops[0]); n++) {
+    if (i->execute1 == dbt_inline_ops[n].handler) {
+      const bxDbtInlineOp *op = &dbt_inline_ops[n];
+      // operands must be general purpose registers
+      if (op->op != DBT_OP_NOP && i->dst() >= BX_GENERAL_REGISTERS) return NULL;
+      if (op->src == DBT_SRC_REG && i->src() >= BX_GENERAL_REGISTERS) return NULL;
+      return op;
+    }
+  }
+
+  return NULL;
+}
+
+// host address of the instruction handler
+static bool dbt_handler_address(BxExecutePtr_tR handler, Bit64u *addr)
+{
+#if BX_USE_CPU_SMF
+  *addr = (Bit64u) handler;
+  return true;
+#else
+  // pointer to member function as defined by the Itanium C++ ABI, only
+  // non-virtual handlers without 'this' adjustment could be called directly
+  struct {
+    Bit64u ptr;
+    Bit64s adj;
+  } mfp;
+
+  if (sizeof(handler) != sizeof(mfp)) return false;
+  memcpy(&mfp, &handler, sizeof(mfp));
+  if ((mfp.ptr & 1) != 0 || mfp.adj != 0) return false;
+  *addr = mfp.ptr;
+  return true;
+#endif
+}
+
+static void dbt_tick1(void)
+{
+  BX_TICK1();
+}
+
+// offsets of the CPU state fields accessed by the translated code
+struct bxDbtOffsets {
+  Bit32u rip, prev_rip, icount, async_event;
+  Bit32u lf_result, lf_auxbits;
+  Bit32u gpr[BX_GENERAL_REGISTERS];
+};
+
+// Lazy flags from the carries vector in RAX and result in RDX, see
+// SET_FLAGS_OSZAPC_SIZE and SET_FLAGS_OSZAP_SIZE for the reference
+static void dbt_emit_lazy_flags(bxDbtEmitter &e, const bxDbtOffsets &off, unsigned size, bool preserveCF)
+{
+  if (size == 64) {
+    e.store64(DBT_RDX, off.lf_result);
+    e.alu(DBT_MOV, DBT_RCX, DBT_RAX, true);
+    e.and_imm32(DBT_RAX, LF_MASK_AF, true);
+    e.shr64(DBT_RCX, 62);
+    e.shl64(DBT_RCX, LF_BIT_PO);
+    e.alu(DBT_OR, DBT_RAX, DBT_RCX, true);
+  }
+  else {
+    e.movsxd(DBT_RDX, DBT_RDX);
+    e.store64(DBT_RDX, off.lf_result);
+    e.and_imm32(DBT_RAX, ~(LF_MASK_PDB | LF_MASK_SD), false);
+  }
+
+  if (preserveCF) {
+    e.load64(DBT_RCX, off.lf_auxbits);
+    e.alu(DBT_XOR, DBT_RCX, DBT_RAX, true);
+    e.and_imm32(DBT_RCX, LF_MASK_CF, true);
+    e.alu(DBT_MOV, DBT_RSI, DBT_RCX, true);
+    e.shr64(DBT_RSI, 1);
+    e.alu(DBT_XOR, DBT_RCX, DBT_RSI, true);
+    e.alu(DBT_XOR, DBT_RAX, DBT_RCX, true);
+    e.alu(DBT_MOV, DBT_RAX, DBT_RAX, false);
+  }
+
+  e.store64(DBT_RAX, off.lf_auxbits);
+}
+
+static void dbt_emit_inline_op(bxDbtEmitter &e, const bxDbtOffsets &off, const bxDbtInlineOp *op, bxInstruction_c *i)
+{
+  bool w64 = (op->size == 64);
+  Bit64u imm = 0;
+
+  if (op->src == DBT_SRC_ID)
+    imm = w64 ? (Bit64u)(Bit64s)(Bit32s) i->Id() : (Bit64u) i->Id();
+#if BX_SUPPORT_X86_64
+  else if (op->src == DBT_SRC_IQ)
+    imm = i->Iq();
+#endif
+
+  switch(op->op) {
+  case DBT_OP_NOP:
+    return;
+
+  case DBT_OP_ZERO_IDIOM:
+    e.alu(DBT_XOR, DBT_RAX, DBT_RAX, false);
+    e.store64(DBT_RAX, off.gpr[i->dst()]);
+    e.store64(DBT_RAX, off.lf_result);
+    e.store64(DBT_RAX, off.lf_auxbits);
+    return;
+
+  case DBT_OP_MOV:
+    if (op->src == DBT_SRC_REG) {
+      if (w64) e.load64(DBT_RAX, off.gpr[i->src()]);
+      else     e.load32(DBT_RAX, off.gpr[i->src()]);
+    }
+    else {
+      e.mov_imm64(DBT_RAX, imm);
+    }
+    e.store64(DBT_RAX, off.gpr[i->dst()]);
+    return;
+
+  default:
+    break;
+  }
+
+  // op1 -> RAX, op2 -> RCX, result -> RDX
+  if (w64) e.load64(DBT_RAX, off.gpr[i->dst()]);
+  else     e.load32(DBT_RAX, off.gpr[i->dst()]);
+
+  if (op->src == DBT_SRC_REG) {
+    if (w64) e.load64(DBT_RCX, off.gpr[i->src()]);
+    else     e.load32(DBT_RCX, off.gpr[i->src()]);
+  }
+  else if (op->src == DBT_SRC_NONE) {
+    e.mov_imm64(DBT_RCX, 1);
+  }
+  else {
+    e.mov_imm64(DBT_RCX, imm);
+  }
+
+  e.alu(DBT_MOV, DBT_RDX, DBT_RAX, w64);
+
+  switch(op->op) {
+  case DBT_OP_ADD:
+  case DBT_OP_INC:
+    e.alu(DBT_ADD, DBT_RDX, DBT_RCX, w64);
+    break;
+  case DBT_OP_SUB:
+  case DBT_OP_CMP:
+  case DBT_OP_DEC:
+    e.alu(DBT_SUB, DBT_RDX, DBT_RCX, w64);
+    break;
+  case DBT_OP_AND:
+  case DBT_OP_TEST:
+    e.alu(DBT_AND, DBT_RDX, DBT_RCX, w64);
+    break;
+  case DBT_OP_OR:
+    e.alu(DBT_OR, DBT_RDX, DBT_RCX, w64);
+    break;
+  case DBT_OP_XOR:
+    e.alu(DBT_XOR, DBT_RDX, DBT_RCX, w64);
+    break;
+  }
+
+  // 32-bit results are zero extended into the 64-bit register
+  if (op->op != DBT_OP_CMP && op->op != DBT_OP_TEST)
+    e.store64(DBT_RDX, off.gpr[i->dst()]);
+
+  // carries vector -> RAX
+  switch(op->op) {
+  case DBT_OP_ADD: // ADD_COUT_VEC
+    e.alu(DBT_MOV, DBT_RSI, DBT_RAX, w64);
+    e.alu(DBT_AND, DBT_RSI, DBT_RCX, w64);
+    e.alu(DBT_OR,  DBT_RAX, DBT_RCX, w64);
+    e.alu(DBT_MOV, DBT_RDI, DBT_RDX, w64);
+    e.not_reg(DBT_RDI, w64);
+    e.alu(DBT_AND, DBT_RAX, DBT_RDI, w64);
+    e.alu(DBT_OR,  DBT_RAX, DBT_RSI, w64);
+    break;
+  case DBT_OP_SUB: // SUB_COUT_VEC
+  case DBT_OP_CMP:
+    e.not_reg(DBT_RAX, w64);
+    e.alu(DBT_MOV, DBT_RSI, DBT_RAX, w64);
+    e.alu(DBT_AND, DBT_RSI, DBT_RCX, w64);
+    e.alu(DBT_XOR, DBT_RAX, DBT_RCX, w64);
+    e.alu(DBT_AND, DBT_RAX, DBT_RDX, w64);
+    e.alu(DBT_OR,  DBT_RAX, DBT_RSI, w64);
+    break;
+  case DBT_OP_INC: // ADD_COUT_VEC(op1, 0, result)
+    e.alu(DBT_MOV, DBT_RDI, DBT_RDX, w64);
+    e.not_reg(DBT_RDI, w64);
+    e.alu(DBT_AND, DBT_RAX, DBT_RDI, w64);
+    break;
+  case DBT_OP_DEC: // SUB_COUT_VEC(op1, 0, result)
+    e.not_reg(DBT_RAX, w64);
+    e.alu(DBT_AND, DBT_RAX, DBT_RDX, w64);
+    break;
+  default:         // logical operations
+    e.alu(DBT_XOR, DBT_RAX, DBT_RAX, false);
+    break;
+  }
+
+  dbt_emit_lazy_flags(e, off, op->size, op->op == DBT_OP_INC || op->op == DBT_OP_DEC);
+}
+
+bool BX_CPU_C::translateTrace(bxICacheEntry_c *entry)
+{
+  Bit32u maxSize = entry->tlen * BX_DBT_MAX_INSTR_CODE_SIZE + BX_DBT_MAX_TRACE_OVERHEAD;
+
+  Bit8u *code = BX_CPU_THIS_PTR iCache.dbtBuffer.alloc(maxSize);
+  if (code == NULL) {
+    if (! BX_CPU_THIS_PTR iCache.dbtBuffer.is_mapped()) {
+      // no executable memory, keep interpreting
+      entry->execCount = 0;
+      return false;
+    }
+    // the code buffer is exhausted, drop all translations and start over
+    BX_CPU_THIS_PTR iCache.flushTranslations();
+    code = BX_CPU_THIS_PTR iCache.dbtBuffer.alloc(maxSize);
+    if (code == NULL) return false;
+  }
+
+  bxDbtOffsets off;
+  const Bit8u *base = (const Bit8u *) BX_CPU_THIS;
+  off.rip = (Bit32u)((const Bit8u *) &RIP - base);
+  off.prev_rip = (Bit32u)((const Bit8u *) &BX_CPU_THIS_PTR prev_rip - base);
+  off.icount = (Bit32u)((const Bit8u *) &BX_CPU_THIS_PTR icount - base);
+  off.async_event = (Bit32u)((const Bit8u *) &BX_CPU_THIS_PTR async_event - base);
+  off.lf_result = (Bit32u)((const Bit8u *) &BX_CPU_THIS_PTR oszapc.result - base);
+  off.lf_auxbits = (Bit32u)((const Bit8u *) &BX_CPU_THIS_PTR oszapc.auxbits - base);
+  for (unsigned n=0; n < BX_GENERAL_REGISTERS; n++)
+    off.gpr[n] = (Bit32u)((const Bit8u *) &BX_CPU_THIS_PTR gen_reg[n].rrx - base);
+
+  // emulated time is advanced by the CPU loop only in single processor mode,
+  // with lazy time accounting it is charged once the translated trace returns
+  bool tick = (BX_SMP_PROCESSORS == 1) && ! BX_LAZY_TIME_ACCOUNTING;
+
+  bxDbtEmitter e(code);
+  Bit32u exits[BX_MAX_TRACE_LENGTH];
+  unsigned nexits = 0;
+
+  e.byte(0x53);                         // push rbx
+  e.byte(0x41); e.byte(0x54);           // push r12
+  e.byte(0x41); e.byte(0x55);           // push r13 (keep the stack aligned)
+  e.alu(DBT_MOV, DBT_RBX, DBT_RDI, true);
+  if (tick) {
+    e.byte(0x49); e.byte(0xbc);         // mov r12, imm64
+    e.qword((Bit64u) bx_pc_system_c::getCountdownPtr());
+  }
+
+  bxInstruction_c *i = entry->i;
+  for (unsigned n=0; n < entry->tlen; n++, i++) {
+    // RIP += i->ilen()
+    e.add_mem64_imm8(off.rip, i->ilen());
+
+    const bxDbtInlineOp *op = dbt_find_inline_op(i);
+    if (op) {
+      dbt_emit_inline_op(e, off, op, i);
+    }
+    else {
+      Bit64u handler;
+      if (! dbt_handler_address(i->execute1, &handler)) {
+        entry->execCount = 0;
+        return false;
+      }
+#if BX_USE_CPU_SMF == 0
+      e.alu(DBT_MOV, DBT_RDI, DBT_RBX, true);
+      e.mov_imm64(DBT_RSI, (Bit64u) i);
+#else
+      e.mov_imm64(DBT_RDI, (Bit64u) i);
+#endif
+      e.call(handler);
+    }
+
+    // prev_rip = RIP, icount++
+    e.load64(DBT_RAX, off.rip);
+    e.store64(DBT_RAX, off.prev_rip);
+    e.add_mem64_imm8(off.icount, 1);
+
+    if (tick) {
+      // countdown == 1 ? tick1() : countdown--
+      e.byte(0x41); e.byte(0x83); e.byte(0x3c); e.byte(0x24); e.byte(0x01); // cmp dword [r12], 1
+      e.byte(0x74); e.byte(0x06);                                           // je call
+      e.byte(0x41); e.byte(0xff); e.byte(0x0c); e.byte(0x24);               // dec dword [r12]
+      e.byte(0xeb); e.byte(0x0c);                                           // jmp done
+      e.call((Bit64u) dbt_tick1);
+    }
+
+    if (n != entry->tlen - 1) {
+      // if (async_event) return
+      e.byte(0x83); e.rbx_disp(7, off.async_event); e.byte(0x00); // cmp dword [rbx+async_event], 0
+      exits[nexits++] = e.jne_rel32();
+    }
+  }
+
+  Bit32u exit = e.size();
+  for (unsigned n=0; n < nexits; n++)
+    e.patch_rel32(exits[n], exit);
+
+  e.byte(0x41); e.byte(0x5d);           // pop r13
+  e.byte(0x41); e.byte(0x5c);           // pop r12
+  e.byte(0x5b);                         // pop rbx
+  e.byte(0xc3);                         // ret
+
+  BX_ASSERT(e.size() <= maxSize);
+  BX_CPU_THIS_PTR iCache.dbtBuffer.commit(e.size());
+
+  entry->dbtCode = (bxDbtTracePtr_t)(void *) code;
+  INC_ICACHE_STAT(dbtTranslations);
+
+  return true;
+}
+
+#endif // BX_SUPPORT_DBT
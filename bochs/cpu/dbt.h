@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA B 02110-1301 USA
+//
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_DBT_H
+#define BX_DBT_H
+
+#if BX_SUPPORT_DBT
+
+// Hot traces are translated into host x86-64 code. The translated code
+// performs exactly the same steps as the non-chaining cpu_loop does for
+// every instruction of the trace (RIP update, handler execution, icount
+// and time accounting, async event check), simple register-only integer
+// instructions are emitted inline and everything else calls the regular
+// instruction handler.
+
+// translated trace entry point, receives the CPU object
+typedef void (*bxDbtTracePtr_t)(BX_CPU_C *cpu);
+
+// number of executions of a trace before it gets translated
+#define BX_DBT_HOT_TRACE_THRESHOLD 64
+
+#define BX_DBT_CODE_BUFFER_SIZE (4 * 1024 * 1024)
+
+// upper bound of host code generated for single guest instruction
+#define BX_DBT_MAX_INSTR_CODE_SIZE 256
+// upper bound of host code generated for trace prologue and epilogue
+#define BX_DBT_MAX_TRACE_OVERHEAD  64
+
+class bxDbtCodeBuffer {
+  Bit8u *buffer;
+  Bit32u index;
+  bool mapFailed;
+
+public:
+  bxDbtCodeBuffer(): buffer(NULL), index(0), mapFailed(false) {}
+ ~bxDbtCodeBuffer();
+
+  // returns pointer to at least 'size' bytes of executable memory or NULL
+  // if the buffer is exhausted and must be reset (or cannot be mapped)
+  Bit8u *alloc(Bit32u size);
+
+  BX_CPP_INLINE bool is_mapped(void) const { return buffer != NULL; }
+
+  BX_CPP_INLINE void commit(Bit32u size) { index += size; }
+
+  // all translations are dropped, the code which is currently running
+  // stays intact until the next translation is generated
+  BX_CPP_INLINE void reset(void) { index = 0; }
+};
+
+#endif // BX_SUPPORT_DBT
+
+#endif
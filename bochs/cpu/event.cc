@@ -174,6 +174,15 @@ bool BX_CPU_C::handleAsyncEvent(void)
   //
   // This area is where we process special conditions and events.
   //
+#if BX_SMP_HOST_THREADS
+  // the events are delivered by the devices and the local APICs shared
+  // with the other processor threads
+  BX_SIM_LOCK_SCOPE();
+
+  if (BX_CPU_THIS_PTR remote.request)
+    handle_remote_requests();
+#endif
+
   if (BX_CPU_THIS_PTR activity_state != BX_ACTIVITY_STATE_ACTIVE) {
     // For one processor, pass the time as quickly as possible until
     // an interrupt wakes up the CPU.
@@ -373,7 +382,7 @@ bool BX_CPU_C::handleAsyncEvent(void)
 //      BX_CPU_THIS_PTR get_TF() || // implies debug_trap is set
         BX_HRQ))
   {
-    BX_CPU_THIS_PTR async_event = 0;
+    clear_async_event();
   }
 
   return 0; // Continue executing cpu_loop.
@@ -398,6 +407,18 @@ bool BX_CPU_C::interrupts_inhibited(unsigned mask)
 
 void BX_CPU_C::deliver_SIPI(unsigned vector)
 {
+#if BX_SMP_HOST_THREADS
+  if (is_running_remotely()) {
+    // the processor state is owned by the processor thread
+    while (__atomic_exchange_n(&BX_CPU_THIS_PTR remote.lock, 1, __ATOMIC_ACQUIRE)) {}
+    BX_CPU_THIS_PTR remote.sipi_vector = vector;
+    BX_CPU_THIS_PTR remote.request |= BX_REMOTE_REQUEST_SIPI;
+    __atomic_store_n(&BX_CPU_THIS_PTR remote.lock, 0, __ATOMIC_RELEASE);
+    signal_async_event();
+    return;
+  }
+#endif
+
   if (BX_CPU_THIS_PTR activity_state == BX_ACTIVITY_STATE_WAIT_FOR_SIPI) {
 #if BX_SUPPORT_VMX
     if (BX_CPU_THIS_PTR in_vmx_guest)
@@ -441,6 +462,72 @@ void BX_CPU_C::clear_INTR(void)
   clear_event(BX_EVENT_PENDING_INTR);
 }
 
+#if BX_SMP_HOST_THREADS
+
+void BX_CPU_C::post_remote_request(Bit32u request)
+{
+  while (__atomic_exchange_n(&BX_CPU_THIS_PTR remote.lock, 1, __ATOMIC_ACQUIRE)) {}
+  BX_CPU_THIS_PTR remote.request |= request;
+  __atomic_store_n(&BX_CPU_THIS_PTR remote.lock, 0, __ATOMIC_RELEASE);
+  signal_async_event();
+}
+
+void BX_CPU_C::post_remote_smc(bx_phy_address pAddr, Bit32u mask)
+{
+  while (__atomic_exchange_n(&BX_CPU_THIS_PTR remote.lock, 1, __ATOMIC_ACQUIRE)) {}
+  if (BX_CPU_THIS_PTR remote.smc_count < BX_REMOTE_SMC_QUEUE_SIZE) {
+    unsigned n = BX_CPU_THIS_PTR remote.smc_count++;
+    BX_CPU_THIS_PTR remote.smc_addr[n] = pAddr;
+    BX_CPU_THIS_PTR remote.smc_mask[n] = mask;
+    BX_CPU_THIS_PTR remote.request |= BX_REMOTE_REQUEST_SMC;
+  }
+  else {
+    BX_CPU_THIS_PTR remote.request |= BX_REMOTE_REQUEST_ICACHE_FLUSH;
+  }
+  __atomic_store_n(&BX_CPU_THIS_PTR remote.lock, 0, __ATOMIC_RELEASE);
+  signal_async_event();
+}
+
+// called by the processor thread itself on the instruction boundary
+void BX_CPU_C::handle_remote_requests(void)
+{
+  bx_phy_address smc_addr[BX_REMOTE_SMC_QUEUE_SIZE];
+  Bit32u smc_mask[BX_REMOTE_SMC_QUEUE_SIZE];
+
+  while (__atomic_exchange_n(&BX_CPU_THIS_PTR remote.lock, 1, __ATOMIC_ACQUIRE)) {}
+  Bit32u request = BX_CPU_THIS_PTR remote.request;
+  unsigned smc_count = BX_CPU_THIS_PTR remote.smc_count;
+  unsigned sipi_vector = BX_CPU_THIS_PTR remote.sipi_vector;
+  for (unsigned n=0; n < smc_count; n++) {
+    smc_addr[n] = BX_CPU_THIS_PTR remote.smc_addr[n];
+    smc_mask[n] = BX_CPU_THIS_PTR remote.smc_mask[n];
+  }
+  BX_CPU_THIS_PTR remote.request = 0;
+  BX_CPU_THIS_PTR remote.smc_count = 0;
+  __atomic_store_n(&BX_CPU_THIS_PTR remote.lock, 0, __ATOMIC_RELEASE);
+
+  if (request & BX_REMOTE_REQUEST_ICACHE_FLUSH) {
+    BX_CPU_THIS_PTR iCache.flushICacheEntries();
+  }
+  else if (request & BX_REMOTE_REQUEST_SMC) {
+    for (unsigned n=0; n < smc_count; n++)
+      BX_CPU_THIS_PTR iCache.handleSMC(smc_addr[n], smc_mask[n]);
+  }
+
+  if (request & BX_REMOTE_REQUEST_TLB_FLUSH)
+    TLB_flush();
+
+  if (request & BX_REMOTE_REQUEST_SIPI) {
+    // the INIT IPI sent before the SIPI is accepted first
+    if (is_unmasked_event_pending(BX_EVENT_INIT))
+      post_remote_request(BX_REMOTE_REQUEST_SIPI);
+    else
+      deliver_SIPI(sipi_vector);
+  }
+}
+
+#endif
+
 #if BX_DEBUGGER
 
 void BX_CPU_C::dbg_take_dma(void)
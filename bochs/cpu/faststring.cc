@@ -29,236 +29,343 @@
 //
 // Repeat Speedups methods
 //
+// All the methods below work only on whole pages mapped in the data TLB
+// and accessible through host pointers. The string is transferred page by
+// page, as long as the next source and destination pages are found in the
+// TLB the operation continues without returning to the instruction handler.
+// Every destination page gets its write stamp decremented so traces from
+// the page are invalidated, the transfer stops after a page which was
+// holding code (one of the CPUs might be running trace from it).
+//
 
 #if BX_SUPPORT_REPEAT_SPEEDUPS
-Bit32u BX_CPU_C::FastRepMOVSB(unsigned srcSeg, Bit32u srcOff, unsigned dstSeg, Bit32u dstOff, Bit32u byteCount, Bit32u granularity)
-{
-  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  bx_address laddrSrc, laddrDst;
+// upper bound of bytes processed by single fast string call, keeps string
+// pointer increments of the instruction handlers in 32-bit signed range
+#define BX_FAST_STRING_MAX_BYTES (1 << 30)
+
+// Legacy mode: compute linear address of seg:offset for string access and
+// return the number of bytes which could be accessed starting from it
+// without segment limit violation or wrap around of the linear address.
+// Zero is returned if the access is not possible using the fast path.
+Bit32u BX_CPU_C::FastRepSegAccess(unsigned s, Bit32u offset, bool write, bx_address *laddr)
+{
+  bx_segment_reg_t *seg = &BX_CPU_THIS_PTR sregs[s];
+  Bit32u limit;
 
-  bx_segment_reg_t *srcSegPtr = &BX_CPU_THIS_PTR sregs[srcSeg];
-  if (srcSegPtr->cache.valid & SegAccessROK4G) {
-    laddrSrc = srcOff;
+  if (seg->cache.valid & (write ? SegAccessWOK4G : SegAccessROK4G)) {
+    *laddr = offset;
+    limit = 0xffffffff;
   }
   else {
-    if (!(srcSegPtr->cache.valid & SegAccessROK))
+    if (!(seg->cache.valid & (write ? SegAccessWOK : SegAccessROK)))
       return 0;
-    if ((srcOff | 0xfff) > srcSegPtr->cache.u.segment.limit_scaled)
+    limit = seg->cache.u.segment.limit_scaled;
+    if (offset > limit)
       return 0;
 
-    laddrSrc = get_laddr32(srcSeg, srcOff);
-  }
+    Bit32u laddr32 = get_laddr32(s, offset);
+    // linear address wraps around at 4G
+    if (limit - offset > 0xffffffff - laddr32)
+      limit = offset + (0xffffffff - laddr32);
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (dstSegPtr->cache.valid & SegAccessWOK4G) {
-    laddrDst = dstOff;
+    *laddr = laddr32;
   }
-  else {
-    if (!(dstSegPtr->cache.valid & SegAccessWOK))
-      return 0;
-    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-      return 0;
 
-    laddrDst = get_laddr32(dstSeg, dstOff);
-  }
+  // limit - offset + 1 bytes are accessible, avoid roll over
+  Bit32u bytes = limit - offset;
+  return (bytes == 0xffffffff) ? bytes : bytes + 1;
+}
+
+Bit32u BX_CPU_C::FastRepMOVSB(unsigned srcSeg, Bit32u srcOff, unsigned dstSeg, Bit32u dstOff, Bit32u byteCount, Bit32u granularity)
+{
+  BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
+
+  // FastRepSegAccess leaves the address unset when it refuses the access
+  bx_address laddrSrc = 0, laddrDst = 0;
+
+  Bit32u bytesSrc = FastRepSegAccess(srcSeg, srcOff, false, &laddrSrc);
+  if (byteCount > bytesSrc)
+    byteCount = bytesSrc;
+
+  Bit32u bytesDst = FastRepSegAccess(dstSeg, dstOff, true, &laddrDst);
+  if (byteCount > bytesDst)
+    byteCount = bytesDst;
+
+  if (! byteCount) return 0;
 
   return FastRepMOVSB(laddrSrc, laddrDst, byteCount, granularity);
 }
 
 Bit32u BX_CPU_C::FastRepMOVSB(bx_address laddrSrc, bx_address laddrDst, Bit64u byteCount, Bit32u granularity)
 {
-  Bit8u *hostAddrSrc = v2h_read_byte(laddrSrc, USER_PL);
-  // Check that native host access was not vetoed for that page
-  if (!hostAddrSrc) return 0;
-
-  Bit8u *hostAddrDst = v2h_write_byte(laddrDst, USER_PL);
-  // Check that native host access was not vetoed for that page
-  if (!hostAddrDst) return 0;
-
   assert(! BX_CPU_THIS_PTR get_DF());
 
-  // See how many bytes can fit in the rest of this page.
-  Bit32u bytesFitSrc = 0x1000 - PAGE_OFFSET(laddrSrc);
-  Bit32u bytesFitDst = 0x1000 - PAGE_OFFSET(laddrDst);
-
-  // Restrict word count to the number that will fit in either
-  // source or dest pages.
-  if (byteCount > bytesFitSrc)
-    byteCount = bytesFitSrc;
-  if (byteCount > bytesFitDst)
-    byteCount = bytesFitDst;
   if (byteCount > bx_pc_system.getNumCpuTicksLeftNextEvent())
     byteCount = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  if (byteCount > BX_FAST_STRING_MAX_BYTES)
+    byteCount = BX_FAST_STRING_MAX_BYTES;
+
+  Bit32u count = 0;
+
+  while (byteCount >= granularity) {
+    Bit8u *hostAddrSrc = v2h_read_byte(laddrSrc, USER_PL);
+    // Check that native host access was not vetoed for that page
+    if (!hostAddrSrc) break;
+
+    Bit8u *hostAddrDst = v2h_write_byte(laddrDst, USER_PL);
+    // Check that native host access was not vetoed for that page
+    if (!hostAddrDst) break;
+
+    // See how many bytes can fit in the rest of this page.
+    Bit32u bytesFitSrc = 0x1000 - PAGE_OFFSET(laddrSrc);
+    Bit32u bytesFitDst = 0x1000 - PAGE_OFFSET(laddrDst);
+
+    // Restrict byte count to the number that will fit in either
+    // source or dest pages.
+    Bit32u bytes = (Bit32u) BX_MIN(byteCount, BX_MIN(bytesFitSrc, bytesFitDst));
+    bytes &= ~(granularity-1);
 
-  byteCount &= ~(granularity-1);
+    // element split between pages, let the instruction handler do it
+    if (! bytes) break;
 
-  // If after all the restrictions, there is anything left to do...
-  if (byteCount) {
     // Transfer data directly using host addresses
-    for (unsigned j=0; j<byteCount; j++) {
-      * (Bit8u *) hostAddrDst = * (Bit8u *) hostAddrSrc;
-      hostAddrDst++;
-      hostAddrSrc++;
+    if (hostAddrDst + bytes <= hostAddrSrc || hostAddrSrc + bytes <= hostAddrDst) {
+      memcpy(hostAddrDst, hostAddrSrc, bytes);
     }
+    else {
+      // overlapping strings must be copied byte by byte
+      for (unsigned j=0; j<bytes; j++) {
+        * (Bit8u *) hostAddrDst = * (Bit8u *) hostAddrSrc;
+        hostAddrDst++;
+        hostAddrSrc++;
+      }
+    }
+
+    count += bytes;
+    byteCount -= bytes;
+    laddrSrc += bytes;
+    laddrDst += bytes;
+
+    // self modifying code detected
+    if (BX_CPU_THIS_PTR async_event) break;
   }
 
-  return byteCount;
+  return count;
 }
 
-Bit32u BX_CPU_C::FastRepSTOSB(unsigned dstSeg, Bit32u dstOff, Bit8u val, Bit32u count)
+Bit32u BX_CPU_C::FastRepSTOS(unsigned dstSeg, Bit32u dstOff, Bit64u val, unsigned len, Bit32u count)
 {
   bx_address laddrDst;
 
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (dstSegPtr->cache.valid & SegAccessWOK4G) {
-    laddrDst = dstOff;
-  }
-  else {
-    if (!(dstSegPtr->cache.valid & SegAccessWOK))
-      return 0;
-    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-      return 0;
+  Bit32u elements = FastRepSegAccess(dstSeg, dstOff, true, &laddrDst) / len;
+  if (count > elements)
+    count = elements;
 
-    laddrDst = get_laddr32(dstSeg, dstOff);
-  }
+  if (! count) return 0;
 
-  return FastRepSTOSB(laddrDst, val, count);
+  return FastRepSTOS(laddrDst, val, len, count);
 }
 
-Bit32u BX_CPU_C::FastRepSTOSB(bx_address laddrDst, Bit8u val, Bit32u count)
+Bit32u BX_CPU_C::FastRepSTOS(bx_address laddrDst, Bit64u val, unsigned len, Bit32u count)
 {
-  Bit8u *hostAddrDst = v2h_write_byte(laddrDst, USER_PL);
-  // Check that native host access was not vetoed for that page
-  if (!hostAddrDst) return 0;
-
   assert(! BX_CPU_THIS_PTR get_DF());
 
-  // See how many bytes can fit in the rest of this page.
-  Bit32u bytesFitDst = 0x1000 - PAGE_OFFSET(laddrDst);
-
-  // Restrict word count to the number that will fit in either
-  // source or dest pages.
-  if (count > bytesFitDst)
-    count = bytesFitDst;
   if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
     count = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  if (count > BX_FAST_STRING_MAX_BYTES / len)
+    count = BX_FAST_STRING_MAX_BYTES / len;
+
+  Bit32u done = 0;
+
+  while (count) {
+    Bit8u *hostAddrDst = v2h_write_byte(laddrDst, USER_PL);
+    // Check that native host access was not vetoed for that page
+    if (!hostAddrDst) break;
+
+    // See how many elements can fit in the rest of this page.
+    Bit32u elements = (0x1000 - PAGE_OFFSET(laddrDst)) / len;
+    if (elements > count)
+      elements = count;
+
+    // element split between pages, let the instruction handler do it
+    if (! elements) break;
 
-  // If after all the restrictions, there is anything left to do...
-  if (count) {
     // Transfer data directly using host addresses
-    for (unsigned j=0; j<count; j++) {
-      * (Bit8u *) hostAddrDst = val;
-      hostAddrDst++;
+    unsigned j;
+    switch(len) {
+    case 1:
+      memset(hostAddrDst, (Bit8u) val, elements);
+      break;
+    case 2:
+      for (j=0; j<elements; j++, hostAddrDst += 2)
+        WriteHostWordToLittleEndian((Bit16u*)hostAddrDst, (Bit16u) val);
+      break;
+    case 4:
+      for (j=0; j<elements; j++, hostAddrDst += 4)
+        WriteHostDWordToLittleEndian((Bit32u*)hostAddrDst, (Bit32u) val);
+      break;
+    default:
+      for (j=0; j<elements; j++, hostAddrDst += 8)
+        WriteHostQWordToLittleEndian((Bit64u*)hostAddrDst, val);
+      break;
     }
+
+    done += elements;
+    count -= elements;
+    laddrDst += elements * len;
+
+    // self modifying code detected
+    if (BX_CPU_THIS_PTR async_event) break;
   }
 
-  return count;
+  return done;
 }
 
-Bit32u BX_CPU_C::FastRepSTOSW(unsigned dstSeg, Bit32u dstOff, Bit16u val, Bit32u count)
+BX_CPP_INLINE Bit64u ReadHostElementFromLittleEndian(Bit8u *hostAddr, unsigned len)
 {
-  bx_address laddrDst;
+  switch(len) {
+  case 1:
+    return *hostAddr;
+  case 2:
+    return ReadHostWordFromLittleEndian((Bit16u*) hostAddr);
+  case 4:
+    return ReadHostDWordFromLittleEndian((Bit32u*) hostAddr);
+  default:
+    return ReadHostQWordFromLittleEndian((Bit64u*) hostAddr);
+  }
+}
+
+// REPE/REPNE CMPS and SCAS: skip over the elements which don't terminate the
+// repeat loop (compare equal for REPE or not equal for REPNE). The element
+// terminating the loop is left to the instruction handler which updates
+// the arithmetic flags.
 
+Bit32u BX_CPU_C::FastRepCMPS(unsigned srcSeg, Bit32u srcOff, unsigned dstSeg, Bit32u dstOff, unsigned len, Bit32u count, bool repe)
+{
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (dstSegPtr->cache.valid & SegAccessWOK4G) {
-    laddrDst = dstOff;
-  }
-  else {
-    if (!(dstSegPtr->cache.valid & SegAccessWOK))
-      return 0;
-    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-      return 0;
+  bx_address laddrSrc, laddrDst;
 
-    laddrDst = get_laddr32(dstSeg, dstOff);
-  }
+  Bit32u elements = FastRepSegAccess(srcSeg, srcOff, false, &laddrSrc) / len;
+  if (count > elements)
+    count = elements;
 
-  return FastRepSTOSW(laddrDst, val, count);
+  elements = FastRepSegAccess(dstSeg, dstOff, false, &laddrDst) / len;
+  if (count > elements)
+    count = elements;
+
+  if (! count) return 0;
+
+  return FastRepCMPS(laddrSrc, laddrDst, len, count, repe);
 }
 
-Bit32u BX_CPU_C::FastRepSTOSW(bx_address laddrDst, Bit16u val, Bit32u count)
+Bit32u BX_CPU_C::FastRepCMPS(bx_address laddrSrc, bx_address laddrDst, unsigned len, Bit32u count, bool repe)
 {
-  Bit8u *hostAddrDst = v2h_write_byte(laddrDst, USER_PL);
-  // Check that native host access was not vetoed for that page
-  if (!hostAddrDst) return 0;
-
   assert(! BX_CPU_THIS_PTR get_DF());
 
-  // See how many words can fit in the rest of this page.
-  Bit32u wordsFitDst = (0x1000 - PAGE_OFFSET(laddrDst)) >> 1;
-
-  // Restrict word count to the number that will fit in either
-  // source or dest pages.
-  if (count > wordsFitDst)
-    count = wordsFitDst;
   if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
     count = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  if (count > BX_FAST_STRING_MAX_BYTES / len)
+    count = BX_FAST_STRING_MAX_BYTES / len;
 
-  // If after all the restrictions, there is anything left to do...
-  if (count) {
-    // Transfer data directly using host addresses
-    for (unsigned j=0; j<count; j++) {
-      WriteHostWordToLittleEndian((Bit16u*)hostAddrDst, val);
-      hostAddrDst += 2;
+  Bit32u done = 0;
+
+  while (count) {
+    Bit8u *hostAddrSrc = v2h_read_byte(laddrSrc, USER_PL);
+    // Check that native host access was not vetoed for that page
+    if (!hostAddrSrc) break;
+
+    Bit8u *hostAddrDst = v2h_read_byte(laddrDst, USER_PL);
+    // Check that native host access was not vetoed for that page
+    if (!hostAddrDst) break;
+
+    // See how many elements can fit in the rest of both pages.
+    Bit32u bytesFit = BX_MIN(0x1000 - PAGE_OFFSET(laddrSrc), 0x1000 - PAGE_OFFSET(laddrDst));
+    Bit32u elements = bytesFit / len;
+    if (elements > count)
+      elements = count;
+
+    // element split between pages, let the instruction handler do it
+    if (! elements) break;
+
+    Bit32u n;
+    for (n=0; n<elements; n++, hostAddrSrc += len, hostAddrDst += len) {
+      if ((memcmp(hostAddrSrc, hostAddrDst, len) == 0) != repe) break;
     }
+
+    done += n;
+    if (n < elements) break;
+
+    count -= elements;
+    laddrSrc += elements * len;
+    laddrDst += elements * len;
   }
 
-  return count;
+  return done;
 }
 
-Bit32u BX_CPU_C::FastRepSTOSD(unsigned dstSeg, Bit32u dstOff, Bit32u val, Bit32u count)
+Bit32u BX_CPU_C::FastRepSCAS(unsigned dstSeg, Bit32u dstOff, Bit64u val, unsigned len, Bit32u count, bool repe)
 {
-  bx_address laddrDst;
-
   BX_ASSERT(BX_CPU_THIS_PTR cpu_mode != BX_MODE_LONG_64);
 
-  bx_segment_reg_t *dstSegPtr = &BX_CPU_THIS_PTR sregs[dstSeg];
-  if (dstSegPtr->cache.valid & SegAccessWOK4G) {
-    laddrDst = dstOff;
-  }
-  else {
-    if (!(dstSegPtr->cache.valid & SegAccessWOK))
-      return 0;
-    if ((dstOff | 0xfff) > dstSegPtr->cache.u.segment.limit_scaled)
-      return 0;
+  bx_address laddrDst;
 
-    laddrDst = get_laddr32(dstSeg, dstOff);
-  }
+  Bit32u elements = FastRepSegAccess(dstSeg, dstOff, false, &laddrDst) / len;
+  if (count > elements)
+    count = elements;
+
+  if (! count) return 0;
 
-  return FastRepSTOSD(laddrDst, val, count);
+  return FastRepSCAS(laddrDst, val, len, count, repe);
 }
 
-Bit32u BX_CPU_C::FastRepSTOSD(bx_address laddrDst, Bit32u val, Bit32u count)
+Bit32u BX_CPU_C::FastRepSCAS(bx_address laddrDst, Bit64u val, unsigned len, Bit32u count, bool repe)
 {
-  Bit8u *hostAddrDst = v2h_write_byte(laddrDst, USER_PL);
-  // Check that native host access was not vetoed for that page
-  if (!hostAddrDst) return 0;
-
   assert(! BX_CPU_THIS_PTR get_DF());
 
-  // See how many dwords can fit in the rest of this page.
-  Bit32u dwordsFitDst = (0x1000 - PAGE_OFFSET(laddrDst)) >> 2;
-
-  // Restrict dword count to the number that will fit in either
-  // source or dest pages.
-  if (count > dwordsFitDst)
-    count = dwordsFitDst;
   if (count > bx_pc_system.getNumCpuTicksLeftNextEvent())
     count = bx_pc_system.getNumCpuTicksLeftNextEvent();
+  if (count > BX_FAST_STRING_MAX_BYTES / len)
+    count = BX_FAST_STRING_MAX_BYTES / len;
 
-  // If after all the restrictions, there is anything left to do...
-  if (count) {
-    // Transfer data directly using host addresses
-    for (unsigned j=0; j<count; j++) {
-      WriteHostDWordToLittleEndian((Bit32u*)hostAddrDst, val);
-      hostAddrDst += 4;
+  Bit32u done = 0;
+
+  while (count) {
+    Bit8u *hostAddrDst = v2h_read_byte(laddrDst, USER_PL);
+    // Check that native host access was not vetoed for that page
+    if (!hostAddrDst) break;
+
+    // See how many elements can fit in the rest of this page.
+    Bit32u elements = (0x1000 - PAGE_OFFSET(laddrDst)) / len;
+    if (elements > count)
+      elements = count;
+
+    // element split between pages, let the instruction handler do it
+    if (! elements) break;
+
+    Bit32u n;
+    if (len == 1 && ! repe) {
+      // REPNE SCASB looks for the first byte equal to AL
+      Bit8u *match = (Bit8u *) memchr(hostAddrDst, (Bit8u) val, elements);
+      n = match ? (Bit32u)(match - hostAddrDst) : elements;
     }
+    else {
+      for (n=0; n<elements; n++, hostAddrDst += len) {
+        if ((ReadHostElementFromLittleEndian(hostAddrDst, len) == val) != repe) break;
+      }
+    }
+
+    done += n;
+    if (n < elements) break;
+
+    count -= elements;
+    laddrDst += elements * len;
   }
 
-  return count;
+  return done;
 }
+
 #endif
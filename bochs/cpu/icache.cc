@@ -34,6 +34,66 @@
 
 bxPageWriteStampTable pageWriteStampTable;
 
+bxPageWriteStampTable::bxPageWriteStampTable():
+  directory(NULL), dirEntries(0)
+{
+  memset(zeroBlock, 0, sizeof(zeroBlock));
+}
+
+void bxPageWriteStampTable::freeBlocks(void)
+{
+  for (Bit32u n=0; n < dirEntries; n++) {
+    if (directory[n] != zeroBlock)
+      delete [] directory[n];
+  }
+  delete [] directory;
+
+  directory = NULL;
+  dirEntries = 0;
+}
+
+void bxPageWriteStampTable::alloc(Bit64u memLen)
+{
+  freeBlocks();
+
+  Bit64u blockSize = (Bit64u) BX_WRITE_STAMP_BLOCK_PAGES << 12;
+  dirEntries = (Bit32u) ((memLen + blockSize - 1) / blockSize);
+  directory = new Bit32u* [dirEntries];
+  for (Bit32u n=0; n < dirEntries; n++)
+    directory[n] = zeroBlock;
+}
+
+Bit32u *bxPageWriteStampTable::allocStamp(bx_phy_address pAddr)
+{
+  bx_phy_address block = blockOf(pAddr);
+  if (block >= dirEntries) return NULL;
+
+  Bit32u *stamps = new Bit32u[BX_WRITE_STAMP_BLOCK_PAGES];
+  memset(stamps, 0, BX_WRITE_STAMP_BLOCK_PAGES * sizeof(Bit32u));
+
+#if BX_SMP_HOST_THREADS
+  // another processor thread might have allocated the block meanwhile
+  Bit32u *expected = zeroBlock;
+  if (! __atomic_compare_exchange_n(&directory[block], &expected, stamps, false,
+                  __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+  {
+    delete [] stamps;
+  }
+#else
+  directory[block] = stamps;
+#endif
+
+  return &directory[block][indexOf(pAddr)];
+}
+
+void bxPageWriteStampTable::resetWriteStamps(void)
+{
+  for (Bit32u n=0; n < dirEntries; n++) {
+    if (directory[n] != zeroBlock)
+      memset(directory[n], 0, BX_WRITE_STAMP_BLOCK_PAGES * sizeof(Bit32u));
+  }
+}
+
 extern int fetchDecode32(const Bit8u *fetchPtr, bool is_32, bxInstruction_c *i, unsigned remainingInPage);
 #if BX_SUPPORT_X86_64
 extern int fetchDecode64(const Bit8u *fetchPtr, bxInstruction_c *i, unsigned remainingInPage);
@@ -43,8 +103,14 @@ extern int assignHandler(bxInstruction_c *i, Bit32u fetchModeMask);
 void flushICaches(void)
 {
   for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SMP_HOST_THREADS
+    if (BX_CPU(i)->is_running_remotely()) {
+      BX_CPU(i)->post_remote_request(BX_REMOTE_REQUEST_ICACHE_FLUSH);
+      continue;
+    }
+#endif
     BX_CPU(i)->iCache.flushICacheEntries();
-    BX_CPU(i)->async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+    BX_EVENT_SET_BITS(BX_CPU(i)->async_event, BX_ASYNC_EVENT_STOP_TRACE);
   }
 
   pageWriteStampTable.resetWriteStamps();
@@ -55,11 +121,84 @@ void handleSMC(bx_phy_address pAddr, Bit32u mask)
   INC_SMC_STAT(smc);
 
   for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
-    BX_CPU(i)->async_event |= BX_ASYNC_EVENT_STOP_TRACE;
+#if BX_SMP_HOST_THREADS
+    // the other processor threads invalidate their traces themselves
+    if (BX_CPU(i)->is_running_remotely()) {
+      BX_CPU(i)->post_remote_smc(pAddr, mask);
+      continue;
+    }
+#endif
+    BX_EVENT_SET_BITS(BX_CPU(i)->async_event, BX_ASYNC_EVENT_STOP_TRACE);
     BX_CPU(i)->iCache.handleSMC(pAddr, mask);
   }
 }
 
+bxICache_c::bxICache_c(): entry(NULL), entries(0), mpool(NULL), mpsize(0), mpSegmentSize(0)
+{
+  flushICacheEntries();
+  flushes = reclaims = 0;
+}
+
+bxICache_c::~bxICache_c()
+{
+  delete [] entry;
+  delete [] mpool;
+}
+
+// allocate trace cache with 'size' entries, size must be power of 2
+void bxICache_c::alloc(unsigned size)
+{
+  delete [] entry;
+  delete [] mpool;
+
+  entries = BX_MAX(size, BX_ICACHE_MIN_ENTRIES);
+  entry = new bxICacheEntry_c[entries];
+
+  mpSegmentSize = (entries * BX_ICACHE_MEMPOOL_RATIO) / BX_ICACHE_MEMPOOL_SEGMENTS;
+  mpsize = mpSegmentSize * BX_ICACHE_MEMPOOL_SEGMENTS;
+  mpool = new bxInstruction_c[mpsize];
+
+  flushICacheEntries();
+  flushes = reclaims = 0;
+}
+
+// The trace memory pool segment is full. Instead of flushing the whole
+// trace cache continue with the next segment in FIFO order and invalidate
+// only the traces which were allocated from it before.
+void bxICache_c::reclaimNextSegment(void)
+{
+  mpSegmentUsed[mpSegment] = mpindex - mpSegment * mpSegmentSize;
+
+  mpSegment = (mpSegment + 1) % BX_ICACHE_MEMPOOL_SEGMENTS;
+  mpindex = mpSegment * mpSegmentSize;
+  mpSegmentEnd = mpindex + mpSegmentSize;
+
+  if (mpSegmentUsed[mpSegment] == 0) return; // nothing allocated there yet
+
+  // some traces might be linked into the reclaimed ones
+  if (breakLinks()) return; // the whole trace cache was flushed
+
+  reclaims++;
+  poolOccupancy -= mpSegmentUsed[mpSegment];
+  mpSegmentUsed[mpSegment] = 0;
+
+  const bxInstruction_c *start = &mpool[mpindex], *end = &mpool[mpSegmentEnd];
+
+  for (unsigned n=0;n<BX_ICACHE_PAGE_SPLIT_ENTRIES;n++) {
+    if (pageSplitIndex[n].ppf != BX_ICACHE_INVALID_PHY_ADDRESS) {
+      const bxInstruction_c *i = pageSplitIndex[n].e->i;
+      if (i >= start && i < end)
+        pageSplitIndex[n].ppf = BX_ICACHE_INVALID_PHY_ADDRESS;
+    }
+  }
+
+  bxICacheEntry_c *e = entry;
+  for (unsigned n=0; n < entries; n++, e++) {
+    if (e->pAddr != BX_ICACHE_INVALID_PHY_ADDRESS && e->i >= start && e->i < end)
+      flushSMC(e);
+  }
+}
+
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
 
 void BX_CPU_C::BxEndTrace(bxInstruction_c *i)
@@ -86,6 +225,10 @@ bxICacheEntry_c* BX_CPU_C::serveICacheMiss(Bit32u eipBiased, bx_phy_address pAdd
   // trace from incoming instruction bytes stream !
   entry->pAddr = pAddr;
   entry->traceMask = 0;
+#if BX_SUPPORT_DBT
+  entry->execCount = 0;
+  entry->dbtCode = NULL;
+#endif
 
   unsigned remainingInPage = BX_CPU_THIS_PTR eipPageWindowSize - eipBiased;
   const Bit8u *fetchPtr = BX_CPU_THIS_PTR eipFetchPtr + eipBiased;
@@ -103,13 +246,19 @@ bxICacheEntry_c* BX_CPU_C::serveICacheMiss(Bit32u eipBiased, bx_phy_address pAdd
 
   // Don't allow traces longer than cpu_loop can execute
   static unsigned quantum =
-#if BX_SUPPORT_SMP
+#if BX_SUPPORT_SMP && BX_SMP_HOST_THREADS == 0
     (BX_SMP_PROCESSORS > 1) ? SIM->get_param_num(BXPN_SMP_QUANTUM)->get() :
 #endif
     BX_MAX_TRACE_LENGTH;
  
   for (unsigned n=0;n < quantum;n++)
   {
+#if BX_SMP_HOST_THREADS
+    // mark the lines before the instruction bytes are read, a processor
+    // thread writing them meanwhile invalidates the trace
+    pageWriteStampTable.markICacheMask(pAddr, (1 << (pageOffset >> 7)) |
+        (1 << (BX_MIN(pageOffset + 15, 0xfff) >> 7)));
+#endif
 #if BX_SUPPORT_X86_64
     if (BX_CPU_THIS_PTR cpu_mode == BX_MODE_LONG_64)
       ret = fetchDecode64(fetchPtr, i, remainingInPage);
@@ -165,10 +314,21 @@ bxICacheEntry_c* BX_CPU_C::serveICacheMiss(Bit32u eipBiased, bx_phy_address pAdd
 
     // continue to the next instruction
     remainingInPage -= iLen;
+    Bit32s nextOffset = iLen;
+#if BX_SUPPORT_SUPERBLOCKS
+    // follow direct branch with target inside the same page, the trace
+    // continues at the branch target instead of the next instruction
+    if ((n+1) < quantum && genSuperblockBranch(i-1, remainingInPage)) {
+      Bit32s disp = (Bit32s) i[-1].Id();
+      remainingInPage -= disp;
+      nextOffset += disp;
+      ret = 0;
+    }
+#endif
     if (ret != 0 /* stop trace indication */ || remainingInPage == 0) break;
-    pAddr += iLen;
-    pageOffset += iLen;
-    fetchPtr += iLen;
+    pAddr += nextOffset;
+    pageOffset += nextOffset;
+    fetchPtr += nextOffset;
 
     // try to find a trace starting from current pAddr and merge
     if (remainingInPage >= 15) { // avoid merging with page split trace
@@ -201,7 +361,9 @@ bool BX_CPU_C::mergeTraces(bxICacheEntry_c *entry, bxInstruction_c *i, bx_phy_ad
 {
   bxICacheEntry_c *e = BX_CPU_THIS_PTR iCache.find_entry(pAddr, BX_CPU_THIS_PTR fetchModeMask);
 
-  if (e != NULL)
+  // superblock trace could loop back to its own beginning which is still
+  // under construction
+  if (e != NULL && e != entry)
   {
     // determine max amount of instruction to take from another entry
     unsigned max_length = e->tlen;
@@ -227,6 +389,83 @@ bool BX_CPU_C::mergeTraces(bxICacheEntry_c *entry, bxInstruction_c *i, bx_phy_ad
   return 0;
 }
 
+#if BX_SUPPORT_SUPERBLOCKS
+
+struct bxSuperblockBranch {
+  BxExecutePtr_tR execute;
+  BxExecutePtr_tR superblock;
+  bool conditional;
+};
+
+static const bxSuperblockBranch superblockBranches[] = {
+  { &BX_CPU_C::JMP_Jd,  &BX_CPU_C::JMP_Jd_Superblock,  false },
+  { &BX_CPU_C::JO_Jd,   &BX_CPU_C::JO_Jd_Superblock,   true  },
+  { &BX_CPU_C::JNO_Jd,  &BX_CPU_C::JNO_Jd_Superblock,  true  },
+  { &BX_CPU_C::JB_Jd,   &BX_CPU_C::JB_Jd_Superblock,   true  },
+  { &BX_CPU_C::JNB_Jd,  &BX_CPU_C::JNB_Jd_Superblock,  true  },
+  { &BX_CPU_C::JZ_Jd,   &BX_CPU_C::JZ_Jd_Superblock,   true  },
+  { &BX_CPU_C::JNZ_Jd,  &BX_CPU_C::JNZ_Jd_Superblock,  true  },
+  { &BX_CPU_C::JBE_Jd,  &BX_CPU_C::JBE_Jd_Superblock,  true  },
+  { &BX_CPU_C::JNBE_Jd, &BX_CPU_C::JNBE_Jd_Superblock, true  },
+  { &BX_CPU_C::JS_Jd,   &BX_CPU_C::JS_Jd_Superblock,   true  },
+  { &BX_CPU_C::JNS_Jd,  &BX_CPU_C::JNS_Jd_Superblock,  true  },
+  { &BX_CPU_C::JP_Jd,   &BX_CPU_C::JP_Jd_Superblock,   true  },
+  { &BX_CPU_C::JNP_Jd,  &BX_CPU_C::JNP_Jd_Superblock,  true  },
+  { &BX_CPU_C::JL_Jd,   &BX_CPU_C::JL_Jd_Superblock,   true  },
+  { &BX_CPU_C::JNL_Jd,  &BX_CPU_C::JNL_Jd_Superblock,  true  },
+  { &BX_CPU_C::JLE_Jd,  &BX_CPU_C::JLE_Jd_Superblock,  true  },
+  { &BX_CPU_C::JNLE_Jd, &BX_CPU_C::JNLE_Jd_Superblock, true  },
+#if BX_SUPPORT_X86_64
+  { &BX_CPU_C::JMP_Jq,  &BX_CPU_C::JMP_Jq_Superblock,  false },
+  { &BX_CPU_C::JO_Jq,   &BX_CPU_C::JO_Jq_Superblock,   true  },
+  { &BX_CPU_C::JNO_Jq,  &BX_CPU_C::JNO_Jq_Superblock,  true  },
+  { &BX_CPU_C::JB_Jq,   &BX_CPU_C::JB_Jq_Superblock,   true  },
+  { &BX_CPU_C::JNB_Jq,  &BX_CPU_C::JNB_Jq_Superblock,  true  },
+  { &BX_CPU_C::JZ_Jq,   &BX_CPU_C::JZ_Jq_Superblock,   true  },
+  { &BX_CPU_C::JNZ_Jq,  &BX_CPU_C::JNZ_Jq_Superblock,  true  },
+  { &BX_CPU_C::JBE_Jq,  &BX_CPU_C::JBE_Jq_Superblock,  true  },
+  { &BX_CPU_C::JNBE_Jq, &BX_CPU_C::JNBE_Jq_Superblock, true  },
+  { &BX_CPU_C::JS_Jq,   &BX_CPU_C::JS_Jq_Superblock,   true  },
+  { &BX_CPU_C::JNS_Jq,  &BX_CPU_C::JNS_Jq_Superblock,  true  },
+  { &BX_CPU_C::JP_Jq,   &BX_CPU_C::JP_Jq_Superblock,   true  },
+  { &BX_CPU_C::JNP_Jq,  &BX_CPU_C::JNP_Jq_Superblock,  true  },
+  { &BX_CPU_C::JL_Jq,   &BX_CPU_C::JL_Jq_Superblock,   true  },
+  { &BX_CPU_C::JNL_Jq,  &BX_CPU_C::JNL_Jq_Superblock,  true  },
+  { &BX_CPU_C::JLE_Jq,  &BX_CPU_C::JLE_Jq_Superblock,  true  },
+  { &BX_CPU_C::JNLE_Jq, &BX_CPU_C::JNLE_Jq_Superblock, true  },
+#endif
+};
+
+// Decide if the trace could be continued at the target of the just decoded
+// direct branch. Unconditional branches are always followed, conditional
+// branches are statically predicted - backward taken, forward not taken
+// (a forward branch which is not taken doesn't end the trace anyway).
+// The branch target must be in the same page, this keeps the traceMask and
+// the page write stamp of the trace valid.
+bool BX_CPU_C::genSuperblockBranch(bxInstruction_c *i, unsigned remainingInPage)
+{
+  for (unsigned n=0; n < sizeof(superblockBranches)/sizeof(superblockBranches[0]); n++) {
+    const bxSuperblockBranch *branch = &superblockBranches[n];
+    if (i->execute1 != branch->execute) continue;
+
+    Bit32s disp = (Bit32s) i->Id();
+    if (branch->conditional && disp >= 0)
+      return false;
+
+    // offset of the branch target relative to the next instruction
+    if (disp >= (Bit32s) remainingInPage ||
+        disp < -(Bit32s) (BX_CPU_THIS_PTR eipPageWindowSize - remainingInPage))
+      return false;
+
+    i->execute1 = branch->superblock;
+    return true;
+  }
+
+  return false;
+}
+
+#endif
+
 void BX_CPU_C::boundaryFetch(const Bit8u *fetchPtr, unsigned remainingInPage, bxInstruction_c *i)
 {
   unsigned j, k;
@@ -26,26 +26,52 @@
 
 extern void handleSMC(bx_phy_address pAddr, Bit32u mask);
 
+// Write stamps are kept for every 4K page of guest physical memory, one bit
+// per 128-byte cache line which holds decoded code. The table is two level:
+// the directory is sized from the guest memory size and every directory
+// entry covers 4M of physical memory. All the entries initially point to
+// the single shared block of zero stamps, a private block is allocated only
+// when a trace is decoded from the memory range it covers. Writes beyond the
+// guest memory never reach the table.
+
+#define BX_WRITE_STAMP_BLOCK_SHIFT 10
+#define BX_WRITE_STAMP_BLOCK_PAGES (1 << BX_WRITE_STAMP_BLOCK_SHIFT)
+
 class bxPageWriteStampTable
 {
-  const Bit32u PHY_MEM_PAGES = 1024*1024;
-  Bit32u *fineGranularityMapping;
+  Bit32u **directory;
+  Bit32u dirEntries;
+  Bit32u zeroBlock[BX_WRITE_STAMP_BLOCK_PAGES];
 
-public:
-  bxPageWriteStampTable() {
-    fineGranularityMapping = new Bit32u[PHY_MEM_PAGES];
-    resetWriteStamps();
+  BX_CPP_INLINE static bx_phy_address blockOf(bx_phy_address pAddr) {
+    return pAddr >> (12 + BX_WRITE_STAMP_BLOCK_SHIFT);
   }
- ~bxPageWriteStampTable() { delete [] fineGranularityMapping; }
 
-  BX_CPP_INLINE static Bit32u hash(bx_phy_address pAddr) {
-    // can share writeStamps between multiple pages if >32 bit phy address
-    return ((Bit32u) pAddr) >> 12;
+  BX_CPP_INLINE static unsigned indexOf(bx_phy_address pAddr) {
+    return (unsigned)(pAddr >> 12) & (BX_WRITE_STAMP_BLOCK_PAGES-1);
+  }
+
+  // returns NULL for pages beyond the guest memory
+  BX_CPP_INLINE Bit32u *stampOf(bx_phy_address pAddr) const
+  {
+    bx_phy_address block = blockOf(pAddr);
+    if (block >= dirEntries) return NULL;
+    return &directory[block][indexOf(pAddr)];
   }
 
+  Bit32u *allocStamp(bx_phy_address pAddr);
+  void freeBlocks(void);
+
+public:
+  bxPageWriteStampTable();
+ ~bxPageWriteStampTable() { freeBlocks(); }
+
+  void alloc(Bit64u memLen);
+
   BX_CPP_INLINE Bit32u getFineGranularityMapping(bx_phy_address pAddr) const
   {
-    return fineGranularityMapping[hash(pAddr)];
+    Bit32u *stamp = stampOf(pAddr);
+    return stamp ? *stamp : 0;
   }
 
   BX_CPP_INLINE void markICache(bx_phy_address pAddr, unsigned len)
@@ -53,56 +79,72 @@ public:
     Bit32u mask  = 1 << (PAGE_OFFSET((Bit32u) pAddr) >> 7);
            mask |= 1 << (PAGE_OFFSET((Bit32u) pAddr + len - 1) >> 7);
 
-    fineGranularityMapping[hash(pAddr)] |= mask;
+    markICacheMask(pAddr, mask);
   }
 
   BX_CPP_INLINE void markICacheMask(bx_phy_address pAddr, Bit32u mask)
   {
-    fineGranularityMapping[hash(pAddr)] |= mask;
+    Bit32u *stamp = stampOf(pAddr);
+    if (stamp == &zeroBlock[indexOf(pAddr)])
+      stamp = allocStamp(pAddr);
+
+    if (stamp)
+#if BX_SMP_HOST_THREADS
+      __atomic_or_fetch(stamp, mask, __ATOMIC_SEQ_CST);
+#else
+      *stamp |= mask;
+#endif
   }
 
   // whole page is being altered
   BX_CPP_INLINE void decWriteStamp(bx_phy_address pAddr)
   {
-    Bit32u index = hash(pAddr);
+    Bit32u *stamp = stampOf(pAddr);
 
-    if (fineGranularityMapping[index]) {
+    if (stamp && *stamp) {
       handleSMC(pAddr, 0xffffffff); // one of the CPUs might be running trace from this page
-      fineGranularityMapping[index] = 0;
+#if BX_SMP_HOST_THREADS
+      __atomic_store_n(stamp, 0, __ATOMIC_SEQ_CST);
+#else
+      *stamp = 0;
+#endif
     }
   }
 
   // assumption: write does not split 4K page
   BX_CPP_INLINE void decWriteStamp(bx_phy_address pAddr, unsigned len)
   {
-    Bit32u index = hash(pAddr);
+    Bit32u *stamp = stampOf(pAddr);
 
-    if (fineGranularityMapping[index]) {
+    if (stamp && *stamp) {
        Bit32u mask  = 1 << (PAGE_OFFSET((Bit32u) pAddr) >> 7);
               mask |= 1 << (PAGE_OFFSET((Bit32u) pAddr + len - 1) >> 7);
 
-       if (fineGranularityMapping[index] & mask) {
+       if (*stamp & mask) {
           // one of the CPUs might be running trace from this page
           handleSMC(pAddr, mask);
-          fineGranularityMapping[index] &= ~mask;
-       }       
+#if BX_SMP_HOST_THREADS
+          __atomic_and_fetch(stamp, ~mask, __ATOMIC_SEQ_CST);
+#else
+          *stamp &= ~mask;
+#endif
+       }
     }
   }
 
-  BX_CPP_INLINE void resetWriteStamps(void);
+  void resetWriteStamps(void);
 };
 
-BX_CPP_INLINE void bxPageWriteStampTable::resetWriteStamps(void)
-{
-  for (Bit32u i=0; i<PHY_MEM_PAGES; i++) {
-    fineGranularityMapping[i] = 0;
-  }
-}
-
 extern bxPageWriteStampTable pageWriteStampTable;
 
-#define BxICacheEntries (64  * 1024)  // Must be a power of 2.
-#define BxICacheMemPool (576 * 1024)
+// default number of trace cache entries, configurable through bochsrc
+#define BX_ICACHE_DEFAULT_ENTRIES (64 * 1024)  // Must be a power of 2.
+// all traces from the same 4K page are kept in one window of 4K entries
+#define BX_ICACHE_MIN_ENTRIES     (4 * 1024)
+// instructions in the trace memory pool per trace cache entry
+#define BX_ICACHE_MEMPOOL_RATIO   9
+// the trace memory pool is reclaimed one segment at a time in FIFO order
+#define BX_ICACHE_MEMPOOL_SEGMENTS 8
 
 struct bxICacheEntry_c
 {
@@ -111,6 +153,11 @@ struct bxICacheEntry_c
 
   Bit32u tlen;          // Trace length in instructions
   bxInstruction_c *i;
+
+#if BX_SUPPORT_DBT
+  Bit32u execCount;         // Trace executions counter (until translated)
+  bxDbtTracePtr_t dbtCode;  // Translated trace host code or NULL
+#endif
 };
 
 #define BX_MAX_TRACE_LENGTH 32
@@ -121,6 +168,9 @@ BX_CPP_INLINE void flushSMC(bxICacheEntry_c *e)
 {
   if (e->pAddr != BX_ICACHE_INVALID_PHY_ADDRESS) {
     e->pAddr = BX_ICACHE_INVALID_PHY_ADDRESS;
+#if BX_SUPPORT_DBT
+    e->dbtCode = NULL;
+#endif
 #if BX_SUPPORT_HANDLERS_CHAINING_SPEEDUPS
     extern void genDummyICacheEntry(bxInstruction_c *i);
 //  for (unsigned instr=0;instr < e->tlen; instr++)
@@ -132,9 +182,16 @@ BX_CPP_INLINE void flushSMC(bxICacheEntry_c *e)
 
 class BOCHSAPI bxICache_c {
 public:
-  bxICacheEntry_c entry[BxICacheEntries];
-  bxInstruction_c mpool[BxICacheMemPool];
+  bxICacheEntry_c *entry;
+  unsigned entries;       // number of trace cache entries, power of 2
+
+  bxInstruction_c *mpool;
+  Bit32u mpsize;          // trace memory pool size in instructions
   unsigned mpindex;
+  unsigned mpSegmentSize;
+  unsigned mpSegment;     // memory pool segment being filled
+  unsigned mpSegmentEnd;
+  unsigned mpSegmentUsed[BX_ICACHE_MEMPOOL_SEGMENTS];
 
   Bit32u traceLinkTimeStamp;
 
@@ -145,30 +202,51 @@ public:
   } pageSplitIndex[BX_ICACHE_PAGE_SPLIT_ENTRIES];
   int nextPageSplitIndex;
 
+#if BX_SUPPORT_DBT
+  bxDbtCodeBuffer dbtBuffer;
+#endif
+
+  // statistics
+  Bit64u flushes;         // whole trace cache flushes
+  Bit64u reclaims;        // memory pool segments reclaimed
+  Bit32u poolOccupancy;   // instructions allocated in not reclaimed segments
+
 public:
-  bxICache_c() { flushICacheEntries(); }
+  bxICache_c();
+ ~bxICache_c();
+
+  void alloc(unsigned size);
 
-  BX_CPP_INLINE static unsigned hash(bx_phy_address pAddr, unsigned fetchModeMask)
+  BX_CPP_INLINE unsigned hash(bx_phy_address pAddr, unsigned fetchModeMask) const
   {
-//  return ((pAddr + (pAddr << 2) + (pAddr>>6)) & (BxICacheEntries-1)) ^ fetchModeMask;
-    return ((pAddr) & (BxICacheEntries-1)) ^ fetchModeMask;
+    // The window of 4K entries for the page is selected by multiplicative
+    // hash of the page frame so the pages with the same low address bits
+    // don't compete for the same entries. handleSMC() relies on the page
+    // window.
+    Bit32u window = (Bit32u) (((Bit32u) (pAddr >> 12)) * 0x9E3779B1) >> 20;
+    return (((window << 12) | PAGE_OFFSET((Bit32u) pAddr)) & (entries-1)) ^ fetchModeMask;
   }
 
   BX_CPP_INLINE void alloc_trace(bxICacheEntry_c *e)
   {
     // took +1 garbend for instruction chaining speedup (end-of-trace opcode)
-    if ((mpindex + BX_MAX_TRACE_LENGTH + 1) > BxICacheMemPool) {
-      flushICacheEntries();
+    if ((mpindex + BX_MAX_TRACE_LENGTH + 1) > mpSegmentEnd) {
+      reclaimNextSegment();
     }
     e->i = &mpool[mpindex];
     e->tlen = 0;
   }
 
-  BX_CPP_INLINE void commit_trace(unsigned len) { mpindex += len; }
+  void reclaimNextSegment(void);
+
+  BX_CPP_INLINE void commit_trace(unsigned len) {
+    mpindex += len;
+    poolOccupancy += len;
+  }
 
   BX_CPP_INLINE void commit_page_split_trace(bx_phy_address paddr, bxICacheEntry_c *e)
   {
-    mpindex += e->tlen;
+    commit_trace(e->tlen);
 
     // register page split entry
     if (pageSplitIndex[nextPageSplitIndex].ppf != BX_ICACHE_INVALID_PHY_ADDRESS)
@@ -183,6 +261,9 @@ public:
   BX_CPP_INLINE void handleSMC(bx_phy_address pAddr, Bit32u mask);
 
   BX_CPP_INLINE void flushICacheEntries(void);
+#if BX_SUPPORT_DBT
+  BX_CPP_INLINE void flushTranslations(void);
+#endif
 
   BX_CPP_INLINE bxICacheEntry_c* get_entry(bx_phy_address pAddr, unsigned fetchModeMask)
   {
@@ -214,9 +295,13 @@ BX_CPP_INLINE void bxICache_c::flushICacheEntries(void)
   bxICacheEntry_c* e = entry;
   unsigned i;
 
-  for (i=0; i<BxICacheEntries; i++, e++) {
+  for (i=0; i<entries; i++, e++) {
     e->pAddr = BX_ICACHE_INVALID_PHY_ADDRESS;
     e->traceMask = 0;
+#if BX_SUPPORT_DBT
+    e->execCount = 0;
+    e->dbtCode = NULL;
+#endif
   }
 
   nextPageSplitIndex = 0;
@@ -224,13 +309,40 @@ BX_CPP_INLINE void bxICache_c::flushICacheEntries(void)
     pageSplitIndex[i].ppf = BX_ICACHE_INVALID_PHY_ADDRESS;
 
   mpindex = 0;
+  mpSegment = 0;
+  mpSegmentEnd = mpSegmentSize;
+  for (i=0;i<BX_ICACHE_MEMPOOL_SEGMENTS;i++)
+    mpSegmentUsed[i] = 0;
+  poolOccupancy = 0;
+  flushes++;
 
   traceLinkTimeStamp = 0;
+
+#if BX_SUPPORT_DBT
+  dbtBuffer.reset();
+#endif
 }
 
+#if BX_SUPPORT_DBT
+
+// drop translated code of all traces but keep the decoded traces
+BX_CPP_INLINE void bxICache_c::flushTranslations(void)
+{
+  bxICacheEntry_c* e = entry;
+
+  for (unsigned i=0; i<entries; i++, e++) {
+    e->execCount = 0;
+    e->dbtCode = NULL;
+  }
+
+  dbtBuffer.reset();
+}
+
+#endif
+
 BX_CPP_INLINE void bxICache_c::handleSMC(bx_phy_address pAddr, Bit32u mask)
 {
-  Bit32u pAddrIndex = bxPageWriteStampTable::hash(pAddr);
+  bx_phy_address pAddrPage = PPFOf(pAddr);
 
   // break all links bewteen traces
   if (breakLinks()) return;
@@ -241,16 +353,12 @@ BX_CPP_INLINE void bxICache_c::handleSMC(bx_phy_address pAddr, Bit32u mask)
   // be invalidated. In order to solve this issue  replace all instructions
   // from the invalidated trace with dummy EndOfTrace opcodes.
 
-  // Another corner case that has to be handled - pageWriteStampTable wrap.
-  // Multiple physical addresses could be mapped into single pageWriteStampTable
-  // entry and all of them have to be invalidated here now.
-
   if (mask & 0x1) {
     // the store touched 1st cache line in the page, check for
     // page split traces to invalidate.
     for (unsigned i=0;i<BX_ICACHE_PAGE_SPLIT_ENTRIES;i++) {
       if (pageSplitIndex[i].ppf != BX_ICACHE_INVALID_PHY_ADDRESS) {
-        if (pAddrIndex == bxPageWriteStampTable::hash(pageSplitIndex[i].ppf)) {
+        if (pAddrPage == PPFOf(pageSplitIndex[i].ppf)) {
           pageSplitIndex[i].ppf = BX_ICACHE_INVALID_PHY_ADDRESS;
           flushSMC(pageSplitIndex[i].e);
         }
@@ -265,7 +373,7 @@ BX_CPP_INLINE void bxICache_c::handleSMC(bx_phy_address pAddr, Bit32u mask)
     Bit32u line_mask = (1 << n);
     if (line_mask > mask) break;
     for (unsigned index=0; index < 128; index++, e++) {
-      if (pAddrIndex == bxPageWriteStampTable::hash(e->pAddr) && (e->traceMask & mask) != 0) {
+      if (pAddrPage == PPFOf(e->pAddr) && (e->traceMask & mask) != 0) {
         flushSMC(e);
       }
     }
@@ -63,6 +63,13 @@ BX_CPU_C::BX_CPU_C(unsigned id): bx_cpuid(id)
 
   stats = NULL;
 
+#if BX_SMP_HOST_THREADS
+  remote.lock = 0;
+  remote.request = 0;
+  remote.smc_count = 0;
+  remote.sipi_vector = 0;
+#endif
+
   srand(time(NULL)); // initialize random generator for RDRAND/RDSEED
 }
 
@@ -122,6 +129,14 @@ void BX_CPU_C::initialize(void)
 
   init_FetchDecodeTables(); // must be called after init_isa_features_bitmask()
 
+  Bit32u icache_size = SIM->get_param_num(BXPN_ICACHE_SIZE)->get();
+  if (icache_size & (icache_size - 1)) {
+    while (icache_size & (icache_size - 1))
+      icache_size &= icache_size - 1;
+    BX_ERROR(("icache_size must be power of 2, using %uK entries", icache_size));
+  }
+  BX_CPU_THIS_PTR iCache.alloc(icache_size * 1024);
+
 #if BX_CPU_LEVEL >= 6
   xsave_xrestor_init();
 #endif
@@ -160,6 +175,18 @@ void BX_CPU_C::init_statistics(void)
   new bx_shadow_num_c(cpu, "iCacheLookups", &stats->iCacheLookups);
   new bx_shadow_num_c(cpu, "iCachePrefetch", &stats->iCachePrefetch);
   new bx_shadow_num_c(cpu, "iCacheMisses", &stats->iCacheMisses);
+  new bx_shadow_num_c(cpu, "iCacheTraceDispatches", &stats->iCacheTraceDispatches);
+#if BX_SUPPORT_SUPERBLOCKS
+  new bx_shadow_num_c(cpu, "iCacheSideExits", &stats->iCacheSideExits);
+#endif
+  new bx_shadow_num_c(cpu, "iCacheFlushes", &iCache.flushes);
+  new bx_shadow_num_c(cpu, "iCacheReclaims", &iCache.reclaims);
+  new bx_shadow_num_c(cpu, "iCachePoolOccupancy", &iCache.poolOccupancy);
+  new bx_shadow_num_c(cpu, "iCachePoolSize", &iCache.mpsize);
+#if BX_SUPPORT_DBT
+  new bx_shadow_num_c(cpu, "dbtTranslations", &stats->dbtTranslations);
+  new bx_shadow_num_c(cpu, "dbtExecutions", &stats->dbtExecutions);
+#endif
 #endif
 
 #if InstrumentTLB
@@ -169,11 +196,15 @@ void BX_CPU_C::init_statistics(void)
   new bx_shadow_num_c(cpu, "tlbMisses", &stats->tlbMisses);
   new bx_shadow_num_c(cpu, "tlbExecuteMisses", &stats->tlbExecuteMisses);
   new bx_shadow_num_c(cpu, "tlbWriteMisses", &stats->tlbWriteMisses);
+  new bx_shadow_num_c(cpu, "tlbEvictions", &stats->tlbEvictions);
+  new bx_shadow_num_c(cpu, "tlbLargeHits", &stats->tlbLargeHits);
 #endif
 
 #if InstrumentTLBFlush
   new bx_shadow_num_c(cpu, "tlbGlobalFlushes", &stats->tlbGlobalFlushes);
   new bx_shadow_num_c(cpu, "tlbNonGlobalFlushes", &stats->tlbNonGlobalFlushes);
+  new bx_shadow_num_c(cpu, "tlbContextSwitches", &stats->tlbContextSwitches);
+  new bx_shadow_num_c(cpu, "tlbContextHits", &stats->tlbContextHits);
 #endif
 
 #if InstrumentStackPrefetch
@@ -514,41 +545,36 @@ void BX_CPU_C::register_state(void)
   BXRS_PARAM_BOOL(cpu, in_smm, in_smm);
 
 #if BX_DEBUGGER
+  // only the first address space context of the TLB is exposed
   bx_list_c *dtlb = new bx_list_c(cpu, "DTLB");
-#if BX_CPU_LEVEL >= 5
-  BXRS_PARAM_BOOL(dtlb, split_large, DTLB.split_large);
-#endif
   for (n=0; n<BX_DTLB_SIZE; n++) {
     sprintf(name, "entry%u", n);
     bx_list_c *tlb_entry = new bx_list_c(dtlb, name);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf, DTLB.entry[n].lpf);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf_mask, DTLB.entry[n].lpf_mask);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, ppf, DTLB.entry[n].ppf);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, accessBits, DTLB.entry[n].accessBits);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf, DTLB.context[0].entry[n].lpf);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf_mask, DTLB.context[0].entry[n].lpf_mask);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, ppf, DTLB.context[0].entry[n].ppf);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, accessBits, DTLB.context[0].entry[n].accessBits);
 #if BX_SUPPORT_PKEYS
-    BXRS_HEX_PARAM_FIELD(tlb_entry, pkey, DTLB.entry[n].pkey);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, pkey, DTLB.context[0].entry[n].pkey);
 #endif
 #if BX_SUPPORT_MEMTYPE
-    BXRS_HEX_PARAM_FIELD(tlb_entry, memtype, DTLB.entry[n].memtype);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, memtype, DTLB.context[0].entry[n].memtype);
 #endif
   }
 
   bx_list_c *itlb = new bx_list_c(cpu, "ITLB");
-#if BX_CPU_LEVEL >= 5
-  BXRS_PARAM_BOOL(itlb, split_large, ITLB.split_large);
-#endif
   for (n=0; n<BX_ITLB_SIZE; n++) {
     sprintf(name, "entry%u", n);
     bx_list_c *tlb_entry = new bx_list_c(itlb, name);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf, ITLB.entry[n].lpf);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf_mask, ITLB.entry[n].lpf_mask);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, ppf, ITLB.entry[n].ppf);
-    BXRS_HEX_PARAM_FIELD(tlb_entry, accessBits, ITLB.entry[n].accessBits);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf, ITLB.context[0].entry[n].lpf);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, lpf_mask, ITLB.context[0].entry[n].lpf_mask);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, ppf, ITLB.context[0].entry[n].ppf);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, accessBits, ITLB.context[0].entry[n].accessBits);
 #if BX_SUPPORT_PKEYS
-    BXRS_HEX_PARAM_FIELD(tlb_entry, pkey, ITLB.entry[n].pkey);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, pkey, ITLB.context[0].entry[n].pkey);
 #endif
 #if BX_SUPPORT_MEMTYPE
-    BXRS_HEX_PARAM_FIELD(tlb_entry, memtype, ITLB.entry[n].memtype);
+    BXRS_HEX_PARAM_FIELD(tlb_entry, memtype, ITLB.context[0].entry[n].memtype);
 #endif
   }
 #endif
@@ -81,6 +81,8 @@ Bit32u BX_CPU_C::FastRepINSW(Bit32u dstOff, Bit16u port, Bit32u wordCount)
 
   // If after all the restrictions, there is anything left to do...
   if (wordCount) {
+    // the bulk transfer state is shared by all the processors
+    BX_SIM_LOCK();
     for (count=0; count<wordCount; ) {
       bx_devices.bulkIOQuantumsTransferred = 0;
       if (BX_CPU_THIS_PTR get_DF()==0) { // Only do accel for DF=0
@@ -105,6 +107,7 @@ Bit32u BX_CPU_C::FastRepINSW(Bit32u dstOff, Bit16u port, Bit32u wordCount)
 
     // Reset for next non-bulk IO
     bx_devices.bulkIOQuantumsRequested = 0;
+    BX_SIM_UNLOCK();
 
     return count;
   }
@@ -161,6 +164,8 @@ Bit32u BX_CPU_C::FastRepOUTSW(unsigned srcSeg, Bit32u srcOff, Bit16u port, Bit32
 
   // If after all the restrictions, there is anything left to do...
   if (wordCount) {
+    // the bulk transfer state is shared by all the processors
+    BX_SIM_LOCK();
     for (count=0; count<wordCount; ) {
       bx_devices.bulkIOQuantumsTransferred = 0;
       if (BX_CPU_THIS_PTR get_DF()==0) { // Only do accel for DF=0
@@ -185,6 +190,7 @@ Bit32u BX_CPU_C::FastRepOUTSW(unsigned srcSeg, Bit32u srcOff, Bit16u port, Bit32
 
     // Reset for next non-bulk IO
     bx_devices.bulkIOQuantumsRequested = 0;
+    BX_SIM_UNLOCK();
 
     return count;
   }
@@ -229,6 +235,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB16_YbDX(bxInstruction_c *i)
   Bit8u value8 = read_RMW_virtual_byte_32(BX_SEG_REG_ES, DI);
 
   value8 = BX_INP(DX, 1);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_byte(value8);
 
@@ -245,6 +254,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB32_YbDX(bxInstruction_c *i)
   Bit8u value8 = read_RMW_virtual_byte(BX_SEG_REG_ES, EDI);
 
   value8 = BX_INP(DX, 1);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   /* no seg override possible */
   write_RMW_linear_byte(value8);
@@ -266,6 +278,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSB64_YbDX(bxInstruction_c *i)
   Bit8u value8 = read_RMW_linear_byte(BX_SEG_REG_ES, RDI);
 
   value8 = BX_INP(DX, 1);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_byte(value8);
 
@@ -308,6 +323,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW16_YwDX(bxInstruction_c *i)
   Bit16u value16 = read_RMW_virtual_word_32(BX_SEG_REG_ES, DI);
 
   value16 = BX_INP(DX, 2);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_word(value16);
 
@@ -347,6 +365,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW32_YwDX(bxInstruction_c *i)
       value16 = read_RMW_virtual_word(BX_SEG_REG_ES, edi);
 
       value16 = BX_INP(DX, 2);
+#if BX_SMP_HOST_THREADS
+      BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
       write_RMW_linear_word(value16);
     }
@@ -358,6 +379,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW32_YwDX(bxInstruction_c *i)
     value16 = read_RMW_virtual_word_32(BX_SEG_REG_ES, edi);
 
     value16 = BX_INP(DX, 2);
+#if BX_SMP_HOST_THREADS
+    BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
     write_RMW_linear_word(value16);
   }
@@ -377,6 +401,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSW64_YwDX(bxInstruction_c *i)
   Bit16u value16 = read_RMW_linear_word(BX_SEG_REG_ES, RDI);
 
   value16 = BX_INP(DX, 2);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_word(value16);
 
@@ -419,6 +446,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD16_YdDX(bxInstruction_c *i)
   Bit32u value32 = read_RMW_virtual_dword_32(BX_SEG_REG_ES, DI);
 
   value32 = BX_INP(DX, 4);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_dword(value32);
 
@@ -435,6 +465,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD32_YdDX(bxInstruction_c *i)
   Bit32u value32 = read_RMW_virtual_dword(BX_SEG_REG_ES, EDI);
 
   value32 = BX_INP(DX, 4);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_dword(value32);
 
@@ -453,6 +486,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INSD64_YdDX(bxInstruction_c *i)
   Bit32u value32 = read_RMW_linear_dword(BX_SEG_REG_ES, RDI);
 
   value32 = BX_INP(DX, 4);
+#if BX_SMP_HOST_THREADS
+  BX_CPU_THIS_PTR address_xlation.rmw_atomic = false; // the port cannot be read again
+#endif
 
   write_RMW_linear_dword(value32);
 
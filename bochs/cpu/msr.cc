@@ -27,6 +27,8 @@
 #include "msr.h"
 #define LOG_THIS BX_CPU_THIS_PTR
 
+#include "pc_system.h"
+
 #if BX_SUPPORT_CET
 extern bool is_invalid_cet_control(bx_address val);
 #endif
@@ -39,8 +41,10 @@ bool BX_CPP_AttrRegparmN(2) BX_CPU_C::rdmsr(Bit32u index, Bit64u *msr)
 #if BX_CPU_LEVEL >= 6
   if (is_cpu_extension_supported(BX_ISA_X2APIC)) {
     if (is_x2apic_msr_range(index)) {
-      if (BX_CPU_THIS_PTR msr.apicbase & 0x400)  // X2APIC mode
+      if (BX_CPU_THIS_PTR msr.apicbase & 0x400) { // X2APIC mode
+        BX_SIM_LOCK_SCOPE();
         return BX_CPU_THIS_PTR lapic.read_x2apic(index, msr);
+      }
       else
         return 0;
     }
@@ -228,7 +232,9 @@ bool BX_CPP_AttrRegparmN(2) BX_CPU_C::rdmsr(Bit32u index, Bit64u *msr)
         BX_ERROR(("RDMSR BX_MSR_TSC_DEADLINE: TSC-Deadline not enabled in the cpu model"));
         return handle_unknown_rdmsr(index, msr);
       }
+      BX_SIM_LOCK();
       val64 = BX_CPU_THIS_PTR lapic.get_tsc_deadline();
+      BX_SIM_UNLOCK();
       break;
 #endif
 
@@ -579,8 +585,10 @@ bool BX_CPP_AttrRegparmN(2) BX_CPU_C::wrmsr(Bit32u index, Bit64u val_64)
 #if BX_CPU_LEVEL >= 6
   if (is_cpu_extension_supported(BX_ISA_X2APIC)) {
     if (is_x2apic_msr_range(index)) {
-      if (BX_CPU_THIS_PTR msr.apicbase & 0x400)  // X2APIC mode
+      if (BX_CPU_THIS_PTR msr.apicbase & 0x400) { // X2APIC mode
+        BX_SIM_LOCK_SCOPE();
         return BX_CPU_THIS_PTR lapic.write_x2apic(index, val32_hi, val32_lo);
+      }
       else
         return 0;
     }
@@ -869,7 +877,9 @@ bool BX_CPP_AttrRegparmN(2) BX_CPU_C::wrmsr(Bit32u index, Bit64u val_64)
         BX_ERROR(("WRMSR BX_MSR_TSC_DEADLINE: TSC-Deadline not enabled in the cpu model"));
         return handle_unknown_wrmsr(index, val_64);
       }
+      BX_SIM_LOCK();
       BX_CPU_THIS_PTR lapic.set_tsc_deadline(val_64);
+      BX_SIM_UNLOCK();
       break;
 #endif
 
@@ -1149,7 +1159,9 @@ bool BX_CPU_C::relocate_apic(Bit64u val_64)
 #endif
 
     BX_CPU_THIS_PTR msr.apicbase = (bx_phy_address) val_64;
+    BX_SIM_LOCK();
     BX_CPU_THIS_PTR lapic.set_base(BX_CPU_THIS_PTR msr.apicbase);
+    BX_SIM_UNLOCK();
     // TLB flush is required for emulation correctness
     TLB_flush();  // don't care about performance of apic relocation
   }
@@ -108,7 +108,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MONITOR(bxInstruction_c *i)
 
   bx_pc_system.invlpg(paddr);
 
+  BX_SIM_LOCK();
   BX_CPU_THIS_PTR monitor.arm(paddr);
+  BX_SIM_UNLOCK();
 
   BX_DEBUG(("MONITOR for phys_addr=0x" FMT_PHY_ADDRX, BX_CPU_THIS_PTR monitor.monitor_addr));
 #endif
@@ -197,6 +199,16 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MWAIT(bxInstruction_c *i)
 
   BX_INSTR_MWAIT(BX_CPU_ID, BX_CPU_THIS_PTR monitor.monitor_addr, CACHE_LINE_SIZE, ECX);
 
+  BX_SIM_LOCK();
+
+#if BX_SMP_HOST_THREADS
+  // another processor thread might have triggered the monitor meanwhile
+  if (! BX_CPU_THIS_PTR monitor.armed) {
+    BX_SIM_UNLOCK();
+    BX_NEXT_TRACE(i);
+  }
+#endif
+
   if (ECX & 2) {
     if (i->getIaOpcode() == BX_IA_MWAITX) {
       BX_CPU_THIS_PTR lapic.set_mwaitx_timer(EBX);
@@ -204,6 +216,8 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MWAIT(bxInstruction_c *i)
   }
 
   enter_sleep_state(new_state);
+
+  BX_SIM_UNLOCK();
 #endif
 
   BX_NEXT_TRACE(i);
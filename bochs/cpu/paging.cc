@@ -429,8 +429,9 @@ void BX_CPU_C::TLB_invlpg(bx_address laddr)
   invalidate_stack_cache();
 
   BX_DEBUG(("TLB_invlpg(0x" FMT_ADDRX "): invalidate TLB entry", laddr));
-  BX_CPU_THIS_PTR DTLB.invlpg(laddr);
-  BX_CPU_THIS_PTR ITLB.invlpg(laddr);
+  // INVLPG invalidates the page in all PCIDs (global mappings) of current VPID
+  BX_CPU_THIS_PTR DTLB.invlpg(laddr, BX_CPU_THIS_PTR DTLB.get_tag(), BX_TLB_TAG_VPID_MASK);
+  BX_CPU_THIS_PTR ITLB.invlpg(laddr, BX_CPU_THIS_PTR ITLB.get_tag(), BX_TLB_TAG_VPID_MASK);
 
 #if BX_SUPPORT_MONITOR_MWAIT
   // invalidating of the TLB entry might change translation for monitored
@@ -442,6 +443,115 @@ void BX_CPU_C::TLB_invlpg(bx_address laddr)
   BX_CPU_THIS_PTR iCache.breakLinks();
 }
 
+#if BX_TLB_CONTEXTS > 1
+
+// Invalidate all address space contexts matching (tag & mask)
+void BX_CPU_C::TLB_flush(Bit32u tag, Bit32u mask)
+{
+  INC_TLBFLUSH_STAT(tlbGlobalFlushes);
+
+  invalidate_prefetch_q();
+  invalidate_stack_cache();
+
+  BX_CPU_THIS_PTR DTLB.flush(tag, mask);
+  BX_CPU_THIS_PTR ITLB.flush(tag, mask);
+
+#if BX_SUPPORT_MONITOR_MWAIT
+  // invalidating of the TLB might change translation for monitored page
+  // and cause subsequent MWAIT instruction to wait forever
+  BX_CPU_THIS_PTR wakeup_monitor();
+#endif
+
+  // break all links bewteen traces
+  BX_CPU_THIS_PTR iCache.breakLinks();
+}
+
+// Invalidate non-global mappings of all address space contexts matching (tag & mask)
+void BX_CPU_C::TLB_flushNonGlobal(Bit32u tag, Bit32u mask)
+{
+  INC_TLBFLUSH_STAT(tlbNonGlobalFlushes);
+
+  invalidate_prefetch_q();
+  invalidate_stack_cache();
+
+  BX_CPU_THIS_PTR DTLB.flushNonGlobal(tag, mask);
+  BX_CPU_THIS_PTR ITLB.flushNonGlobal(tag, mask);
+
+#if BX_SUPPORT_MONITOR_MWAIT
+  // invalidating of the TLB might change translation for monitored page
+  // and cause subsequent MWAIT instruction to wait forever
+  BX_CPU_THIS_PTR wakeup_monitor();
+#endif
+
+  // break all links bewteen traces
+  BX_CPU_THIS_PTR iCache.breakLinks();
+}
+
+// Invalidate mappings of the page in all address space contexts matching (tag & mask)
+void BX_CPU_C::TLB_invlpg(bx_address laddr, Bit32u tag, Bit32u mask)
+{
+  invalidate_prefetch_q();
+  invalidate_stack_cache();
+
+  BX_DEBUG(("TLB_invlpg(0x" FMT_ADDRX ", tag=0x%07x): invalidate TLB entry", laddr, tag));
+  BX_CPU_THIS_PTR DTLB.invlpg(laddr, tag, mask);
+  BX_CPU_THIS_PTR ITLB.invlpg(laddr, tag, mask);
+
+#if BX_SUPPORT_MONITOR_MWAIT
+  // invalidating of the TLB entry might change translation for monitored
+  // page and cause subsequent MWAIT instruction to wait forever
+  BX_CPU_THIS_PTR wakeup_monitor();
+#endif
+
+  // break all links bewteen traces
+  BX_CPU_THIS_PTR iCache.breakLinks();
+}
+
+// TLB address space tag of the current CPU state
+Bit32u BX_CPU_C::get_TLB_tag(void)
+{
+  Bit32u vpid = 0, pcid = 0;
+
+#if BX_SUPPORT_VMX >= 2
+  if (BX_CPU_THIS_PTR in_vmx_guest && SECONDARY_VMEXEC_CONTROL(VMX_VM_EXEC_CTRL3_VPID_ENABLE))
+    vpid = BX_CPU_THIS_PTR vmcs.vpid;
+#endif
+
+  if (BX_CPU_THIS_PTR cr4.get_PCIDE())
+    pcid = (Bit32u) BX_CPU_THIS_PTR cr3 & BX_TLB_TAG_PCID_MASK;
+
+  return BX_TLB_TAG(vpid, pcid);
+}
+
+// Make TLB address space context of the current CPU state active, the
+// mappings cached for the other contexts are preserved
+void BX_CPU_C::TLB_switchContext(void)
+{
+  Bit32u tag = get_TLB_tag();
+  if (BX_CPU_THIS_PTR DTLB.get_tag() == tag) return;
+
+  INC_TLBFLUSH_STAT(tlbContextSwitches);
+
+  invalidate_prefetch_q();
+  invalidate_stack_cache();
+
+  BX_DEBUG(("TLB_switchContext: switch to VPID=%d PCID=0x%03x", tag >> 12, tag & BX_TLB_TAG_PCID_MASK));
+  if (BX_CPU_THIS_PTR DTLB.switch_context(tag))
+    INC_TLBFLUSH_STAT(tlbContextHits);
+  BX_CPU_THIS_PTR ITLB.switch_context(tag);
+
+#if BX_SUPPORT_MONITOR_MWAIT
+  // switching of the address space might change translation for monitored
+  // page and cause subsequent MWAIT instruction to wait forever
+  BX_CPU_THIS_PTR wakeup_monitor();
+#endif
+
+  // break all links bewteen traces
+  BX_CPU_THIS_PTR iCache.breakLinks();
+}
+
+#endif
+
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVLPG(bxInstruction_c* i)
 {
   // CPL is always 0 in real mode
@@ -858,13 +968,33 @@ bx_phy_address BX_CPU_C::translate_linear_long_mode(bx_address laddr, Bit32u &lp
 
 #endif
 
+// Write back the paging structure entry with the accessed and dirty bits
+// set. The processors running in the host threads set the bits atomically,
+// another processor might update the same entry meanwhile.
+void BX_CPU_C::write_paging_entry_bits(bx_phy_address entry_addr, unsigned len, void *entry, Bit32u bits)
+{
+#if BX_SMP_HOST_THREADS
+  bx_hostpageaddr_t hostAddr = getHostMemAddr(entry_addr, BX_WRITE);
+  if (hostAddr) {
+    pageWriteStampTable.decWriteStamp(A20ADDR(entry_addr), len);
+    if (len == 8)
+      __atomic_or_fetch((Bit64u *) hostAddr, (Bit64u) bits, __ATOMIC_SEQ_CST);
+    else
+      __atomic_or_fetch((Bit32u *) hostAddr, bits, __ATOMIC_SEQ_CST);
+    return;
+  }
+#endif
+
+  access_write_physical(entry_addr, len, entry);
+}
+
 void BX_CPU_C::update_access_dirty_PAE(bx_phy_address *entry_addr, Bit64u *entry, BxMemtype *entry_memtype, unsigned max_level, unsigned leaf, unsigned write)
 {
   // Update A bit if needed
   for (unsigned level=max_level; level > leaf; level--) {
     if (!(entry[level] & 0x20)) {
       entry[level] |= 0x20;
-      access_write_physical(entry_addr[level], 8, &entry[level]);
+      write_paging_entry_bits(entry_addr[level], 8, &entry[level], 0x20);
       BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[level], 8, entry_memtype[level], BX_WRITE,
             (BX_PTE_ACCESS + level), (Bit8u*)(&entry[level]));
     }
@@ -873,7 +1003,7 @@ void BX_CPU_C::update_access_dirty_PAE(bx_phy_address *entry_addr, Bit64u *entry
   // Update A/D bits if needed
   if (!(entry[leaf] & 0x20) || (write && !(entry[leaf] & 0x40))) {
     entry[leaf] |= (0x20 | (write<<6)); // Update A and possibly D bits
-    access_write_physical(entry_addr[leaf], 8, &entry[leaf]);
+    write_paging_entry_bits(entry_addr[leaf], 8, &entry[leaf], 0x20 | (write<<6));
     BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[leaf], 8, entry_memtype[leaf], BX_WRITE,
             (BX_PTE_ACCESS + leaf), (Bit8u*)(&entry[leaf]));
   }
@@ -1261,7 +1391,7 @@ void BX_CPU_C::update_access_dirty(bx_phy_address *entry_addr, Bit32u *entry, Bx
     // Update PDE A bit if needed
     if (!(entry[BX_LEVEL_PDE] & 0x20)) {
       entry[BX_LEVEL_PDE] |= 0x20;
-      access_write_physical(entry_addr[BX_LEVEL_PDE], 4, &entry[BX_LEVEL_PDE]);
+      write_paging_entry_bits(entry_addr[BX_LEVEL_PDE], 4, &entry[BX_LEVEL_PDE], 0x20);
       BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[BX_LEVEL_PDE], 4, entry_memtype[BX_LEVEL_PDE], BX_WRITE, BX_PDE_ACCESS, (Bit8u*)(&entry[BX_LEVEL_PDE]));
     }
   }
@@ -1269,7 +1399,7 @@ void BX_CPU_C::update_access_dirty(bx_phy_address *entry_addr, Bit32u *entry, Bx
   // Update A/D bits if needed
   if (!(entry[leaf] & 0x20) || (write && !(entry[leaf] & 0x40))) {
     entry[leaf] |= (0x20 | (write<<6)); // Update A and possibly D bits
-    access_write_physical(entry_addr[leaf], 4, &entry[leaf]);
+    write_paging_entry_bits(entry_addr[leaf], 4, &entry[leaf], 0x20 | (write<<6));
     BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[leaf], 4, entry_memtype[leaf], BX_WRITE, (BX_PTE_ACCESS + leaf), (Bit8u*)(&entry[leaf]));
   }
 }
@@ -1333,39 +1463,77 @@ bx_phy_address BX_CPU_C::translate_linear(bx_TLB_entry *tlbEntry, bx_address lad
 #if BX_SUPPORT_X86_64
   Bit32u pkey = 0;
 #endif
+#if BX_CPU_LEVEL >= 5
+  bx_TLB_large_entry *largeEntry = NULL; // large page entry to be updated by the page walk
+  bx_TLB_large_entry *largeAlias = NULL; // large page the TLB entry becomes alias of
+#endif
 
   if(BX_CPU_THIS_PTR cr0.get_PG())
   {
-    BX_DEBUG(("page walk for%s address 0x" FMT_LIN_ADDRX, isShadowStack ? " shadow stack" : "", laddr));
+#if BX_CPU_LEVEL >= 5
+    // large page translation cached by previous page walk
+    bx_TLB_large_entry *large = isExecute ? BX_CPU_THIS_PTR ITLB.get_large_entry_of(laddr) :
+                                            BX_CPU_THIS_PTR DTLB.get_large_entry_of(laddr);
+    if (large) {
+      Bit32u accessMask = 1 << (isShadowStack | (isWrite<<1) | user);
+#if BX_SUPPORT_PKEYS
+      if (! isExecute)
+        accessMask &= isWrite ? BX_CPU_THIS_PTR wr_pkey[large->pkey] : BX_CPU_THIS_PTR rd_pkey[large->pkey];
+#endif
+      if (! (large->accessBits & accessMask)) large = NULL;
+    }
 
-#if BX_CPU_LEVEL >= 6
-#if BX_SUPPORT_X86_64
-    if (long_mode())
-      paddress = translate_linear_long_mode(laddr, lpf_mask, pkey, user, rw);
+    if (large) {
+      INC_TLB_STAT(tlbLargeHits);
+      lpf_mask = large->lpf_mask;
+      combined_access = large->combined_access;
+#if BX_SUPPORT_PKEYS
+      pkey = large->pkey;
+#endif
+      paddress = large->ppf | (laddr & lpf_mask);
+      largeAlias = large;
+    }
     else
 #endif
-      if (BX_CPU_THIS_PTR cr4.get_PAE())
-        paddress = translate_linear_PAE(laddr, lpf_mask, user, rw);
+    {
+      BX_DEBUG(("page walk for%s address 0x" FMT_LIN_ADDRX, isShadowStack ? " shadow stack" : "", laddr));
+
+#if BX_CPU_LEVEL >= 6
+#if BX_SUPPORT_X86_64
+      if (long_mode())
+        paddress = translate_linear_long_mode(laddr, lpf_mask, pkey, user, rw);
       else
+#endif
+        if (BX_CPU_THIS_PTR cr4.get_PAE())
+          paddress = translate_linear_PAE(laddr, lpf_mask, user, rw);
+        else
 #endif 
-        paddress = translate_linear_legacy(laddr, lpf_mask, user, rw);
+          paddress = translate_linear_legacy(laddr, lpf_mask, user, rw);
 
-    // translate_linear functions return combined U/S, R/W bits, Global Page bit
-    // and also effective page tables memory type in lower 12 bits of the physical address.
-    // Bit 1 - R/W bit
-    // Bit 2 - U/S bit
-    // Bit 9,10,11 - Effective Memory Table from page tables
-    combined_access = paddress & lpf_mask;
-    paddress = (paddress & ~((Bit64u) lpf_mask)) | (laddr & lpf_mask);
+      // translate_linear functions return combined U/S, R/W bits, Global Page bit
+      // and also effective page tables memory type in lower 12 bits of the physical address.
+      // Bit 1 - R/W bit
+      // Bit 2 - U/S bit
+      // Bit 9,10,11 - Effective Memory Table from page tables
+      combined_access = paddress & lpf_mask;
+      paddress = (paddress & ~((Bit64u) lpf_mask)) | (laddr & lpf_mask);
 
 #if BX_CPU_LEVEL >= 5
-    if (lpf_mask > 0xfff) {
-      if (isExecute)
-        BX_CPU_THIS_PTR ITLB.split_large = true;
-      else
-        BX_CPU_THIS_PTR DTLB.split_large = true;
-    }
+      if (lpf_mask > 0xfff) {
+        if (isExecute)
+          largeEntry = BX_CPU_THIS_PTR ITLB.alloc_large_entry(laddr, lpf_mask);
+        else
+          largeEntry = BX_CPU_THIS_PTR DTLB.alloc_large_entry(laddr, lpf_mask);
+
+        largeEntry->ppf = paddress & ~((bx_phy_address) lpf_mask);
+        largeEntry->combined_access = combined_access;
+#if BX_SUPPORT_PKEYS
+        largeEntry->pkey = pkey;
 #endif
+        largeAlias = largeEntry;
+      }
+#endif
+    }
   }
   else {
     // no paging
@@ -1392,6 +1560,12 @@ bx_phy_address BX_CPU_C::translate_linear(bx_TLB_entry *tlbEntry, bx_address lad
   paddress = A20ADDR(paddress);
   ppf = PPFOf(paddress);
 
+#if InstrumentTLB
+  // valid translation of another page replaced by this one
+  if (tlbEntry->valid() && LPFOf(tlbEntry->lpf) != lpf)
+    INC_TLB_STAT(tlbEvictions);
+#endif
+
   // direct memory access is NOT allowed by default
   tlbEntry->lpf = lpf | TLB_NoHostPtr;
   tlbEntry->lpf_mask = lpf_mask;
@@ -1430,8 +1604,12 @@ bx_phy_address BX_CPU_C::translate_linear(bx_TLB_entry *tlbEntry, bx_address lad
     ) {
     if (isExecute)
       tlbEntry->accessBits |= TLB_UserExecuteOK;
-    else
-      tlbEntry->accessBits |= TLB_UserReadOK | TLB_UserWriteOK;
+    else {
+      // host pointer obtained for read access can't be used for writing
+      tlbEntry->accessBits |= TLB_UserReadOK;
+      if (isWrite)
+        tlbEntry->accessBits |= TLB_UserWriteOK;
+    }
   }
   else {
     if ((combined_access & BX_COMBINED_ACCESS_USER) != 0) {
@@ -1480,6 +1658,21 @@ bx_phy_address BX_CPU_C::translate_linear(bx_TLB_entry *tlbEntry, bx_address lad
     tlbEntry->accessBits |= TLB_GlobalPage;
 #endif
 
+#if BX_CPU_LEVEL >= 5
+  // access rights granted by the page walk apply to every 4K page of the
+  // large page, global bit is sticky so no global 4K alias outlives its
+  // large page entry
+  if (largeEntry)
+    largeEntry->accessBits = tlbEntry->accessBits | (largeEntry->accessBits & TLB_GlobalPage);
+
+  if (largeAlias) {
+    if (isExecute)
+      BX_CPU_THIS_PTR ITLB.add_large_alias(largeAlias, tlbEntry);
+    else
+      BX_CPU_THIS_PTR DTLB.add_large_alias(largeAlias, tlbEntry);
+  }
+#endif
+
   // Attempt to get a host pointer to this physical page. Put that
   // pointer in the TLB cache. Note if the request is vetoed, NULL
   // will be returned, and it's OK to OR zero in anyways.
@@ -2106,7 +2299,7 @@ void BX_CPU_C::update_ept_access_dirty(bx_phy_address *entry_addr, Bit64u *entry
   for (unsigned level=BX_LEVEL_PML4; level > leaf; level--) {
     if (!(entry[level] & 0x100)) {
       entry[level] |= 0x100;
-      access_write_physical(entry_addr[level], 8, &entry[level]);
+      write_paging_entry_bits(entry_addr[level], 8, &entry[level], 0x100);
       BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[level], 8, MEMTYPE(eptptr_memtype), BX_WRITE, (BX_EPT_PTE_ACCESS + level), (Bit8u*)(&entry[level]));
     }
   }
@@ -2114,7 +2307,7 @@ void BX_CPU_C::update_ept_access_dirty(bx_phy_address *entry_addr, Bit64u *entry
   // Update A/D bits if needed
   if (!(entry[leaf] & 0x100) || (write && !(entry[leaf] & 0x200))) {
     entry[leaf] |= (0x100 | (write<<9)); // Update A and possibly D bits
-    access_write_physical(entry_addr[leaf], 8, &entry[leaf]);
+    write_paging_entry_bits(entry_addr[leaf], 8, &entry[leaf], 0x100 | (write<<9));
     BX_NOTIFY_PHY_MEMORY_ACCESS(entry_addr[leaf], 8, MEMTYPE(eptptr_memtype), BX_WRITE, (BX_EPT_PTE_ACCESS + leaf), (Bit8u*)(&entry[leaf]));
   }
 }
@@ -2647,7 +2840,9 @@ void BX_CPU_C::access_write_physical(bx_phy_address paddr, unsigned len, void *d
 
 #if BX_SUPPORT_APIC
   if (BX_CPU_THIS_PTR lapic.is_selected(paddr)) {
+    BX_SIM_LOCK();
     BX_CPU_THIS_PTR lapic.write(paddr, data, len);
+    BX_SIM_UNLOCK();
     return;
   }
 #endif
@@ -2665,7 +2860,9 @@ void BX_CPU_C::access_read_physical(bx_phy_address paddr, unsigned len, void *da
 
 #if BX_SUPPORT_APIC
   if (BX_CPU_THIS_PTR lapic.is_selected(paddr)) {
+    BX_SIM_LOCK();
     BX_CPU_THIS_PTR lapic.read(paddr, data, len);
+    BX_SIM_UNLOCK();
     return;
   }
 #endif
@@ -2705,21 +2902,24 @@ bool BX_CPU_C::check_addr_in_tlb_buffers(const Bit8u *addr, const Bit8u *end)
   }
 #endif
 
-  for (unsigned tlb_entry_num=0; tlb_entry_num < BX_DTLB_SIZE; tlb_entry_num++) {
-    bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR DTLB.entry[tlb_entry_num];
-    if (tlbEntry->valid()) {
-      if ((tlbEntry->hostPageAddr >= (const bx_hostpageaddr_t)addr) &&
-          (tlbEntry->hostPageAddr  < (const bx_hostpageaddr_t)end))
-        return true;
+  // check all cached address space contexts, not only the active one
+  for (unsigned ctx=0; ctx < BX_TLB_CONTEXTS; ctx++) {
+    for (unsigned tlb_entry_num=0; tlb_entry_num < BX_DTLB_SIZE; tlb_entry_num++) {
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR DTLB.context[ctx].entry[tlb_entry_num];
+      if (tlbEntry->valid()) {
+        if ((tlbEntry->hostPageAddr >= (const bx_hostpageaddr_t)addr) &&
+            (tlbEntry->hostPageAddr  < (const bx_hostpageaddr_t)end))
+          return true;
+      }
     }
-  }
 
-  for (unsigned tlb_entry_num=0; tlb_entry_num < BX_ITLB_SIZE; tlb_entry_num++) {
-    bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR ITLB.entry[tlb_entry_num];
-    if (tlbEntry->valid()) {
-      if ((tlbEntry->hostPageAddr >= (const bx_hostpageaddr_t)addr) &&
-          (tlbEntry->hostPageAddr  < (const bx_hostpageaddr_t)end))
-        return true;
+    for (unsigned tlb_entry_num=0; tlb_entry_num < BX_ITLB_SIZE; tlb_entry_num++) {
+      bx_TLB_entry *tlbEntry = &BX_CPU_THIS_PTR ITLB.context[ctx].entry[tlb_entry_num];
+      if (tlbEntry->valid()) {
+        if ((tlbEntry->hostPageAddr >= (const bx_hostpageaddr_t)addr) &&
+            (tlbEntry->hostPageAddr  < (const bx_hostpageaddr_t)end))
+          return true;
+      }
     }
   }
 
@@ -530,9 +530,14 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::BxNoEVEX(bxInstruction_c *i)
 
 #endif
 
-void BX_CPU_C::handleCpuContextChange(void)
+void BX_CPU_C::handleCpuContextChange(bool flushTLB)
 {
-  TLB_flush();
+  if (flushTLB) {
+    TLB_flush();
+#if BX_TLB_CONTEXTS > 1
+    TLB_switchContext();
+#endif
+  }
 
   invalidate_prefetch_q();
   invalidate_stack_cache();
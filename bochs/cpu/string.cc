@@ -231,47 +231,93 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSW16_YwXw(bxInstruction_c *i)
 /* 16 bit opsize mode, 32 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSW32_YwXw(bxInstruction_c *i)
 {
+  Bit32s increment = 0;
+
   Bit32u esi = ESI;
   Bit32u edi = EDI;
 
-  Bit16u temp16 = read_virtual_word(i->seg(), esi);
-  write_virtual_word(BX_SEG_REG_ES, edi, temp16);
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepMOVSB(i->seg(), esi, BX_SEG_REG_ES, edi, ECX*2, 2);
+    if (byteCount) {
+      Bit32u wordCount = byteCount >> 1;
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    esi -= 2;
-    edi -= 2;
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(wordCount-1);
+
+      // Decrement eCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX = ECX - (wordCount-1);
+
+      increment = byteCount;
+    }
   }
-  else {
-    esi += 2;
-    edi += 2;
+
+  if (increment == 0)
+#endif
+  {
+    Bit16u temp16 = read_virtual_word(i->seg(), esi);
+    write_virtual_word(BX_SEG_REG_ES, edi, temp16);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -2 : 2;
   }
 
   // zero extension of RSI/RDI
-  RSI = esi;
-  RDI = edi;
+  RSI = esi + increment;
+  RDI = edi + increment;
 }
 
 #if BX_SUPPORT_X86_64
 /* 16 bit opsize mode, 64 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::MOVSW64_YwXw(bxInstruction_c *i)
 {
+  Bit32s increment = 0;
+
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
-  Bit16u temp16 = read_linear_word(i->seg(), get_laddr64(i->seg(), rsi));
-  write_linear_word(BX_SEG_REG_ES, rdi, temp16);
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u byteCount = FastRepMOVSB(get_laddr64(i->seg(), rsi), rdi, ECX*2, 2);
+    if (byteCount) {
+      Bit32u wordCount = byteCount >> 1;
+
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(wordCount-1);
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    rsi -= 2;
-    rdi -= 2;
+      // Decrement RCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX -= (wordCount-1);
+
+      increment = byteCount;
+    }
   }
-  else {
-    rsi += 2;
-    rdi += 2;
+
+  if (increment == 0)
+#endif
+  {
+    Bit16u temp16 = read_linear_word(i->seg(), get_laddr64(i->seg(), rsi));
+    write_linear_word(BX_SEG_REG_ES, rdi, temp16);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -2 : 2;
   }
 
-  RSI = rsi;
-  RDI = rdi;
+  RSI = rsi + increment;
+  RDI = rdi + increment;
 }
 #endif
 
@@ -580,6 +626,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSB32_XbYb(bxInstruction_c *i)
   Bit32u esi = ESI;
   Bit32u edi = EDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u byteCount = FastRepCMPS(i->seg(), esi, BX_SEG_REG_ES, edi, 1, ECX-1, i->lockRepUsedValue() == 3);
+    if (byteCount) {
+      // The main cpu loop will decrement the ticks count and eCX
+      // for the element compared below.
+      BX_TICKN(byteCount);
+      RCX = ECX - byteCount;
+      esi += byteCount;
+      edi += byteCount;
+    }
+  }
+#endif
+
   op1_8 = read_virtual_byte(i->seg(), esi);
   op2_8 = read_virtual_byte(BX_SEG_REG_ES, edi);
 
@@ -610,6 +675,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSB64_XbYb(bxInstruction_c *i)
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u byteCount = FastRepCMPS(get_laddr64(i->seg(), rsi), rdi, 1, ECX-1, i->lockRepUsedValue() == 3);
+    if (byteCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(byteCount);
+      RCX -= byteCount;
+      rsi += byteCount;
+      rdi += byteCount;
+    }
+  }
+#endif
+
   op1_8 = read_linear_byte(i->seg(), get_laddr64(i->seg(), rsi));
   op2_8 = read_linear_byte(BX_SEG_REG_ES, rdi);
 
@@ -667,6 +751,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSW32_XwYw(bxInstruction_c *i)
   Bit32u esi = ESI;
   Bit32u edi = EDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u wordCount = FastRepCMPS(i->seg(), esi, BX_SEG_REG_ES, edi, 2, ECX-1, i->lockRepUsedValue() == 3);
+    if (wordCount) {
+      // The main cpu loop will decrement the ticks count and eCX
+      // for the element compared below.
+      BX_TICKN(wordCount);
+      RCX = ECX - wordCount;
+      esi += wordCount * 2;
+      edi += wordCount * 2;
+    }
+  }
+#endif
+
   op1_16 = read_virtual_word(i->seg(), esi);
   op2_16 = read_virtual_word(BX_SEG_REG_ES, edi);
 
@@ -697,6 +800,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSW64_XwYw(bxInstruction_c *i)
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u wordCount = FastRepCMPS(get_laddr64(i->seg(), rsi), rdi, 2, ECX-1, i->lockRepUsedValue() == 3);
+    if (wordCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(wordCount);
+      RCX -= wordCount;
+      rsi += wordCount * 2;
+      rdi += wordCount * 2;
+    }
+  }
+#endif
+
   op1_16 = read_linear_word(i->seg(), get_laddr64(i->seg(), rsi));
   op2_16 = read_linear_word(BX_SEG_REG_ES, rdi);
 
@@ -754,6 +876,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSD32_XdYd(bxInstruction_c *i)
   Bit32u esi = ESI;
   Bit32u edi = EDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u dwordCount = FastRepCMPS(i->seg(), esi, BX_SEG_REG_ES, edi, 4, ECX-1, i->lockRepUsedValue() == 3);
+    if (dwordCount) {
+      // The main cpu loop will decrement the ticks count and eCX
+      // for the element compared below.
+      BX_TICKN(dwordCount);
+      RCX = ECX - dwordCount;
+      esi += dwordCount * 4;
+      edi += dwordCount * 4;
+    }
+  }
+#endif
+
   op1_32 = read_virtual_dword(i->seg(), esi);
   op2_32 = read_virtual_dword(BX_SEG_REG_ES, edi);
 
@@ -785,6 +926,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSD64_XdYd(bxInstruction_c *i)
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u dwordCount = FastRepCMPS(get_laddr64(i->seg(), rsi), rdi, 4, ECX-1, i->lockRepUsedValue() == 3);
+    if (dwordCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(dwordCount);
+      RCX -= dwordCount;
+      rsi += dwordCount * 4;
+      rdi += dwordCount * 4;
+    }
+  }
+#endif
+
   op1_32 = read_linear_dword(i->seg(), get_laddr64(i->seg(), rsi));
   op2_32 = read_linear_dword(BX_SEG_REG_ES, rdi);
 
@@ -842,6 +1002,25 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::CMPSQ64_XqYq(bxInstruction_c *i)
   Bit64u rsi = RSI;
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u qwordCount = FastRepCMPS(get_laddr64(i->seg(), rsi), rdi, 8, ECX-1, i->lockRepUsedValue() == 3);
+    if (qwordCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(qwordCount);
+      RCX -= qwordCount;
+      rsi += qwordCount * 8;
+      rdi += qwordCount * 8;
+    }
+  }
+#endif
+
   op1_64 = read_linear_qword(i->seg(), get_laddr64(i->seg(), rsi));
   op2_64 = read_linear_qword(BX_SEG_REG_ES, rdi);
 
@@ -974,6 +1153,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASB32_ALYb(bxInstruction_c *i)
 
   Bit32u edi = EDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u byteCount = FastRepSCAS(BX_SEG_REG_ES, edi, AL, 1, ECX-1, i->lockRepUsedValue() == 3);
+    if (byteCount) {
+      // The main cpu loop will decrement the ticks count and eCX
+      // for the element compared below.
+      BX_TICKN(byteCount);
+      RCX = ECX - byteCount;
+      edi += byteCount;
+    }
+  }
+#endif
+
   op2_8 = read_virtual_byte(BX_SEG_REG_ES, edi);
   diff_8 = op1_8 - op2_8;
 
@@ -998,6 +1195,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASB64_ALYb(bxInstruction_c *i)
 
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u byteCount = FastRepSCAS(rdi, AL, 1, ECX-1, i->lockRepUsedValue() == 3);
+    if (byteCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(byteCount);
+      RCX -= byteCount;
+      rdi += byteCount;
+    }
+  }
+#endif
+
   op2_8 = read_virtual_byte(BX_SEG_REG_ES, rdi);
 
   diff_8 = op1_8 - op2_8;
@@ -1044,6 +1259,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASW32_AXYw(bxInstruction_c *i)
 
   Bit32u edi = EDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u wordCount = FastRepSCAS(BX_SEG_REG_ES, edi, AX, 2, ECX-1, i->lockRepUsedValue() == 3);
+    if (wordCount) {
+      // The main cpu loop will decrement the ticks count and eCX
+      // for the element compared below.
+      BX_TICKN(wordCount);
+      RCX = ECX - wordCount;
+      edi += wordCount * 2;
+    }
+  }
+#endif
+
   op2_16 = read_virtual_word(BX_SEG_REG_ES, edi);
   diff_16 = op1_16 - op2_16;
 
@@ -1068,6 +1301,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASW64_AXYw(bxInstruction_c *i)
 
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u wordCount = FastRepSCAS(rdi, AX, 2, ECX-1, i->lockRepUsedValue() == 3);
+    if (wordCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(wordCount);
+      RCX -= wordCount;
+      rdi += wordCount * 2;
+    }
+  }
+#endif
+
   op2_16 = read_virtual_word(BX_SEG_REG_ES, rdi);
 
   diff_16 = op1_16 - op2_16;
@@ -1114,6 +1365,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASD32_EAXYd(bxInstruction_c *i)
 
   Bit32u edi = EDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u dwordCount = FastRepSCAS(BX_SEG_REG_ES, edi, EAX, 4, ECX-1, i->lockRepUsedValue() == 3);
+    if (dwordCount) {
+      // The main cpu loop will decrement the ticks count and eCX
+      // for the element compared below.
+      BX_TICKN(dwordCount);
+      RCX = ECX - dwordCount;
+      edi += dwordCount * 4;
+    }
+  }
+#endif
+
   op2_32 = read_virtual_dword(BX_SEG_REG_ES, edi);
   diff_32 = op1_32 - op2_32;
 
@@ -1139,6 +1408,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASD64_EAXYd(bxInstruction_c *i)
 
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u dwordCount = FastRepSCAS(rdi, EAX, 4, ECX-1, i->lockRepUsedValue() == 3);
+    if (dwordCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(dwordCount);
+      RCX -= dwordCount;
+      rdi += dwordCount * 4;
+    }
+  }
+#endif
+
   op2_32 = read_virtual_dword(BX_SEG_REG_ES, rdi);
 
   diff_32 = op1_32 - op2_32;
@@ -1186,6 +1473,24 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::SCASQ64_RAXYq(bxInstruction_c *i)
 
   Bit64u rdi = RDI;
 
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can skip over the elements which don't
+   * terminate the repeat loop in a batch, only the last compare is done
+   * below to update the flags.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event && ECX > 1)
+  {
+    Bit32u qwordCount = FastRepSCAS(rdi, RAX, 8, ECX-1, i->lockRepUsedValue() == 3);
+    if (qwordCount) {
+      // The main cpu loop will decrement the ticks count and RCX
+      // for the element compared below.
+      BX_TICKN(qwordCount);
+      RCX -= qwordCount;
+      rdi += qwordCount * 8;
+    }
+  }
+#endif
+
   op2_64 = read_virtual_qword(BX_SEG_REG_ES, rdi);
 
   diff_64 = op1_64 - op2_64;
@@ -1310,7 +1615,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSB32_YbAL(bxInstruction_c *i)
    */
   if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
   {
-    Bit32u byteCount = FastRepSTOSB(BX_SEG_REG_ES, edi, AL, ECX);
+    Bit32u byteCount = FastRepSTOS(BX_SEG_REG_ES, edi, AL, 1, ECX);
     if (byteCount) {
       // Decrement the ticks count by the number of iterations, minus
       // one, since the main cpu loop will decrement one.  Also,
@@ -1351,7 +1656,7 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSB64_YbAL(bxInstruction_c *i)
    */
   if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
   {
-    Bit32u byteCount = FastRepSTOSB(rdi, AL, ECX);
+    Bit32u byteCount = FastRepSTOS(rdi, AL, 1, ECX);
     if (byteCount) {
       // Decrement the ticks count by the number of iterations, minus
       // one, since the main cpu loop will decrement one.  Also,
@@ -1399,19 +1704,41 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSW16_YwAX(bxInstruction_c *i)
 /* 16 bit opsize mode, 32 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSW32_YwAX(bxInstruction_c *i)
 {
+  Bit32s increment = 0;
   Bit32u edi = EDI;
 
-  write_virtual_word(BX_SEG_REG_ES, edi, AX);
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u wordCount = FastRepSTOS(BX_SEG_REG_ES, edi, AX, 2, ECX);
+    if (wordCount) {
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(wordCount-1);
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    edi -= 2;
+      // Decrement eCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX = ECX - (wordCount-1);
+
+      increment = wordCount << 1;
+    }
   }
-  else {
-    edi += 2;
+
+  if (increment == 0)
+#endif
+  {
+    write_virtual_word(BX_SEG_REG_ES, edi, AX);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -2 : 2;
   }
 
   // zero extension of RDI
-  RDI = edi;
+  RDI = edi + increment;
 }
 
 #if BX_SUPPORT_X86_64
@@ -1419,17 +1746,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSW32_YwAX(bxInstruction_c *i)
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSW64_YwAX(bxInstruction_c *i)
 {
   Bit64u rdi = RDI;
+  Bit32s increment = 0;
 
-  write_linear_word(BX_SEG_REG_ES, rdi, AX);
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u wordCount = FastRepSTOS(rdi, AX, 2, ECX);
+    if (wordCount) {
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(wordCount-1);
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    rdi -= 2;
+      // Decrement RCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX -= (wordCount-1);
+
+      increment = wordCount << 1;
+    }
   }
-  else {
-    rdi += 2;
+
+  if (increment == 0)
+#endif
+  {
+    write_linear_word(BX_SEG_REG_ES, rdi, AX);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -2 : 2;
   }
 
-  RDI = rdi;
+  RDI = rdi + increment;
 }
 #endif
 
@@ -1453,19 +1802,41 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD16_YdEAX(bxInstruction_c *i)
 /* 32 bit opsize mode, 32 bit address size */
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD32_YdEAX(bxInstruction_c *i)
 {
+  Bit32s increment = 0;
   Bit32u edi = EDI;
 
-  write_virtual_dword(BX_SEG_REG_ES, edi, EAX);
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u dwordCount = FastRepSTOS(BX_SEG_REG_ES, edi, EAX, 4, ECX);
+    if (dwordCount) {
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(dwordCount-1);
+
+      // Decrement eCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX = ECX - (dwordCount-1);
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    edi -= 4;
+      increment = dwordCount << 2;
+    }
   }
-  else {
-    edi += 4;
+
+  if (increment == 0)
+#endif
+  {
+    write_virtual_dword(BX_SEG_REG_ES, edi, EAX);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -4 : 4;
   }
 
   // zero extension of RDI
-  RDI = edi;
+  RDI = edi + increment;
 }
 
 #if BX_SUPPORT_X86_64
@@ -1474,17 +1845,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD32_YdEAX(bxInstruction_c *i)
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSD64_YdEAX(bxInstruction_c *i)
 {
   Bit64u rdi = RDI;
+  Bit32s increment = 0;
 
-  write_linear_dword(BX_SEG_REG_ES, rdi, EAX);
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u dwordCount = FastRepSTOS(rdi, EAX, 4, ECX);
+    if (dwordCount) {
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(dwordCount-1);
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    rdi -= 4;
+      // Decrement RCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX -= (dwordCount-1);
+
+      increment = dwordCount << 2;
+    }
   }
-  else {
-    rdi += 4;
+
+  if (increment == 0)
+#endif
+  {
+    write_linear_dword(BX_SEG_REG_ES, rdi, EAX);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -4 : 4;
   }
 
-  RDI = rdi;
+  RDI = rdi + increment;
 }
 
 /* 64 bit opsize mode, 32 bit address size */
@@ -1509,17 +1902,39 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSQ32_YqRAX(bxInstruction_c *i)
 void BX_CPP_AttrRegparmN(1) BX_CPU_C::STOSQ64_YqRAX(bxInstruction_c *i)
 {
   Bit64u rdi = RDI;
+  Bit32s increment = 0;
+
+#if (BX_SUPPORT_REPEAT_SPEEDUPS) && (BX_DEBUGGER == 0)
+  /* If conditions are right, we can transfer IO to physical memory
+   * in a batch, rather than one instruction at a time.
+   */
+  if (i->repUsedL() && !BX_CPU_THIS_PTR get_DF() && !BX_CPU_THIS_PTR async_event)
+  {
+    Bit32u qwordCount = FastRepSTOS(rdi, RAX, 8, ECX);
+    if (qwordCount) {
+      // Decrement the ticks count by the number of iterations, minus
+      // one, since the main cpu loop will decrement one.  Also,
+      // the count is predecremented before examined, so definitely
+      // don't roll it under zero.
+      BX_TICKN(qwordCount-1);
 
-  write_linear_qword(BX_SEG_REG_ES, rdi, RAX);
+      // Decrement RCX.  Note, the main loop will decrement 1 also, so
+      // decrement by one less than expected, like the case above.
+      RCX -= (qwordCount-1);
 
-  if (BX_CPU_THIS_PTR get_DF()) {
-    rdi -= 8;
+      increment = qwordCount << 3;
+    }
   }
-  else {
-    rdi += 8;
+
+  if (increment == 0)
+#endif
+  {
+    write_linear_qword(BX_SEG_REG_ES, rdi, RAX);
+
+    increment = BX_CPU_THIS_PTR get_DF() ? -8 : 8;
   }
 
-  RDI = rdi;
+  RDI = rdi + increment;
 }
 
 #endif
@@ -588,7 +588,7 @@ bool BX_CPU_C::SvmEnterLoadCheckGuestState(void)
     inhibit_interrupts(BX_INHIBIT_INTERRUPTS);
   }
 
-  BX_CPU_THIS_PTR async_event = 0;
+  clear_async_event();
 
   setEFlags((Bit32u) guest.eflags);
 
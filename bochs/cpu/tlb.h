@@ -51,10 +51,13 @@ BX_CPP_INLINE bx_address AlignedAccessLPFOf(bx_address laddr, unsigned alignment
 
 // BX_TLB_INDEX_OF(lpf): This macro is passed the linear page frame
 //   (top bits of the linear address).  It must map these bits to
-//   one of the TLB cache slots, given the size of BX_TLB_SIZE.
-//   There will be a many-to-one mapping to each TLB cache slot.
-//   When there are collisions, the old entry is overwritten with
-//   one for the newest access.
+//   one of the TLB cache sets, given the size of BX_TLB_SIZE and
+//   number of ways BX_TLB_WAYS. There will be a many-to-one mapping
+//   to each TLB cache set.
+// BX_TLB_ENTRY_OF(lpf): Returns the TLB entry of the set which holds
+//   translation of the linear page frame. When no such entry exists,
+//   the least recently used entry of the set is returned and will be
+//   overwritten with one for the newest access.
 #define BX_DTLB_ENTRY_OF(lpf, len) (BX_CPU_THIS_PTR DTLB.get_entry_of((lpf), (len)))
 #define BX_DTLB_INDEX_OF(lpf, len) (BX_CPU_THIS_PTR DTLB.get_index_of((lpf), (len)))
 
@@ -175,85 +178,375 @@ struct bx_TLB_entry
   BX_CPP_INLINE Bit32u get_memtype() const { return MEMTYPE(memtype); }
 };
 
+#if BX_CPU_LEVEL >= 5
+
+// Translations of large (2M/4M/1G) pages are kept once per page in a small
+// fully associative array next to the TLB, a TLB miss inside a cached large
+// page is served from the array without a page walk. For the fast path the
+// TLB also caches up to BX_TLB_LARGE_ALIASES 4K aliases of every large page.
+// The large page entry records the TLB entries of its aliases, so INVLPG or
+// replacement of a large page purges them without probing the TLB sets.
+#define BX_TLB_LARGE_ENTRIES 16
+#define BX_TLB_LARGE_ALIASES 8
+
+struct bx_TLB_large_entry
+{
+  bx_address lpf;         // linear page frame of the large page
+  bx_phy_address ppf;     // physical page frame of the large page
+  Bit32u lpf_mask;        // linear address mask of the page size
+  Bit32u accessBits;      // TLB accessBits granted by the last page walk
+  Bit32u combined_access; // combined access bits returned by the page walk
+#if BX_SUPPORT_PKEYS
+  Bit32u pkey;
+#endif
+  Bit16u alias[BX_TLB_LARGE_ALIASES]; // TLB entries holding 4K aliases
+  unsigned aliases;       // number of recorded aliases
+  unsigned alias_next;    // oldest alias, replaced first
+
+  bx_TLB_large_entry() { invalidate(); }
+
+  BX_CPP_INLINE bool valid() const { return lpf != BX_INVALID_TLB_ENTRY; }
+
+  BX_CPP_INLINE void invalidate() {
+    lpf = BX_INVALID_TLB_ENTRY;
+    accessBits = 0;
+    aliases = 0;
+    alias_next = 0;
+  }
+
+  BX_CPP_INLINE bool contains(bx_address laddr) const {
+    return (laddr & ~((bx_address) lpf_mask)) == lpf;
+  }
+};
+
+#endif
+
+// The TLB keeps translations of several address space contexts at the same
+// time. Each context is tagged with VPID (bits 27:12) and PCID (bits 11:0),
+// switching between cached contexts (CR3 load with CR4.PCIDE=1, VM entry and
+// VM exit with VPID enabled) doesn't require flushing the TLB.
+#if BX_SUPPORT_X86_64 && BX_CPU_LEVEL >= 6
+  #define BX_TLB_CONTEXTS 4
+#else
+  #define BX_TLB_CONTEXTS 1
+#endif
+
+BX_CPP_INLINE Bit32u BX_TLB_TAG(Bit32u vpid, Bit32u pcid) { return (vpid << 12) | pcid; }
+
+const Bit32u BX_TLB_TAG_PCID_MASK = 0x00000fff;
+const Bit32u BX_TLB_TAG_VPID_MASK = 0x0ffff000;
+const Bit32u BX_TLB_TAG_ALL_MASK  = 0x0fffffff;
+
+const Bit32u BX_INVALID_TLB_TAG = 0xffffffff;
+
+// The TLB is BX_TLB_WAYS-way set associative, entries of a set are kept
+// next to each other. Replacement within a set is tree pseudo-LRU, one bit
+// per node of the binary tree over the ways of the set.
+#if (BX_TLB_WAYS & (BX_TLB_WAYS - 1)) != 0 || BX_TLB_WAYS > 8
+  #error "BX_TLB_WAYS must be 1, 2, 4 or 8"
+#endif
+
 template <unsigned size>
 struct TLB {
-  bx_TLB_entry entry[size];
+  bx_TLB_entry *entry;  // entries of the active address space context
+#if BX_TLB_WAYS > 1
+  Bit8u *plru;          // pseudo-LRU state of the active context sets
+#endif
+
+  struct bx_TLB_context {
+    bx_TLB_entry entry[size];
+#if BX_TLB_WAYS > 1
+    Bit8u plru[size / BX_TLB_WAYS];
+#endif
+    Bit32u tag;
+    Bit32u last_used;
 #if BX_CPU_LEVEL >= 5
-  bool split_large;
+    bx_TLB_large_entry large[BX_TLB_LARGE_ENTRIES];
+    unsigned large_next;
 #endif
+  } context[BX_TLB_CONTEXTS];
+
+  unsigned active;
+  Bit32u context_switches;
 
 public:
-  TLB() { flush(); }
+  TLB() {
+    for (unsigned ctx=0; ctx < BX_TLB_CONTEXTS; ctx++) {
+      context[ctx].tag = BX_INVALID_TLB_TAG;
+      context[ctx].last_used = 0;
+#if BX_TLB_WAYS > 1
+      memset(context[ctx].plru, 0, sizeof(context[ctx].plru));
+#endif
+    }
+    context_switches = 0;
+    active = 0;
+    context[0].tag = BX_TLB_TAG(0, 0);
+    entry = context[0].entry;
+#if BX_TLB_WAYS > 1
+    plru = context[0].plru;
+#endif
+    flush();
+  }
 
+  // index of the first entry of the set
   BX_CPP_INLINE unsigned get_index_of(bx_address lpf, unsigned len = 0)
   {
-    const Bit32u tlb_mask = ((size-1) << 12);
-    return (((unsigned(lpf) + len) & tlb_mask) >> 12);
+    const Bit32u tlb_mask = ((size/BX_TLB_WAYS-1) << 12);
+    return (((unsigned(lpf) + len) & tlb_mask) >> 12) * BX_TLB_WAYS;
   }
 
   BX_CPP_INLINE bx_TLB_entry *get_entry_of(bx_address lpf, unsigned len = 0)
   {
+#if BX_TLB_WAYS > 1
+    unsigned index = get_index_of(lpf, len);
+    bx_TLB_entry *set = &entry[index];
+    // bit [11] of the TLB lpf used for TLB_NoHostPtr valid indication
+    lpf = LPFOf(lpf);
+    unsigned way = 0;
+    while (AlignedAccessLPFOf(set[way].lpf, 0x7ff) != lpf) {
+      if (++way == BX_TLB_WAYS) {
+        way = plru_victim(index / BX_TLB_WAYS);
+        break;
+      }
+    }
+    plru_touch(index / BX_TLB_WAYS, way);
+    return &set[way];
+#else
     return &entry[get_index_of(lpf, len)];
+#endif
   }
 
-  BX_CPP_INLINE void flush(void)
-  {
-    for (unsigned n=0; n < size; n++)
-      entry[n].invalidate();
+  BX_CPP_INLINE Bit32u get_tag(void) const { return context[active].tag; }
 
 #if BX_CPU_LEVEL >= 5
-    split_large = false;  // flushing whole TLB
+  // find cached large page translation of laddr in the active context
+  BX_CPP_INLINE bx_TLB_large_entry *get_large_entry_of(bx_address laddr)
+  {
+    return find_large_entry(active, laddr);
+  }
+
+  // allocate large page entry for translation of laddr in the active context,
+  // replacing an entry of another large page purges all its 4K aliases
+  bx_TLB_large_entry *alloc_large_entry(bx_address laddr, Bit32u lpf_mask)
+  {
+    bx_TLB_large_entry *large = context[active].large;
+    bx_address lpf = laddr & ~((bx_address) lpf_mask);
+    unsigned n, victim = BX_TLB_LARGE_ENTRIES;
+
+    for (n=0; n < BX_TLB_LARGE_ENTRIES; n++) {
+      if (large[n].lpf == lpf && large[n].lpf_mask == lpf_mask) return &large[n];
+      if (! large[n].valid() && victim == BX_TLB_LARGE_ENTRIES) victim = n;
+    }
+
+    if (victim == BX_TLB_LARGE_ENTRIES) {
+      victim = context[active].large_next;
+      context[active].large_next = (victim + 1) % BX_TLB_LARGE_ENTRIES;
+      invalidate_large_entry(active, &large[victim]);
+    }
+
+    large[victim].lpf = lpf;
+    large[victim].lpf_mask = lpf_mask;
+    large[victim].accessBits = 0;
+    return &large[victim];
+  }
+
+  // record TLB entry of the active context which caches a 4K alias of the
+  // large page, the oldest alias is purged when too many are cached
+  void add_large_alias(bx_TLB_large_entry *large, bx_TLB_entry *tlbEntry)
+  {
+    Bit16u index = (Bit16u)(tlbEntry - entry);
+    unsigned n;
+
+    for (n=0; n < large->aliases; n++) {
+      if (large->alias[n] == index) return;
+    }
+
+    if (large->aliases < BX_TLB_LARGE_ALIASES) {
+      large->alias[large->aliases++] = index;
+    }
+    else {
+      n = large->alias_next;
+      large->alias_next = (n + 1) % BX_TLB_LARGE_ALIASES;
+      purge_large_alias(entry, large, large->alias[n]);
+      large->alias[n] = index;
+    }
+  }
 #endif
+
+  // make the context tagged with 'tag' active, returns false if the context
+  // was not cached and an empty context had to be allocated for it
+  bool switch_context(Bit32u tag)
+  {
+    if (context[active].tag == tag) return true;
+
+    unsigned ctx, victim = 0;
+    for (ctx=0; ctx < BX_TLB_CONTEXTS; ctx++) {
+      if (context[ctx].tag == tag) break;
+      if (context[ctx].last_used < context[victim].last_used) victim = ctx;
+    }
+
+    bool hit = (ctx < BX_TLB_CONTEXTS);
+    if (! hit) {
+      // replace least recently used context
+      ctx = victim;
+      flush_context(ctx);
+      context[ctx].tag = tag;
+    }
+
+    context[ctx].last_used = ++context_switches;
+    active = ctx;
+    entry = context[ctx].entry;
+#if BX_TLB_WAYS > 1
+    plru = context[ctx].plru;
+#endif
+    return hit;
+  }
+
+  // invalidate all cached contexts
+  BX_CPP_INLINE void flush(void)
+  {
+    for (unsigned ctx=0; ctx < BX_TLB_CONTEXTS; ctx++)
+      flush_context(ctx);
+  }
+
+  // invalidate all contexts matching (tag & mask)
+  BX_CPP_INLINE void flush(Bit32u tag, Bit32u mask)
+  {
+    for (unsigned ctx=0; ctx < BX_TLB_CONTEXTS; ctx++)
+      if ((context[ctx].tag & mask) == (tag & mask))
+        flush_context(ctx);
   }
 
 #if BX_CPU_LEVEL >= 6
-  BX_CPP_INLINE void flushNonGlobal(void)
+  // invalidate non-global entries of the active context
+  BX_CPP_INLINE void flushNonGlobal(void) { flushNonGlobal_context(active); }
+
+  // invalidate non-global entries of all contexts matching (tag & mask)
+  BX_CPP_INLINE void flushNonGlobal(Bit32u tag, Bit32u mask)
+  {
+    for (unsigned ctx=0; ctx < BX_TLB_CONTEXTS; ctx++)
+      if ((context[ctx].tag & mask) == (tag & mask))
+        flushNonGlobal_context(ctx);
+  }
+#endif
+
+  // invalidate translation of laddr in all contexts matching (tag & mask)
+  BX_CPP_INLINE void invlpg(bx_address laddr, Bit32u tag, Bit32u mask)
   {
-    Bit32u lpf_mask = 0;
+    for (unsigned ctx=0; ctx < BX_TLB_CONTEXTS; ctx++)
+      if ((context[ctx].tag & mask) == (tag & mask))
+        invlpg_context(ctx, laddr);
+  }
 
-    for (unsigned n=0; n<size; n++) {
-      bx_TLB_entry *tlbEntry = &entry[n];
-      if (tlbEntry->valid()) {
-        if (!(tlbEntry->accessBits & TLB_GlobalPage))
-          tlbEntry->invalidate();
-        else
-          lpf_mask |= tlbEntry->lpf_mask;
+private:
+#if BX_TLB_WAYS > 1
+  // mark the way as most recently used: every node on the path to the
+  // way points to the other half of the tree
+  BX_CPP_INLINE void plru_touch(unsigned set, unsigned way)
+  {
+    unsigned bits = plru[set];
+    for (unsigned node = 1, half = BX_TLB_WAYS >> 1; half; half >>= 1) {
+      if (way & half) {
+        bits &= ~(1 << node);
+        node = 2*node + 1;
+      }
+      else {
+        bits |= (1 << node);
+        node = 2*node;
       }
     }
+    plru[set] = (Bit8u) bits;
+  }
+
+  // follow the tree nodes to the pseudo least recently used way
+  BX_CPP_INLINE unsigned plru_victim(unsigned set) const
+  {
+    unsigned bits = plru[set], node = 1;
+    while (node < BX_TLB_WAYS)
+      node = 2*node + ((bits >> node) & 1);
+    return node - BX_TLB_WAYS;
+  }
+#endif
+
+#if BX_CPU_LEVEL >= 5
+  BX_CPP_INLINE bx_TLB_large_entry *find_large_entry(unsigned ctx, bx_address laddr)
+  {
+    bx_TLB_large_entry *large = context[ctx].large;
+    for (unsigned n=0; n < BX_TLB_LARGE_ENTRIES; n++) {
+      if (large[n].valid() && large[n].contains(laddr)) return &large[n];
+    }
+    return NULL;
+  }
 
-    split_large = (lpf_mask > 0xfff);
+  // the recorded TLB entry may meanwhile hold another translation
+  BX_CPP_INLINE void purge_large_alias(bx_TLB_entry *tlb, bx_TLB_large_entry *large, unsigned index)
+  {
+    if (large->contains(LPFOf(tlb[index].lpf)))
+      tlb[index].invalidate();
+  }
+
+  // invalidate large page entry together with all its 4K aliases
+  void invalidate_large_entry(unsigned ctx, bx_TLB_large_entry *large)
+  {
+    if (! large->valid()) return;
+
+    for (unsigned n=0; n < large->aliases; n++)
+      purge_large_alias(context[ctx].entry, large, large->alias[n]);
+
+    large->invalidate();
   }
 #endif
 
-  BX_CPP_INLINE void invlpg(bx_address laddr)
+  void flush_context(unsigned ctx)
   {
+    bx_TLB_entry *tlb = context[ctx].entry;
+    for (unsigned n=0; n < size; n++)
+      tlb[n].invalidate();
+
 #if BX_CPU_LEVEL >= 5
-    if (split_large) {
-      Bit32u lpf_mask = 0;
-
-      // make sure INVLPG handles correctly large pages
-      for (unsigned n=0; n<size; n++) {
-        bx_TLB_entry *tlbEntry = &entry[n];
-        if (tlbEntry->valid()) {
-          bx_address entry_lpf_mask = tlbEntry->lpf_mask;
-          if ((laddr & ~entry_lpf_mask) == (tlbEntry->lpf & ~entry_lpf_mask)) {
-            tlbEntry->invalidate();
-          }
-          else {
-            lpf_mask |= entry_lpf_mask;
-          }
-        }
-      }
+    for (unsigned n=0; n < BX_TLB_LARGE_ENTRIES; n++)
+      context[ctx].large[n].invalidate();
+    context[ctx].large_next = 0;
+#endif
+  }
+
+#if BX_CPU_LEVEL >= 6
+  void flushNonGlobal_context(unsigned ctx)
+  {
+    bx_TLB_entry *tlb = context[ctx].entry;
+
+    for (unsigned n=0; n<size; n++) {
+      bx_TLB_entry *tlbEntry = &tlb[n];
+      if (!(tlbEntry->accessBits & TLB_GlobalPage))
+        tlbEntry->invalidate();
+    }
 
-      split_large = (lpf_mask > 0xfff);
+    // global bit of a large page entry is sticky, so every global 4K alias
+    // left in the TLB still has its large page entry
+    bx_TLB_large_entry *large = context[ctx].large;
+    for (unsigned n=0; n < BX_TLB_LARGE_ENTRIES; n++) {
+      if (!(large[n].accessBits & TLB_GlobalPage))
+        large[n].invalidate();
     }
-    else
+  }
 #endif
-    {
-      bx_TLB_entry *tlbEntry = get_entry_of(laddr);
+
+  void invlpg_context(unsigned ctx, bx_address laddr)
+  {
+    bx_TLB_entry *tlbEntry = &context[ctx].entry[get_index_of(laddr)];
+    for (unsigned way=0; way < BX_TLB_WAYS; way++, tlbEntry++) {
       if (LPFOf(tlbEntry->lpf) == LPFOf(laddr))
         tlbEntry->invalidate();
     }
+
+#if BX_CPU_LEVEL >= 5
+    // make sure INVLPG handles correctly large pages
+    bx_TLB_large_entry *large = context[ctx].large;
+    for (unsigned n=0; n < BX_TLB_LARGE_ENTRIES; n++) {
+      if (large[n].valid() && large[n].contains(laddr))
+        invalidate_large_entry(ctx, &large[n]);
+    }
+#endif
   }
 };
 
@@ -416,7 +416,9 @@ void BX_CPU_C::VMabort(VMX_vmabort_code error_code)
 
 #if BX_SUPPORT_VMX >= 2
   // Deactivate VMX preemtion timer
+  BX_SIM_LOCK();
   BX_CPU_THIS_PTR lapic.deactivate_vmx_preemption_timer();
+  BX_SIM_UNLOCK();
 #endif
 
   shutdown();
@@ -2084,7 +2086,7 @@ Bit32u BX_CPU_C::VMenterLoadCheckGuestState(Bit64u *qualification)
   }
 #endif
 
-  BX_CPU_THIS_PTR async_event = 0;
+  clear_async_event();
 
   setEFlags((Bit32u) guest.rflags);
 
@@ -2161,7 +2163,14 @@ Bit32u BX_CPU_C::VMenterLoadCheckGuestState(Bit64u *qualification)
   if (vm->vmexec_ctrls2 & VMX_VM_EXEC_CTRL2_INTERRUPT_WINDOW_VMEXIT)
     signal_event(BX_EVENT_VMX_INTERRUPT_WINDOW_EXITING);
 
-  handleCpuContextChange();
+#if BX_SUPPORT_VMX >= 2 && BX_TLB_CONTEXTS > 1
+  // VM entry with VPID enabled doesn't invalidate any cached mappings, the
+  // guest address space context is activated once the VM entry completes
+  if (vm->vmexec_ctrls3 & VMX_VM_EXEC_CTRL3_VPID_ENABLE)
+    handleCpuContextChange(false);
+  else
+#endif
+    handleCpuContextChange();
 
 #if BX_SUPPORT_MONITOR_MWAIT
   BX_CPU_THIS_PTR monitor.reset_monitor();
@@ -2476,11 +2485,13 @@ void BX_CPU_C::VMexitSaveGuestState(void)
   }
 
   // Deactivate VMX preemtion timer
+  BX_SIM_LOCK();
   BX_CPU_THIS_PTR lapic.deactivate_vmx_preemption_timer();
   clear_event(BX_EVENT_VMX_PREEMPTION_TIMER_EXPIRED);
   // Store back to VMCS
   if (vm->vmexit_ctrls & VMX_VMEXIT_CTRL1_STORE_VMX_PREEMPTION_TIMER)
     VMwrite32(VMCS_32BIT_GUEST_PREEMPTION_TIMER_VALUE, BX_CPU_THIS_PTR lapic.read_vmx_preemption_timer());
+  BX_SIM_UNLOCK();
 
   if (vm->vmexec_ctrls3 & VMX_VM_EXEC_CTRL3_VIRTUAL_INT_DELIVERY) {
     VMwrite16(VMCS_16BIT_GUEST_INTERRUPT_STATUS, (((Bit16u) vm->svi) << 8) | vm->rvi);
@@ -2680,7 +2691,16 @@ void BX_CPU_C::VMexitLoadHostState(void)
 
   BX_CPU_THIS_PTR activity_state = BX_ACTIVITY_STATE_ACTIVE;
 
-  handleCpuContextChange();
+#if BX_SUPPORT_VMX >= 2 && BX_TLB_CONTEXTS > 1
+  // VM exit with VPID enabled doesn't invalidate any cached mappings,
+  // switch back to the host address space context
+  if (SECONDARY_VMEXEC_CONTROL(VMX_VM_EXEC_CTRL3_VPID_ENABLE)) {
+    handleCpuContextChange(false);
+    TLB_switchContext();
+  }
+  else
+#endif
+    handleCpuContextChange();
 
 #if BX_SUPPORT_MONITOR_MWAIT
   BX_CPU_THIS_PTR monitor.reset_monitor();
@@ -3121,6 +3141,11 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMLAUNCH(bxInstruction_c *i)
 
   BX_CPU_THIS_PTR in_vmx_guest = true;
 
+#if BX_TLB_CONTEXTS > 1
+  // activate address space context tagged with the guest VPID
+  TLB_switchContext();
+#endif
+
   unmask_event(BX_EVENT_INIT);
 
   if (VMEXIT(VMX_VM_EXEC_CTRL2_TSC_OFFSET))
@@ -3137,7 +3162,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::VMLAUNCH(bxInstruction_c *i)
     else {
       // activate VMX preemption timer
       BX_DEBUG(("VMX preemption timer active"));
+      BX_SIM_LOCK();
       BX_CPU_THIS_PTR lapic.set_vmx_preemption_timer(timer_value);
+      BX_SIM_UNLOCK();
     }
   }
 #endif
@@ -3790,11 +3817,19 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVVPID(bxInstruction_c *i)
       BX_NEXT_TRACE(i);
     }
 
+#if BX_TLB_CONTEXTS > 1
+    TLB_invlpg((bx_address) invvpid_desc.xmm64u(1), BX_TLB_TAG(vpid, 0), BX_TLB_TAG_VPID_MASK);
+#else
     TLB_flush(); // invalidate all mappings for address LADDR tagged with VPID
+#endif
     break;
 
   case BX_INVEPT_INVVPID_SINGLE_CONTEXT_INVALIDATION:
+#if BX_TLB_CONTEXTS > 1
+    TLB_flush(BX_TLB_TAG(vpid, 0), BX_TLB_TAG_VPID_MASK);
+#else
     TLB_flush(); // invalidate all mappings tagged with VPID
+#endif
     break;
 
   case BX_INVEPT_INVVPID_ALL_CONTEXT_INVALIDATION:
@@ -3802,7 +3837,11 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVVPID(bxInstruction_c *i)
     break;
 
   case BX_INVEPT_INVVPID_SINGLE_CONTEXT_NON_GLOBAL_INVALIDATION:
+#if BX_TLB_CONTEXTS > 1
+    TLB_flushNonGlobal(BX_TLB_TAG(vpid, 0), BX_TLB_TAG_VPID_MASK);
+#else
     TLB_flushNonGlobal(); // invalidate all mappings tagged with VPID except globals
+#endif
     break;
 
   default:
@@ -3874,6 +3913,9 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVPCID(bxInstruction_c *i)
   }
 
   Bit16u pcid = invpcid_desc.xmm16u(0) & 0xfff;
+#if BX_TLB_CONTEXTS > 1
+  Bit32u tlb_tag = get_TLB_tag();
+#endif
 
   switch(type) {
   case BX_INVPCID_INDIVIDUAL_ADDRESS_NON_GLOBAL_INVALIDATION:
@@ -3887,7 +3929,12 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVPCID(bxInstruction_c *i)
       BX_ERROR(("INVPCID: invalid PCID"));
       exception(BX_GP_EXCEPTION, 0);
     }
+#if BX_TLB_CONTEXTS > 1
+    // Invalidate mappings for LADDR tagged with PCID (current VPID)
+    TLB_invlpg((bx_address) invpcid_desc.xmm64u(1), (tlb_tag & BX_TLB_TAG_VPID_MASK) | pcid, BX_TLB_TAG_ALL_MASK);
+#else
     TLB_flushNonGlobal(); // Invalidate all mappings for LADDR tagged with PCID except globals
+#endif
     break;
 
   case BX_INVPCID_SINGLE_CONTEXT_NON_GLOBAL_INVALIDATION:
@@ -3895,15 +3942,28 @@ void BX_CPP_AttrRegparmN(1) BX_CPU_C::INVPCID(bxInstruction_c *i)
       BX_ERROR(("INVPCID: invalid PCID"));
       exception(BX_GP_EXCEPTION, 0);
     }
+#if BX_TLB_CONTEXTS > 1
+    // Invalidate all mappings tagged with PCID (current VPID) except globals
+    TLB_flushNonGlobal((tlb_tag & BX_TLB_TAG_VPID_MASK) | pcid, BX_TLB_TAG_ALL_MASK);
+#else
     TLB_flushNonGlobal(); // Invalidate all mappings tagged with PCID except globals
+#endif
     break;
 
   case BX_INVPCID_ALL_CONTEXT_INVALIDATION:
+#if BX_TLB_CONTEXTS > 1
+    TLB_flush(tlb_tag, BX_TLB_TAG_VPID_MASK); // Invalidate all mappings tagged with any PCID (current VPID)
+#else
     TLB_flush(); // Invalidate all mappings tagged with any PCID
+#endif
     break;
 
   case BX_INVPCID_ALL_CONTEXT_NON_GLOBAL_INVALIDATION:
+#if BX_TLB_CONTEXTS > 1
+    TLB_flushNonGlobal(tlb_tag, BX_TLB_TAG_VPID_MASK); // Invalidate all mappings tagged with any PCID (current VPID) except globals
+#else
     TLB_flushNonGlobal(); // Invalidate all mappings tagged with any PCID except globals
+#endif
     break;
 
   default:
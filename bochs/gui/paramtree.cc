@@ -1052,7 +1052,7 @@ bx_param_filename_c::bx_param_filename_c(bx_param_c *parent,
 bx_shadow_data_c::bx_shadow_data_c(bx_param_c *parent,
     const char *name,
     Bit8u *ptr_to_data,
-    Bit32u data_size,
+    Bit64u data_size,
     bool is_text)
   : bx_param_c(SIM->gen_param_id(), name, "")
 {
@@ -1060,6 +1060,7 @@ bx_shadow_data_c::bx_shadow_data_c(bx_param_c *parent,
   this->data_ptr = ptr_to_data;
   this->data_size = data_size;
   this->is_text = is_text;
+  this->mappable = 0;
   if (parent) {
     BX_ASSERT(parent->get_type() == BXT_LIST);
     this->parent = (bx_list_c *)parent;
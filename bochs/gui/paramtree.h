@@ -448,18 +448,22 @@ public:
 };
 
 class BOCHSAPI bx_shadow_data_c : public bx_param_c {
-  Bit32u data_size;
+  Bit64u data_size;
   Bit8u *data_ptr;
   bool is_text;
+  bool mappable;
 public:
   bx_shadow_data_c(bx_param_c *parent,
       const char *name,
       Bit8u *ptr_to_data,
-      Bit32u data_size, bool is_text=0);
+      Bit64u data_size, bool is_text=0);
   Bit8u *getptr() {return data_ptr;}
   const Bit8u *getptr() const {return data_ptr;}
-  Bit32u get_size() const {return data_size;}
+  Bit64u get_size() const {return data_size;}
   bool is_text_format() const {return is_text;}
+  // restore may map the binary checkpoint file over the data (page aligned mmap() memory only)
+  void set_mappable(bool val) {mappable = val;}
+  bool is_mappable() const {return mappable;}
   Bit8u get(Bit32u index);
   void set(Bit32u index, Bit8u value);
 };
@@ -542,6 +546,8 @@ public:
   void add(bx_param_c *param);
   bx_param_c *get(int index);
   bx_param_c *get_by_name(const char *name);
+  // first item of the chained list, for walking large lists in order
+  bx_listitem_t *get_first_item() { return list; }
   int get_size() const { return size; }
   Bit32u get_choice() const { return choice; }
   void set_choice(Bit32u new_choice) { choice = new_choice; }
@@ -29,11 +29,37 @@
 #include "bx_debug/debug.h"
 #include "virt_timer.h"
 
+#if BX_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#if BX_HAVE_FORK
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <dirent.h>
+#endif
+#endif
+
 bx_simulator_interface_c *SIM = NULL;
 logfunctions *siminterface_log = NULL;
 bx_list_c *root_param = NULL;
 #define LOG_THIS siminterface_log->
 
+// Binary save format (save_format: binary), all values little endian:
+//   header:   magic, version, number of sections, index of the root section,
+//             offset and size of the section table
+//   data:     contents of the data params, each one page aligned, so restore
+//             can map the file instead of reading it
+//   sections: one per list, the list items in order, every item stored as
+//             type, name length, name and value
+//   table:    offset, size and path of every section
+// The filedata params are kept in separate files like in the text format.
+#define BX_SR_BINARY_FILE    "checkpoint.bin"
+#define BX_SR_BINARY_MAGIC   "BXCHKPT1"
+#define BX_SR_BINARY_VERSION 1
+#define BX_SR_BINARY_HEADER  40
+#define BX_SR_BINARY_ALIGN   4096
+
 // bx_simulator_interface just defines the interface that the Bochs simulator
 // and the gui will use to talk to each other.  None of the methods of
 // bx_simulator_interface are implemented; they are all virtual.  The
@@ -211,6 +237,7 @@ public:
     return (bx_list_c*)get_param("bochs", NULL);
   }
   virtual bool restore_bochs_param(bx_list_c *root, const char *sr_path, const char *restore_name);
+  virtual int fork_simulation();
   // special config parameter and options functions for plugins
   virtual bool opt_plugin_ctrl(const char *plugname, bool load);
 #if BX_NETWORKING
@@ -235,6 +262,8 @@ public:
 
 private:
   bool save_sr_param(FILE *fp, bx_param_c *node, const char *sr_path, int level);
+  bool save_sr_binary(FILE *fp, const char *sr_path);
+  bool restore_sr_binary(FILE *fp, const char *sr_path);
 };
 
 // recursive function to find parameters from the path
@@ -1078,6 +1107,7 @@ bool bx_real_sim_c::save_state(const char *checkpoint_path)
   int dev, ndev = SIM->get_n_log_modules();
   int type, ntype = SIM->get_max_log_level();
 
+  bx_sr_before_save_state();
   get_param_string(BXPN_RESTORE_PATH)->set(checkpoint_path);
   sprintf(sr_file, "%s/config", checkpoint_path);
   if (write_rc(sr_file, 1) < 0)
@@ -1100,17 +1130,47 @@ bool bx_real_sim_c::save_state(const char *checkpoint_path)
   } else {
     return 0;
   }
-  bx_list_c *sr_list = get_bochs_root();
-  ndev = sr_list->get_size();
-  for (dev=0; dev<ndev; dev++) {
-    sprintf(sr_file, "%s/%s", checkpoint_path, sr_list->get(dev)->get_name());
-    fp = fopen(sr_file, "w");
-    if (fp != NULL) {
-      save_sr_param(fp, sr_list->get(dev), checkpoint_path, 0);
-      fclose(fp);
-    } else {
+  sprintf(sr_file, "%s/%s", checkpoint_path, BX_SR_BINARY_FILE);
+  if (SIM->get_param_enum(BXPN_SAVE_FORMAT)->get() == BX_SAVE_FORMAT_BINARY) {
+    // The guest memory may still be mapped from the binary file restored
+    // before. Truncating it would corrupt the memory, so the new file is
+    // written under a temporary name and replaces the old one when done.
+    char tmp_file[BX_PATHNAME_LEN+8];
+    sprintf(tmp_file, "%s.tmp", sr_file);
+    fp = fopen(tmp_file, "wb");
+    if (fp == NULL)
+      return 0;
+    bool ret = save_sr_binary(fp, checkpoint_path);
+    if (fclose(fp) != 0)
+      ret = 0;
+#ifdef WIN32
+    // rename() does not replace an existing file here
+    if (ret)
+      remove(sr_file);
+#endif
+    if (ret && (rename(tmp_file, sr_file) != 0)) {
+      BX_ERROR(("save_state(): could not rename '%s' to '%s'", tmp_file, sr_file));
+      ret = 0;
+    }
+    if (!ret) {
+      remove(tmp_file);
       return 0;
     }
+  } else {
+    // a stale binary file would be preferred on restore
+    remove(sr_file);
+    bx_list_c *sr_list = get_bochs_root();
+    ndev = sr_list->get_size();
+    for (dev=0; dev<ndev; dev++) {
+      sprintf(sr_file, "%s/%s", checkpoint_path, sr_list->get(dev)->get_name());
+      fp = fopen(sr_file, "w");
+      if (fp != NULL) {
+        save_sr_param(fp, sr_list->get(dev), checkpoint_path, 0);
+        fclose(fp);
+      } else {
+        return 0;
+      }
+    }
   }
   get_param_string(BXPN_RESTORE_PATH)->set("none");
   return 1;
@@ -1196,6 +1256,64 @@ static int bx_restore_getline(FILE *fp, char *line, int maxlen)
   return (ret != NULL) ? len : 0;
 }
 
+// Copy the saved file to the backing store of the param (if any) and let
+// the restore handler read it.
+static void restore_sr_filedata(bx_shadow_filedata_c *param, const char *fname)
+{
+  FILE *fp2 = fopen(fname, "rb");
+  if (fp2 != NULL) {
+    FILE **fpp = param->get_fpp();
+    // Without backing store the data is only read by the restore handler.
+    if (fpp != NULL) {
+      // If the temporary backing store file wasn't created, do it now.
+      if (*fpp == NULL) {
+        *fpp = tmpfile64();
+      } else {
+        fseeko64(*fpp, 0, SEEK_SET);
+      }
+      if (*fpp != NULL) {
+        char *buffer = new char[4096];
+        while (!feof(fp2)) {
+          size_t chars = fread(buffer, 1, 4096, fp2);
+          fwrite(buffer, 1, chars, *fpp);
+        }
+        delete [] buffer;
+        fflush(*fpp);
+      }
+    }
+    param->restore(fp2);
+    fclose(fp2);
+  }
+}
+
+// Save the backing store of the param (if any) to the file <list>.<name>
+// and let the save handler add its data.
+static void save_sr_filedata(bx_shadow_filedata_c *param, const char *sr_path)
+{
+  char tmpstr[BX_PATHNAME_LEN+1];
+
+  if (sr_path)
+    sprintf(tmpstr, "%s/%s.%s", sr_path, param->get_parent()->get_name(), param->get_name());
+  else
+    sprintf(tmpstr, "%s.%s", param->get_parent()->get_name(), param->get_name());
+  FILE *fp2 = fopen(tmpstr, "wb");
+  if (fp2 != NULL) {
+    FILE **fpp = param->get_fpp();
+    // If the backing store hasn't been created, just save an empty 0 byte placeholder file.
+    if ((fpp != NULL) && (*fpp != NULL)) {
+      char *buffer = new char[4096];
+      fseeko64(*fpp, 0, SEEK_SET);
+      while (!feof(*fpp)) {
+        size_t chars = fread (buffer, 1, 4096, *fpp);
+        fwrite(buffer, 1, chars, fp2);
+      }
+      delete [] buffer;
+    }
+    param->save(fp2);
+    fclose(fp2);
+  }
+}
+
 bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path, const char *restore_name)
 {
   char devstate[BX_PATHNAME_LEN], devdata[BX_PATHNAME_LEN];
@@ -1281,27 +1399,7 @@ bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path, co
                   break;
                 case BXT_PARAM_FILEDATA:
                   sprintf(devdata, "%s/%s", sr_path, ptr);
-                  fp2 = fopen(devdata, "rb");
-                  if (fp2 != NULL) {
-                    FILE **fpp = ((bx_shadow_filedata_c*)param)->get_fpp();
-                    // If the temporary backing store file wasn't created, do it now.
-                    if (*fpp == NULL) {
-                      *fpp = tmpfile64();
-                    } else {
-                      fseeko64(*fpp, 0, SEEK_SET);
-                    }
-                    if (*fpp != NULL) {
-                      char *buffer = new char[4096];
-                      while (!feof(fp2)) {
-                        size_t chars = fread(buffer, 1, 4096, fp2);
-                        fwrite(buffer, 1, chars, *fpp);
-                      }
-                      delete [] buffer;
-                      fflush(*fpp);
-                    }
-                    ((bx_shadow_filedata_c*)param)->restore(fp2);
-                    fclose(fp2);
-                  }
+                  restore_sr_filedata((bx_shadow_filedata_c*)param, devdata);
                   break;
                 case BXT_LIST:
                   base = (bx_list_c*)param;
@@ -1327,15 +1425,129 @@ bool bx_real_sim_c::restore_bochs_param(bx_list_c *root, const char *sr_path, co
 
 bool bx_real_sim_c::restore_hardware()
 {
+  char sr_file[BX_PATHNAME_LEN];
+  const char *sr_path = get_param_string(BXPN_RESTORE_PATH)->getptr();
+
+  sprintf(sr_file, "%s/%s", sr_path, BX_SR_BINARY_FILE);
+  FILE *fp = fopen(sr_file, "rb");
+  if (fp != NULL) {
+    // mapped data stays valid after the file is closed
+    bool ret = restore_sr_binary(fp, sr_path);
+    fclose(fp);
+    return ret;
+  }
   bx_list_c *sr_list = get_bochs_root();
   int ndev = sr_list->get_size();
   for (int dev=0; dev<ndev; dev++) {
-    if (!restore_bochs_param(sr_list, get_param_string(BXPN_RESTORE_PATH)->getptr(), sr_list->get(dev)->get_name()))
+    if (!restore_bochs_param(sr_list, sr_path, sr_list->get(dev)->get_name()))
       return 0;
   }
   return 1;
 }
 
+#if BX_HAVE_FORK && defined(__linux__)
+// After fork() the open files share their file offset with the parent, so
+// reading them in both processes at the same time would fail. Reopen them
+// to get a private offset. Files opened for writing only (log files) keep
+// the shared offset, so the output of both processes is appended.
+static void reopen_shared_files(void)
+{
+  char path[32];
+  struct dirent *entry;
+  struct stat stat_buf;
+
+  DIR *dir = opendir("/proc/self/fd");
+  if (dir == NULL) {
+    BX_ERROR(("cannot reopen the files shared with the parent process"));
+    return;
+  }
+  while ((entry = readdir(dir)) != NULL) {
+    int fd = atoi(entry->d_name);
+    if ((fd <= 2) || (fd == dirfd(dir))) continue;
+    if ((fstat(fd, &stat_buf) < 0) || !S_ISREG(stat_buf.st_mode)) continue;
+    int flags = fcntl(fd, F_GETFL);
+    if ((flags < 0) || ((flags & O_ACCMODE) == O_WRONLY)) continue;
+    // this also works for files already deleted (temporary files)
+    sprintf(path, "/proc/self/fd/%d", fd);
+    int newfd = open(path, flags & ~(O_CREAT | O_EXCL | O_TRUNC));
+    if (newfd < 0) {
+      BX_ERROR(("cannot reopen file descriptor %d", fd));
+      continue;
+    }
+    lseek(newfd, lseek(fd, 0, SEEK_CUR), SEEK_SET);
+    int fdflags = fcntl(fd, F_GETFD);
+    dup2(newfd, fd);
+    fcntl(fd, F_SETFD, fdflags);
+    close(newfd);
+  }
+  closedir(dir);
+}
+#endif
+
+#if BX_HAVE_FORK
+// Check if the enabled devices in the list use one of the allowed host
+// backends. Both processes would talk to the same host window, network
+// connection or serial device.
+static bool fork_check_backends(const char *list_name, const char *backend,
+                                const char *allowed1, const char *allowed2)
+{
+  bool ok = 1;
+
+  bx_list_c *list = (bx_list_c*) SIM->get_param(list_name);
+  if (list == NULL) return 1;
+  for (int i = 0; i < list->get_size(); i++) {
+    bx_param_c *dev = list->get(i);
+    if (dev->get_type() != BXT_LIST) continue;
+    bx_param_bool_c *enabled = (bx_param_bool_c*) ((bx_list_c*)dev)->get_by_name("enabled");
+    bx_param_enum_c *mode = (bx_param_enum_c*) ((bx_list_c*)dev)->get_by_name(backend);
+    if ((enabled == NULL) || (mode == NULL) || !enabled->get()) continue;
+    const char *name = mode->get_selected();
+    if (strcmp(name, allowed1) && strcmp(name, allowed2)) {
+      BX_ERROR(("fork_simulation(): %s.%s uses %s '%s'", list_name, dev->get_name(),
+                backend, name));
+      ok = 0;
+    }
+  }
+  return ok;
+}
+#endif
+
+int bx_real_sim_c::fork_simulation()
+{
+#if BX_HAVE_FORK
+  bool ok = 1;
+
+  const char *display = get_param_enum(BXPN_SEL_DISPLAY_LIBRARY)->get_selected();
+  if (strcmp(display, "nogui")) {
+    BX_ERROR(("fork_simulation(): not supported with display library '%s'", display));
+    ok = 0;
+  }
+  if (!fork_check_backends("network", "ethmod", "null", "vnet")) ok = 0;
+  if (!fork_check_backends("ports.serial", "mode", "null", "mouse")) ok = 0;
+  if (!ok) return -1;
+  // buffered output would be written by both processes
+  fflush(NULL);
+  bx_before_fork();
+  pid_t pid = fork();
+  if (pid < 0) {
+    BX_ERROR(("fork_simulation(): fork() failed"));
+    bx_after_fork(0);
+    return -1;
+  }
+  if (pid == 0) {
+#ifdef __linux__
+    reopen_shared_files();
+#endif
+    BX_INFO(("forked simulation running in process %d", (int) getpid()));
+  }
+  bx_after_fork(pid == 0);
+  return (int) pid;
+#else
+  BX_ERROR(("fork_simulation(): not supported on this host"));
+  return -1;
+#endif
+}
+
 bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_path, int level)
 {
   int i, j;
@@ -1400,26 +1612,7 @@ bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_pat
       break;
     case BXT_PARAM_FILEDATA:
       fprintf(fp, "%s.%s\n", node->get_parent()->get_name(), node->get_name());
-      if (sr_path)
-        sprintf(tmpstr, "%s/%s.%s", sr_path, node->get_parent()->get_name(), node->get_name());
-      else
-        sprintf(tmpstr, "%s.%s", node->get_parent()->get_name(), node->get_name());
-      fp2 = fopen(tmpstr, "wb");
-      if (fp2 != NULL) {
-        FILE **fpp = ((bx_shadow_filedata_c*)node)->get_fpp();
-        // If the backing store hasn't been created, just save an empty 0 byte placeholder file.
-        if (*fpp != NULL) {
-          char *buffer = new char[4096];
-          fseeko64(*fpp, 0, SEEK_SET);
-          while (!feof(*fpp)) {
-            size_t chars = fread (buffer, 1, 4096, *fpp);
-            fwrite(buffer, 1, chars, fp2);
-          }
-          delete [] buffer;
-        }
-        ((bx_shadow_filedata_c*)node)->save(fp2);
-        fclose(fp2);
-      }
+      save_sr_filedata((bx_shadow_filedata_c*)node, sr_path);
       break;
     case BXT_LIST:
       {
@@ -1441,6 +1634,355 @@ bool bx_real_sim_c::save_sr_param(FILE *fp, bx_param_c *node, const char *sr_pat
   return 1;
 }
 
+typedef struct {
+  Bit8u *data;
+  Bit32u size, maxsize;
+} bx_sr_buffer_t;
+
+typedef struct {
+  FILE *fp;
+  const char *sr_path;
+  Bit64u end;            // end of the data written so far
+  bx_sr_buffer_t table;
+  Bit32u sections;
+  Bit64u *section_offset;
+  Bit32u *section_size;
+} bx_sr_binary_t;
+
+static void sr_put_le(Bit8u *ptr, Bit64u val, unsigned len)
+{
+  for (unsigned i = 0; i < len; i++)
+    ptr[i] = (Bit8u)(val >> (i*8));
+}
+
+static Bit64u sr_get_le(const Bit8u *ptr, unsigned len)
+{
+  Bit64u val = 0;
+  for (unsigned i = 0; i < len; i++)
+    val |= ((Bit64u) ptr[i]) << (i*8);
+  return val;
+}
+
+static void sr_buffer_put(bx_sr_buffer_t *buf, const void *data, Bit32u len)
+{
+  if ((buf->size + len) > buf->maxsize) {
+    Bit32u maxsize = (buf->maxsize > 0) ? buf->maxsize : 256;
+    while (maxsize < (buf->size + len))
+      maxsize *= 2;
+    Bit8u *newdata = new Bit8u[maxsize];
+    if (buf->size > 0)
+      memcpy(newdata, buf->data, buf->size);
+    delete [] buf->data;
+    buf->data = newdata;
+    buf->maxsize = maxsize;
+  }
+  memcpy(buf->data + buf->size, data, len);
+  buf->size += len;
+}
+
+static void sr_buffer_put_le(bx_sr_buffer_t *buf, Bit64u val, unsigned len)
+{
+  Bit8u tmp[8];
+  sr_put_le(tmp, val, len);
+  sr_buffer_put(buf, tmp, len);
+}
+
+static void sr_buffer_put_item(bx_sr_buffer_t *buf, bx_param_c *param)
+{
+  const char *name = param->get_name();
+  Bit8u len = (Bit8u) strlen(name);
+  sr_buffer_put_le(buf, param->get_type(), 1);
+  sr_buffer_put_le(buf, len, 1);
+  sr_buffer_put(buf, name, len);
+}
+
+static bool sr_binary_write(bx_sr_binary_t *ctx, Bit64u offset, const void *data, Bit64u len)
+{
+  if (fseeko64(ctx->fp, offset, SEEK_SET))
+    return 0;
+  if ((len > 0) && (fwrite(data, 1, (size_t) len, ctx->fp) != len))
+    return 0;
+  if ((offset + len) > ctx->end)
+    ctx->end = offset + len;
+  return 1;
+}
+
+// Returns the index of the section written for the list or -1 on error.
+static Bit32s sr_binary_save_list(bx_sr_binary_t *ctx, bx_list_c *list)
+{
+  bx_sr_buffer_t buf = {NULL, 0, 0};
+  char tmpstr[BX_PATHNAME_LEN+1];
+  bool ok = 1;
+
+  for (bx_listitem_t *item = list->get_first_item(); (item != NULL) && ok; item = item->next) {
+    bx_param_c *param = item->param;
+    switch (param->get_type()) {
+      case BXT_PARAM_NUM:
+      case BXT_PARAM_BOOL:
+      case BXT_PARAM_ENUM:
+        sr_buffer_put_item(&buf, param);
+        sr_buffer_put_le(&buf, ((bx_param_num_c*)param)->get64(), 8);
+        break;
+      case BXT_PARAM_STRING:
+      case BXT_PARAM_BYTESTRING:
+        {
+          Bit16u len = (Bit16u) param->dump_param(tmpstr, BX_PATHNAME_LEN, 0);
+          sr_buffer_put_item(&buf, param);
+          sr_buffer_put_le(&buf, len, 2);
+          sr_buffer_put(&buf, tmpstr, len);
+        }
+        break;
+      case BXT_PARAM_DATA:
+        {
+          bx_shadow_data_c *dparam = (bx_shadow_data_c*)param;
+          Bit64u offset = (ctx->end + BX_SR_BINARY_ALIGN - 1) & ~(Bit64u)(BX_SR_BINARY_ALIGN - 1);
+          ok = sr_binary_write(ctx, offset, dparam->getptr(), dparam->get_size());
+          sr_buffer_put_item(&buf, param);
+          sr_buffer_put_le(&buf, offset, 8);
+          sr_buffer_put_le(&buf, dparam->get_size(), 8);
+        }
+        break;
+      case BXT_PARAM_FILEDATA:
+        save_sr_filedata((bx_shadow_filedata_c*)param, ctx->sr_path);
+        sr_buffer_put_item(&buf, param);
+        break;
+      case BXT_LIST:
+        {
+          Bit32s section = sr_binary_save_list(ctx, (bx_list_c*)param);
+          ok = (section >= 0);
+          sr_buffer_put_item(&buf, param);
+          sr_buffer_put_le(&buf, section, 4);
+        }
+        break;
+      default:
+        BX_ERROR(("save_sr_binary(): unknown parameter type"));
+    }
+  }
+
+  Bit64u offset = ctx->end;
+  if (ok)
+    ok = sr_binary_write(ctx, offset, buf.data, buf.size);
+  delete [] buf.data;
+  if (!ok)
+    return -1;
+
+  list->get_param_path(tmpstr, BX_PATHNAME_LEN);
+  Bit16u len = (Bit16u) strlen(tmpstr);
+  sr_buffer_put_le(&ctx->table, offset, 8);
+  sr_buffer_put_le(&ctx->table, buf.size, 4);
+  sr_buffer_put_le(&ctx->table, len, 2);
+  sr_buffer_put(&ctx->table, tmpstr, len);
+  return ctx->sections++;
+}
+
+bool bx_real_sim_c::save_sr_binary(FILE *fp, const char *sr_path)
+{
+  bx_sr_binary_t ctx;
+  Bit8u header[BX_SR_BINARY_HEADER];
+
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.fp = fp;
+  ctx.sr_path = sr_path;
+  ctx.end = BX_SR_BINARY_HEADER;
+  Bit32s root = sr_binary_save_list(&ctx, get_bochs_root());
+  bool ok = (root >= 0);
+  Bit64u table_offset = ctx.end;
+  if (ok)
+    ok = sr_binary_write(&ctx, table_offset, ctx.table.data, ctx.table.size);
+  if (ok) {
+    memset(header, 0, sizeof(header));
+    memcpy(header, BX_SR_BINARY_MAGIC, 8);
+    sr_put_le(header + 8, BX_SR_BINARY_VERSION, 4);
+    sr_put_le(header + 12, ctx.sections, 4);
+    sr_put_le(header + 16, root, 4);
+    sr_put_le(header + 24, table_offset, 8);
+    sr_put_le(header + 32, ctx.table.size, 8);
+    ok = sr_binary_write(&ctx, 0, header, sizeof(header));
+  }
+  delete [] ctx.table.data;
+  if (!ok)
+    BX_ERROR(("save_sr_binary(): error writing '%s/%s'", sr_path, BX_SR_BINARY_FILE));
+  return ok;
+}
+
+static bool sr_binary_restore_data(bx_sr_binary_t *ctx, bx_shadow_data_c *dparam, Bit64u offset, Bit64u size)
+{
+  Bit8u *ptr = dparam->getptr();
+
+  if (size != dparam->get_size()) {
+    BX_ERROR(("restore_sr_binary(): size mismatch of data '%s'", dparam->get_name()));
+    if (size > dparam->get_size())
+      size = dparam->get_size();
+  }
+#if BX_HAVE_SYS_MMAN_H
+  else if (dparam->is_mappable() &&
+           ((((bx_ptr_equiv_t) ptr) | offset | size) & (BX_SR_BINARY_ALIGN - 1)) == 0) {
+    // the guest modifications go to private copies of the pages
+    if (mmap(ptr, (size_t) size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+             fileno(ctx->fp), (off_t) offset) != MAP_FAILED)
+      return 1;
+  }
+#endif
+  if (fseeko64(ctx->fp, offset, SEEK_SET))
+    return 0;
+  return (size == 0) || (fread(ptr, 1, (size_t) size, ctx->fp) == size);
+}
+
+static bool sr_binary_restore_list(bx_sr_binary_t *ctx, Bit32u section, bx_list_c *list)
+{
+  char name[256], tmpstr[BX_PATHNAME_LEN+1];
+  bool ok = 1;
+
+  if (section >= ctx->sections)
+    return 0;
+  Bit32u size = ctx->section_size[section];
+  Bit8u *buf = new Bit8u[size + 1];
+  if (fseeko64(ctx->fp, ctx->section_offset[section], SEEK_SET) ||
+      ((size > 0) && (fread(buf, 1, size, ctx->fp) != size))) {
+    delete [] buf;
+    return 0;
+  }
+
+  // the items are usually found in the list order
+  bx_listitem_t *item = list->get_first_item();
+  Bit8u *ptr = buf, *end = buf + size;
+  while ((ptr < end) && ok) {
+    if ((end - ptr) < 2 || (end - ptr - 2) < ptr[1]) {
+      ok = 0;
+      break;
+    }
+    Bit8u type = ptr[0];
+    memcpy(name, ptr + 2, ptr[1]);
+    name[ptr[1]] = 0;
+    ptr += 2 + ptr[1];
+
+    bx_param_c *param = NULL;
+    if ((item != NULL) && !strcmp(item->param->get_name(), name)) {
+      param = item->param;
+      item = item->next;
+    } else {
+      param = list->get_by_name(name);
+    }
+    if (param == NULL) {
+      BX_PANIC(("cannot find param '%s'!", name));
+    } else if (param->get_type() != type) {
+      BX_PANIC(("type mismatch of param '%s'!", name));
+      param = NULL;
+    } else if (param->get_type() != BXT_LIST) {
+      param->get_param_path(tmpstr, BX_PATHNAME_LEN);
+      BX_DEBUG(("restoring parameter '%s'", tmpstr));
+    }
+
+    switch (type) {
+      case BXT_PARAM_NUM:
+      case BXT_PARAM_BOOL:
+      case BXT_PARAM_ENUM:
+        if ((end - ptr) < 8) {
+          ok = 0;
+          break;
+        }
+        if (param != NULL)
+          ((bx_param_num_c*)param)->set((Bit64s) sr_get_le(ptr, 8));
+        ptr += 8;
+        break;
+      case BXT_PARAM_STRING:
+      case BXT_PARAM_BYTESTRING:
+        {
+          if ((end - ptr) < 2) {
+            ok = 0;
+            break;
+          }
+          Bit32u len = (Bit32u) sr_get_le(ptr, 2);
+          if (((end - ptr - 2) < (Bit32s) len) || (len > BX_PATHNAME_LEN)) {
+            ok = 0;
+            break;
+          }
+          memcpy(tmpstr, ptr + 2, len);
+          tmpstr[len] = 0;
+          if (param != NULL)
+            param->parse_param(tmpstr);
+          ptr += 2 + len;
+        }
+        break;
+      case BXT_PARAM_DATA:
+        if ((end - ptr) < 16) {
+          ok = 0;
+          break;
+        }
+        if (param != NULL)
+          ok = sr_binary_restore_data(ctx, (bx_shadow_data_c*)param, sr_get_le(ptr, 8), sr_get_le(ptr + 8, 8));
+        ptr += 16;
+        break;
+      case BXT_PARAM_FILEDATA:
+        if (param != NULL) {
+          sprintf(tmpstr, "%s/%s.%s", ctx->sr_path, list->get_name(), param->get_name());
+          restore_sr_filedata((bx_shadow_filedata_c*)param, tmpstr);
+        }
+        break;
+      case BXT_LIST:
+        if ((end - ptr) < 4) {
+          ok = 0;
+          break;
+        }
+        if (param != NULL)
+          ok = sr_binary_restore_list(ctx, (Bit32u) sr_get_le(ptr, 4), (bx_list_c*)param);
+        ptr += 4;
+        break;
+      default:
+        ok = 0;
+    }
+  }
+  delete [] buf;
+
+  if (ok)
+    list->restore();
+  return ok;
+}
+
+bool bx_real_sim_c::restore_sr_binary(FILE *fp, const char *sr_path)
+{
+  bx_sr_binary_t ctx;
+  Bit8u header[BX_SR_BINARY_HEADER];
+
+  BX_INFO(("restoring '%s/%s'", sr_path, BX_SR_BINARY_FILE));
+  if ((fread(header, sizeof(header), 1, fp) != 1) || memcmp(header, BX_SR_BINARY_MAGIC, 8) ||
+      (sr_get_le(header + 8, 4) != BX_SR_BINARY_VERSION)) {
+    BX_ERROR(("restore_sr_binary(): unsupported file format"));
+    return 0;
+  }
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.fp = fp;
+  ctx.sr_path = sr_path;
+  ctx.sections = (Bit32u) sr_get_le(header + 12, 4);
+  Bit32u root = (Bit32u) sr_get_le(header + 16, 4);
+  Bit64u table_offset = sr_get_le(header + 24, 8);
+  Bit32u table_size = (Bit32u) sr_get_le(header + 32, 8);
+
+  Bit8u *table = new Bit8u[table_size];
+  bool ok = !fseeko64(fp, table_offset, SEEK_SET) && (fread(table, 1, table_size, fp) == table_size);
+  ctx.section_offset = new Bit64u[ctx.sections];
+  ctx.section_size = new Bit32u[ctx.sections];
+  Bit8u *ptr = table, *end = table + table_size;
+  for (Bit32u i = 0; (i < ctx.sections) && ok; i++) {
+    if ((end - ptr) < 14) {
+      ok = 0;
+      break;
+    }
+    ctx.section_offset[i] = sr_get_le(ptr, 8);
+    ctx.section_size[i] = (Bit32u) sr_get_le(ptr + 8, 4);
+    ptr += 14 + sr_get_le(ptr + 12, 2); // skip the list path
+  }
+  if (ok)
+    ok = sr_binary_restore_list(&ctx, root, get_bochs_root());
+  if (!ok)
+    BX_ERROR(("restore_sr_binary(): corrupted file"));
+
+  delete [] table;
+  delete [] ctx.section_offset;
+  delete [] ctx.section_size;
+  return ok;
+}
+
 bool bx_real_sim_c::opt_plugin_ctrl(const char *plugname, bool load)
 {
   bx_list_c *plugin_ctrl = (bx_list_c*)SIM->get_param(BXPN_PLUGIN_CTRL);
@@ -433,6 +433,14 @@ enum {
   BX_RUN_START
 };
 
+// These are the formats of the saved simulation state.
+enum {
+  // Text file per device, binary data params in separate files.
+  BX_SAVE_FORMAT_TEXT,
+  // Single binary file with page aligned data, see siminterface.cc.
+  BX_SAVE_FORMAT_BINARY
+};
+
 enum {
   BX_DDC_MODE_DISABLED,
   BX_DDC_MODE_BUILTIN,
@@ -739,6 +747,9 @@ public:
   virtual bool restore_hardware() {return 0;}
   virtual bx_list_c *get_bochs_root() {return NULL;}
   virtual bool restore_bochs_param(bx_list_c *root, const char *sr_path, const char *restore_name) { return 0; }
+  // Fork the running simulation into a child process. Returns the process
+  // id of the child in the parent, 0 in the child and -1 on error.
+  virtual int fork_simulation() {return -1;}
 
   // special config parameter and options functions for plugins
   virtual bool opt_plugin_ctrl(const char *plugname, bool load) {return 0;}
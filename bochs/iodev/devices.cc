@@ -423,6 +423,11 @@ void bx_devices_c::after_restore_state()
   bx_plugins_after_restore_state();
 }
 
+void bx_devices_c::after_fork(bool child)
+{
+  bx_plugins_after_fork(child);
+}
+
 void bx_devices_c::exit()
 {
   // delete i/o handlers before unloading plugins
@@ -421,6 +421,57 @@ void bx_floppy_ctrl_c::after_restore_state(void)
   }
 }
 
+// The floppy images are shared by the processes of a forked simulation. Like
+// the hard disk images they no longer change after the fork: a VVFAT floppy
+// gets a volatile redolog and every process continues with a private copy
+// of a writable image file.
+void bx_floppy_ctrl_c::after_fork(bool child)
+{
+  char pname[10], tmpname[BX_PATHNAME_LEN+8];
+  Bit8u buffer[4096];
+
+  for (int i = 0; i < 2; i++) {
+    floppy_t *media = &BX_FD_THIS s.media[i];
+    if (!BX_FD_THIS s.media_present[i] || media->write_protected || (media->fd < 0))
+      continue;
+    sprintf(pname, "floppy.%d", i);
+    bx_list_c *floppy = (bx_list_c*)SIM->get_param(pname);
+    const char *path = SIM->get_param_string("path", floppy)->getptr();
+    if (media->vvfat_floppy) {
+      volatile_image_t *overlay = new volatile_image_t(NULL);
+      // only the parent process closes the VVFAT image, committing its changes
+      if (overlay->open(media->vvfat, path + 6, !child) < 0) {
+        BX_PANIC(("fd%d: could not create redolog after fork", i));
+        delete overlay;
+        continue;
+      }
+      media->vvfat = overlay;
+      continue;
+    }
+    sprintf(tmpname, "%s.XXXXXX", path);
+    int fd = mkstemp(tmpname);
+    if (fd < 0) {
+      BX_PANIC(("fd%d: could not create image copy after fork", i));
+      continue;
+    }
+    unlink(tmpname);
+    // the image file may be smaller than the media
+    ssize_t ret;
+    lseek(media->fd, 0, SEEK_SET);
+    while ((ret = ::read(media->fd, (bx_ptr_t) buffer, sizeof(buffer))) > 0) {
+      if (::write(fd, (bx_ptr_t) buffer, ret) != ret) {
+        ret = -1;
+        break;
+      }
+    }
+    if (ret < 0) {
+      BX_PANIC(("fd%d: could not copy image after fork", i));
+    }
+    close(media->fd);
+    media->fd = fd;
+  }
+}
+
 void bx_floppy_ctrl_c::runtime_config_handler(void *this_ptr)
 {
   bx_floppy_ctrl_c *class_ptr = (bx_floppy_ctrl_c *) this_ptr;
@@ -54,6 +54,7 @@ public:
   virtual void reset(unsigned type);
   virtual void register_state(void);
   virtual void after_restore_state(void);
+  virtual void after_fork(bool child);
 #if BX_DEBUGGER
   virtual void debug_dump(int argc, char **argv);
 #endif
@@ -29,8 +29,8 @@
 #define BX_PLUGGABLE
 
 #include "iodev.h"
-#include "harddrv.h"
 #include "hdimage/hdimage.h"
+#include "harddrv.h"
 #include "hdimage/cdrom.h"
 
 #define LOG_THIS theHardDrive->
@@ -135,6 +135,10 @@ bx_hard_drive_c::bx_hard_drive_c()
       channels[channel].drives[device].cdrom.cd = NULL;
       channels[channel].drives[device].seek_timer_index = BX_NULL_TIMER_HANDLE;
       channels[channel].drives[device].statusbar_id = -1;
+      channels[channel].drives[device].async = 0;
+      channels[channel].drives[device].aio.state = BX_AIO_IDLE;
+      channels[channel].drives[device].aio_buffer = NULL;
+      channels[channel].drives[device].aio_sectors = 0;
     }
   }
   rt_conf_id = -1;
@@ -148,7 +152,20 @@ bx_hard_drive_c::~bx_hard_drive_c()
   SIM->unregister_runtime_config_handler(rt_conf_id);
   for (Bit8u channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
     for (Bit8u device=0; device<2; device ++) {
+      if (channels[channel].drives[device].aio.state == BX_AIO_PENDING) {
+        bx_hdimage_ctl.aio_wait(&channels[channel].drives[device].aio);
+      }
+      if (channels[channel].drives[device].aio_buffer != NULL) {
+        delete [] channels[channel].drives[device].aio_buffer;
+      }
+      sprintf(ata_name, "ata.%d.%s", channel, (device==0)?"master":"slave");
+      base = (bx_list_c*) SIM->get_param(ata_name);
       if (channels[channel].drives[device].hdimage != NULL) {
+        if (SIM->get_param_bool("commit", base)->get()) {
+          if (channels[channel].drives[device].hdimage->commit() < 0) {
+            BX_ERROR(("ata%d-%d: failed to commit the redolog", channel, device));
+          }
+        }
         channels[channel].drives[device].hdimage->close();
         delete channels[channel].drives[device].hdimage;
         channels[channel].drives[device].hdimage = NULL;
@@ -160,8 +177,6 @@ bx_hard_drive_c::~bx_hard_drive_c()
       if (channels[channel].drives[device].controller.buffer != NULL) {
         delete [] channels[channel].drives[device].controller.buffer;
       }
-      sprintf(ata_name, "ata.%d.%s", channel, (device==0)?"master":"slave");
-      base = (bx_list_c*) SIM->get_param(ata_name);
       SIM->get_param_string("path", base)->set_handler(NULL);
       SIM->get_param_enum("status", base)->set_handler(NULL);
     }
@@ -368,6 +383,11 @@ void bx_hard_drive_c::init(void)
         BX_HD_THIS channels[channel].drives[device].controller.buffer_total_size =
           MAX_MULTIPLE_SECTORS * sect_size;
         BX_HD_THIS channels[channel].drives[device].sect_size = sect_size;
+        if (SIM->get_param_bool("async", base)->get()) {
+          BX_INFO(("ata%d-%d: using asynchronous image access", channel, device));
+          BX_HD_THIS channels[channel].drives[device].async = 1;
+          BX_HD_THIS channels[channel].drives[device].aio_buffer = new Bit8u[AIO_BUFFER_SIZE];
+        }
       } else if (SIM->get_param_enum("type", base)->get() == BX_ATA_DEVICE_CDROM) {
         bx_list_c *cdrom_rt = (bx_list_c*)SIM->get_param(BXPN_MENU_RUNTIME_CDROM);
         sprintf(pname, "cdrom%d", BX_HD_THIS cdrom_count + 1);
@@ -576,6 +596,14 @@ void bx_hard_drive_c::reset(unsigned type)
   for (unsigned channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
     if (BX_HD_THIS channels[channel].irq)
       DEV_pic_lower_irq(BX_HD_THIS channels[channel].irq);
+    for (unsigned device=0; device<2; device++) {
+      // a pending write still goes to the image, the command is dropped
+      if (BX_DRIVE(channel, device).aio.state == BX_AIO_PENDING) {
+        bx_hdimage_ctl.aio_wait(&BX_DRIVE(channel, device).aio);
+      }
+      BX_DRIVE(channel, device).aio.state = BX_AIO_IDLE;
+      BX_DRIVE(channel, device).aio_sectors = 0;
+    }
   }
 }
 
@@ -651,6 +679,41 @@ void bx_hard_drive_c::register_state(void)
   }
 }
 
+// The data read ahead may not match the restored image
+void bx_hard_drive_c::after_restore_state(void)
+{
+  for (unsigned channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
+    for (unsigned device=0; device<2; device++) {
+      BX_DRIVE(channel, device).aio_sectors = 0;
+    }
+  }
+}
+
+// The base images are shared by the processes of a forked simulation. Both
+// of them continue with a volatile redolog, so the base images no longer
+// change and every process sees the disk contents at the time of the fork.
+void bx_hard_drive_c::after_fork(bool child)
+{
+  char ata_name[20];
+
+  for (Bit8u channel=0; channel<BX_MAX_ATA_CHANNEL; channel++) {
+    for (Bit8u device=0; device<2; device ++) {
+      device_image_t *hdimage = BX_HD_THIS channels[channel].drives[device].hdimage;
+      if ((hdimage == NULL) || !BX_DRIVE_IS_HD(channel, device)) continue;
+      sprintf(ata_name, "ata.%d.%s", channel, (device==0)?"master":"slave");
+      bx_list_c *base = (bx_list_c*) SIM->get_param(ata_name);
+      volatile_image_t *overlay = new volatile_image_t(NULL);
+      // only the parent process closes the base image, removing its lock
+      if (overlay->open(hdimage, SIM->get_param_string("path", base)->getptr(), !child) < 0) {
+        BX_PANIC(("ata%d-%d: could not create redolog after fork", channel, device));
+        delete overlay;
+        continue;
+      }
+      BX_HD_THIS channels[channel].drives[device].hdimage = overlay;
+    }
+  }
+}
+
 void bx_hard_drive_c::seek_timer_handler(void *this_ptr)
 {
   bx_hard_drive_c *class_ptr = (bx_hard_drive_c *) this_ptr;
@@ -664,6 +727,9 @@ void bx_hard_drive_c::seek_timer()
   Bit8u device = param & 1;
   controller_t *controller = &BX_CONTROLLER(channel, device);
   if (BX_DRIVE_IS_HD(channel, device)) {
+    // wait for the asynchronous image access to complete
+    if (!ide_aio_complete(channel, device))
+      return;
     switch (controller->current_command) {
       case 0x24: // READ SECTORS EXT
       case 0x29: // READ MULTIPLE EXT
@@ -691,6 +757,12 @@ void bx_hard_drive_c::seek_timer()
         DEV_ide_bmdma_start_transfer(channel);
 #endif
         break;
+#if BX_SUPPORT_PCI
+      case 0x35: // WRITE DMA EXT
+      case 0xCA: // WRITE DMA
+        BX_HD_THIS bmdma_complete(channel);
+        break;
+#endif
       case 0x70: // SEEK
         BX_SELECTED_DRIVE(channel).curr_lsector = BX_SELECTED_DRIVE(channel).next_lsector;
         controller->error_register = 0;
@@ -2076,8 +2148,8 @@ void bx_hard_drive_c::write(Bit32u address, Bit32u value, unsigned io_len)
           controller->status.corrected_data = 0;
           controller->buffer_index = 0;
           start_seek(channel);
-          if (!ide_read_sector(channel, controller->buffer,
-                                  controller->buffer_size)) {
+          if (!ide_transfer_sectors(channel, controller->buffer, controller->buffer_size,
+                                    0, BX_SELECTED_DRIVE(channel).async)) {
             bx_pc_system.deactivate_timer(
               BX_SELECTED_DRIVE(channel).seek_timer_index);
             command_aborted(channel, value);
@@ -2461,6 +2533,10 @@ void bx_hard_drive_c::write(Bit32u address, Bit32u value, unsigned io_len)
             }
             BX_SELECTED_DRIVE(channel).next_lsector = logical_sector;
             controller->current_command = value;
+            if (BX_SELECTED_DRIVE(channel).async &&
+                !ide_aio_prefetch(channel, logical_sector)) {
+              break;
+            }
             controller->error_register = 0;
             controller->status.busy  = 1;
             controller->status.drive_ready = 1;
@@ -3373,12 +3449,20 @@ bool bx_hard_drive_c::bmdma_present(void)
 bool bx_hard_drive_c::bmdma_read_sector(Bit8u channel, Bit8u *buffer, Bit32u *sector_size)
 {
   controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
+  Bit32u count, sect_size;
 
   if ((controller->current_command == 0xC8) ||
       (controller->current_command == 0x25)) {
-    *sector_size = BX_SELECTED_DRIVE(channel).hdimage->sect_size;
     if (controller->num_sectors == 0)
       return 0;
+    // read all sectors requested by the DMA controller at once
+    sect_size = BX_SELECTED_DRIVE(channel).hdimage->sect_size;
+    count = (*sector_size + sect_size - 1) / sect_size;
+    if (count > controller->num_sectors)
+      count = controller->num_sectors;
+    if (count == 0)
+      count = 1;
+    *sector_size = count * sect_size;
     if (!ide_read_sector(channel, buffer, *sector_size)) {
       return 0;
     }
@@ -3388,21 +3472,27 @@ bool bx_hard_drive_c::bmdma_read_sector(Bit8u channel, Bit8u *buffer, Bit32u *se
         case 0x28: // read (10)
         case 0xa8: // read (12)
         case 0xbe: // read cd
-          *sector_size = controller->buffer_size;
+          // read all blocks requested by the DMA controller at once
+          count = (*sector_size + controller->buffer_size - 1) / controller->buffer_size;
+          if ((Bit32s)count > BX_SELECTED_DRIVE(channel).cdrom.remaining_blocks)
+            count = BX_SELECTED_DRIVE(channel).cdrom.remaining_blocks;
+          if (count == 0)
+            count = 1;
+          *sector_size = count * controller->buffer_size;
           if (!BX_SELECTED_DRIVE(channel).cdrom.ready) {
             BX_PANIC(("Read with CDROM not ready"));
             return 0;
           }
           /* set status bar conditions for device */
           bx_gui->statusbar_setitem(BX_SELECTED_DRIVE(channel).statusbar_id, 1);
-          if (!BX_SELECTED_DRIVE(channel).cdrom.cd->read_block(buffer, BX_SELECTED_DRIVE(channel).cdrom.next_lba,
-                                                               controller->buffer_size))
+          if (!BX_SELECTED_DRIVE(channel).cdrom.cd->read_blocks(buffer, BX_SELECTED_DRIVE(channel).cdrom.next_lba,
+                                                                count, controller->buffer_size))
           {
             BX_PANIC(("CDROM: read block %d failed", BX_SELECTED_DRIVE(channel).cdrom.next_lba));
             return 0;
           }
-          BX_SELECTED_DRIVE(channel).cdrom.next_lba++;
-          BX_SELECTED_DRIVE(channel).cdrom.remaining_blocks--;
+          BX_SELECTED_DRIVE(channel).cdrom.next_lba += count;
+          BX_SELECTED_DRIVE(channel).cdrom.remaining_blocks -= count;
           if (!BX_SELECTED_DRIVE(channel).cdrom.remaining_blocks) {
             BX_SELECTED_DRIVE(channel).cdrom.curr_lba = BX_SELECTED_DRIVE(channel).cdrom.next_lba;
           }
@@ -3430,9 +3520,10 @@ bool bx_hard_drive_c::bmdma_read_sector(Bit8u channel, Bit8u *buffer, Bit32u *se
   return 1;
 }
 
-bool bx_hard_drive_c::bmdma_write_sector(Bit8u channel, Bit8u *buffer)
+bool bx_hard_drive_c::bmdma_write_sector(Bit8u channel, Bit8u *buffer, Bit32u *sector_size)
 {
   controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
+  Bit32u count, sect_size;
 
   if ((controller->current_command != 0xCA) &&
       (controller->current_command != 0x35)) {
@@ -3442,7 +3533,15 @@ bool bx_hard_drive_c::bmdma_write_sector(Bit8u channel, Bit8u *buffer)
   }
   if (controller->num_sectors == 0)
     return 0;
-  if (!ide_write_sector(channel, buffer, BX_SELECTED_DRIVE(channel).sect_size)) {
+  // write all complete sectors provided by the DMA controller at once
+  sect_size = BX_SELECTED_DRIVE(channel).sect_size;
+  count = *sector_size / sect_size;
+  if (count > controller->num_sectors)
+    count = controller->num_sectors;
+  if (count == 0)
+    count = 1;
+  *sector_size = count * sect_size;
+  if (!ide_transfer_sectors(channel, buffer, *sector_size, 1, BX_SELECTED_DRIVE(channel).async)) {
     return 0;
   }
   return 1;
@@ -3452,6 +3551,14 @@ void bx_hard_drive_c::bmdma_complete(Bit8u channel)
 {
   controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
 
+  if (BX_SELECTED_DRIVE(channel).aio.state == BX_AIO_PENDING) {
+    // the command completes when the last write is done (see seek_timer)
+    controller->status.busy = 1;
+    controller->status.drq = 0;
+    bx_pc_system.activate_timer(BX_SELECTED_DRIVE(channel).seek_timer_index, AIO_POLL_TIME, 0);
+    return;
+  }
+
   controller->status.busy = 0;
   controller->status.drive_ready = 1;
   controller->status.drq = 0;
@@ -3487,76 +3594,164 @@ void bx_hard_drive_c::set_signature(Bit8u channel, Bit8u id)
 }
 
 bool bx_hard_drive_c::ide_read_sector(Bit8u channel, Bit8u *buffer, Bit32u buffer_size)
+{
+  return ide_transfer_sectors(channel, buffer, buffer_size, 0, 0);
+}
+
+bool bx_hard_drive_c::ide_write_sector(Bit8u channel, Bit8u *buffer, Bit32u buffer_size)
+{
+  return ide_transfer_sectors(channel, buffer, buffer_size, 1, 0);
+}
+
+bool bx_hard_drive_c::ide_transfer_sectors(Bit8u channel, Bit8u *buffer, Bit32u buffer_size, bool write, bool async)
 {
   controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
 
   Bit64s logical_sector = 0;
-  Bit64s ret;
+  Bit64s run_sector = 0;
+  Bit32u run_count = 0;
 
   unsigned sect_size = BX_SELECTED_DRIVE(channel).sect_size;
   int sector_count = (buffer_size / sect_size);
   Bit8u *bufptr = buffer;
+  Bit8u *run_buffer = buffer;
+  // Update the controller registers sector by sector, but transfer each run
+  // of consecutive sectors with a single vectored image access
   do {
     if (!calculate_logical_address(channel, &logical_sector)) {
       command_aborted(channel, controller->current_command);
       return 0;
     }
-    ret = BX_SELECTED_DRIVE(channel).hdimage->lseek(logical_sector * sect_size, SEEK_SET);
-    if (ret < 0) {
-      BX_ERROR(("could not lseek() hard drive image file"));
-      command_aborted(channel, controller->current_command);
-      return 0;
+    if ((run_count > 0) && (logical_sector != (run_sector + run_count))) {
+      if (!ide_transfer_run(channel, run_sector, run_buffer, run_count, write, async)) {
+        return 0;
+      }
+      run_count = 0;
     }
-    /* set status bar conditions for device */
-    bx_gui->statusbar_setitem(BX_SELECTED_DRIVE(channel).statusbar_id, 1);
-    ret = BX_SELECTED_DRIVE(channel).hdimage->read((bx_ptr_t)bufptr, sect_size);
-    if (ret < sect_size) {
-      BX_ERROR(("could not read() hard drive image file at byte %lu", (unsigned long)logical_sector*sect_size));
-      command_aborted(channel, controller->current_command);
-      return 0;
+    if (run_count == 0) {
+      run_sector = logical_sector;
+      run_buffer = bufptr;
     }
+    run_count++;
     increment_address(channel, &logical_sector);
     BX_SELECTED_DRIVE(channel).next_lsector = logical_sector;
     bufptr += sect_size;
   } while (--sector_count > 0);
 
-  return 1;
+  return ide_transfer_run(channel, run_sector, run_buffer, run_count, write, async);
 }
 
-bool bx_hard_drive_c::ide_write_sector(Bit8u channel, Bit8u *buffer, Bit32u buffer_size)
+bool bx_hard_drive_c::ide_transfer_run(Bit8u channel, Bit64s sector, Bit8u *buffer, Bit32u count, bool write, bool async)
 {
   controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
-
-  Bit64s logical_sector = 0;
-  Bit64s ret;
-
   unsigned sect_size = BX_SELECTED_DRIVE(channel).sect_size;
-  int sector_count = (buffer_size / sect_size);
-  Bit8u *bufptr = buffer;
-  do {
-    if (!calculate_logical_address(channel, &logical_sector)) {
-      command_aborted(channel, controller->current_command);
-      return 0;
-    }
-    ret = BX_SELECTED_DRIVE(channel).hdimage->lseek(logical_sector * sect_size, SEEK_SET);
-    if (ret < 0) {
-      BX_ERROR(("could not lseek() hard drive image file at byte %lu", (unsigned long)logical_sector * sect_size));
-      command_aborted(channel, controller->current_command);
-      return 0;
-    }
-    /* set status bar conditions for device */
-    bx_gui->statusbar_setitem(BX_SELECTED_DRIVE(channel).statusbar_id, 1, 1 /* write */);
-    ret = BX_SELECTED_DRIVE(channel).hdimage->write((bx_ptr_t)bufptr, sect_size);
-    if (ret < sect_size) {
-      BX_ERROR(("could not write() hard drive image file at byte %lu", (unsigned long)logical_sector*sect_size));
-      command_aborted(channel, controller->current_command);
-      return 0;
+  bx_iovec_t iov;
+  ssize_t ret;
+
+  iov.iov_base = buffer;
+  iov.iov_len = count * sect_size;
+  // the image is accessed by one request at a time
+  if (!ide_aio_finish(channel, BX_SLAVE_SELECTED(channel))) {
+    return 0;
+  }
+  if (write) {
+    BX_SELECTED_DRIVE(channel).aio_sectors = 0;
+    if (async && (iov.iov_len <= AIO_BUFFER_SIZE)) {
+      memcpy(BX_SELECTED_DRIVE(channel).aio_buffer, buffer, iov.iov_len);
+      ide_aio_submit(channel, sector, BX_SELECTED_DRIVE(channel).aio_buffer, count, 1);
+      return 1;
     }
-    increment_address(channel, &logical_sector);
-    BX_SELECTED_DRIVE(channel).next_lsector = logical_sector;
-    bufptr += sect_size;
-  } while (--sector_count > 0);
+  } else if ((BX_SELECTED_DRIVE(channel).aio_sectors > 0) &&
+             (sector >= BX_SELECTED_DRIVE(channel).aio_sector) &&
+             ((sector + count) <= (BX_SELECTED_DRIVE(channel).aio_sector +
+                                   BX_SELECTED_DRIVE(channel).aio_sectors))) {
+    memcpy(buffer, BX_SELECTED_DRIVE(channel).aio_buffer +
+           (sector - BX_SELECTED_DRIVE(channel).aio_sector) * sect_size, iov.iov_len);
+    return 1;
+  } else if (async) {
+    ide_aio_submit(channel, sector, buffer, count, 0);
+    return 1;
+  }
+  /* set status bar conditions for device */
+  bx_gui->statusbar_setitem(BX_SELECTED_DRIVE(channel).statusbar_id, 1, write);
+  if (!write) {
+    ret = BX_SELECTED_DRIVE(channel).hdimage->readv(sector * sect_size, &iov, 1);
+  } else {
+    ret = BX_SELECTED_DRIVE(channel).hdimage->writev(sector * sect_size, &iov, 1);
+  }
+  if (ret < (ssize_t)iov.iov_len) {
+    BX_ERROR(("could not %s() hard drive image file at byte %lu", write ? "write" : "read",
+              (unsigned long)sector * sect_size));
+    command_aborted(channel, controller->current_command);
+    return 0;
+  }
+  return 1;
+}
 
+void bx_hard_drive_c::ide_aio_submit(Bit8u channel, Bit64s sector, Bit8u *buffer, Bit32u count, bool write)
+{
+  bx_aio_request_t *aio = &BX_SELECTED_DRIVE(channel).aio;
+
+  aio->image = BX_SELECTED_DRIVE(channel).hdimage;
+  aio->offset = sector * BX_SELECTED_DRIVE(channel).sect_size;
+  aio->iov.iov_base = buffer;
+  aio->iov.iov_len = count * BX_SELECTED_DRIVE(channel).sect_size;
+  aio->write = write;
+  /* set status bar conditions for device */
+  bx_gui->statusbar_setitem(BX_SELECTED_DRIVE(channel).statusbar_id, 1, write);
+  bx_hdimage_ctl.aio_submit(aio);
+}
+
+// Wait for the pending request (if any) of the device and check the result
+bool bx_hard_drive_c::ide_aio_finish(Bit8u channel, Bit8u device)
+{
+  controller_t *controller = &BX_CONTROLLER(channel, device);
+  bx_aio_request_t *aio = &BX_DRIVE(channel, device).aio;
+
+  if (aio->state == BX_AIO_IDLE)
+    return 1;
+  bx_hdimage_ctl.aio_wait(aio);
+  aio->state = BX_AIO_IDLE;
+  if (aio->ret < (ssize_t)aio->iov.iov_len) {
+    BX_ERROR(("could not %s() hard drive image file at byte " FMT_LL "d",
+              aio->write ? "write" : "read", aio->offset));
+    BX_DRIVE(channel, device).aio_sectors = 0;
+    command_aborted(channel, controller->current_command);
+    return 0;
+  }
+  return 1;
+}
+
+// Called from the seek timer: returns 0 if the command cannot continue yet
+bool bx_hard_drive_c::ide_aio_complete(Bit8u channel, Bit8u device)
+{
+  bx_aio_request_t *aio = &BX_DRIVE(channel, device).aio;
+
+  if ((aio->state == BX_AIO_PENDING) && !bx_hdimage_ctl.aio_done(aio)) {
+    bx_pc_system.activate_timer(BX_DRIVE(channel, device).seek_timer_index, AIO_POLL_TIME, 0);
+    return 0;
+  }
+  return ide_aio_finish(channel, device);
+}
+
+// Start reading all sectors of a DMA transfer while the seek is emulated
+bool bx_hard_drive_c::ide_aio_prefetch(Bit8u channel, Bit64s sector)
+{
+  controller_t *controller = &BX_SELECTED_CONTROLLER(channel);
+  Bit32u count = controller->num_sectors;
+  Bit64s max_sector = BX_SELECTED_DRIVE(channel).hdimage->hd_size / BX_SELECTED_DRIVE(channel).sect_size;
+
+  if (!ide_aio_finish(channel, BX_SLAVE_SELECTED(channel)))
+    return 0;
+  BX_SELECTED_DRIVE(channel).aio_sectors = 0;
+  // CHS addressing may wrap at the end of the disk
+  if (!controller->lba_mode || ((sector + count) > max_sector) ||
+      ((count * BX_SELECTED_DRIVE(channel).sect_size) > AIO_BUFFER_SIZE)) {
+    return 1;
+  }
+  BX_SELECTED_DRIVE(channel).aio_sector = sector;
+  BX_SELECTED_DRIVE(channel).aio_sectors = count;
+  ide_aio_submit(channel, sector, BX_SELECTED_DRIVE(channel).aio_buffer, count, 0);
   return 1;
 }
 
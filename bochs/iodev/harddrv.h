@@ -23,6 +23,10 @@
 
 #define MAX_MULTIPLE_SECTORS 16
 
+// transfer buffer size and poll interval (usec) for asynchronous image access
+#define AIO_BUFFER_SIZE (1 << 20)
+#define AIO_POLL_TIME   50
+
 typedef enum _sense {
       SENSE_NONE = 0, SENSE_NOT_READY = 2, SENSE_ILLEGAL_REQUEST = 5,
       SENSE_UNIT_ATTENTION = 6
@@ -171,10 +175,12 @@ public:
   virtual void     reset(unsigned type);
 #if BX_SUPPORT_PCI
   virtual bool     bmdma_read_sector(Bit8u channel, Bit8u *buffer, Bit32u *sector_size);
-  virtual bool     bmdma_write_sector(Bit8u channel, Bit8u *buffer);
+  virtual bool     bmdma_write_sector(Bit8u channel, Bit8u *buffer, Bit32u *sector_size);
   virtual void     bmdma_complete(Bit8u channel);
 #endif
   virtual void     register_state(void);
+  virtual void     after_restore_state(void);
+  virtual void     after_fork(bool child);
 
   virtual Bit32u virt_read_handler(Bit32u address, unsigned io_len)
   {
@@ -217,6 +223,12 @@ private:
   BX_HD_SMF void set_signature(Bit8u channel, Bit8u id);
   BX_HD_SMF bool ide_read_sector(Bit8u channel, Bit8u *buffer, Bit32u buffer_size);
   BX_HD_SMF bool ide_write_sector(Bit8u channel, Bit8u *buffer, Bit32u buffer_size);
+  BX_HD_SMF bool ide_transfer_sectors(Bit8u channel, Bit8u *buffer, Bit32u buffer_size, bool write, bool async);
+  BX_HD_SMF bool ide_transfer_run(Bit8u channel, Bit64s sector, Bit8u *buffer, Bit32u count, bool write, bool async);
+  BX_HD_SMF void ide_aio_submit(Bit8u channel, Bit64s sector, Bit8u *buffer, Bit32u count, bool write);
+  BX_HD_SMF bool ide_aio_finish(Bit8u channel, Bit8u device);
+  BX_HD_SMF bool ide_aio_complete(Bit8u channel, Bit8u device);
+  BX_HD_SMF bool ide_aio_prefetch(Bit8u channel, Bit64s sector);
   BX_HD_SMF void lba48_transform(controller_t *controller, bool lba48);
   BX_HD_SMF void start_seek(Bit8u channel);
 
@@ -254,6 +266,13 @@ private:
       Bit8u device_num; // for ATAPI identify & inquiry
       bool status_changed;
       int seek_timer_index;
+
+      // asynchronous image access
+      bool async;
+      bx_aio_request_t aio;
+      Bit8u *aio_buffer;
+      Bit64s aio_sector;  // first sector read ahead into aio_buffer
+      Bit32u aio_sectors; // number of sectors read ahead
     } drives[2];
     unsigned drive_select;
 
@@ -23,6 +23,7 @@
 
 #include "bochs.h"
 #include "cdrom.h"
+#include "hdimage.h"
 
 #include <stdio.h>
 
@@ -46,10 +47,14 @@ cdrom_base_c::cdrom_base_c(const char *dev)
     path = strdup(dev);
   }
   using_file = 0;
+  cache = NULL;
+  cache_frames = 0;
 }
 
 cdrom_base_c::~cdrom_base_c(void)
 {
+  if (cache != NULL)
+    delete cache;
   if (fd >= 0)
     close(fd);
   if (path)
@@ -65,6 +70,10 @@ bool cdrom_base_c::insert_cdrom(const char *dev)
   // Load CD-ROM. Returns 0 if CD is not ready.
   if (dev != NULL) path = strdup(dev);
   BX_INFO(("load cdrom with path='%s'", path));
+  if (cache != NULL) {
+    delete cache;
+    cache = NULL;
+  }
 
   // all platforms except win32
   fd = open(path, O_RDONLY
@@ -85,6 +94,9 @@ bool cdrom_base_c::insert_cdrom(const char *dev)
   if (S_ISREG(stat_buf.st_mode)) {
     using_file = 1;
     BX_INFO(("Opening image file as a cd."));
+    cache = new hdimage_cache_c(fd, CDROM_CACHE_BLOCK_SIZE, CDROM_CACHE_BLOCKS,
+                                CDROM_READAHEAD_BLOCKS);
+    cache_frames = (Bit32u)(stat_buf.st_size / BX_CD_FRAMESIZE);
   } else {
     using_file = 0;
     BX_INFO(("Using direct access for cdrom."));
@@ -99,6 +111,10 @@ void cdrom_base_c::eject_cdrom()
   // Logically eject the CD.  I suppose we could stick in
   // some ioctl() calls to really eject the CD as well.
 
+  if (cache != NULL) {
+    delete cache;
+    cache = NULL;
+  }
   if (fd >= 0) {
     close(fd);
     fd = -1;
@@ -252,6 +268,9 @@ bool BX_CPP_AttrRegparmN(3) cdrom_base_c::read_block(Bit8u* buf, Bit32u lba, int
   } else {
     buf1 = buf;
   }
+  if (cache != NULL) {
+    return read_blocks(buf1, lba, 1, BX_CD_FRAMESIZE);
+  }
   do {
     pos = lseek(fd, (off_t) lba * BX_CD_FRAMESIZE, SEEK_SET);
     if (pos < 0) {
@@ -264,6 +283,42 @@ bool BX_CPP_AttrRegparmN(3) cdrom_base_c::read_block(Bit8u* buf, Bit32u lba, int
   return (n == BX_CD_FRAMESIZE);
 }
 
+bool cdrom_base_c::read_blocks(Bit8u* buf, Bit32u lba, int count, int blocksize)
+{
+  // Read consecutive blocks from the CD. The data of image files is copied
+  // from the cache in runs of blocks.
+
+  Bit64s offset;
+  Bit32u pos;
+  Bit8u *data;
+  int n;
+
+  if ((cache == NULL) || (blocksize != BX_CD_FRAMESIZE)) {
+    for (n = 0; n < count; n++) {
+      if (!read_block(buf + n * blocksize, lba + n, blocksize))
+        return 0;
+    }
+    return 1;
+  }
+  while (count > 0) {
+    if (lba >= cache_frames)
+      return 0;
+    offset = (Bit64s)lba * BX_CD_FRAMESIZE;
+    pos = (Bit32u)(offset & (CDROM_CACHE_BLOCK_SIZE - 1));
+    n = (CDROM_CACHE_BLOCK_SIZE - pos) / BX_CD_FRAMESIZE;
+    if (n > count) n = count;
+    if ((Bit32u)n > (cache_frames - lba)) n = cache_frames - lba;
+    data = cache->get(offset - pos, 0);
+    if (data == NULL)
+      return 0;
+    memcpy(buf, data + pos, n * BX_CD_FRAMESIZE);
+    buf += n * BX_CD_FRAMESIZE;
+    lba += n;
+    count -= n;
+  }
+  return 1;
+}
+
 Bit32u cdrom_base_c::capacity()
 {
   // Return CD-ROM capacity.  I believe you want to return
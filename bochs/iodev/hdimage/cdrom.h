@@ -23,10 +23,17 @@
 
 extern unsigned int bx_cdrom_count;
 
+// CD-ROM image files are read through a block cache. A miss on the block
+// following the previous miss reads the next blocks of the image too.
+#define CDROM_CACHE_BLOCK_SIZE (64 * 1024)
+#define CDROM_CACHE_BLOCKS     128
+#define CDROM_READAHEAD_BLOCKS 32
+
+class hdimage_cache_c;
 
 class cdrom_base_c : public logfunctions {
 public:
-  cdrom_base_c() {}
+  cdrom_base_c() {cache = NULL;}
   cdrom_base_c(const char *dev);
   virtual ~cdrom_base_c(void);
 
@@ -45,6 +52,9 @@ public:
   // Read a single block from the CD. Returns 0 on failure.
   virtual bool read_block(Bit8u* buf, Bit32u lba, int blocksize) BX_CPP_AttrRegparmN(3);
 
+  // Read consecutive blocks from the CD. Returns 0 on failure.
+  virtual bool read_blocks(Bit8u* buf, Bit32u lba, int count, int blocksize);
+
   // Start (spin up) the CD.
   virtual bool start_cdrom();
 
@@ -55,4 +65,6 @@ protected:
   int fd;
   char *path;
   bool using_file;
+  hdimage_cache_c *cache;
+  Bit32u cache_frames;
 };
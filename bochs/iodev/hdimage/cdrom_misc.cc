@@ -141,9 +141,8 @@ void cdrom_misc_c::eject_cdrom()
       ioctl (fd, CDROMEJECT, NULL);
 #endif
     }
-    close(fd);
-    fd = -1;
   }
+  cdrom_base_c::eject_cdrom();
 }
 
 bool cdrom_misc_c::read_toc(Bit8u* buf, int* length, bool msf, int start_track, int format)
@@ -0,0 +1,816 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// Compressed read-only disk image with a cache of decompressed chunks
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#ifdef BXIMAGE
+#include "config.h"
+#include "misc/bxcompat.h"
+#include "osdep.h"
+#include "misc/bswap.h"
+#else
+#include "bochs.h"
+#include "plugin.h"
+#endif
+#include "hdimage.h"
+#include "compressed.h"
+
+#define LOG_THIS bx_hdimage_ctl.
+
+#ifndef BXIMAGE
+
+// disk image plugin entry point
+
+PLUGIN_ENTRY_FOR_IMG_MODULE(compressed)
+{
+  if (mode == PLUGIN_PROBE) {
+    return (int)PLUGTYPE_IMG;
+  }
+  return 0; // Success
+}
+
+#endif
+
+//
+// Define the static class that registers the derived device image class,
+// and allocates one on request.
+//
+class bx_compressed_locator_c : public hdimage_locator_c {
+public:
+  bx_compressed_locator_c(void) : hdimage_locator_c("compressed") {}
+protected:
+  device_image_t *allocate(Bit64u disk_size, const char *journal) {
+    return (new compressed_image_t());
+  }
+  int check_format(int fd, Bit64u disk_size) {
+    return (compressed_image_t::check_format(fd, disk_size));
+  }
+} bx_compressed_match;
+
+// LZ4 block format
+// Each sequence consists of a token (literal length / match length - 4),
+// the literals, the 16-bit match offset and the match. Lengths of 15 and
+// more continue in the following bytes. The last sequence only contains
+// literals. The compressor is a simple greedy one using a hash table.
+
+#define LZ4_HASH_LOG    12
+#define LZ4_MIN_MATCH   4
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MF_LIMIT    12
+#define LZ4_MAX_OFFSET  65535
+
+#ifdef BXIMAGE
+// only bximage compresses images
+static inline Bit32u lz4_read32(const Bit8u *p)
+{
+  Bit32u val;
+  memcpy(&val, p, 4);
+  return val;
+}
+
+static inline Bit32u lz4_hash(Bit32u val)
+{
+  return (val * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+static Bit8u* lz4_put_length(Bit8u *op, Bit32u len)
+{
+  while (len >= 255) {
+    *op++ = 255;
+    len -= 255;
+  }
+  *op++ = (Bit8u)len;
+  return op;
+}
+
+// Returns the compressed size or 0 if it does not fit into 'dst_size'
+static int lz4_compress(const Bit8u *src, int src_size, Bit8u *dst, int dst_size)
+{
+  Bit32u table[1 << LZ4_HASH_LOG];
+  const Bit8u *ip = src, *anchor = src, *ref;
+  const Bit8u *iend = src + src_size;
+  const Bit8u *mflimit = iend - LZ4_MF_LIMIT;
+  const Bit8u *matchlimit = iend - LZ4_LAST_LITERALS;
+  Bit8u *op = dst, *oend = dst + dst_size, *token;
+  Bit32u litlen, matchlen, h;
+
+  memset(table, 0, sizeof(table));
+  if (src_size > LZ4_MF_LIMIT) {
+    while (ip < mflimit) {
+      h = lz4_hash(lz4_read32(ip));
+      ref = src + table[h];
+      table[h] = (Bit32u)(ip - src);
+      if ((ref >= ip) || ((ip - ref) > LZ4_MAX_OFFSET) ||
+          (lz4_read32(ref) != lz4_read32(ip))) {
+        // skip faster over data that does not compress
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+      while ((ip > anchor) && (ref > src) && (ip[-1] == ref[-1])) {
+        ip--;
+        ref--;
+      }
+      const Bit8u *mp = ip + LZ4_MIN_MATCH, *rp = ref + LZ4_MIN_MATCH;
+      while ((mp < matchlimit) && (*mp == *rp)) {
+        mp++;
+        rp++;
+      }
+      litlen = (Bit32u)(ip - anchor);
+      matchlen = (Bit32u)(mp - ip) - LZ4_MIN_MATCH;
+      if ((op + 1 + (litlen / 255) + 1 + litlen + 2 + (matchlen / 255) + 1) > oend)
+        return 0;
+      token = op++;
+      if (litlen >= 15) {
+        *token = 15 << 4;
+        op = lz4_put_length(op, litlen - 15);
+      } else {
+        *token = (Bit8u)(litlen << 4);
+      }
+      memcpy(op, anchor, litlen);
+      op += litlen;
+      *op++ = (Bit8u)(ip - ref);
+      *op++ = (Bit8u)((ip - ref) >> 8);
+      if (matchlen >= 15) {
+        *token |= 15;
+        op = lz4_put_length(op, matchlen - 15);
+      } else {
+        *token |= (Bit8u)matchlen;
+      }
+      ip = anchor = mp;
+    }
+  }
+  litlen = (Bit32u)(iend - anchor);
+  if ((op + 1 + (litlen / 255) + 1 + litlen) > oend)
+    return 0;
+  token = op++;
+  if (litlen >= 15) {
+    *token = 15 << 4;
+    op = lz4_put_length(op, litlen - 15);
+  } else {
+    *token = (Bit8u)(litlen << 4);
+  }
+  memcpy(op, anchor, litlen);
+  op += litlen;
+  return (int)(op - dst);
+}
+#endif
+
+// Returns the decompressed size or -1 if the data is corrupted
+static int lz4_decompress(const Bit8u *src, int src_size, Bit8u *dst, int dst_size)
+{
+  const Bit8u *ip = src, *iend = src + src_size;
+  Bit8u *op = dst, *oend = dst + dst_size;
+  Bit32u len, offset;
+  Bit8u token, b;
+
+  while (ip < iend) {
+    token = *ip++;
+    len = token >> 4;
+    if (len == 15) {
+      do {
+        if (ip >= iend) return -1;
+        b = *ip++;
+        len += b;
+      } while (b == 255);
+    }
+    if ((len > (Bit32u)(iend - ip)) || (len > (Bit32u)(oend - op)))
+      return -1;
+    memcpy(op, ip, len);
+    op += len;
+    ip += len;
+    if (ip >= iend)
+      break;
+    if ((iend - ip) < 2)
+      return -1;
+    offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if ((offset == 0) || (offset > (Bit32u)(op - dst)))
+      return -1;
+    len = token & 15;
+    if (len == 15) {
+      do {
+        if (ip >= iend) return -1;
+        b = *ip++;
+        len += b;
+      } while (b == 255);
+    }
+    len += LZ4_MIN_MATCH;
+    if (len > (Bit32u)(oend - op))
+      return -1;
+    if (offset >= len) {
+      memcpy(op, op - offset, len);
+      op += len;
+    } else {
+      // overlapping match repeats the last 'offset' bytes
+      for (Bit32u i = 0; i < len; i++, op++) {
+        *op = op[-(int)offset];
+      }
+    }
+  }
+  return (int)(op - dst);
+}
+
+static int compressed_check_header(int fd, compressed_header_t *header)
+{
+  if (bx_read_image(fd, 0, header, sizeof(compressed_header_t)) != STANDARD_HEADER_SIZE) {
+    return HDIMAGE_READ_ERROR;
+  }
+  if (strcmp((char*)header->standard.magic, STANDARD_HEADER_MAGIC) != 0) {
+    return HDIMAGE_NO_SIGNATURE;
+  }
+  if ((strcmp((char*)header->standard.type, COMPRESSED_TYPE) != 0) ||
+      (strcmp((char*)header->standard.subtype, COMPRESSED_SUBTYPE_LZ4) != 0)) {
+    return HDIMAGE_TYPE_ERROR;
+  }
+  if (dtoh32(header->standard.version) != STANDARD_HEADER_VERSION) {
+    return HDIMAGE_VERSION_ERROR;
+  }
+  return HDIMAGE_FORMAT_OK;
+}
+
+#ifndef BXIMAGE
+BX_THREAD_FUNC(compressed_prefetch_thread, indata)
+{
+  ((compressed_image_t*)indata)->prefetch_worker();
+  BX_THREAD_EXIT;
+}
+#endif
+
+compressed_image_t::compressed_image_t()
+  : fd(-1),
+  pathname(NULL),
+  chunk_size(0),
+  chunks(0),
+  index(NULL),
+  current_offset(0),
+  lru_counter(0),
+  read_buf(NULL),
+  comp_buf(NULL),
+  last_chunk(0)
+{
+  if (sizeof(compressed_header_t) != STANDARD_HEADER_SIZE) {
+    BX_FATAL(("system error: invalid header structure size"));
+  }
+  for (int i = 0; i < COMPRESSED_CACHE_ENTRIES; i++) {
+    cache[i].data = NULL;
+  }
+  BX_INIT_MUTEX(mutex);
+#ifndef BXIMAGE
+  prefetch_running = 0;
+#else
+  writable = 0;
+  write_buf = NULL;
+#endif
+}
+
+compressed_image_t::~compressed_image_t()
+{
+  close();
+  BX_FINI_MUTEX(mutex);
+}
+
+int compressed_image_t::check_format(int fd, Bit64u imgsize)
+{
+  compressed_header_t temp_header;
+
+  return compressed_check_header(fd, &temp_header);
+}
+
+int compressed_image_t::open(const char* _pathname, int flags)
+{
+  Bit64u imgsize = 0;
+  Bit64u index_offset;
+  int ret;
+
+  pathname = _pathname;
+  close();
+
+  if ((fd = hdimage_open_file(pathname, flags, &imgsize, &mtime)) < 0) {
+    BX_ERROR(("compressed: cannot open image file '%s'", pathname));
+    return -1;
+  }
+  if ((ret = compressed_check_header(fd, &header)) != HDIMAGE_FORMAT_OK) {
+    switch (ret) {
+      case HDIMAGE_READ_ERROR:
+        BX_ERROR(("compressed: cannot read header of '%s'", pathname));
+        break;
+      case HDIMAGE_NO_SIGNATURE:
+      case HDIMAGE_TYPE_ERROR:
+        BX_ERROR(("compressed: '%s' is not a compressed image", pathname));
+        break;
+      case HDIMAGE_VERSION_ERROR:
+        BX_ERROR(("compressed: unsupported version of '%s'", pathname));
+        break;
+    }
+    close();
+    return -1;
+  }
+
+  chunk_size = dtoh32(header.specific.chunk);
+  chunks = dtoh32(header.specific.chunks);
+  hd_size = dtoh64(header.specific.disk);
+  index_offset = dtoh64(header.specific.index);
+  if ((chunk_size == 0) || ((chunk_size % 512) != 0) ||
+      (((Bit64u)chunks * chunk_size) < hd_size) ||
+      ((index_offset + (chunks + 1) * sizeof(Bit64u)) > imgsize)) {
+    BX_ERROR(("compressed: invalid header of '%s'", pathname));
+    close();
+    return -1;
+  }
+
+  index = new Bit64u[chunks + 1];
+  if (bx_read_image(fd, (Bit64s)index_offset, index, (chunks + 1) * sizeof(Bit64u)) !=
+      (int)((chunks + 1) * sizeof(Bit64u))) {
+    BX_ERROR(("compressed: cannot read index of '%s'", pathname));
+    close();
+    return -1;
+  }
+  for (Bit32u i = 0; i <= chunks; i++) {
+    index[i] = dtoh64(index[i]);
+    if ((index[i] < STANDARD_HEADER_SIZE) || (index[i] > index_offset) ||
+        ((i > 0) && ((index[i] < index[i - 1]) || ((index[i] - index[i - 1]) > chunk_size)))) {
+      BX_ERROR(("compressed: invalid index of '%s'", pathname));
+      close();
+      return -1;
+    }
+  }
+
+  for (int i = 0; i < COMPRESSED_CACHE_ENTRIES; i++) {
+    cache[i].chunk = chunks;
+    cache[i].lru = 0;
+    cache[i].data = new Bit8u[chunk_size];
+  }
+  lru_counter = 0;
+  read_buf = new Bit8u[chunk_size];
+  comp_buf = new Bit8u[chunk_size];
+  last_chunk = chunks;
+  current_offset = 0;
+#ifndef BXIMAGE
+  queue_head = 0;
+  queue_count = 0;
+  prefetch_next = 0;
+#else
+  // only a new image can be written
+  writable = ((flags & O_ACCMODE) != O_RDONLY) && (index_offset == STANDARD_HEADER_SIZE);
+  if (writable) {
+    write_buf = new Bit8u[chunk_size];
+    memset(write_buf, 0, chunk_size);
+    write_chunk = 0;
+    data_end = STANDARD_HEADER_SIZE;
+  }
+#endif
+
+  BX_INFO(("'compressed' disk image opened: path is '%s', %u chunks of %u KB",
+           pathname, chunks, chunk_size >> 10));
+  return fd;
+}
+
+void compressed_image_t::close()
+{
+#ifndef BXIMAGE
+  stop_threads();
+#else
+  if (writable) {
+    if (!finish_image()) {
+      BX_ERROR(("compressed: failed to complete image '%s'", pathname));
+    }
+    writable = 0;
+  }
+  if (write_buf != NULL) {
+    delete [] write_buf;
+    write_buf = NULL;
+  }
+#endif
+  if (fd > -1) {
+    bx_close_image(fd, pathname);
+    fd = -1;
+  }
+  if (index != NULL) {
+    delete [] index;
+    index = NULL;
+  }
+  for (int i = 0; i < COMPRESSED_CACHE_ENTRIES; i++) {
+    if (cache[i].data != NULL) {
+      delete [] cache[i].data;
+      cache[i].data = NULL;
+    }
+  }
+  if (read_buf != NULL) {
+    delete [] read_buf;
+    read_buf = NULL;
+  }
+  if (comp_buf != NULL) {
+    delete [] comp_buf;
+    comp_buf = NULL;
+  }
+}
+
+// Read and decompress a chunk using the file descriptor and the buffer of
+// the calling thread
+bool compressed_image_t::load_chunk(int file, Bit32u chunk, Bit8u *data, Bit8u *buffer)
+{
+  Bit32u len = (Bit32u)(index[chunk + 1] - index[chunk]);
+
+  if (len == 0) {
+    memset(data, 0, chunk_size);
+  } else if (len == chunk_size) {
+    if (bx_read_image(file, (Bit64s)index[chunk], data, len) != (int)len)
+      return 0;
+  } else {
+    if (bx_read_image(file, (Bit64s)index[chunk], buffer, len) != (int)len)
+      return 0;
+    if (lz4_decompress(buffer, len, data, chunk_size) != (int)chunk_size) {
+      BX_ERROR(("compressed: chunk %u of '%s' is corrupted", chunk, pathname));
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// Returns the cache entry of the chunk or -1 (mutex must be held)
+int compressed_image_t::find_chunk(Bit32u chunk)
+{
+  for (int i = 0; i < COMPRESSED_CACHE_ENTRIES; i++) {
+    if (cache[i].chunk == chunk) {
+      cache[i].lru = ++lru_counter;
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Replace the least recently used entry with the decompressed chunk. The
+// buffers are swapped, the caller gets the buffer of the evicted entry.
+void compressed_image_t::insert_chunk(Bit32u chunk, Bit8u **data)
+{
+  int victim = 0;
+  Bit8u *old;
+
+  for (int i = 1; i < COMPRESSED_CACHE_ENTRIES; i++) {
+    if ((Bit32u)(lru_counter - cache[i].lru) > (Bit32u)(lru_counter - cache[victim].lru)) {
+      victim = i;
+    }
+  }
+  old = cache[victim].data;
+  cache[victim].data = *data;
+  cache[victim].chunk = chunk;
+  cache[victim].lru = ++lru_counter;
+  *data = old;
+}
+
+ssize_t compressed_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  ssize_t total = 0;
+
+  if (lseek(offset, SEEK_SET) < 0)
+    return -1;
+  for (int i = 0; i < iovcnt; i++) {
+    if (read(iov[i].iov_base, iov[i].iov_len) != (ssize_t)iov[i].iov_len)
+      return -1;
+    total += iov[i].iov_len;
+  }
+  return total;
+}
+
+ssize_t compressed_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  ssize_t total = 0;
+
+  if (lseek(offset, SEEK_SET) < 0)
+    return -1;
+  for (int i = 0; i < iovcnt; i++) {
+    if (write(iov[i].iov_base, iov[i].iov_len) != (ssize_t)iov[i].iov_len)
+      return -1;
+    total += iov[i].iov_len;
+  }
+  return total;
+}
+
+Bit64s compressed_image_t::lseek(Bit64s offset, int whence)
+{
+  if (whence == SEEK_SET) {
+    current_offset = offset;
+  } else if (whence == SEEK_CUR) {
+    current_offset += offset;
+  } else {
+    BX_ERROR(("compressed: lseek mode not supported"));
+    return -1;
+  }
+  if ((current_offset < 0) || ((Bit64u)current_offset > hd_size))
+    return -1;
+  return current_offset;
+}
+
+ssize_t compressed_image_t::read(void* buf, size_t count)
+{
+  Bit8u *cbuf = (Bit8u*)buf;
+  ssize_t total = 0;
+  int e;
+
+  if ((Bit64u)current_offset + count > hd_size)
+    return -1;
+  while (count > 0) {
+    Bit32u i = (Bit32u)(current_offset / chunk_size);
+    Bit32u offset = (Bit32u)(current_offset % chunk_size);
+    Bit32u len = chunk_size - offset;
+    if (len > count) len = (Bit32u)count;
+
+#ifdef BXIMAGE
+    // data written but not compressed yet
+    if (writable && (i >= write_chunk)) {
+      if (i == write_chunk) {
+        memcpy(cbuf, write_buf + offset, len);
+      } else {
+        memset(cbuf, 0, len);
+      }
+    } else
+#endif
+    {
+      BX_LOCK(mutex);
+      if ((e = find_chunk(i)) >= 0) {
+        memcpy(cbuf, cache[e].data + offset, len);
+        BX_UNLOCK(mutex);
+      } else {
+        BX_UNLOCK(mutex);
+        if (!load_chunk(fd, i, read_buf, comp_buf)) {
+          BX_ERROR(("compressed: cannot read chunk %u of '%s'", i, pathname));
+          return -1;
+        }
+        memcpy(cbuf, read_buf + offset, len);
+        BX_LOCK(mutex);
+        if (find_chunk(i) < 0) {
+          insert_chunk(i, &read_buf);
+        }
+        BX_UNLOCK(mutex);
+      }
+    }
+#ifndef BXIMAGE
+    if (i != last_chunk) {
+      prefetch(i);
+    }
+#endif
+    last_chunk = i;
+    current_offset += len;
+    cbuf += len;
+    count -= len;
+    total += len;
+  }
+  return total;
+}
+
+#ifndef BXIMAGE
+ssize_t compressed_image_t::write(const void* buf, size_t count)
+{
+  BX_ERROR(("compressed: image '%s' is read-only, use it as base of a 'volatile' or 'undoable' disk", pathname));
+  return -1;
+}
+
+// Queue the chunks following a sequential read for decompression by the
+// prefetch threads
+void compressed_image_t::prefetch(Bit32u chunk)
+{
+#if COMPRESSED_PREFETCH
+  Bit32u i, last;
+
+  if (chunk != (last_chunk + 1)) {
+    prefetch_next = 0;
+    return;
+  }
+  if (!prefetch_running) {
+    bx_create_sem(&prefetch_sem);
+    prefetch_running = 1;
+    for (i = 0; i < COMPRESSED_PREFETCH_THREADS; i++) {
+      BX_THREAD_CREATE(compressed_prefetch_thread, this, prefetch_threads[i]);
+    }
+    bx_hdimage_ctl.add_thread_image(this);
+  }
+  i = chunk + 1;
+  if (i < prefetch_next) i = prefetch_next;
+  last = chunk + COMPRESSED_PREFETCH_DEPTH + 1;
+  if (last > chunks) last = chunks;
+  BX_LOCK(mutex);
+  for (; (i < last) && (queue_count < COMPRESSED_PREFETCH_DEPTH); i++) {
+    if (find_chunk(i) < 0) {
+      prefetch_queue[(queue_head + queue_count) % COMPRESSED_PREFETCH_DEPTH] = i;
+      queue_count++;
+    }
+  }
+  BX_UNLOCK(mutex);
+  prefetch_next = i;
+  bx_set_sem(&prefetch_sem);
+#endif
+}
+
+// The queued chunks are kept, prefetch() starts the threads again
+void compressed_image_t::stop_threads()
+{
+  if (prefetch_running) {
+    prefetch_running = 0;
+    for (int i = 0; i < COMPRESSED_PREFETCH_THREADS; i++) {
+      bx_set_sem(&prefetch_sem);
+    }
+    for (int i = 0; i < COMPRESSED_PREFETCH_THREADS; i++) {
+      BX_THREAD_JOIN(prefetch_threads[i]);
+    }
+    bx_destroy_sem(&prefetch_sem);
+    bx_hdimage_ctl.remove_thread_image(this);
+  }
+}
+
+void compressed_image_t::prefetch_worker()
+{
+  Bit8u *data = new Bit8u[chunk_size];
+  Bit8u *buffer = new Bit8u[chunk_size];
+  Bit32u chunk = 0;
+  bool found;
+  int flags = O_RDONLY;
+
+#ifdef O_BINARY
+  flags |= O_BINARY;
+#endif
+  // the file offset of the image file belongs to the reading thread
+  int file = ::open(pathname, flags);
+
+  while (prefetch_running) {
+    bx_wait_sem(&prefetch_sem);
+    // process all queued chunks, the semaphore may not count them all
+    do {
+      BX_LOCK(mutex);
+      found = (queue_count > 0);
+      if (found) {
+        chunk = prefetch_queue[queue_head];
+        queue_head = (queue_head + 1) % COMPRESSED_PREFETCH_DEPTH;
+        queue_count--;
+      }
+      BX_UNLOCK(mutex);
+      if (found && (file >= 0) && load_chunk(file, chunk, data, buffer)) {
+        BX_LOCK(mutex);
+        if (find_chunk(chunk) < 0) {
+          insert_chunk(chunk, &data);
+        }
+        BX_UNLOCK(mutex);
+      }
+    } while (found && prefetch_running);
+  }
+  if (file >= 0) {
+    ::close(file);
+  }
+  delete [] data;
+  delete [] buffer;
+}
+
+bool compressed_image_t::save_state(const char *backup_fname)
+{
+  // the image is never modified
+  return 1;
+}
+
+void compressed_image_t::restore_state(const char *backup_fname)
+{
+}
+#else
+// Compress the chunk being written and append it to the image
+bool compressed_image_t::flush_chunk()
+{
+  int len;
+
+  index[write_chunk] = data_end;
+  for (len = 0; len < (int)chunk_size; len++) {
+    if (write_buf[len] != 0) break;
+  }
+  if (len < (int)chunk_size) {
+    len = lz4_compress(write_buf, chunk_size, comp_buf, chunk_size - 1);
+    if (len > 0) {
+      if (bx_write_image(fd, (Bit64s)data_end, comp_buf, len) != len)
+        return 0;
+    } else {
+      len = chunk_size;
+      if (bx_write_image(fd, (Bit64s)data_end, write_buf, len) != len)
+        return 0;
+    }
+    data_end += len;
+  }
+  memset(write_buf, 0, chunk_size);
+  write_chunk++;
+  index[write_chunk] = data_end;
+  return 1;
+}
+
+// Compress the remaining chunks and write the index after the data
+bool compressed_image_t::finish_image()
+{
+  while (write_chunk < chunks) {
+    if (!flush_chunk())
+      return 0;
+  }
+  header.specific.index = htod64(data_end);
+  for (Bit32u i = 0; i <= chunks; i++) {
+    index[i] = htod64(index[i]);
+  }
+  if ((bx_write_image(fd, (Bit64s)data_end, index, (chunks + 1) * sizeof(Bit64u)) !=
+       (int)((chunks + 1) * sizeof(Bit64u))) ||
+      (bx_write_image(fd, 0, &header, STANDARD_HEADER_SIZE) != STANDARD_HEADER_SIZE)) {
+    return 0;
+  }
+  return 1;
+}
+
+ssize_t compressed_image_t::write(const void* buf, size_t count)
+{
+  const Bit8u *cbuf = (const Bit8u*)buf;
+  ssize_t total = 0;
+
+  if (!writable) {
+    BX_ERROR(("compressed: image '%s' is read-only", pathname));
+    return -1;
+  }
+  if ((Bit64u)current_offset + count > hd_size)
+    return -1;
+  while (count > 0) {
+    Bit32u i = (Bit32u)(current_offset / chunk_size);
+    Bit32u offset = (Bit32u)(current_offset % chunk_size);
+    Bit32u len = chunk_size - offset;
+    if (len > count) len = (Bit32u)count;
+
+    if (i < write_chunk) {
+      BX_ERROR(("compressed: image '%s' can only be written sequentially", pathname));
+      return -1;
+    }
+    // skipped chunks contain zeros
+    while (write_chunk < i) {
+      if (!flush_chunk())
+        return -1;
+    }
+    memcpy(write_buf + offset, cbuf, len);
+    current_offset += len;
+    cbuf += len;
+    count -= len;
+    total += len;
+  }
+  return total;
+}
+
+int compressed_image_t::create_image(const char *pathname, Bit64u size)
+{
+  compressed_header_t temp_header;
+  Bit32u chunks;
+  Bit64u entries[512];
+  Bit64s offset;
+
+  chunks = (Bit32u)((size + COMPRESSED_CHUNK_SIZE - 1) / COMPRESSED_CHUNK_SIZE);
+  memset(&temp_header, 0, sizeof(temp_header));
+  strcpy((char*)temp_header.standard.magic, STANDARD_HEADER_MAGIC);
+  strcpy((char*)temp_header.standard.type, COMPRESSED_TYPE);
+  strcpy((char*)temp_header.standard.subtype, COMPRESSED_SUBTYPE_LZ4);
+  temp_header.standard.version = htod32(STANDARD_HEADER_VERSION);
+  temp_header.standard.header = htod32(STANDARD_HEADER_SIZE);
+  temp_header.specific.chunks = htod32(chunks);
+  temp_header.specific.chunk = htod32(COMPRESSED_CHUNK_SIZE);
+  temp_header.specific.disk = htod64(size);
+  temp_header.specific.index = htod64(STANDARD_HEADER_SIZE);
+
+  int fd = bx_create_image_file(pathname);
+  if (fd < 0)
+    BX_FATAL(("ERROR: failed to create compressed image file"));
+  if (bx_write_image(fd, 0, &temp_header, STANDARD_HEADER_SIZE) != STANDARD_HEADER_SIZE) {
+    ::close(fd);
+    BX_FATAL(("ERROR: The disk image is not complete - could not write header!"));
+  }
+  // all chunks are empty
+  for (int i = 0; i < 512; i++) {
+    entries[i] = htod64(STANDARD_HEADER_SIZE);
+  }
+  for (offset = 0; offset <= (Bit64s)chunks; offset += 512) {
+    int count = ((chunks + 1 - offset) < 512) ? (int)(chunks + 1 - offset) : 512;
+    if (bx_write_image(fd, STANDARD_HEADER_SIZE + offset * sizeof(Bit64u), entries,
+                       count * sizeof(Bit64u)) != (int)(count * sizeof(Bit64u))) {
+      ::close(fd);
+      BX_FATAL(("ERROR: The disk image is not complete - could not write index!"));
+    }
+  }
+  ::close(fd);
+  return 0;
+}
+#endif
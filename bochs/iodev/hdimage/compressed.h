@@ -0,0 +1,137 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// Compressed read-only disk image
+//
+// The disk is split into chunks that are compressed separately using the
+// LZ4 block format. The chunk data follows the header, the index with the
+// file offset of each chunk is stored after the data. The size of a chunk
+// is the difference to the offset of the next one. Chunks containing only
+// zeros have no data, chunks that cannot be compressed are stored as is.
+// An image can only be written sequentially after bximage created it.
+
+#ifndef BX_COMPRESSED_H
+#define BX_COMPRESSED_H
+
+#define COMPRESSED_TYPE "Compressed"
+#define COMPRESSED_SUBTYPE_LZ4 "LZ4"
+
+#define COMPRESSED_CHUNK_SIZE (64 * 1024)
+
+// number of decompressed chunks kept in memory
+#define COMPRESSED_CACHE_ENTRIES 32
+// the chunks following a sequential read are decompressed in advance by
+// separate threads (set to 0 to disable) and number of chunks to prefetch
+#define COMPRESSED_PREFETCH         1
+#define COMPRESSED_PREFETCH_THREADS 2
+#define COMPRESSED_PREFETCH_DEPTH   8
+
+ typedef struct
+ {
+   // the fields in the header are kept in little endian
+   Bit32u  chunks;     // #chunks of the disk
+   Bit32u  chunk;      // chunk size in bytes
+   Bit64u  disk;       // disk size in bytes
+   Bit64u  index;      // file offset of the chunk index
+ } compressed_specific_header_t;
+
+ typedef struct
+ {
+   standard_header_t standard;
+   compressed_specific_header_t specific;
+
+   Bit8u padding[STANDARD_HEADER_SIZE - (sizeof (standard_header_t) + sizeof (compressed_specific_header_t))];
+ } compressed_header_t;
+
+class compressed_image_t : public device_image_t
+{
+  public:
+    compressed_image_t();
+    virtual ~compressed_image_t();
+
+    int open(const char* pathname, int flags);
+    void close();
+    Bit64s lseek(Bit64s offset, int whence);
+    ssize_t read(void* buf, size_t count);
+    ssize_t write(const void* buf, size_t count);
+    ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+    ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+
+    static int check_format(int fd, Bit64u imgsize);
+
+#ifdef BXIMAGE
+    int create_image(const char *pathname, Bit64u size);
+#else
+    bool save_state(const char *backup_fname);
+    void restore_state(const char *backup_fname);
+    void stop_threads();
+
+    void prefetch_worker();
+#endif
+
+  private:
+    bool load_chunk(int file, Bit32u chunk, Bit8u *data, Bit8u *buffer);
+    int find_chunk(Bit32u chunk);
+    void insert_chunk(Bit32u chunk, Bit8u **data);
+#ifndef BXIMAGE
+    void prefetch(Bit32u chunk);
+#else
+    bool flush_chunk();
+    bool finish_image();
+#endif
+
+    int fd;
+    const char *pathname;
+    compressed_header_t header;
+    Bit32u chunk_size;
+    Bit32u chunks;
+    Bit64u *index;
+    Bit64s current_offset;
+
+    // LRU of decompressed chunks, shared with the prefetch threads
+    struct compressed_cache_t {
+      Bit32u chunk;
+      Bit32u lru;
+      Bit8u  *data;
+    } cache[COMPRESSED_CACHE_ENTRIES];
+    Bit32u lru_counter;
+    Bit8u *read_buf;
+    Bit8u *comp_buf;
+    Bit32u last_chunk;
+    BX_MUTEX(mutex);
+
+#ifndef BXIMAGE
+    bx_thread_sem_t prefetch_sem;
+    BX_THREAD_VAR(prefetch_threads[COMPRESSED_PREFETCH_THREADS]);
+    volatile bool prefetch_running;
+    Bit32u prefetch_queue[COMPRESSED_PREFETCH_DEPTH];
+    int queue_head;
+    int queue_count;
+    Bit32u prefetch_next;
+#else
+    // sequential writing of a new image
+    bool writable;
+    Bit8u *write_buf;
+    Bit32u write_chunk;
+    Bit64u data_end;
+#endif
+};
+
+#endif
@@ -0,0 +1,752 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// Deduplicating disk image with a chunk store shared between images
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#ifdef BXIMAGE
+#include "config.h"
+#include "misc/bxcompat.h"
+#include "osdep.h"
+#include "misc/bswap.h"
+#else
+#include "bochs.h"
+#include "plugin.h"
+#endif
+#include "hdimage.h"
+#include "dedup.h"
+
+#define LOG_THIS bx_hdimage_ctl.
+
+#ifndef BX_PATHNAME_LEN
+#define BX_PATHNAME_LEN 512
+#endif
+
+#ifndef O_ACCMODE
+#define O_ACCMODE (O_WRONLY | O_RDWR)
+#endif
+
+#ifndef BXIMAGE
+
+// disk image plugin entry point
+
+PLUGIN_ENTRY_FOR_IMG_MODULE(dedup)
+{
+  if (mode == PLUGIN_PROBE) {
+    return (int)PLUGTYPE_IMG;
+  }
+  return 0; // Success
+}
+
+#endif
+
+// Images of this process using the same chunk store share its mutex. The
+// fcntl() lock only excludes other processes, and it is released as soon as
+// any descriptor of the store index is closed. The store is only appended
+// to and its descriptors are only closed while holding the mutex.
+typedef struct dedup_store_t {
+  char path[BX_PATHNAME_LEN];
+  unsigned users;
+  BX_MUTEX(mutex);
+  struct dedup_store_t *next;
+} dedup_store_t;
+
+static BX_MUTEX(dedup_stores_mutex);
+static dedup_store_t *dedup_stores = NULL;
+
+static dedup_store_t *dedup_get_store(const char *path)
+{
+  dedup_store_t *store;
+
+  BX_LOCK(dedup_stores_mutex);
+  for (store = dedup_stores; store != NULL; store = store->next) {
+    if (!strcmp(store->path, path))
+      break;
+  }
+  if (store == NULL) {
+    store = new dedup_store_t;
+    strcpy(store->path, path);
+    store->users = 0;
+    BX_INIT_MUTEX(store->mutex);
+    store->next = dedup_stores;
+    dedup_stores = store;
+  }
+  store->users++;
+  BX_UNLOCK(dedup_stores_mutex);
+  return store;
+}
+
+static void dedup_put_store(dedup_store_t *store)
+{
+  dedup_store_t **ptr;
+
+  BX_LOCK(dedup_stores_mutex);
+  if (--store->users == 0) {
+    for (ptr = &dedup_stores; *ptr != NULL; ptr = &(*ptr)->next) {
+      if (*ptr == store) {
+        *ptr = store->next;
+        break;
+      }
+    }
+    BX_FINI_MUTEX(store->mutex);
+    delete store;
+  }
+  BX_UNLOCK(dedup_stores_mutex);
+}
+
+//
+// Define the static class that registers the derived device image class,
+// and allocates one on request.
+//
+class bx_dedup_locator_c : public hdimage_locator_c {
+public:
+  bx_dedup_locator_c(void) : hdimage_locator_c("dedup") {
+    BX_INIT_MUTEX(dedup_stores_mutex);
+  }
+protected:
+  device_image_t *allocate(Bit64u disk_size, const char *journal) {
+    return (new dedup_image_t());
+  }
+  int check_format(int fd, Bit64u disk_size) {
+    return (dedup_image_t::check_format(fd, disk_size));
+  }
+} bx_dedup_match;
+
+// The hash is only used to find candidates, chunks are compared before
+// they are shared.
+static Bit64u dedup_hash(const Bit8u *data, Bit32u len)
+{
+  const Bit64u *p = (const Bit64u*)data;
+  Bit64u hash = BX_CONST64(0xcbf29ce484222325);
+
+  for (Bit32u i = 0; i < (len / 8); i++) {
+    hash ^= dtoh64(p[i]);
+    hash *= BX_CONST64(0x100000001b3);
+    hash ^= hash >> 29;
+  }
+  return hash;
+}
+
+static bool dedup_zero_chunk(const Bit8u *data, Bit32u len)
+{
+  const Bit64u *p = (const Bit64u*)data;
+
+  for (Bit32u i = 0; i < (len / 8); i++) {
+    if (p[i] != 0) return 0;
+  }
+  return 1;
+}
+
+// A relative store name is located in the directory of the image
+static void dedup_store_path(const char *image, const Bit8u *store, char *path)
+{
+  const char *name = (const char*)store;
+  char *p, *q;
+
+  if ((name[0] == '/') || (name[0] == '\\') || ((name[0] != 0) && (name[1] == ':'))) {
+    strncpy(path, name, BX_PATHNAME_LEN - 1);
+  } else {
+    strncpy(path, image, BX_PATHNAME_LEN - 1);
+    path[BX_PATHNAME_LEN - 1] = 0;
+    p = strrchr(path, '/');
+    q = strrchr(path, '\\');
+    if (q > p) p = q;
+    if (p != NULL) {
+      p[1] = 0;
+    } else {
+      path[0] = 0;
+    }
+    strncat(path, name, BX_PATHNAME_LEN - strlen(path) - 1);
+  }
+  path[BX_PATHNAME_LEN - 1] = 0;
+}
+
+static int dedup_check_header(int fd, const char *subtype, dedup_header_t *header)
+{
+  if (bx_read_image(fd, 0, header, sizeof(dedup_header_t)) != STANDARD_HEADER_SIZE) {
+    return HDIMAGE_READ_ERROR;
+  }
+  if (strcmp((char*)header->standard.magic, STANDARD_HEADER_MAGIC) != 0) {
+    return HDIMAGE_NO_SIGNATURE;
+  }
+  if ((strcmp((char*)header->standard.type, DEDUP_TYPE) != 0) ||
+      (strcmp((char*)header->standard.subtype, subtype) != 0)) {
+    return HDIMAGE_TYPE_ERROR;
+  }
+  if (dtoh32(header->standard.version) != STANDARD_HEADER_VERSION) {
+    return HDIMAGE_VERSION_ERROR;
+  }
+  return HDIMAGE_FORMAT_OK;
+}
+
+dedup_image_t::dedup_image_t()
+  : fd(-1),
+  store_fd(-1),
+  store_index_fd(-1),
+  store(NULL),
+  pathname(NULL),
+  chunk_size(0),
+  index(NULL),
+  current_offset(0),
+  table(NULL),
+  table_size(0),
+  table_used(0),
+  store_index_size(0),
+  chunk_buf(NULL),
+  chunk_index(DEDUP_CHUNK_NOT_ALLOCATED),
+  chunk_dirty(0),
+  compare_buf(NULL)
+{
+  if (sizeof(dedup_header_t) != STANDARD_HEADER_SIZE) {
+    BX_FATAL(("system error: invalid header structure size"));
+  }
+}
+
+dedup_image_t::~dedup_image_t()
+{
+  close();
+}
+
+int dedup_image_t::check_format(int fd, Bit64u imgsize)
+{
+  dedup_header_t temp_header;
+
+  return dedup_check_header(fd, DEDUP_SUBTYPE_IMAGE, &temp_header);
+}
+
+int dedup_image_t::open(const char* _pathname, int flags)
+{
+  Bit64u imgsize = 0;
+  Bit32u chunks;
+  int ret;
+
+  pathname = _pathname;
+  close();
+
+  if ((fd = hdimage_open_file(pathname, flags, &imgsize, &mtime)) < 0) {
+    BX_ERROR(("dedup: cannot open image file '%s'", pathname));
+    return -1;
+  }
+  if ((ret = dedup_check_header(fd, DEDUP_SUBTYPE_IMAGE, &header)) != HDIMAGE_FORMAT_OK) {
+    switch (ret) {
+      case HDIMAGE_READ_ERROR:
+        BX_ERROR(("dedup: cannot read header of '%s'", pathname));
+        break;
+      case HDIMAGE_NO_SIGNATURE:
+      case HDIMAGE_TYPE_ERROR:
+        BX_ERROR(("dedup: '%s' is not a dedup image", pathname));
+        break;
+      case HDIMAGE_VERSION_ERROR:
+        BX_ERROR(("dedup: unsupported version of '%s'", pathname));
+        break;
+    }
+    close();
+    return -1;
+  }
+
+  chunk_size = dtoh32(header.specific.chunk);
+  chunks = dtoh32(header.specific.chunks);
+  hd_size = dtoh64(header.specific.disk);
+  if ((chunk_size == 0) || ((chunk_size % 512) != 0) ||
+      (((Bit64u)chunks * chunk_size) < hd_size)) {
+    BX_ERROR(("dedup: invalid header of '%s'", pathname));
+    close();
+    return -1;
+  }
+  header.specific.store[DEDUP_STORE_NAME_LEN - 1] = 0;
+
+  index = new Bit32u[chunks];
+  if (bx_read_image(fd, STANDARD_HEADER_SIZE, index, chunks * sizeof(Bit32u)) !=
+      (int)(chunks * sizeof(Bit32u))) {
+    BX_ERROR(("dedup: cannot read index of '%s'", pathname));
+    close();
+    return -1;
+  }
+  for (Bit32u i = 0; i < chunks; i++) {
+    index[i] = dtoh32(index[i]);
+  }
+
+  if (!open_store(flags)) {
+    close();
+    return -1;
+  }
+
+  chunk_buf = new Bit8u[chunk_size];
+  compare_buf = new Bit8u[chunk_size];
+  chunk_index = DEDUP_CHUNK_NOT_ALLOCATED;
+  chunk_dirty = 0;
+  current_offset = 0;
+
+  BX_INFO(("'dedup' disk image opened: path is '%s', %u chunks in the store",
+           pathname, table_used));
+  return fd;
+}
+
+bool dedup_image_t::open_store(int flags)
+{
+  char path[BX_PATHNAME_LEN];
+  dedup_header_t store_header;
+  int mode = ((flags & O_ACCMODE) == O_RDONLY) ? O_RDONLY : O_RDWR;
+
+#ifdef O_BINARY
+  mode |= O_BINARY;
+#endif
+  dedup_store_path(pathname, header.specific.store, path);
+  store = dedup_get_store(path);
+  store_fd = ::open(path, mode);
+  strncat(path, DEDUP_STORE_INDEX_EXTENSION, BX_PATHNAME_LEN - strlen(path) - 1);
+  store_index_fd = ::open(path, mode);
+  if ((store_fd < 0) || (store_index_fd < 0)) {
+    BX_ERROR(("dedup: cannot open chunk store '%s'", header.specific.store));
+    return 0;
+  }
+  if ((dedup_check_header(store_index_fd, DEDUP_SUBTYPE_STORE, &store_header) != HDIMAGE_FORMAT_OK) ||
+      (store_header.specific.chunk != header.specific.chunk)) {
+    BX_ERROR(("dedup: chunk store '%s' does not match the image", header.specific.store));
+    return 0;
+  }
+  table_size = 1024;
+  table_used = 0;
+  table = new dedup_record_t[table_size];
+  for (Bit32u i = 0; i < table_size; i++) {
+    table[i].chunk = DEDUP_CHUNK_NOT_ALLOCATED;
+  }
+  store_index_size = STANDARD_HEADER_SIZE;
+  return load_records();
+}
+
+void dedup_image_t::close()
+{
+  if (fd > -1) {
+    if (chunk_dirty && !flush_chunk()) {
+      BX_ERROR(("dedup: failed to write back the last chunk of '%s'", pathname));
+    }
+    bx_close_image(fd, pathname);
+    fd = -1;
+  }
+  if (store != NULL) {
+    BX_LOCK(store->mutex);
+    if (store_fd > -1) {
+      ::close(store_fd);
+      store_fd = -1;
+    }
+    if (store_index_fd > -1) {
+      ::close(store_index_fd);
+      store_index_fd = -1;
+    }
+    BX_UNLOCK(store->mutex);
+    dedup_put_store(store);
+    store = NULL;
+  }
+  if (index != NULL) {
+    delete [] index;
+    index = NULL;
+  }
+  if (table != NULL) {
+    delete [] table;
+    table = NULL;
+  }
+  if (chunk_buf != NULL) {
+    delete [] chunk_buf;
+    chunk_buf = NULL;
+  }
+  if (compare_buf != NULL) {
+    delete [] compare_buf;
+    compare_buf = NULL;
+  }
+}
+
+// Read the records appended to the store index since the last call
+bool dedup_image_t::load_records()
+{
+  dedup_record_t records[256];
+  int ret;
+
+  while ((ret = bx_read_image(store_index_fd, store_index_size, records, sizeof(records))) > 0) {
+    int count = ret / sizeof(dedup_record_t);
+    for (int i = 0; i < count; i++) {
+      add_record(dtoh64(records[i].hash), dtoh32(records[i].chunk));
+    }
+    store_index_size += count * sizeof(dedup_record_t);
+    if (ret < (int)sizeof(records))
+      break;
+  }
+  return (ret >= 0);
+}
+
+void dedup_image_t::add_record(Bit64u hash, Bit32u chunk)
+{
+  Bit32u i;
+
+  if ((table_used * 2) >= table_size) {
+    dedup_record_t *old_table = table;
+    Bit32u old_size = table_size;
+
+    table_size *= 2;
+    table = new dedup_record_t[table_size];
+    for (i = 0; i < table_size; i++) {
+      table[i].chunk = DEDUP_CHUNK_NOT_ALLOCATED;
+    }
+    table_used = 0;
+    for (i = 0; i < old_size; i++) {
+      if (old_table[i].chunk != DEDUP_CHUNK_NOT_ALLOCATED) {
+        add_record(old_table[i].hash, old_table[i].chunk);
+      }
+    }
+    delete [] old_table;
+  }
+  i = (Bit32u)hash & (table_size - 1);
+  while (table[i].chunk != DEDUP_CHUNK_NOT_ALLOCATED) {
+    i = (i + 1) & (table_size - 1);
+  }
+  table[i].hash = hash;
+  table[i].chunk = chunk;
+  table_used++;
+}
+
+// Returns the store chunk with the contents of 'data' if present
+Bit32u dedup_image_t::find_chunk(Bit64u hash, const Bit8u *data)
+{
+  Bit32u i = (Bit32u)hash & (table_size - 1);
+
+  while (table[i].chunk != DEDUP_CHUNK_NOT_ALLOCATED) {
+    if ((table[i].hash == hash) &&
+        (bx_read_image(store_fd, (Bit64s)table[i].chunk * chunk_size, compare_buf, chunk_size) == (int)chunk_size) &&
+        !memcmp(compare_buf, data, chunk_size)) {
+      return table[i].chunk;
+    }
+    i = (i + 1) & (table_size - 1);
+  }
+  return DEDUP_CHUNK_NOT_ALLOCATED;
+}
+
+// Other processes may append to the store at the same time
+bool dedup_image_t::lock_store(bool lock)
+{
+#ifndef WIN32
+  struct flock fl;
+
+  memset(&fl, 0, sizeof(fl));
+  fl.l_type = lock ? F_WRLCK : F_UNLCK;
+  fl.l_whence = SEEK_SET;
+  return (fcntl(store_index_fd, F_SETLKW, &fl) == 0);
+#else
+  return 1;
+#endif
+}
+
+// Returns the store chunk with the contents of 'data', appending it to the
+// store if not present yet
+Bit32u dedup_image_t::store_chunk(const Bit8u *data)
+{
+  dedup_record_t record;
+  Bit64u hash = dedup_hash(data, chunk_size);
+  Bit32u chunk = find_chunk(hash, data);
+  Bit64s end;
+
+  if (chunk != DEDUP_CHUNK_NOT_ALLOCATED)
+    return chunk;
+
+  BX_LOCK(store->mutex);
+  if (!lock_store(1)) {
+    BX_UNLOCK(store->mutex);
+    BX_ERROR(("dedup: cannot lock chunk store '%s'", header.specific.store));
+    return DEDUP_CHUNK_NOT_ALLOCATED;
+  }
+  if (load_records()) {
+    chunk = find_chunk(hash, data);
+  }
+  if (chunk == DEDUP_CHUNK_NOT_ALLOCATED) {
+    end = ::lseek(store_fd, 0, SEEK_END);
+    chunk = (Bit32u)((end + chunk_size - 1) / chunk_size);
+    record.hash = htod64(hash);
+    record.chunk = htod32(chunk);
+    record.reserved = 0;
+    // the chunk data must be complete before the record refers to it
+    if ((end < 0) ||
+        (bx_write_image(store_fd, (Bit64s)chunk * chunk_size, (void*)data, chunk_size) != (int)chunk_size) ||
+        (bx_write_image(store_index_fd, store_index_size, &record, sizeof(record)) != sizeof(record))) {
+      BX_ERROR(("dedup: cannot write to chunk store '%s'", header.specific.store));
+      chunk = DEDUP_CHUNK_NOT_ALLOCATED;
+    } else {
+      store_index_size += sizeof(record);
+      add_record(hash, chunk);
+    }
+  }
+  lock_store(0);
+  BX_UNLOCK(store->mutex);
+  return chunk;
+}
+
+// Make 'chunk_index' the chunk being modified. Its contents are not read
+// if the caller overwrites the whole chunk.
+bool dedup_image_t::load_chunk(Bit32u _index, bool overwrite)
+{
+  if (chunk_index == _index)
+    return 1;
+  if (chunk_dirty && !flush_chunk())
+    return 0;
+  chunk_index = DEDUP_CHUNK_NOT_ALLOCATED;
+  if (overwrite) {
+    // nothing to do
+  } else if (index[_index] == DEDUP_CHUNK_NOT_ALLOCATED) {
+    memset(chunk_buf, 0, chunk_size);
+  } else if (bx_read_image(store_fd, (Bit64s)index[_index] * chunk_size, chunk_buf, chunk_size) != (int)chunk_size) {
+    BX_ERROR(("dedup: cannot read chunk %u from the store", index[_index]));
+    return 0;
+  }
+  chunk_index = _index;
+  return 1;
+}
+
+bool dedup_image_t::flush_chunk()
+{
+  Bit32u chunk = DEDUP_CHUNK_NOT_ALLOCATED, entry;
+
+  if (!chunk_dirty)
+    return 1;
+  if (!dedup_zero_chunk(chunk_buf, chunk_size)) {
+    chunk = store_chunk(chunk_buf);
+    if (chunk == DEDUP_CHUNK_NOT_ALLOCATED)
+      return 0;
+  }
+  if (index[chunk_index] != chunk) {
+    index[chunk_index] = chunk;
+    entry = htod32(chunk);
+    if (bx_write_image(fd, STANDARD_HEADER_SIZE + (Bit64s)chunk_index * sizeof(Bit32u),
+                       &entry, sizeof(Bit32u)) != sizeof(Bit32u)) {
+      BX_ERROR(("dedup: cannot write index of '%s'", pathname));
+      return 0;
+    }
+  }
+  chunk_dirty = 0;
+  return 1;
+}
+
+Bit64s dedup_image_t::lseek(Bit64s offset, int whence)
+{
+  if (whence == SEEK_SET) {
+    current_offset = offset;
+  } else if (whence == SEEK_CUR) {
+    current_offset += offset;
+  } else {
+    BX_ERROR(("dedup: lseek mode not supported"));
+    return -1;
+  }
+  if ((current_offset < 0) || ((Bit64u)current_offset > hd_size))
+    return -1;
+  return current_offset;
+}
+
+ssize_t dedup_image_t::read(void* buf, size_t count)
+{
+  Bit8u *cbuf = (Bit8u*)buf;
+  ssize_t total = 0;
+
+  if ((Bit64u)current_offset + count > hd_size)
+    return -1;
+  while (count > 0) {
+    Bit32u i = (Bit32u)(current_offset / chunk_size);
+    Bit32u offset = (Bit32u)(current_offset % chunk_size);
+    Bit32u len = chunk_size - offset;
+    if (len > count) len = (Bit32u)count;
+
+    if (i == chunk_index) {
+      memcpy(cbuf, chunk_buf + offset, len);
+    } else if (index[i] == DEDUP_CHUNK_NOT_ALLOCATED) {
+      memset(cbuf, 0, len);
+    } else if (bx_read_image(store_fd, (Bit64s)index[i] * chunk_size + offset, cbuf, len) != (int)len) {
+      BX_ERROR(("dedup: cannot read chunk %u from the store", index[i]));
+      return -1;
+    }
+    current_offset += len;
+    cbuf += len;
+    count -= len;
+    total += len;
+  }
+  return total;
+}
+
+ssize_t dedup_image_t::write(const void* buf, size_t count)
+{
+  const Bit8u *cbuf = (const Bit8u*)buf;
+  ssize_t total = 0;
+
+  if ((Bit64u)current_offset + count > hd_size)
+    return -1;
+  while (count > 0) {
+    Bit32u i = (Bit32u)(current_offset / chunk_size);
+    Bit32u offset = (Bit32u)(current_offset % chunk_size);
+    Bit32u len = chunk_size - offset;
+    if (len > count) len = (Bit32u)count;
+
+    if (!load_chunk(i, (len == chunk_size)))
+      return -1;
+    memcpy(chunk_buf + offset, cbuf, len);
+    chunk_dirty = 1;
+    current_offset += len;
+    cbuf += len;
+    count -= len;
+    total += len;
+  }
+  return total;
+}
+
+ssize_t dedup_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  ssize_t total = 0;
+
+  if (lseek(offset, SEEK_SET) < 0)
+    return -1;
+  for (int i = 0; i < iovcnt; i++) {
+    if (read(iov[i].iov_base, iov[i].iov_len) != (ssize_t)iov[i].iov_len)
+      return -1;
+    total += iov[i].iov_len;
+  }
+  return total;
+}
+
+ssize_t dedup_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  ssize_t total = 0;
+
+  if (lseek(offset, SEEK_SET) < 0)
+    return -1;
+  for (int i = 0; i < iovcnt; i++) {
+    if (write(iov[i].iov_base, iov[i].iov_len) != (ssize_t)iov[i].iov_len)
+      return -1;
+    total += iov[i].iov_len;
+  }
+  return total;
+}
+
+// Store the chunk modified last and update its index entry
+int dedup_image_t::flush()
+{
+  return flush_chunk() ? 0 : -1;
+}
+
+#ifdef BXIMAGE
+static void dedup_make_header(dedup_header_t *header, const char *subtype)
+{
+  memset(header, 0, sizeof(dedup_header_t));
+  strcpy((char*)header->standard.magic, STANDARD_HEADER_MAGIC);
+  strcpy((char*)header->standard.type, DEDUP_TYPE);
+  strcpy((char*)header->standard.subtype, subtype);
+  header->standard.version = htod32(STANDARD_HEADER_VERSION);
+  header->standard.header = htod32(STANDARD_HEADER_SIZE);
+  header->specific.chunk = htod32(DEDUP_CHUNK_SIZE);
+}
+
+int dedup_image_t::create_image(const char *pathname, Bit64u size)
+{
+  char path[BX_PATHNAME_LEN];
+  dedup_header_t temp_header;
+  Bit32u chunks, entries[512];
+  Bit64s offset;
+  int fd, sfd;
+
+  chunks = (Bit32u)((size + DEDUP_CHUNK_SIZE - 1) / DEDUP_CHUNK_SIZE);
+  dedup_make_header(&temp_header, DEDUP_SUBTYPE_IMAGE);
+  temp_header.specific.chunks = htod32(chunks);
+  temp_header.specific.disk = htod64(size);
+  strcpy((char*)temp_header.specific.store, DEDUP_STORE_NAME);
+
+  // create the shared chunk store unless other images use it already
+  dedup_store_path(pathname, temp_header.specific.store, path);
+  if ((sfd = ::open(path, O_RDONLY
+#ifdef O_BINARY
+                    | O_BINARY
+#endif
+                   )) >= 0) {
+    ::close(sfd);
+  } else {
+    if ((sfd = bx_create_image_file(path)) < 0)
+      BX_FATAL(("ERROR: failed to create chunk store '%s'", path));
+    ::close(sfd);
+    strncat(path, DEDUP_STORE_INDEX_EXTENSION, BX_PATHNAME_LEN - strlen(path) - 1);
+    if ((sfd = bx_create_image_file(path)) < 0)
+      BX_FATAL(("ERROR: failed to create chunk store index '%s'", path));
+    dedup_header_t store_header;
+    dedup_make_header(&store_header, DEDUP_SUBTYPE_STORE);
+    if (bx_write_image(sfd, 0, &store_header, STANDARD_HEADER_SIZE) != STANDARD_HEADER_SIZE) {
+      ::close(sfd);
+      BX_FATAL(("ERROR: The chunk store is not complete - could not write header!"));
+    }
+    ::close(sfd);
+  }
+
+  fd = bx_create_image_file(pathname);
+  if (fd < 0)
+    BX_FATAL(("ERROR: failed to create dedup image file"));
+  if (bx_write_image(fd, 0, &temp_header, STANDARD_HEADER_SIZE) != STANDARD_HEADER_SIZE) {
+    ::close(fd);
+    BX_FATAL(("ERROR: The disk image is not complete - could not write header!"));
+  }
+  for (int i = 0; i < 512; i++) {
+    entries[i] = htod32(DEDUP_CHUNK_NOT_ALLOCATED);
+  }
+  for (offset = 0; offset < (Bit64s)chunks; offset += 512) {
+    int count = ((chunks - offset) < 512) ? (int)(chunks - offset) : 512;
+    if (bx_write_image(fd, STANDARD_HEADER_SIZE + offset * sizeof(Bit32u), entries,
+                       count * sizeof(Bit32u)) != (int)(count * sizeof(Bit32u))) {
+      ::close(fd);
+      BX_FATAL(("ERROR: The disk image is not complete - could not write index!"));
+    }
+  }
+  ::close(fd);
+  return 0;
+}
+#else
+bool dedup_image_t::save_state(const char *backup_fname)
+{
+  // the store is only appended to, so the index describes the disk
+  if (!flush_chunk())
+    return 0;
+  return hdimage_backup_file(fd, backup_fname);
+}
+
+void dedup_image_t::restore_state(const char *backup_fname)
+{
+  int temp_fd;
+  Bit64u imgsize;
+
+  if ((temp_fd = hdimage_open_file(backup_fname, O_RDONLY, &imgsize, NULL)) < 0) {
+    BX_PANIC(("Cannot open dedup image backup '%s'", backup_fname));
+    return;
+  }
+  if (check_format(temp_fd, imgsize) < HDIMAGE_FORMAT_OK) {
+    ::close(temp_fd);
+    BX_PANIC(("Cannot detect dedup image header"));
+    return;
+  }
+  ::close(temp_fd);
+  close();
+  if (!hdimage_copy_file(backup_fname, pathname)) {
+    BX_PANIC(("Failed to restore dedup image '%s'", pathname));
+    return;
+  }
+  device_image_t::open(pathname);
+}
+#endif
@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+// Deduplicating disk image
+//
+// The image file only contains an index that maps each chunk of the disk
+// to a chunk of a chunk store shared by all images in the same directory.
+// Chunks with identical contents are stored once. The store consists of
+// the data file with the chunks and an index file with the content hash of
+// each chunk. Both files are only appended to, so an image file can be
+// copied to create another disk with the same contents.
+
+#ifndef BX_DEDUP_H
+#define BX_DEDUP_H
+
+#define DEDUP_TYPE "Dedup"
+#define DEDUP_SUBTYPE_IMAGE "Image"
+#define DEDUP_SUBTYPE_STORE "Store"
+
+#define DEDUP_CHUNK_SIZE (64 * 1024)
+#define DEDUP_CHUNK_NOT_ALLOCATED (0xffffffff)
+
+// default chunk store name, relative to the directory of the image
+#define DEDUP_STORE_NAME "dedup.store"
+#define DEDUP_STORE_INDEX_EXTENSION ".idx"
+#define DEDUP_STORE_NAME_LEN 256
+
+ typedef struct
+ {
+   // the fields in the header are kept in little endian
+   Bit32u  chunks;     // #entries in the index
+   Bit32u  chunk;      // chunk size in bytes
+   Bit64u  disk;       // disk size in bytes
+   Bit8u   store[DEDUP_STORE_NAME_LEN]; // chunk store file name
+ } dedup_specific_header_t;
+
+ typedef struct
+ {
+   standard_header_t standard;
+   dedup_specific_header_t specific;
+
+   Bit8u padding[STANDARD_HEADER_SIZE - (sizeof (standard_header_t) + sizeof (dedup_specific_header_t))];
+ } dedup_header_t;
+
+ // record of the chunk store index file (little endian)
+ typedef struct
+ {
+   Bit64u  hash;
+   Bit32u  chunk;
+   Bit32u  reserved;
+ } dedup_record_t;
+
+struct dedup_store_t;
+
+class dedup_image_t : public device_image_t
+{
+  public:
+    dedup_image_t();
+    virtual ~dedup_image_t();
+
+    int open(const char* pathname, int flags);
+    void close();
+    Bit64s lseek(Bit64s offset, int whence);
+    ssize_t read(void* buf, size_t count);
+    ssize_t write(const void* buf, size_t count);
+    ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+    ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+    int flush();
+
+    static int check_format(int fd, Bit64u imgsize);
+
+#ifdef BXIMAGE
+    int create_image(const char *pathname, Bit64u size);
+#else
+    bool save_state(const char *backup_fname);
+    void restore_state(const char *backup_fname);
+#endif
+
+  private:
+    bool open_store(int flags);
+    bool load_records();
+    void add_record(Bit64u hash, Bit32u chunk);
+    Bit32u find_chunk(Bit64u hash, const Bit8u *data);
+    Bit32u store_chunk(const Bit8u *data);
+    bool lock_store(bool lock);
+    bool load_chunk(Bit32u index, bool overwrite);
+    bool flush_chunk();
+
+    int fd;
+    int store_fd;
+    int store_index_fd;
+    struct dedup_store_t *store;
+    const char *pathname;
+    dedup_header_t header;
+    Bit32u chunk_size;
+    Bit32u *index;
+    Bit64s current_offset;
+
+    // hash table of the chunks in the store
+    dedup_record_t *table;
+    Bit32u table_size;
+    Bit32u table_used;
+    Bit64s store_index_size;
+
+    // chunk being modified and buffer for comparing chunks
+    Bit8u *chunk_buf;
+    Bit32u chunk_index;
+    bool chunk_dirty;
+    Bit8u *compare_buf;
+};
+
+#endif
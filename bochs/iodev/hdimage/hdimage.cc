@@ -40,6 +40,9 @@
 #if BX_HAVE_SYS_MMAN_H
 #include <sys/mman.h>
 #endif
+#if BX_HAVE_GETTIMEOFDAY
+#include <sys/time.h>
+#endif
 #ifdef linux
 #include <linux/fs.h>
 #include <sys/ioctl.h>
@@ -70,9 +73,23 @@ const char *builtin_mode_names[n_hdimage_builtin_modes] = {
 
 const char **hdimage_mode_names;
 
+#ifndef BXIMAGE
+// images running helper threads, they must be stopped before a fork
+typedef struct bx_thread_image_t {
+  device_image_t *image;
+  struct bx_thread_image_t *next;
+} bx_thread_image_t;
+
+static BX_MUTEX(thread_image_mutex);
+static bx_thread_image_t *thread_images = NULL;
+#endif
+
 bx_hdimage_ctl_c::bx_hdimage_ctl_c()
 {
   put("hdimage", "IMG");
+#ifndef BXIMAGE
+  BX_INIT_MUTEX(thread_image_mutex);
+#endif
 }
 
 void bx_hdimage_ctl_c::init(void)
@@ -135,6 +152,7 @@ void bx_hdimage_ctl_c::list_modules(void)
 
 void bx_hdimage_ctl_c::exit(void)
 {
+  aio_stop();
   free(hdimage_mode_names);
   hdimage_locator_c::cleanup();
 }
@@ -182,6 +200,192 @@ cdrom_base_c* bx_hdimage_ctl_c::init_cdrom(const char *dev)
 #endif
 }
 
+// asynchronous image access
+
+static BX_MUTEX(aio_mutex);
+static bx_thread_sem_t aio_sem;
+static BX_THREAD_VAR(aio_threads[BX_AIO_THREADS]);
+static volatile bool aio_running = 0;
+static int aio_pending = 0;
+static bx_aio_request_t *aio_head = NULL;
+static bx_aio_request_t *aio_tail = NULL;
+
+BX_THREAD_FUNC(aio_thread, indata)
+{
+  ((bx_hdimage_ctl_c*)indata)->aio_worker();
+  BX_THREAD_EXIT;
+}
+
+void bx_hdimage_ctl_c::aio_worker(void)
+{
+  bx_aio_request_t *req;
+  ssize_t ret;
+
+  while (aio_running) {
+    bx_wait_sem(&aio_sem);
+    // process all queued requests, the semaphore may not count them all
+    do {
+      BX_LOCK(aio_mutex);
+      req = aio_head;
+      if (req != NULL) {
+        aio_head = req->next;
+        if (aio_head == NULL) aio_tail = NULL;
+      }
+      BX_UNLOCK(aio_mutex);
+      if (req != NULL) {
+        if (req->write) {
+          ret = req->image->writev(req->offset, &req->iov, 1);
+        } else {
+          ret = req->image->readv(req->offset, &req->iov, 1);
+        }
+        BX_LOCK(aio_mutex);
+        req->ret = ret;
+        req->state = BX_AIO_DONE;
+        aio_pending--;
+        BX_UNLOCK(aio_mutex);
+      }
+    } while (req != NULL);
+  }
+}
+
+void bx_hdimage_ctl_c::aio_start(void)
+{
+  BX_INIT_MUTEX(aio_mutex);
+  bx_create_sem(&aio_sem);
+  aio_running = 1;
+  for (int i = 0; i < BX_AIO_THREADS; i++) {
+    BX_THREAD_CREATE(aio_thread, this, aio_threads[i]);
+  }
+  BX_INFO(("started %d disk I/O threads", BX_AIO_THREADS));
+}
+
+void bx_hdimage_ctl_c::aio_stop(void)
+{
+  if (aio_running) {
+    aio_flush();
+    aio_running = 0;
+    // wake up all threads before waiting for any of them
+    for (int i = 0; i < BX_AIO_THREADS; i++) {
+      bx_set_sem(&aio_sem);
+    }
+    for (int i = 0; i < BX_AIO_THREADS; i++) {
+      BX_THREAD_JOIN(aio_threads[i]);
+    }
+    bx_destroy_sem(&aio_sem);
+    BX_FINI_MUTEX(aio_mutex);
+  }
+}
+
+void bx_hdimage_ctl_c::aio_submit(bx_aio_request_t *req)
+{
+  if (!aio_running) {
+    aio_start();
+  }
+  req->state = BX_AIO_PENDING;
+  req->next = NULL;
+  BX_LOCK(aio_mutex);
+  if (aio_tail != NULL) {
+    aio_tail->next = req;
+  } else {
+    aio_head = req;
+  }
+  aio_tail = req;
+  aio_pending++;
+  BX_UNLOCK(aio_mutex);
+  bx_set_sem(&aio_sem);
+}
+
+bool bx_hdimage_ctl_c::aio_done(bx_aio_request_t *req)
+{
+  int state;
+
+  if (!aio_running) {
+    return (req->state != BX_AIO_PENDING);
+  }
+  BX_LOCK(aio_mutex);
+  state = req->state;
+  BX_UNLOCK(aio_mutex);
+  return (state != BX_AIO_PENDING);
+}
+
+void bx_hdimage_ctl_c::aio_wait(bx_aio_request_t *req)
+{
+  while (!aio_done(req)) {
+    BX_MSLEEP(1);
+  }
+}
+
+void bx_hdimage_ctl_c::aio_flush(void)
+{
+  int pending;
+
+  if (!aio_running) return;
+  do {
+    BX_LOCK(aio_mutex);
+    pending = aio_pending;
+    BX_UNLOCK(aio_mutex);
+    if (pending > 0) {
+      BX_MSLEEP(1);
+    }
+  } while (pending > 0);
+}
+
+void bx_hdimage_ctl_c::add_thread_image(device_image_t *image)
+{
+  bx_thread_image_t *entry = new bx_thread_image_t;
+
+  entry->image = image;
+  BX_LOCK(thread_image_mutex);
+  entry->next = thread_images;
+  thread_images = entry;
+  BX_UNLOCK(thread_image_mutex);
+}
+
+void bx_hdimage_ctl_c::remove_thread_image(device_image_t *image)
+{
+  bx_thread_image_t **ptr, *entry;
+
+  BX_LOCK(thread_image_mutex);
+  for (ptr = &thread_images; *ptr != NULL; ptr = &(*ptr)->next) {
+    if ((*ptr)->image == image) {
+      entry = *ptr;
+      *ptr = entry->next;
+      delete entry;
+      break;
+    }
+  }
+  BX_UNLOCK(thread_image_mutex);
+}
+
+// Only the thread calling fork() exists in the child process. The pending
+// requests are completed and the helper threads of the images are stopped,
+// so that no thread holds a lock when the process is copied.
+void bx_hdimage_ctl_c::before_fork(void)
+{
+  bx_thread_image_t *list, *next;
+
+  aio_flush();
+  BX_LOCK(thread_image_mutex);
+  list = thread_images;
+  thread_images = NULL;
+  BX_UNLOCK(thread_image_mutex);
+  while (list != NULL) {
+    next = list->next;
+    list->image->stop_threads();
+    delete list;
+    list = next;
+  }
+}
+
+// The I/O threads do not exist in the child process of a fork. They are
+// started again with the next request.
+void bx_hdimage_ctl_c::after_fork(bool child)
+{
+  if (child) {
+    aio_running = 0;
+  }
+}
+
 #endif // ifndef BXIMAGE
 
 hdimage_locator_c *hdimage_locator_c::all = NULL;
@@ -633,6 +837,54 @@ int device_image_t::open(const char* _pathname)
   return open(_pathname, O_RDWR);
 }
 
+ssize_t device_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  ssize_t total = 0;
+
+  for (int i = 0; i < iovcnt; i++) {
+    Bit8u *buf = (Bit8u*)iov[i].iov_base;
+    size_t len = iov[i].iov_len;
+    while (len > 0) {
+      size_t count = (len < sect_size) ? len : sect_size;
+      if (lseek(offset, SEEK_SET) < 0) {
+        return -1;
+      }
+      if (read(buf, count) != (ssize_t)count) {
+        return -1;
+      }
+      offset += count;
+      buf += count;
+      len -= count;
+      total += count;
+    }
+  }
+  return total;
+}
+
+ssize_t device_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  ssize_t total = 0;
+
+  for (int i = 0; i < iovcnt; i++) {
+    Bit8u *buf = (Bit8u*)iov[i].iov_base;
+    size_t len = iov[i].iov_len;
+    while (len > 0) {
+      size_t count = (len < sect_size) ? len : sect_size;
+      if (lseek(offset, SEEK_SET) < 0) {
+        return -1;
+      }
+      if (write(buf, count) != (ssize_t)count) {
+        return -1;
+      }
+      offset += count;
+      buf += count;
+      len -= count;
+      total += count;
+    }
+  }
+  return total;
+}
+
 Bit32u device_image_t::get_capabilities()
 {
   return (cylinders == 0) ? HDIMAGE_AUTO_GEOMETRY : 0;
@@ -689,6 +941,28 @@ ssize_t flat_image_t::write(const void* buf, size_t count)
   return ::write(fd, (char*) buf, count);
 }
 
+ssize_t flat_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+#if BX_HAVE_PREADV
+#ifdef IOV_MAX
+  if (iovcnt <= IOV_MAX)
+#endif
+    return ::preadv(fd, iov, iovcnt, (off_t)offset);
+#endif
+  return device_image_t::readv(offset, iov, iovcnt);
+}
+
+ssize_t flat_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+#if BX_HAVE_PREADV
+#ifdef IOV_MAX
+  if (iovcnt <= IOV_MAX)
+#endif
+    return ::pwritev(fd, iov, iovcnt, (off_t)offset);
+#endif
+  return device_image_t::writev(offset, iov, iovcnt);
+}
+
 int flat_image_t::check_format(int fd, Bit64u imgsize)
 {
   char buffer[512];
@@ -1646,13 +1920,339 @@ ssize_t dll_image_t::write(const void* buf, size_t count)
 }
 #endif // DLL_HD_SUPPORT
 
+// streaming image copy implementation
+
+static Bit64u hdimage_copy_time(void)
+{
+#if BX_HAVE_GETTIMEOFDAY
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return (Bit64u)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+  return (Bit64u)time(NULL) * 1000000;
+#endif
+}
+
+static bool hdimage_zero_block(const Bit8u *buf, Bit32u len)
+{
+  const Bit64u *p = (const Bit64u*)buf;
+
+  for (Bit32u i = 0; i < (len / 8); i++) {
+    if (p[i] != 0) return 0;
+  }
+  return 1;
+}
+
+BX_THREAD_FUNC(hdimage_copy_thread, indata)
+{
+  ((hdimage_copy_c*)indata)->writer();
+  BX_THREAD_EXIT;
+}
+
+hdimage_copy_c::hdimage_copy_c(device_image_t *dst, bool _skip_zero)
+{
+  image = dst;
+  skip_zero = _skip_zero;
+  for (int i = 0; i < HDIMAGE_COPY_BUFFERS; i++) {
+    buffers[i].data = new Bit8u[HDIMAGE_COPY_BUFFER_SIZE];
+    buffers[i].offset = 0;
+    buffers[i].len = 0;
+  }
+  next_put = 0;
+  next_write = 0;
+  queued = 0;
+  finishing = 0;
+  finished = 0;
+  error = 0;
+  bytes_read = 0;
+  bytes_written = 0;
+  start_time = hdimage_copy_time();
+  end_time = start_time;
+  BX_INIT_MUTEX(mutex);
+  BX_THREAD_CREATE(hdimage_copy_thread, this, thread);
+}
+
+hdimage_copy_c::~hdimage_copy_c()
+{
+  finish();
+  BX_FINI_MUTEX(mutex);
+  for (int i = 0; i < HDIMAGE_COPY_BUFFERS; i++) {
+    delete [] buffers[i].data;
+  }
+}
+
+Bit8u* hdimage_copy_c::get_buffer()
+{
+  int n;
+
+  do {
+    BX_LOCK(mutex);
+    n = queued;
+    BX_UNLOCK(mutex);
+    if (n == HDIMAGE_COPY_BUFFERS) {
+      BX_MSLEEP(1);
+    }
+  } while (n == HDIMAGE_COPY_BUFFERS);
+  return buffers[next_put].data;
+}
+
+void hdimage_copy_c::put_buffer(Bit64s offset, Bit32u len)
+{
+  buffers[next_put].offset = offset;
+  buffers[next_put].len = len;
+  bytes_read += len;
+  next_put = (next_put + 1) % HDIMAGE_COPY_BUFFERS;
+  BX_LOCK(mutex);
+  queued++;
+  BX_UNLOCK(mutex);
+}
+
+int hdimage_copy_c::finish()
+{
+  bool done;
+
+  BX_LOCK(mutex);
+  done = finished;
+  finishing = 1;
+  BX_UNLOCK(mutex);
+  if (!done) {
+    // BX_THREAD_JOIN() does not wait on all platforms
+    do {
+      BX_MSLEEP(1);
+      BX_LOCK(mutex);
+      done = finished;
+      BX_UNLOCK(mutex);
+    } while (!done);
+    BX_THREAD_JOIN(thread);
+    end_time = hdimage_copy_time();
+  }
+  return error ? -1 : 0;
+}
+
+void hdimage_copy_c::report(const char *what)
+{
+  char msg[128];
+  double sec = (double)(end_time - start_time) / 1000000.0;
+  double rd = (double)bytes_read / 1048576.0;
+
+  sprintf(msg, "%s: %.1f MB read, %.1f MB written in %.2f seconds (%.1f MB/s)",
+          what, rd, (double)bytes_written / 1048576.0, sec, (sec > 0) ? (rd / sec) : 0.0);
+#ifdef BXIMAGE
+  printf("%s\n", msg);
+#else
+  BX_INFO(("%s", msg));
+#endif
+}
+
+void hdimage_copy_c::writer()
+{
+  Bit32u sect_size = image->sect_size, start, end;
+  bx_iovec_t iov;
+  Bit8u *data;
+  int n;
+  bool done;
+
+  while (1) {
+    BX_LOCK(mutex);
+    n = queued;
+    done = finishing;
+    BX_UNLOCK(mutex);
+    if (n == 0) {
+      if (done) break;
+      BX_MSLEEP(1);
+      continue;
+    }
+    data = buffers[next_write].data;
+    end = 0;
+    while (!error && (end < buffers[next_write].len)) {
+      start = end;
+      if (skip_zero) {
+        while ((start < buffers[next_write].len) && hdimage_zero_block(data + start, sect_size)) {
+          start += sect_size;
+        }
+      }
+      end = start;
+      while ((end < buffers[next_write].len) &&
+             (!skip_zero || !hdimage_zero_block(data + end, sect_size))) {
+        end += sect_size;
+      }
+      if (end > start) {
+        iov.iov_base = data + start;
+        iov.iov_len = end - start;
+        if (image->writev(buffers[next_write].offset + start, &iov, 1) != (ssize_t)iov.iov_len) {
+          error = 1;
+        } else {
+          bytes_written += iov.iov_len;
+        }
+      }
+    }
+    next_write = (next_write + 1) % HDIMAGE_COPY_BUFFERS;
+    BX_LOCK(mutex);
+    queued--;
+    BX_UNLOCK(mutex);
+  }
+  BX_LOCK(mutex);
+  finished = 1;
+  BX_UNLOCK(mutex);
+}
+
+// image block cache implementation
+
+hdimage_cache_c::hdimage_cache_c(int _fd, Bit32u _block_size, int _entries, int _readahead)
+{
+  fd = _fd;
+  block_size = _block_size;
+  entries = (_entries > 2) ? _entries : 2;
+  // never let the readahead evict the block just requested
+  readahead = (_readahead < (entries / 2)) ? _readahead : (entries / 2);
+  blocks = new cache_block_t[entries];
+  for (int i = 0; i < entries; i++) {
+    blocks[i].offset = -1;
+    blocks[i].lru = 0;
+    blocks[i].dirty = 0;
+    blocks[i].data = new Bit8u[block_size];
+  }
+  lru_counter = 0;
+  last_entry = 0;
+  last_miss = -1;
+  ra_buffer = (readahead > 0) ? new Bit8u[(readahead + 1) * block_size] : NULL;
+}
+
+hdimage_cache_c::~hdimage_cache_c()
+{
+  flush();
+  for (int i = 0; i < entries; i++) {
+    delete [] blocks[i].data;
+  }
+  delete [] blocks;
+  if (ra_buffer != NULL) {
+    delete [] ra_buffer;
+  }
+}
+
+int hdimage_cache_c::find(Bit64s offset)
+{
+  if (blocks[last_entry].offset == offset)
+    return last_entry;
+  for (int i = 0; i < entries; i++) {
+    if (blocks[i].offset == offset)
+      return i;
+  }
+  return -1;
+}
+
+int hdimage_cache_c::evict(bool clean_only)
+{
+  int entry = 0;
+
+  for (int i = 1; i < entries; i++) {
+    if (blocks[i].lru < blocks[entry].lru) {
+      entry = i;
+    }
+  }
+  if (blocks[entry].dirty) {
+    if (clean_only || (write_back(entry) < 0))
+      return -1;
+  }
+  blocks[entry].offset = -1;
+  return entry;
+}
+
+int hdimage_cache_c::write_back(int i)
+{
+  if (bx_write_image(fd, blocks[i].offset, blocks[i].data, block_size) != (int)block_size) {
+    BX_ERROR(("image cache: failed to write block at offset " FMT_LL "d", blocks[i].offset));
+    return -1;
+  }
+  blocks[i].dirty = 0;
+  return 0;
+}
+
+Bit8u* hdimage_cache_c::get(Bit64s offset, bool modify, bool create)
+{
+  int entry, ret, count = 1;
+
+  entry = find(offset);
+  if (entry < 0) {
+    if ((entry = evict(0)) < 0)
+      return NULL;
+    if (create) {
+      memset(blocks[entry].data, 0, block_size);
+      modify = 1;
+    } else {
+      if ((readahead > 0) && (offset == (last_miss + (Bit64s)block_size))) {
+        count += readahead;
+        ret = bx_read_image(fd, offset, ra_buffer, count * block_size);
+        if (ret > 0) {
+          memcpy(blocks[entry].data, ra_buffer, ((Bit32u)ret < block_size) ? ret : block_size);
+        }
+      } else {
+        ret = bx_read_image(fd, offset, blocks[entry].data, block_size);
+      }
+      if (ret < 0) {
+        BX_ERROR(("image cache: failed to read block at offset " FMT_LL "d", offset));
+        return NULL;
+      }
+      // the end of a sparse image file may not be written yet
+      if ((Bit32u)ret < block_size) {
+        memset(blocks[entry].data + ret, 0, block_size - ret);
+      }
+      blocks[entry].offset = offset;
+      blocks[entry].lru = ++lru_counter;
+      last_miss = offset;
+      for (int i = 1; (i < count) && ((Bit32u)ret >= ((i + 1) * block_size)); i++) {
+        Bit64s ra_offset = offset + (Bit64s)i * block_size;
+        if (find(ra_offset) < 0) {
+          // writing back a block now could make the data read ahead stale
+          int ra_entry = evict(1);
+          if (ra_entry < 0)
+            break;
+          memcpy(blocks[ra_entry].data, ra_buffer + i * block_size, block_size);
+          blocks[ra_entry].offset = ra_offset;
+          blocks[ra_entry].lru = ++lru_counter;
+        }
+        last_miss = ra_offset;
+      }
+    }
+    blocks[entry].offset = offset;
+  }
+  blocks[entry].lru = ++lru_counter;
+  if (modify) {
+    blocks[entry].dirty = 1;
+  }
+  last_entry = entry;
+  return blocks[entry].data;
+}
+
+int hdimage_cache_c::flush()
+{
+  int ret = 0;
+
+  for (int i = 0; i < entries; i++) {
+    if (blocks[i].dirty && (write_back(i) < 0)) {
+      ret = -1;
+    }
+  }
+  return ret;
+}
+
 // redolog implementation
 redolog_t::redolog_t()
 {
   fd = -1;
   pathname = NULL;
   catalog = NULL;
-  bitmap = NULL;
+  catalog_dirty_first = REDOLOG_PAGE_NOT_ALLOCATED;
+  catalog_dirty_last = 0;
+  for (int i = 0; i < REDOLOG_BITMAP_CACHE; i++) {
+    bitmaps[i].index = REDOLOG_PAGE_NOT_ALLOCATED;
+    bitmaps[i].lru = 0;
+    bitmaps[i].dirty = 0;
+    bitmaps[i].data = NULL;
+  }
+  bitmap_lru = 0;
+  bitmap_last = 0;
   extent_index = (Bit32u)0;
   extent_offset = (Bit32u)0;
   extent_next = (Bit32u)0;
@@ -1720,10 +2320,9 @@ int redolog_t::make_header(const char* type, Bit64u size)
   print_header();
 
   catalog = new Bit32u[dtoh32(header.specific.catalog)];
-  bitmap =  new Bit8u[dtoh32(header.specific.bitmap)];
 
-  if ((catalog == NULL) || (bitmap==NULL))
-    BX_PANIC(("redolog : could not malloc catalog or bitmap"));
+  if (catalog == NULL)
+    BX_PANIC(("redolog : could not malloc catalog"));
 
   for (Bit32u i=0; i<dtoh32(header.specific.catalog); i++)
     catalog[i] = htod32(REDOLOG_PAGE_NOT_ALLOCATED);
@@ -1864,9 +2463,6 @@ int redolog_t::open(const char* filename, const char *type, int flags)
   }
   BX_INFO(("redolog : next extent will be at index %d",extent_next));
 
-  // memory used for storing bitmaps
-  bitmap = new Bit8u[dtoh32(header.specific.bitmap)];
-
   bitmap_blocks = 1 + (dtoh32(header.specific.bitmap) - 1) / 512;
   extent_blocks = 1 + (dtoh32(header.specific.extent) - 1) / 512;
 
@@ -1874,24 +2470,29 @@ int redolog_t::open(const char* filename, const char *type, int flags)
   BX_DEBUG(("redolog : each extent is %d blocks", extent_blocks));
 
   imagepos = 0;
-  bitmap_update = 1;
 
   return 0;
 }
 
 void redolog_t::close()
 {
-  if (fd >= 0)
+  if (fd >= 0) {
+    flush();
     bx_close_image(fd, pathname);
+    fd = -1;
+  }
 
-  if (pathname != NULL)
+  if (pathname != NULL) {
     delete [] pathname;
+    pathname = NULL;
+  }
 
-  if (catalog != NULL)
+  if (catalog != NULL) {
     delete [] catalog;
+    catalog = NULL;
+  }
 
-  if (bitmap != NULL)
-    delete [] bitmap;
+  free_bitmaps();
 }
 
 Bit64u redolog_t::get_size()
@@ -1931,11 +2532,7 @@ Bit64s redolog_t::lseek(Bit64s offset, int whence)
     return -1;
   }
 
-  Bit32u old_extent_index = extent_index;
   extent_index = (Bit32u)(imagepos / dtoh32(header.specific.extent));
-  if (extent_index != old_extent_index) {
-    bitmap_update = 1;
-  }
   extent_offset = (Bit32u)((imagepos % dtoh32(header.specific.extent)) / 512);
 
   BX_DEBUG(("redolog : lseeking extent index %d, offset %d",extent_index, extent_offset));
@@ -1943,136 +2540,297 @@ Bit64s redolog_t::lseek(Bit64s offset, int whence)
   return imagepos;
 }
 
-ssize_t redolog_t::read(void* buf, size_t count)
+Bit64s redolog_t::get_bitmap_offset(Bit32u index)
 {
-  Bit64s block_offset, bitmap_offset;
-  ssize_t ret;
+  Bit64s offset;
 
-  if (count != 512) {
-    BX_PANIC(("redolog : read() with count not 512"));
-    return -1;
+  offset  = (Bit64s)STANDARD_HEADER_SIZE + (dtoh32(header.specific.catalog) * sizeof(Bit32u));
+  offset += (Bit64s)512 * dtoh32(catalog[index]) * (extent_blocks + bitmap_blocks);
+  return offset;
+}
+
+// Return the bitmap of an allocated extent. The bitmaps are kept in a small
+// LRU cache and only written back when evicted or flushed. The bitmap of a
+// new extent is cleared instead of being read from the file.
+Bit8u* redolog_t::get_bitmap(Bit32u index, bool modify, bool clear)
+{
+  Bit32u bitmap_size = dtoh32(header.specific.bitmap);
+  int entry = bitmap_last;
+
+  if (bitmaps[entry].index != index) {
+    entry = 0;
+    for (int i = 0; i < REDOLOG_BITMAP_CACHE; i++) {
+      if (bitmaps[i].index == index) {
+        entry = i;
+        break;
+      }
+      if (bitmaps[i].lru < bitmaps[entry].lru) {
+        entry = i;
+      }
+    }
+    if (bitmaps[entry].index != index) {
+      if (bitmaps[entry].dirty && !write_bitmap(entry)) {
+        return NULL;
+      }
+      if (bitmaps[entry].data == NULL) {
+        bitmaps[entry].data = new Bit8u[bitmap_size];
+      }
+      bitmaps[entry].index = REDOLOG_PAGE_NOT_ALLOCATED;
+      if (clear) {
+        memset(bitmaps[entry].data, 0, bitmap_size);
+        modify = 1;
+      } else if (bx_read_image(fd, (off_t)get_bitmap_offset(index), bitmaps[entry].data, bitmap_size) != (ssize_t)bitmap_size) {
+        BX_PANIC(("redolog : failed to read bitmap for extent %d", index));
+        return NULL;
+      }
+      bitmaps[entry].index = index;
+    }
+    bitmap_last = entry;
   }
+  bitmaps[entry].lru = ++bitmap_lru;
+  if (modify) {
+    bitmaps[entry].dirty = 1;
+  }
+  return bitmaps[entry].data;
+}
 
-  BX_DEBUG(("redolog : reading index %d, mapping to %d", extent_index, dtoh32(catalog[extent_index])));
+bool redolog_t::write_bitmap(int entry)
+{
+  Bit32u bitmap_size = dtoh32(header.specific.bitmap);
+  Bit64s bitmap_offset = get_bitmap_offset(bitmaps[entry].index);
 
-  if (dtoh32(catalog[extent_index]) == REDOLOG_PAGE_NOT_ALLOCATED) {
-    // page not allocated
+  BX_DEBUG(("redolog : writing bitmap at offset %x", (Bit32u)bitmap_offset));
+
+  if (bx_write_image(fd, (off_t)bitmap_offset, bitmaps[entry].data, bitmap_size) != (ssize_t)bitmap_size) {
+    BX_PANIC(("redolog : failed to write bitmap for extent %d", bitmaps[entry].index));
     return 0;
   }
+  bitmaps[entry].dirty = 0;
+  return 1;
+}
 
-  bitmap_offset  = (Bit64s)STANDARD_HEADER_SIZE + (dtoh32(header.specific.catalog) * sizeof(Bit32u));
-  bitmap_offset += (Bit64s)512 * dtoh32(catalog[extent_index]) * (extent_blocks + bitmap_blocks);
-  block_offset    = bitmap_offset + ((Bit64s)512 * (bitmap_blocks + extent_offset));
+void redolog_t::free_bitmaps()
+{
+  for (int i = 0; i < REDOLOG_BITMAP_CACHE; i++) {
+    if (bitmaps[i].data != NULL) {
+      delete [] bitmaps[i].data;
+      bitmaps[i].data = NULL;
+    }
+    bitmaps[i].index = REDOLOG_PAGE_NOT_ALLOCATED;
+    bitmaps[i].lru = 0;
+    bitmaps[i].dirty = 0;
+  }
+  bitmap_lru = 0;
+  bitmap_last = 0;
+}
 
-  BX_DEBUG(("redolog : bitmap offset is %x", (Bit32u)bitmap_offset));
-  BX_DEBUG(("redolog : block offset is %x", (Bit32u)block_offset));
+bool redolog_t::allocate_extent(Bit32u index)
+{
+  Bit64s bitmap_offset, extent_size;
 
-  if (bitmap_update) {
-    if (bx_read_image(fd, (off_t)bitmap_offset, bitmap,  dtoh32(header.specific.bitmap)) != (ssize_t)dtoh32(header.specific.bitmap)) {
-      BX_PANIC(("redolog : failed to read bitmap for extent %d", extent_index));
-      return -1;
+  if (extent_next >= dtoh32(header.specific.catalog)) {
+    BX_PANIC(("redolog : can't allocate new extent... catalog is full"));
+    return 0;
+  }
+
+  BX_DEBUG(("redolog : allocating new extent at %d", extent_next));
+
+  catalog[index] = htod32(extent_next);
+  extent_next += 1;
+  if (index < catalog_dirty_first) catalog_dirty_first = index;
+  if (index > catalog_dirty_last) catalog_dirty_last = index;
+
+  // Reserve the space of bitmap and extent. The data blocks are not cleared,
+  // since only the blocks marked in the bitmap are ever read back.
+  bitmap_offset = get_bitmap_offset(index);
+  extent_size = (Bit64s)512 * (bitmap_blocks + extent_blocks);
+#if BX_HAVE_POSIX_FALLOCATE
+  if (posix_fallocate(fd, (off_t)bitmap_offset, (off_t)extent_size) != 0)
+#endif
+  {
+    Bit8u zerobuffer[512];
+
+    // extend the file by writing the last block of the extent
+    memset(zerobuffer, 0, 512);
+    if (bx_write_image(fd, (off_t)(bitmap_offset + extent_size - 512), zerobuffer, 512) != 512) {
+      BX_PANIC(("redolog : failed to allocate extent %d", index));
+      return 0;
     }
-    bitmap_update = 0;
   }
 
-  if (((bitmap[extent_offset/8] >> (extent_offset%8)) & 0x01) == 0x00) {
-    BX_DEBUG(("read not in redolog"));
+  return (get_bitmap(index, 1, 1) != NULL);
+}
 
-    // bitmap says block not in redolog
-    return 0;
+bool redolog_t::flush()
+{
+  Bit64s catalog_offset;
+  int size;
+  bool ret = 1;
+
+  // Write bitmaps before the catalog entries referring to them
+  for (int i = 0; i < REDOLOG_BITMAP_CACHE; i++) {
+    if (bitmaps[i].dirty && !write_bitmap(i)) {
+      ret = 0;
+    }
   }
 
-  ret = bx_read_image(fd, (off_t)block_offset, buf, count);
-  if (ret >= 0) lseek(512, SEEK_CUR);
+  if (catalog_dirty_first <= catalog_dirty_last) {
+    catalog_offset = (Bit64s)STANDARD_HEADER_SIZE + (catalog_dirty_first * sizeof(Bit32u));
+    size = (catalog_dirty_last - catalog_dirty_first + 1) * sizeof(Bit32u);
 
+    BX_DEBUG(("redolog : writing catalog at offset %x", (Bit32u)catalog_offset));
+
+    if (bx_write_image(fd, (off_t)catalog_offset, &catalog[catalog_dirty_first], size) != size) {
+      BX_PANIC(("redolog : failed to write catalog"));
+      return 0;
+    }
+    catalog_dirty_first = REDOLOG_PAGE_NOT_ALLOCATED;
+    catalog_dirty_last = 0;
+  }
   return ret;
 }
 
-ssize_t redolog_t::write(const void* buf, size_t count)
+ssize_t redolog_t::read(void* buf, size_t count)
 {
-  Bit32u i;
-  Bit64s block_offset, bitmap_offset, catalog_offset;
-  ssize_t written;
-  bool update_catalog = 0;
+  Bit8u *bitmap, *cbuf = (Bit8u*)buf;
+  Bit32u i, n, sectors;
+  Bit64s block_offset;
+  ssize_t len, total = 0;
 
-  if (count != 512) {
-    BX_PANIC(("redolog : write() with count not 512"));
+  if ((count % 512) != 0) {
+    BX_PANIC(("redolog : read() with count not multiple of 512"));
     return -1;
   }
 
-  BX_DEBUG(("redolog : writing index %d, mapping to %d", extent_index, dtoh32(catalog[extent_index])));
+  while (total < (ssize_t)count) {
+    BX_DEBUG(("redolog : reading index %d, mapping to %d", extent_index, dtoh32(catalog[extent_index])));
 
-  if (dtoh32(catalog[extent_index]) == REDOLOG_PAGE_NOT_ALLOCATED) {
-    if (extent_next >= dtoh32(header.specific.catalog)) {
-      BX_PANIC(("redolog : can't allocate new extent... catalog is full"));
+    if (dtoh32(catalog[extent_index]) == REDOLOG_PAGE_NOT_ALLOCATED) {
+      // page not allocated
+      break;
+    }
+    bitmap = get_bitmap(extent_index, 0, 0);
+    if (bitmap == NULL) {
       return -1;
     }
 
-    BX_DEBUG(("redolog : allocating new extent at %d", extent_next));
+    // count the following blocks of this extent found in the redolog
+    sectors = (Bit32u)((count - total) / 512);
+    for (n = 0; (n < sectors) && ((extent_offset + n) < extent_blocks); n++) {
+      i = extent_offset + n;
+      if (((bitmap[i/8] >> (i%8)) & 0x01) == 0x00) break;
+    }
+    if (n == 0) {
+      BX_DEBUG(("read not in redolog"));
+      break;
+    }
 
-    // Extent not allocated, allocate new
-    catalog[extent_index] = htod32(extent_next);
+    block_offset = get_bitmap_offset(extent_index) + ((Bit64s)512 * (bitmap_blocks + extent_offset));
+    BX_DEBUG(("redolog : block offset is %x", (Bit32u)block_offset));
 
-    extent_next += 1;
+    len = (ssize_t)n * 512;
+    if (bx_read_image(fd, (off_t)block_offset, cbuf, (int)len) != len) {
+      return -1;
+    }
+    lseek(len, SEEK_CUR);
+    cbuf += len;
+    total += len;
+    // the run continues in the next extent only if this one is complete
+    if (extent_offset != 0) break;
+  }
 
-    char *zerobuffer = new char[512];
-    memset(zerobuffer, 0, 512);
+  return total;
+}
 
-    // Write bitmap
-    bitmap_offset  = (Bit64s)STANDARD_HEADER_SIZE + (dtoh32(header.specific.catalog) * sizeof(Bit32u));
-    bitmap_offset += (Bit64s)512 * dtoh32(catalog[extent_index]) * (extent_blocks + bitmap_blocks);
-    ::lseek(fd, (off_t)bitmap_offset, SEEK_SET);
-    for (i=0; i<bitmap_blocks; i++) {
-      ::write(fd, zerobuffer, 512);
-    }
-    // Write extent
-    for (i=0; i<extent_blocks; i++) {
-      ::write(fd, zerobuffer, 512);
-    }
+ssize_t redolog_t::skip(size_t count)
+{
+  Bit8u *bitmap;
+  Bit32u i, n, sectors;
+  ssize_t len, total = 0;
 
-    delete [] zerobuffer;
+  while (total < (ssize_t)count) {
+    sectors = (Bit32u)((count - total) / 512);
+    n = extent_blocks - extent_offset;
+    if (n > sectors) n = sectors;
+    if (dtoh32(catalog[extent_index]) != REDOLOG_PAGE_NOT_ALLOCATED) {
+      bitmap = get_bitmap(extent_index, 0, 0);
+      if (bitmap == NULL) {
+        return -1;
+      }
+      for (i = 0; i < n; i++) {
+        if (((bitmap[(extent_offset+i)/8] >> ((extent_offset+i)%8)) & 0x01) != 0x00) break;
+      }
+      n = i;
+    }
+    if (n == 0) break;
 
-    update_catalog = 1;
+    len = (ssize_t)n * 512;
+    lseek(len, SEEK_CUR);
+    total += len;
+    if (extent_offset != 0) break;
   }
 
-  bitmap_offset  = (Bit64s)STANDARD_HEADER_SIZE + (dtoh32(header.specific.catalog) * sizeof(Bit32u));
-  bitmap_offset += (Bit64s)512 * dtoh32(catalog[extent_index]) * (extent_blocks + bitmap_blocks);
-  block_offset    = bitmap_offset + ((Bit64s)512 * (bitmap_blocks + extent_offset));
+  return total;
+}
 
-  BX_DEBUG(("redolog : bitmap offset is %x", (Bit32u)bitmap_offset));
-  BX_DEBUG(("redolog : block offset is %x", (Bit32u)block_offset));
+ssize_t redolog_t::write(const void* buf, size_t count)
+{
+  Bit8u *bitmap, *cbuf = (Bit8u*)buf;
+  Bit32u i, n, sectors;
+  Bit64s block_offset;
+  ssize_t len, total = 0;
+  bool modified = 0;
+
+  if ((count % 512) != 0) {
+    BX_PANIC(("redolog : write() with count not multiple of 512"));
+    return -1;
+  }
 
-  // Write block
-  written = bx_write_image(fd, (off_t)block_offset, (void*)buf, count);
+  while (total < (ssize_t)count) {
+    BX_DEBUG(("redolog : writing index %d, mapping to %d", extent_index, dtoh32(catalog[extent_index])));
 
-  // Write bitmap
-  if (bitmap_update) {
-    if (bx_read_image(fd, (off_t)bitmap_offset, bitmap,  dtoh32(header.specific.bitmap)) != (ssize_t)dtoh32(header.specific.bitmap)) {
-      BX_PANIC(("redolog : failed to read bitmap for extent %d", extent_index));
-      return 0;
+    if (dtoh32(catalog[extent_index]) == REDOLOG_PAGE_NOT_ALLOCATED) {
+      // Extent not allocated, allocate new
+      if (!allocate_extent(extent_index)) {
+        return -1;
+      }
+    }
+    bitmap = get_bitmap(extent_index, 0, 0);
+    if (bitmap == NULL) {
+      return -1;
     }
-    bitmap_update = 0;
-  }
 
-  // If bloc does not belong to extent yet
-  if (((bitmap[extent_offset/8] >> (extent_offset%8)) & 0x01) == 0x00) {
-    bitmap[extent_offset/8] |= 1 << (extent_offset%8);
-    bx_write_image(fd, (off_t)bitmap_offset, bitmap,  dtoh32(header.specific.bitmap));
-  }
+    sectors = (Bit32u)((count - total) / 512);
+    n = extent_blocks - extent_offset;
+    if (n > sectors) n = sectors;
 
-  // Write catalog
-  if (update_catalog) {
-    // FIXME if mmap
-    catalog_offset  = (Bit64s)STANDARD_HEADER_SIZE + (extent_index * sizeof(Bit32u));
+    block_offset = get_bitmap_offset(extent_index) + ((Bit64s)512 * (bitmap_blocks + extent_offset));
+    BX_DEBUG(("redolog : block offset is %x", (Bit32u)block_offset));
 
-    BX_DEBUG(("redolog : writing catalog at offset %x", (Bit32u)catalog_offset));
+    // Write blocks
+    len = (ssize_t)n * 512;
+    if (bx_write_image(fd, (off_t)block_offset, cbuf, (int)len) != len) {
+      return -1;
+    }
 
-    bx_write_image(fd, (off_t)catalog_offset, &catalog[extent_index], sizeof(Bit32u));
-  }
+    // Mark the blocks not belonging to the extent yet
+    for (i = extent_offset; i < (extent_offset + n); i++) {
+      if (((bitmap[i/8] >> (i%8)) & 0x01) == 0x00) {
+        bitmap[i/8] |= 1 << (i%8);
+        modified = 1;
+      }
+    }
+    if (modified) {
+      get_bitmap(extent_index, 1, 0);
+      modified = 0;
+    }
 
-  if (written >= 0) lseek(512, SEEK_CUR);
+    lseek(len, SEEK_CUR);
+    cbuf += len;
+    total += len;
+  }
 
-  return written;
+  return total;
 }
 
 int redolog_t::check_format(int fd, const char *subtype)
@@ -2102,74 +2860,91 @@ int redolog_t::check_format(int fd, const char *subtype)
   return HDIMAGE_FORMAT_OK;
 }
 
-#ifdef BXIMAGE
+// Unallocated extents are passed without reading their bitmap. The runs of
+// blocks found are read into large buffers and written by a separate thread.
 int redolog_t::commit(device_image_t *base_image)
 {
-  int ret = 0;
-  Bit32u i;
-  Bit8u buffer[512];
+  hdimage_copy_c *copy;
+  Bit64s offset = 0, disk_size = get_size(), len;
+  ssize_t ret = 0;
+#ifdef BXIMAGE
+  int percent, last = 0;
 
   printf("\nCommitting changes to base image file: [  0%%]");
+#endif
 
-  for (i = 0; i < dtoh32(header.specific.catalog); i++) {
-    printf("\x8\x8\x8\x8\x8%3d%%]", (i+1)*100/dtoh32(header.specific.catalog));
-    fflush(stdout);
-
-    if (dtoh32(catalog[i]) != REDOLOG_PAGE_NOT_ALLOCATED) {
-      Bit64s bitmap_offset;
-      Bit32u bitmap_size, j;
-
-      bitmap_offset  = (Bit64s)STANDARD_HEADER_SIZE + (dtoh32(header.specific.catalog) * sizeof(Bit32u));
-      bitmap_offset += (Bit64s)512 * dtoh32(catalog[i]) * (extent_blocks + bitmap_blocks);
-
-      // Read bitmap
-      bitmap_size = dtoh32(header.specific.bitmap);
-      if ((Bit32u)bx_read_image(fd, (off_t)bitmap_offset, bitmap, bitmap_size) != bitmap_size) {
-        ret = -1;
-        break;
-      }
-
-      for (j = 0; j < dtoh32(header.specific.bitmap); j++) {
-        Bit32u bit;
-
-        for (bit = 0; bit < 8; bit++) {
-          if ( (bitmap[j] & (1 << bit)) != 0) {
-            Bit64s base_offset, block_offset;
-
-            block_offset = bitmap_offset + ((Bit64s)512 * (bitmap_blocks + ((j * 8) + bit)));
-
-            if (bx_read_image(fd, (off_t)block_offset, buffer, 512) != 512) {
-              ret = -1;
-              break;
-            }
-
-            base_offset  = (Bit64s)i * (dtoh32(header.specific.extent));
-            base_offset += (Bit64s)512 * ((j * 8) + bit);
-
-            if (base_image->lseek(base_offset, SEEK_SET) < 0) {
-              ret = -1;
-              break;
-            }
-            if (base_image->write(buffer, 512) < 0) {
-              ret = -1;
-              break;
-            }
-          }
-        }
-      }
+  copy = new hdimage_copy_c(base_image, 0);
+  lseek(0, SEEK_SET);
+  while (offset < disk_size) {
+    len = disk_size - offset;
+    if (len > 0x40000000) len = 0x40000000;
+    ret = skip((size_t)len);
+    if (ret < 0) break;
+    offset += ret;
+    if (offset >= disk_size) break;
+    len = disk_size - offset;
+    if (len > HDIMAGE_COPY_BUFFER_SIZE) len = HDIMAGE_COPY_BUFFER_SIZE;
+    ret = read(copy->get_buffer(), (size_t)len);
+    if (ret <= 0) {
+      ret = -1;
+      break;
+    }
+    copy->put_buffer(offset, (Bit32u)ret);
+    offset += ret;
+#ifdef BXIMAGE
+    percent = (int)(offset * 100 / disk_size);
+    if (percent != last) {
+      printf("\x8\x8\x8\x8\x8%3d%%]", percent);
+      fflush(stdout);
+      last = percent;
     }
+#endif
   }
-  return ret;
-}
+  if (copy->finish() < 0) {
+    ret = -1;
+  }
+#ifdef BXIMAGE
+  printf("\x8\x8\x8\x8\x8%3d%%]\n", 100);
 #endif
+  copy->report("redolog commit");
+  delete copy;
+  return (ret < 0) ? -1 : 0;
+}
 
 #ifndef BXIMAGE
 bool redolog_t::save_state(const char *backup_fname)
 {
+  if (!flush()) {
+    return 0;
+  }
   return hdimage_backup_file(fd, backup_fname);
 }
 #endif
 
+// The redolog based images transfer each buffer with a single access
+
+static ssize_t redolog_image_rw(device_image_t *image, Bit64s offset,
+                                const bx_iovec_t *iov, int iovcnt, bool write)
+{
+  ssize_t ret, total = 0;
+
+  if (image->lseek(offset, SEEK_SET) < 0) {
+    return -1;
+  }
+  for (int i = 0; i < iovcnt; i++) {
+    if (write) {
+      ret = image->write(iov[i].iov_base, iov[i].iov_len);
+    } else {
+      ret = image->read(iov[i].iov_base, iov[i].iov_len);
+    }
+    if (ret != (ssize_t)iov[i].iov_len) {
+      return -1;
+    }
+    total += ret;
+  }
+  return total;
+}
+
 /*** growing_image_t function definitions ***/
 
 growing_image_t::growing_image_t()
@@ -2209,27 +2984,31 @@ ssize_t growing_image_t::read(void* buf, size_t count)
 
   memset(buf, 0, count);
   while (n < count) {
-    ret = redolog->read(cbuf, 512);
-    if (ret < 0) break;
-    cbuf += 512;
-    n += 512;
+    ret = redolog->read(cbuf, count - n);
+    if (ret == 0) {
+      // blocks not in the redolog read as zeros
+      ret = redolog->skip(count - n);
+    }
+    if (ret <= 0) return -1;
+    cbuf += ret;
+    n += ret;
   }
-  return (ret < 0) ? ret : count;
+  return count;
 }
 
 ssize_t growing_image_t::write(const void* buf, size_t count)
 {
-  char *cbuf = (char*)buf;
-  size_t n = 0;
-  ssize_t ret = 0;
+  return redolog->write(buf, count);
+}
 
-  while (n < count) {
-    ret = redolog->write(cbuf, 512);
-    if (ret < 0) break;
-    cbuf += 512;
-    n += 512;
-  }
-  return (ret < 0) ? ret : count;
+ssize_t growing_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  return redolog_image_rw(this, offset, iov, iovcnt, 0);
+}
+
+ssize_t growing_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  return redolog_image_rw(this, offset, iov, iovcnt, 1);
 }
 
 Bit32u growing_image_t::get_timestamp()
@@ -2237,6 +3016,11 @@ Bit32u growing_image_t::get_timestamp()
   return redolog->get_timestamp();
 }
 
+int growing_image_t::flush()
+{
+  return redolog->flush() ? 0 : -1;
+}
+
 int growing_image_t::check_format(int fd, Bit64u imgsize)
 {
   return redolog_t::check_format(fd, REDOLOG_SUBTYPE_GROWING);
@@ -2317,6 +3101,7 @@ bool coherency_check(device_image_t *ro_disk, redolog_t *redolog)
 undoable_image_t::undoable_image_t(const char* _redolog_name)
 {
   redolog = new redolog_t();
+  ro_name = NULL;
   redolog_name = NULL;
   if (_redolog_name != NULL) {
     if ((strlen(_redolog_name) > 0) && (strcmp(_redolog_name,"none") != 0)) {
@@ -2352,6 +3137,8 @@ int undoable_image_t::open(const char* pathname, int flags)
   }
   if (ro_disk->open(pathname, O_RDONLY) < 0)
     return -1;
+  ro_name = new char[strlen(pathname) + 1];
+  strcpy(ro_name, pathname);
 
   hd_size = ro_disk->hd_size;
   if (ro_disk->get_capabilities() & HDIMAGE_HAS_GEOMETRY) {
@@ -2391,6 +3178,9 @@ void undoable_image_t::close()
   redolog->close();
   ro_disk->close();
 
+  if (ro_name != NULL)
+    delete [] ro_name;
+
   if (redolog_name != NULL)
     delete [] redolog_name;
 }
@@ -2406,31 +3196,45 @@ ssize_t undoable_image_t::read(void* buf, size_t count)
   char *cbuf = (char*)buf;
   size_t n = 0;
   ssize_t ret = 0;
+  Bit64s offset = redolog->lseek(0, SEEK_CUR);
+  bx_iovec_t iov;
 
   while (n < count) {
-    if ((size_t)redolog->read(cbuf, 512) != 512) {
-      ret = ro_disk->read(cbuf, 512);
-      if (ret < 0) break;
+    ret = redolog->read(cbuf, count - n);
+    if (ret == 0) {
+      // read the blocks not in the redolog from the r/o disk
+      ret = redolog->skip(count - n);
+      if (ret > 0) {
+        iov.iov_base = cbuf;
+        iov.iov_len = ret;
+        if (ro_disk->readv(offset + n, &iov, 1) != ret) return -1;
+      }
     }
-    cbuf += 512;
-    n += 512;
+    if (ret <= 0) return -1;
+    cbuf += ret;
+    n += ret;
   }
-  return (ret < 0) ? ret : count;
+  return count;
 }
 
 ssize_t undoable_image_t::write(const void* buf, size_t count)
 {
-  char *cbuf = (char*)buf;
-  size_t n = 0;
-  ssize_t ret = 0;
+  return redolog->write(buf, count);
+}
 
-  while (n < count) {
-    ret = redolog->write(cbuf, 512);
-    if (ret < 0) break;
-    cbuf += 512;
-    n += 512;
-  }
-  return (ret < 0) ? ret : count;
+ssize_t undoable_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  return redolog_image_rw(this, offset, iov, iovcnt, 0);
+}
+
+ssize_t undoable_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  return redolog_image_rw(this, offset, iov, iovcnt, 1);
+}
+
+int undoable_image_t::flush()
+{
+  return redolog->flush() ? 0 : -1;
 }
 
 #ifndef BXIMAGE
@@ -2462,6 +3266,26 @@ void undoable_image_t::restore_state(const char *backup_fname)
     }
   }
 }
+
+int undoable_image_t::commit()
+{
+  int ret;
+
+  BX_INFO(("committing redolog '%s' to '%s'", redolog_name, ro_name));
+  ro_disk->close();
+  if (ro_disk->open(ro_name, O_RDWR) < 0) {
+    BX_ERROR(("Can't open base image '%s' for writing", ro_name));
+    ro_disk->open(ro_name, O_RDONLY);
+    return -1;
+  }
+  ret = redolog->commit(ro_disk);
+  if (ret == 0) {
+    // the next session starts with an empty redolog
+    redolog->close();
+    unlink(redolog_name);
+  }
+  return ret;
+}
 #endif
 
 /*** volatile_image_t function definitions ***/
@@ -2477,6 +3301,8 @@ volatile_image_t::volatile_image_t(const char* _redolog_name)
       strcpy(redolog_name, _redolog_name);
     }
   }
+  caps = 0;
+  close_ro_disk = 1;
 }
 
 volatile_image_t::~volatile_image_t()
@@ -2487,8 +3313,6 @@ volatile_image_t::~volatile_image_t()
 
 int volatile_image_t::open(const char* pathname, int flags)
 {
-  int filedes;
-  Bit32u timestamp;
   const char* image_mode = NULL;
 
   UNUSED(flags);
@@ -2508,6 +3332,26 @@ int volatile_image_t::open(const char* pathname, int flags)
   if (ro_disk->open(pathname, O_RDONLY)<0)
     return -1;
 
+  return create_redolog(pathname);
+}
+
+#ifndef BXIMAGE
+int volatile_image_t::open(device_image_t *base, const char* pathname, bool close_base)
+{
+  ro_disk = base;
+  close_ro_disk = close_base;
+  cylinders = base->cylinders;
+  heads = base->heads;
+  spt = base->spt;
+  return create_redolog(pathname);
+}
+#endif
+
+int volatile_image_t::create_redolog(const char* pathname)
+{
+  int filedes;
+  Bit32u timestamp;
+
   hd_size = ro_disk->hd_size;
   if (ro_disk->get_capabilities() & HDIMAGE_HAS_GEOMETRY) {
     cylinders = ro_disk->cylinders;
@@ -2556,7 +3400,8 @@ int volatile_image_t::open(const char* pathname, int flags)
 void volatile_image_t::close()
 {
   redolog->close();
-  ro_disk->close();
+  if (close_ro_disk)
+    ro_disk->close();
 
 #if defined(WIN32) || BX_WITH_MACOS
   // on non-unix we have to wait till the file is closed to delete it
@@ -2580,31 +3425,40 @@ ssize_t volatile_image_t::read(void* buf, size_t count)
   char *cbuf = (char*)buf;
   size_t n = 0;
   ssize_t ret = 0;
+  Bit64s offset = redolog->lseek(0, SEEK_CUR);
+  bx_iovec_t iov;
 
   while (n < count) {
-    if ((size_t)redolog->read(cbuf, 512) != 512) {
-      ret = ro_disk->read(cbuf, 512);
-      if (ret < 0) break;
+    ret = redolog->read(cbuf, count - n);
+    if (ret == 0) {
+      // read the blocks not in the redolog from the r/o disk
+      ret = redolog->skip(count - n);
+      if (ret > 0) {
+        iov.iov_base = cbuf;
+        iov.iov_len = ret;
+        if (ro_disk->readv(offset + n, &iov, 1) != ret) return -1;
+      }
     }
-    cbuf += 512;
-    n += 512;
+    if (ret <= 0) return -1;
+    cbuf += ret;
+    n += ret;
   }
-  return (ret < 0) ? ret : count;
+  return count;
 }
 
 ssize_t volatile_image_t::write(const void* buf, size_t count)
 {
-  char *cbuf = (char*)buf;
-  size_t n = 0;
-  ssize_t ret = 0;
+  return redolog->write(buf, count);
+}
 
-  while (n < count) {
-    ret = redolog->write(cbuf, 512);
-    if (ret < 0) break;
-    cbuf += 512;
-    n += 512;
-  }
-  return (ret < 0) ? ret : count;
+ssize_t volatile_image_t::readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  return redolog_image_rw(this, offset, iov, iovcnt, 0);
+}
+
+ssize_t volatile_image_t::writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt)
+{
+  return redolog_image_rw(this, offset, iov, iovcnt, 1);
 }
 
 #ifndef BXIMAGE
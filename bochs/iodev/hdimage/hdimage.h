@@ -21,6 +21,8 @@
 #ifndef BX_HDIMAGE_H
 #define BX_HDIMAGE_H
 
+#include "bxthread.h"
+
 // required for access() checks
 #ifndef F_OK
 #define F_OK 0
@@ -80,6 +82,9 @@
 
 #define REDOLOG_PAGE_NOT_ALLOCATED (0xffffffff)
 
+// number of extent bitmaps kept in memory
+#define REDOLOG_BITMAP_CACHE 32
+
 #define UNDOABLE_REDOLOG_EXTENSION ".redolog"
 #define UNDOABLE_REDOLOG_EXTENSION_LENGTH (strlen(UNDOABLE_REDOLOG_EXTENSION))
 #define VOLATILE_REDOLOG_EXTENSION ".XXXXXX"
@@ -142,6 +147,17 @@ class device_image_t;
 class redolog_t;
 class cdrom_base_c;
 
+// scatter/gather buffer used by the vectored read/write methods
+#ifndef WIN32
+#include <sys/uio.h>
+typedef struct iovec bx_iovec_t;
+#else
+typedef struct {
+  void   *iov_base;
+  size_t  iov_len;
+} bx_iovec_t;
+#endif
+
 #ifdef BXIMAGE
 int bx_create_image_file(const char *filename);
 #endif
@@ -192,12 +208,23 @@ class BOCHSAPI_MSVCONLY device_image_t
       // written (count).
       virtual ssize_t write(const void* buf, size_t count) = 0;
 
+      // Read / write the iovcnt buffers in iov starting at byte offset.
+      // The buffer sizes must be multiples of sect_size. Return the number
+      // of bytes transferred or -1 on error. The default implementation
+      // seeks and reads / writes each sector separately.
+      virtual ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+      virtual ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+
       // Get image capabilities
       virtual Bit32u get_capabilities();
 
       // Get modification time in FAT format
       virtual Bit32u get_timestamp();
 
+      // Write the data cached in memory back to the image file. Returns 0
+      // on success or -1 on failure.
+      virtual int flush() {return 0;}
+
       // Check image format
       static int check_format(int fd, Bit64u imgsize) {return HDIMAGE_NO_SIGNATURE;}
 
@@ -209,6 +236,14 @@ class BOCHSAPI_MSVCONLY device_image_t
       virtual void register_state(bx_list_c *parent);
       virtual bool save_state(const char *backup_fname) {return 0;}
       virtual void restore_state(const char *backup_fname) {}
+
+      // Write the changes kept in a redolog to the base image. Returns -1
+      // on failure or if the image mode has no base image.
+      virtual int commit() {return -1;}
+
+      // Stop the helper threads of the image before the simulation forks.
+      // The image starts them again when it needs them.
+      virtual void stop_threads() {}
 #endif
 
       unsigned cylinders;
@@ -246,6 +281,10 @@ class flat_image_t : public device_image_t
       // written (count).
       ssize_t write(const void* buf, size_t count);
 
+      // Vectored read / write with a single preadv() / pwritev() call
+      ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+      ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+
       // Check image format
       static int check_format(int fd, Bit64u imgsize);
 
@@ -447,25 +486,48 @@ class BOCHSAPI_MSVCONLY redolog_t
       bool set_timestamp(Bit32u timestamp);
 
       Bit64s lseek(Bit64s offset, int whence);
+      // Read the sectors at the current position that are stored in the
+      // redolog, up to count bytes. Stops at the first sector not found and
+      // returns the number of bytes read (0 if the first one is missing).
       ssize_t read(void* buf, size_t count);
+      // Skip the sectors at the current position that are not stored in the
+      // redolog, up to count bytes. Returns the number of bytes skipped.
+      ssize_t skip(size_t count);
       ssize_t write(const void* buf, size_t count);
+      // Write the modified bitmaps and catalog entries to the file
+      bool flush();
 
       static int check_format(int fd, const char *subtype);
-
-#ifdef BXIMAGE
+      // Copy the blocks stored in the redolog to the base image
       int commit(device_image_t *base_image);
-#else
+
+#ifndef BXIMAGE
       bool save_state(const char *backup_fname);
 #endif
 
   private:
       void             print_header();
+      Bit64s           get_bitmap_offset(Bit32u index);
+      Bit8u           *get_bitmap(Bit32u index, bool modify, bool clear);
+      bool             write_bitmap(int entry);
+      bool             allocate_extent(Bit32u index);
+      void             free_bitmaps();
+
       char            *pathname;
       int              fd;
       redolog_header_t header;     // Header is kept in x86 (little) endianness
       Bit32u          *catalog;
-      Bit8u           *bitmap;
-      bool             bitmap_update;
+      Bit32u           catalog_dirty_first;
+      Bit32u           catalog_dirty_last;
+      // LRU cache of extent bitmaps, written back when evicted or flushed
+      struct {
+        Bit32u index;              // extent index or REDOLOG_PAGE_NOT_ALLOCATED
+        Bit32u lru;
+        bool   dirty;
+        Bit8u *data;
+      } bitmaps[REDOLOG_BITMAP_CACHE];
+      Bit32u           bitmap_lru;
+      int              bitmap_last;
       Bit32u           extent_index;
       Bit32u           extent_offset;
       Bit32u           extent_next;
@@ -502,9 +564,16 @@ class growing_image_t : public device_image_t
       // written (count).
       ssize_t write(const void* buf, size_t count);
 
+      // Read / write runs of sectors with a single redolog access
+      ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+      ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+
       // Get modification time in FAT format
       virtual Bit32u get_timestamp();
 
+      // Write the cached redolog bitmaps and catalog
+      int flush();
+
       // Check image format
       static int check_format(int fd, Bit64u imgsize);
 
@@ -548,18 +617,29 @@ class undoable_image_t : public device_image_t
       // written (count).
       ssize_t write(const void* buf, size_t count);
 
+      // Read / write runs of sectors with a single redolog access
+      ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+      ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+
       // Get image capabilities
       virtual Bit32u get_capabilities() {return caps;}
 
+      // Write the cached redolog bitmaps and catalog
+      int flush();
+
 #ifndef BXIMAGE
       // Save/restore support
       bool save_state(const char *backup_fname);
       void restore_state(const char *backup_fname);
+
+      // Commit the redolog to the base image and remove it
+      int commit();
 #endif
 
   private:
       redolog_t       *redolog;       // Redolog instance
       device_image_t  *ro_disk;       // Read-only base disk instance
+      char            *ro_name;       // Base disk name
       char            *redolog_name;  // Redolog name
       Bit32u          caps;
 };
@@ -576,6 +656,12 @@ class volatile_image_t : public device_image_t
       // Open an image with specific flags. Returns non-negative if successful.
       int open(const char* pathname, int flags);
 
+#ifndef BXIMAGE
+      // Put the redolog on top of an image that is already open. The base
+      // image is closed with this one if close_base is set.
+      int open(device_image_t *base, const char* pathname, bool close_base);
+#endif
+
       // Close the image.
       void close();
 
@@ -591,6 +677,10 @@ class volatile_image_t : public device_image_t
       // written (count).
       ssize_t write(const void* buf, size_t count);
 
+      // Read / write runs of sectors with a single redolog access
+      ssize_t readv(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+      ssize_t writev(Bit64s offset, const bx_iovec_t *iov, int iovcnt);
+
       // Get image capabilities
       virtual Bit32u get_capabilities() {return caps;}
 
@@ -601,16 +691,125 @@ class volatile_image_t : public device_image_t
 #endif
 
   private:
+      int create_redolog(const char* pathname);
+
       redolog_t       *redolog;       // Redolog instance
       device_image_t  *ro_disk;       // Read-only base disk instance
       char            *redolog_name;  // Redolog name
       char            *redolog_temp;  // Redolog temporary file name
       Bit32u          caps;
+      bool            close_ro_disk;
 };
 
 
+// STREAMING IMAGE COPY
+// Used for committing redologs and converting images. The caller reads the
+// source data into large buffers, a separate thread writes them to the
+// destination image in the meantime.
+#define HDIMAGE_COPY_BUFFERS     4
+#define HDIMAGE_COPY_BUFFER_SIZE (4 << 20)
+
+class BOCHSAPI_MSVCONLY hdimage_copy_c
+{
+  public:
+      // Runs of zero sectors are not written if skip_zero is set
+      hdimage_copy_c(device_image_t *dst, bool skip_zero);
+      ~hdimage_copy_c();
+
+      // Return the next free buffer (HDIMAGE_COPY_BUFFER_SIZE bytes)
+      Bit8u* get_buffer();
+      // Queue the buffer returned by get_buffer() for writing at offset
+      void put_buffer(Bit64s offset, Bit32u len);
+      // Wait until all data is written. Returns 0 on success.
+      int finish();
+      // Print the amount of data copied and the throughput
+      void report(const char *what);
+
+      void writer();
+
+  private:
+      device_image_t *image;
+      bool skip_zero;
+      struct {
+        Bit8u  *data;
+        Bit64s  offset;
+        Bit32u  len;
+      } buffers[HDIMAGE_COPY_BUFFERS];
+      int next_put;
+      int next_write;
+      volatile int queued;
+      volatile bool finishing;
+      volatile bool finished;
+      bool error;
+      Bit64u bytes_read;
+      Bit64u bytes_written;
+      Bit64u start_time;
+      Bit64u end_time;
+      BX_MUTEX(mutex);
+      BX_THREAD_VAR(thread);
+};
+
+// IMAGE BLOCK CACHE
+// LRU cache for fixed size blocks of an image file (grain tables, block
+// bitmaps, data blocks). Modified blocks are written back when they are
+// evicted or on flush(). A miss on the block following the previous miss
+// reads the next blocks of the file too.
+class BOCHSAPI_MSVCONLY hdimage_cache_c
+{
+  public:
+      hdimage_cache_c(int fd, Bit32u block_size, int entries, int readahead);
+      ~hdimage_cache_c();
+
+      // Return the block at byte offset 'offset' of the file or NULL on
+      // error. The pointer is valid until the next get() call. With 'modify'
+      // set the block is marked dirty, with 'create' it is zero-filled
+      // instead of read from the file.
+      Bit8u* get(Bit64s offset, bool modify, bool create = 0);
+      // Write all dirty blocks to the file. Returns 0 on success.
+      int flush();
+
+  private:
+      int find(Bit64s offset);
+      int evict(bool clean_only);
+      int write_back(int i);
+
+      int fd;
+      Bit32u block_size;
+      int entries;
+      int readahead;
+      struct cache_block_t {
+        Bit64s offset;
+        Bit32u lru;
+        bool   dirty;
+        Bit8u  *data;
+      } *blocks;
+      Bit32u lru_counter;
+      int    last_entry;
+      Bit64s last_miss;
+      Bit8u  *ra_buffer;
+};
+
 #ifndef BXIMAGE
 
+// ASYNCHRONOUS IMAGE ACCESS
+// The requests are serviced by a pool of host I/O threads. Only one request
+// per image may be pending, the device polls for its completion.
+#define BX_AIO_THREADS 4
+
+#define BX_AIO_IDLE    0
+#define BX_AIO_PENDING 1
+#define BX_AIO_DONE    2
+
+typedef struct bx_aio_request_t {
+  device_image_t *image;
+  Bit64s offset;
+  bx_iovec_t iov;
+  bool write;
+  ssize_t ret;
+  int state;
+  struct bx_aio_request_t *next;
+} bx_aio_request_t;
+
 #define DEV_hdimage_init_image(a,b,c) bx_hdimage_ctl.init_image(a,b,c)
 #define DEV_hdimage_init_cdrom(a)     bx_hdimage_ctl.init_cdrom(a)
 
@@ -625,6 +824,20 @@ public:
   void exit(void);
   device_image_t *init_image(const char *image_mode, Bit64u disk_size, const char *journal);
   cdrom_base_c *init_cdrom(const char *dev);
+  // asynchronous image access
+  void aio_submit(bx_aio_request_t *req);
+  bool aio_done(bx_aio_request_t *req);
+  void aio_wait(bx_aio_request_t *req);
+  void aio_flush(void);
+  void aio_worker(void);
+  // images running helper threads
+  void add_thread_image(device_image_t *image);
+  void remove_thread_image(device_image_t *image);
+  void before_fork(void);
+  void after_fork(bool child);
+private:
+  void aio_start(void);
+  void aio_stop(void);
 };
 
 BOCHSAPI extern bx_hdimage_ctl_c bx_hdimage_ctl;
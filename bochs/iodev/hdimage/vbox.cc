@@ -89,10 +89,9 @@ protected:
 vbox_image_t::vbox_image_t()
   : file_descriptor(-1),
   mtlb(0),
+  block_cache(0),
   block_data(0),
   current_offset(INVALID_OFFSET),
-  mtlb_sector(0),
-  is_dirty(0),
   mtlb_dirty(0),
   header_dirty(0)
 {
@@ -123,12 +122,9 @@ int vbox_image_t::open(const char* _pathname, int flags)
     return -1;
   }
 
-  // allocate one block of memory
-  block_data = new Bit8u[(unsigned) header.block_size];
-  if (block_data == 0) {
-    BX_PANIC(("unable to allocate %d bytes for vbox block size", header.block_size));
-  }
-  is_dirty = 0;
+  // the most recently used blocks are kept in memory
+  block_cache = new hdimage_cache_c(file_descriptor, header.block_size, VBOX_BLOCK_CACHE, VBOX_READAHEAD);
+  block_data = 0;
   mtlb_dirty = 0;
   header_dirty = 0;
 
@@ -147,10 +143,6 @@ int vbox_image_t::open(const char* _pathname, int flags)
       BX_PANIC(("did not read in map table"));
   }
 
-  // read in the first index so that we have something in memory
-  read_block(0);
-
-  mtlb_sector = 0;
   current_offset = 0;
 
   hd_size = header.disk_size;
@@ -182,23 +174,9 @@ void vbox_image_t::close()
 
   flush();
 
-  // write the map back to the disk
-  if (mtlb_dirty) {
-    if (bx_write_image(file_descriptor, header.offset_blocks, mtlb, (unsigned) header.blocks_in_hdd * sizeof(Bit32u))
-        != (ssize_t)(header.blocks_in_hdd * sizeof(Bit32u))) {
-        BX_PANIC(("did not write map table"));
-    }
-  }
-
-  // write header back to image
-  if (header_dirty) {
-    if (bx_write_image(file_descriptor, 0, &header, sizeof(VBOX_VDI_Header)) != sizeof(VBOX_VDI_Header)) {
-      BX_PANIC(("did not write header"));
-    }
-  }
-
+  delete block_cache; block_cache = 0;
   delete [] mtlb; mtlb = 0;
-  delete [] block_data; block_data = 0;
+  block_data = 0;
 
   bx_close_image(file_descriptor, pathname);
   file_descriptor = -1;
@@ -227,7 +205,7 @@ ssize_t vbox_image_t::read(void *buf, size_t count)
   char *cbuf = (char*)buf;
   ssize_t total = 0;
   while (count > 0) {
-    off_t readable = perform_seek();
+    off_t readable = perform_seek(0);
     if (readable == INVALID_OFFSET) {
       BX_ERROR(("vbox disk image read failed on %u bytes at " FMT_LL "d", (unsigned)count, current_offset));
       return -1;
@@ -235,7 +213,11 @@ ssize_t vbox_image_t::read(void *buf, size_t count)
 
     off_t copysize = ((off_t)count > readable) ? readable : count;
     off_t offset = current_offset & (header.block_size - 1);
-    memcpy(cbuf, block_data + (size_t) offset, (size_t) copysize);
+    if (block_data != 0) {
+      memcpy(cbuf, block_data + (size_t) offset, (size_t) copysize);
+    } else {
+      memset(cbuf, 0, (size_t) copysize);
+    }
 
     current_offset += copysize;
     total += (long) copysize;
@@ -251,7 +233,7 @@ ssize_t vbox_image_t::write(const void *buf, size_t count)
   char *cbuf = (char*)buf;
   ssize_t total = 0;
   while (count > 0) {
-    off_t writable = perform_seek();
+    off_t writable = perform_seek(1);
     if (writable == INVALID_OFFSET) {
       BX_ERROR(("vbox disk image write failed on %u bytes at " FMT_LL "d", (unsigned)count, current_offset));
       return -1;
@@ -265,7 +247,6 @@ ssize_t vbox_image_t::write(const void *buf, size_t count)
     total += (long) writesize;
     cbuf += writesize;
     count -= (size_t) writesize;
-    is_dirty = 1;
   }
   return total;
 }
@@ -336,7 +317,7 @@ bool vbox_image_t::read_header()
 // Returns the number of bytes that can be read from the current offset before needing
 // to perform another seek.
 //
-off_t vbox_image_t::perform_seek()
+off_t vbox_image_t::perform_seek(bool write)
 {
   if (current_offset == INVALID_OFFSET) {
     BX_ERROR(("invalid offset specified in vbox seek"));
@@ -345,79 +326,75 @@ off_t vbox_image_t::perform_seek()
 
   Bit32u index = (Bit32u) (current_offset / header.block_size);
 
-  if (mtlb_sector == index) {
-    return header.block_size - (current_offset & (header.block_size - 1));
-  } else {
-    flush();
-
-    read_block(index);
-    mtlb_sector = index;
-
-    return header.block_size;
+  block_data = read_block(index, write);
+  if ((block_data == 0) && (write || (dtoh32(mtlb[index]) != -1))) {
+    return INVALID_OFFSET;
   }
+  return header.block_size - (current_offset & (header.block_size - 1));
 }
 
-void vbox_image_t::flush()
+int vbox_image_t::flush()
 {
-  if (!is_dirty)
-    return;
-
   //
-  // Write dirty sectors to disk.
+  // Write dirty blocks to disk first.
   //
-  write_block(mtlb_sector);
-  is_dirty = 0;
-}
-
-void vbox_image_t::read_block(const Bit32u index)
-{
-  off_t offset;
+  if (block_cache->flush() < 0)
+    return -1;
 
-  // if the mtlb[index] returns -1, then we haven't written this sector
-  //  to disk yet, so return an "empty" buffer
-  if (dtoh32(mtlb[index]) == -1) {
-    if (header.image_type == 2) {
-      BX_PANIC(("Found non-existing block in Static type image"));
+  // write the map back to the disk
+  if (mtlb_dirty) {
+    if (bx_write_image(file_descriptor, header.offset_blocks, mtlb, (unsigned) header.blocks_in_hdd * sizeof(Bit32u))
+        != (ssize_t)(header.blocks_in_hdd * sizeof(Bit32u))) {
+        BX_PANIC(("did not write map table"));
+        return -1;
     }
-    memset(block_data, 0, header.block_size);
+    mtlb_dirty = 0;
+  }
 
-    BX_DEBUG(("reading empty block index %d", index));
-  } else {
-    if (dtoh32(mtlb[index]) >= (int) header.blocks_in_hdd) {
-      BX_PANIC(("Trying to read past end of image (index out of range)"));
+  // write header back to image
+  if (header_dirty) {
+    if (bx_write_image(file_descriptor, 0, &header, sizeof(VBOX_VDI_Header)) != sizeof(VBOX_VDI_Header)) {
+      BX_PANIC(("did not write header"));
+      return -1;
     }
-    offset = dtoh32(mtlb[index]) * header.block_size;
-    bx_read_image(file_descriptor, header.offset_data + offset, block_data, header.block_size);
-
-    BX_DEBUG(("reading block index %d (%d) " FMT_LL "d", index, dtoh32(mtlb[index]), offset));
+    header_dirty = 0;
   }
+  return 0;
 }
 
-void vbox_image_t::write_block(const Bit32u index)
+//
+// Returns the data of the block from the block cache. A block that has not been
+// written yet reads as NULL (all zero) and is allocated if 'write' is set.
+//
+Bit8u* vbox_image_t::read_block(const Bit32u index, bool write)
 {
   off_t offset;
+  bool create = 0;
 
   // if the mtlb[index] returns -1, then we haven't written this sector
-  //  to disk yet, so allocate another and write it to file
+  //  to disk yet, so allocate another one if required
   if (dtoh32(mtlb[index]) == -1) {
     if (header.image_type == 2) {
       BX_PANIC(("Found non-existing block in Static type image"));
     }
+    if (!write) {
+      BX_DEBUG(("reading empty block index %d", index));
+      return 0;
+    }
     mtlb[index] = htod32(header.blocks_allocated++);
     BX_DEBUG(("allocating new block at block: %d", dtoh32(mtlb[index])));
     mtlb_dirty = 1;
     header_dirty = 1;
+    create = 1;
   }
 
   if (dtoh32(mtlb[index]) >= (int) header.blocks_in_hdd) {
-    BX_PANIC(("Trying to write past end of image (index out of range)"));
+    BX_PANIC(("Trying to access past end of image (index out of range)"));
+    return 0;
   }
+  offset = (off_t) dtoh32(mtlb[index]) * header.block_size;
 
-  offset = dtoh32(mtlb[index]) * header.block_size;
-
-  BX_DEBUG(("writing block index %d (%d) " FMT_LL "d", index, dtoh32(mtlb[index]), offset));
-
-  bx_write_image(file_descriptor, header.offset_data + offset, block_data, header.block_size);
+  return block_cache->get(header.offset_data + offset, write, create);
 }
 
 Bit32u vbox_image_t::get_capabilities(void)
@@ -428,6 +405,7 @@ Bit32u vbox_image_t::get_capabilities(void)
 #ifndef BXIMAGE
 bool vbox_image_t::save_state(const char *backup_fname)
 {
+  flush();
   return hdimage_backup_file(file_descriptor, backup_fname);
 }
 
@@ -74,6 +74,11 @@ VBOX_VDI_Header;
 #pragma options align=reset
 #endif
 
+// number of image blocks kept in memory
+#define VBOX_BLOCK_CACHE 8
+// number of blocks read ahead during sequential access
+#define VBOX_READAHEAD   1
+
 class vbox_image_t : public device_image_t
 {
     public:
@@ -87,6 +92,7 @@ class vbox_image_t : public device_image_t
         ssize_t write(const void* buf, size_t count);
 
         Bit32u get_capabilities();
+        int flush();
         static int check_format(int fd, Bit64u imgsize);
 
 #ifndef BXIMAGE
@@ -101,18 +107,15 @@ class vbox_image_t : public device_image_t
         bool is_open() const;
 
         bool read_header();
-        off_t perform_seek();
-        void flush();
-        void read_block(const Bit32u index);
-        void write_block(const Bit32u index);
+        off_t perform_seek(bool write);
+        Bit8u* read_block(const Bit32u index, bool write);
 
         int file_descriptor;
         VBOX_VDI_Header header;
         Bit32s *mtlb;
+        hdimage_cache_c *block_cache;
         Bit8u  *block_data;
         off_t current_offset;
-        Bit32u mtlb_sector;
-        bool is_dirty;
         bool mtlb_dirty;
         bool header_dirty;
         const char *pathname;
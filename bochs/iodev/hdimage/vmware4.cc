@@ -87,10 +87,13 @@ protected:
 
 vmware4_image_t::vmware4_image_t()
   : file_descriptor(-1),
+  table_cache(0),
+  grain_cache(0),
   tlb(0),
   tlb_offset(INVALID_OFFSET),
-  current_offset(INVALID_OFFSET),
-  is_dirty(0)
+  tlb_sector(0),
+  eof_sector(0),
+  current_offset(INVALID_OFFSET)
 {
   if (sizeof(_VM4_Header) != 77) {
     BX_FATAL(("system error: invalid header structure size"));
@@ -119,13 +122,15 @@ int vmware4_image_t::open(const char* _pathname, int flags)
     return -1;
   }
 
-  tlb = new Bit8u[(unsigned)header.tlb_size_sectors * SECTOR_SIZE];
-  if (tlb == 0)
-    BX_PANIC(("unable to allocate " FMT_LL "d bytes for vmware4 image's tlb", header.tlb_size_sectors * SECTOR_SIZE));
+  table_cache = new hdimage_cache_c(file_descriptor, SECTOR_SIZE, VMWARE4_TABLE_CACHE, VMWARE4_READAHEAD);
+  grain_cache = new hdimage_cache_c(file_descriptor, (Bit32u)header.tlb_size_sectors * SECTOR_SIZE,
+                                    VMWARE4_GRAIN_CACHE, VMWARE4_READAHEAD);
 
+  tlb = 0;
   tlb_offset = INVALID_OFFSET;
+  tlb_sector = 0;
+  eof_sector = (Bit32u)((imgsize + SECTOR_SIZE - 1) / SECTOR_SIZE);
   current_offset = 0;
-  is_dirty = 0;
 
   sect_size = SECTOR_SIZE;
   hd_size = header.total_sectors * sect_size;
@@ -149,7 +154,9 @@ void vmware4_image_t::close()
     return;
 
   flush();
-  delete [] tlb; tlb = 0;
+  delete grain_cache; grain_cache = 0;
+  delete table_cache; table_cache = 0;
+  tlb = 0;
 
   bx_close_image(file_descriptor, pathname);
   file_descriptor = -1;
@@ -178,14 +185,18 @@ ssize_t vmware4_image_t::read(void * buf, size_t count)
   char *cbuf = (char*)buf;
   ssize_t total = 0;
   while (count > 0) {
-    off_t readable = perform_seek();
+    off_t readable = perform_seek(0);
     if (readable == INVALID_OFFSET) {
       BX_DEBUG(("vmware4 disk image read failed on %u bytes at " FMT_LL "d", (unsigned)count, current_offset));
       return -1;
     }
 
     off_t copysize = ((off_t)count > readable) ? readable : count;
-    memcpy(cbuf, tlb + current_offset - tlb_offset, (size_t)copysize);
+    if (tlb != 0) {
+      memcpy(cbuf, tlb + current_offset - tlb_offset, (size_t)copysize);
+    } else {
+      memset(cbuf, 0, (size_t)copysize);
+    }
 
     current_offset += copysize;
     total += (long)copysize;
@@ -200,7 +211,7 @@ ssize_t vmware4_image_t::write(const void * buf, size_t count)
   char *cbuf = (char*)buf;
   ssize_t total = 0;
   while (count > 0) {
-    off_t writable = perform_seek();
+    off_t writable = perform_seek(1);
     if (writable == INVALID_OFFSET) {
       BX_DEBUG(("vmware4 disk image write failed on %u bytes at " FMT_LL "d", (unsigned)count, current_offset));
       return -1;
@@ -213,7 +224,6 @@ ssize_t vmware4_image_t::write(const void * buf, size_t count)
     total += (long)writesize;
     cbuf += writesize;
     count -= (size_t)writesize;
-    is_dirty = 1;
   }
   return total;
 }
@@ -294,95 +304,96 @@ bool vmware4_image_t::read_header()
 
 //
 // Returns the number of bytes that can be read from the current offset before needing
-// to perform another seek.
+// to perform another seek. The grain data is left in 'tlb' (NULL if the grain is not
+// allocated yet and 'write' is not set).
 //
-off_t vmware4_image_t::perform_seek()
+off_t vmware4_image_t::perform_seek(bool write)
 {
+  off_t grain_size = (off_t)header.tlb_size_sectors * SECTOR_SIZE;
+  bool create = 0;
+
   if (current_offset == INVALID_OFFSET) {
     BX_DEBUG(("invalid offset specified in vmware4 seek"));
     return INVALID_OFFSET;
   }
 
+  Bit64u index = current_offset / grain_size;
+
   //
-  // The currently loaded tlb can service the request.
+  // Look up the grain unless it is the one of the previous access. The grain
+  // directory and grain table sectors come from the table cache.
   //
-  if (tlb_offset / (header.tlb_size_sectors * SECTOR_SIZE) == current_offset / (header.tlb_size_sectors * SECTOR_SIZE))
-    return (header.tlb_size_sectors * SECTOR_SIZE) - (current_offset - tlb_offset);
-
-  flush();
+  if ((tlb_offset == INVALID_OFFSET) || ((Bit64u)(tlb_offset / grain_size) != index) ||
+      ((tlb_sector == 0) && write)) {
+    Bit32u slb_index = (Bit32u)(index % header.slb_count);
+    Bit32u flb_index = (Bit32u)(index / header.slb_count);
 
-  Bit64u index = current_offset / (header.tlb_size_sectors * SECTOR_SIZE);
-  Bit32u slb_index = (Bit32u)(index % header.slb_count);
-  Bit32u flb_index = (Bit32u)(index / header.slb_count);
+    Bit32u slb_sector = read_block_index(header.flb_offset_sectors, flb_index);
+    Bit32u slb_copy_sector = read_block_index(header.flb_copy_offset_sectors, flb_index);
 
-  Bit32u slb_sector = read_block_index(header.flb_offset_sectors, flb_index);
-  Bit32u slb_copy_sector = read_block_index(header.flb_copy_offset_sectors, flb_index);
-
-  if (slb_sector == 0 && slb_copy_sector == 0) {
-    BX_DEBUG(("loaded vmware4 disk image requires un-implemented feature"));
-    return INVALID_OFFSET;
+    if (slb_sector == 0 && slb_copy_sector == 0) {
+      BX_DEBUG(("loaded vmware4 disk image requires un-implemented feature"));
+      return INVALID_OFFSET;
+    }
+    if (slb_sector == 0)
+      slb_sector = slb_copy_sector;
+
+    tlb_offset = index * grain_size;
+    tlb_sector = read_block_index(slb_sector, slb_index);
+    if ((tlb_sector == 0) && write) {
+      //
+      // Allocate a new grain at the end of the file. It is written when
+      // the grain cache evicts or flushes it.
+      //
+      tlb_sector = eof_sector;
+      eof_sector += (Bit32u)header.tlb_size_sectors;
+      write_block_index(slb_sector, slb_index, tlb_sector);
+      if (slb_copy_sector != 0)
+        write_block_index(slb_copy_sector, slb_index, tlb_sector);
+      create = 1;
+    }
   }
-  if (slb_sector == 0)
-    slb_sector = slb_copy_sector;
 
-  Bit32u tlb_sector = read_block_index(slb_sector, slb_index);
-  tlb_offset = index * header.tlb_size_sectors * SECTOR_SIZE;
   if (tlb_sector == 0) {
-    //
-    // Allocate a new tlb
-    //
-    memset(tlb, 0, (size_t)header.tlb_size_sectors * SECTOR_SIZE);
-
-    //
-    // Instead of doing a write to increase the file size, we could use
-    // ftruncate but it is not portable.
-    //
-    off_t eof = ((::lseek(file_descriptor, 0, SEEK_END) + SECTOR_SIZE - 1) / SECTOR_SIZE) * SECTOR_SIZE;
-    ::write(file_descriptor, tlb, (unsigned)header.tlb_size_sectors * SECTOR_SIZE);
-    tlb_sector = (Bit32u)eof / SECTOR_SIZE;
-
-    write_block_index(slb_sector, slb_index, tlb_sector);
-    write_block_index(slb_copy_sector, slb_index, tlb_sector);
-
-    ::lseek(file_descriptor, eof, SEEK_SET);
+    tlb = 0;
   } else {
-    ::lseek(file_descriptor, tlb_sector * SECTOR_SIZE, SEEK_SET);
-    ::read(file_descriptor, tlb, (unsigned)header.tlb_size_sectors * SECTOR_SIZE);
-    ::lseek(file_descriptor, tlb_sector * SECTOR_SIZE, SEEK_SET);
+    tlb = grain_cache->get((Bit64s)tlb_sector * SECTOR_SIZE, write, create);
+    if (tlb == 0) {
+      tlb_offset = INVALID_OFFSET;
+      return INVALID_OFFSET;
+    }
   }
 
-  return (header.tlb_size_sectors * SECTOR_SIZE) - (current_offset - tlb_offset);
+  return grain_size - (current_offset - tlb_offset);
 }
 
-void vmware4_image_t::flush()
+int vmware4_image_t::flush()
 {
-  if (!is_dirty)
-    return;
-
   //
-  // Write dirty sectors to disk first. Assume that the file is already at the
-  // position for the current tlb.
+  // Write the grain data before the grain tables pointing to it.
   //
-  ::write(file_descriptor, tlb, (unsigned)header.tlb_size_sectors * SECTOR_SIZE);
-  is_dirty = 0;
+  if (grain_cache->flush() < 0)
+    return -1;
+  return table_cache->flush();
 }
 
 Bit32u vmware4_image_t::read_block_index(Bit64u sector, Bit32u index)
 {
-  Bit32u ret;
-
-  bx_read_image(file_descriptor, sector * SECTOR_SIZE + index * sizeof(Bit32u),
-                &ret, sizeof(Bit32u));
+  Bit64s offset = sector * SECTOR_SIZE + index * sizeof(Bit32u);
+  Bit8u *data = table_cache->get(offset & ~(SECTOR_SIZE - 1), 0);
 
-  return dtoh32(ret);
+  if (data == 0)
+    return 0;
+  return dtoh32(*(Bit32u*)(data + (offset & (SECTOR_SIZE - 1))));
 }
 
 void vmware4_image_t::write_block_index(Bit64u sector, Bit32u index, Bit32u block_sector)
 {
-  block_sector = htod32(block_sector);
+  Bit64s offset = sector * SECTOR_SIZE + index * sizeof(Bit32u);
+  Bit8u *data = table_cache->get(offset & ~(SECTOR_SIZE - 1), 1);
 
-  bx_write_image(file_descriptor, sector * SECTOR_SIZE + index * sizeof(Bit32u),
-                 &block_sector, sizeof(Bit32u));
+  if (data != 0)
+    *(Bit32u*)(data + (offset & (SECTOR_SIZE - 1))) = htod32(block_sector);
 }
 
 Bit32u vmware4_image_t::get_capabilities(void)
@@ -503,6 +514,7 @@ int vmware4_image_t::create_image(const char *pathname, Bit64u size)
 #else
 bool vmware4_image_t::save_state(const char *backup_fname)
 {
+  flush();
   return hdimage_backup_file(file_descriptor, backup_fname);
 }
 
@@ -62,6 +62,12 @@ VM4_Header;
 #pragma options align=reset
 #endif
 
+// number of grain directory / grain table sectors and grains kept in memory
+#define VMWARE4_TABLE_CACHE 256
+#define VMWARE4_GRAIN_CACHE 16
+// number of grains read ahead during sequential access
+#define VMWARE4_READAHEAD   4
+
 class vmware4_image_t : public device_image_t
 {
     public:
@@ -75,6 +81,7 @@ class vmware4_image_t : public device_image_t
         ssize_t write(const void* buf, size_t count);
 
         Bit32u get_capabilities();
+        int flush();
         static int check_format(int fd, Bit64u imgsize);
 
 #ifdef BXIMAGE
@@ -91,17 +98,19 @@ class vmware4_image_t : public device_image_t
         bool is_open() const;
 
         bool read_header();
-        off_t perform_seek();
-        void flush();
+        off_t perform_seek(bool write);
         Bit32u read_block_index(Bit64u sector, Bit32u index);
         void write_block_index(Bit64u sector, Bit32u index, Bit32u block_sector);
 
         int file_descriptor;
         VM4_Header header;
+        hdimage_cache_c *table_cache;
+        hdimage_cache_c *grain_cache;
         Bit8u* tlb;
         off_t tlb_offset;
+        Bit32u tlb_sector;
+        Bit32u eof_sector;
         off_t current_offset;
-        bool is_dirty;
         const char *pathname;
 };
 
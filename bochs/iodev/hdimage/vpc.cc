@@ -127,6 +127,7 @@ int vpc_image_t::open(const char* _pathname, int flags)
   int disk_type;
 
   pathname = _pathname;
+  bitmap_cache = NULL;
   if ((fd = hdimage_open_file(pathname, flags, &imgsize, &mtime)) < 0) {
     BX_ERROR(("VPC: cannot open hdimage file '%s'", pathname));
     return -1;
@@ -213,7 +214,7 @@ int vpc_image_t::open(const char* _pathname, int flags)
       }
     }
 
-    last_bitmap_offset = (Bit64s) -1;
+    bitmap_cache = new hdimage_cache_c(fd, bitmap_size, VPC_BITMAP_CACHE, 0);
   }
   cur_sector = 0;
 
@@ -225,6 +226,10 @@ int vpc_image_t::open(const char* _pathname, int flags)
 void vpc_image_t::close(void)
 {
   if (fd > -1) {
+    if (bitmap_cache != NULL) {
+      delete bitmap_cache;
+      bitmap_cache = NULL;
+    }
     delete [] pagetable;
     bx_close_image(fd, pathname);
   }
@@ -325,6 +330,11 @@ Bit32u vpc_image_t::get_capabilities(void)
   return HDIMAGE_HAS_GEOMETRY;
 }
 
+int vpc_image_t::flush()
+{
+  return (bitmap_cache != NULL) ? bitmap_cache->flush() : 0;
+}
+
 #ifdef BXIMAGE
 int vpc_image_t::create_image(const char *pathname, Bit64u size)
 {
@@ -413,6 +423,9 @@ int vpc_image_t::create_image(const char *pathname, Bit64u size)
 #else
 bool vpc_image_t::save_state(const char *backup_fname)
 {
+  if (bitmap_cache != NULL) {
+    bitmap_cache->flush();
+  }
   return hdimage_backup_file(fd, backup_fname);
 }
 
@@ -468,14 +481,20 @@ Bit64s vpc_image_t::get_sector_offset(Bit64s sector_num, int write)
   // unused in the bitmap. We get away with setting all bits in the block
   // bitmap each time we write to a new block. This might cause Virtual PC to
   // miss sparse read optimization, but it's not a problem in terms of
-  // correctness.
-  if (write && (last_bitmap_offset != bitmap_offset)) {
-    Bit8u *bitmap = new Bit8u[bitmap_size];
-
-    last_bitmap_offset = bitmap_offset;
-    memset(bitmap, 0xff, bitmap_size);
-    bx_write_image(fd, bitmap_offset, bitmap, bitmap_size);
-    delete [] bitmap;
+  // correctness. The bitmaps are kept in the cache and only written back
+  // if they change.
+  if (write) {
+    Bit8u *bitmap = bitmap_cache->get(bitmap_offset, 0);
+
+    if (bitmap == NULL)
+      return -1;
+    for (Bit32u i = 0; i < bitmap_size; i++) {
+      if (bitmap[i] != 0xff) {
+        memset(bitmap, 0xff, bitmap_size);
+        bitmap_cache->get(bitmap_offset, 1);
+        break;
+      }
+    }
   }
 
   return (Bit64s)block_offset;
@@ -525,13 +544,11 @@ Bit64s vpc_image_t::alloc_block(Bit64s sector_num)
   pagetable[index] = (Bit32u)(free_data_block_offset / 512);
 
   // Initialize the block's bitmap
-  Bit8u *bitmap = new Bit8u[bitmap_size];
-  memset(bitmap, 0xff, bitmap_size);
-  ret = bx_write_image(fd, free_data_block_offset, bitmap, bitmap_size);
-  delete [] bitmap;
-  if (ret < 0) {
-    return ret;
+  Bit8u *bitmap = bitmap_cache->get(free_data_block_offset, 1, 1);
+  if (bitmap == NULL) {
+    return -1;
   }
+  memset(bitmap, 0xff, bitmap_size);
 
   // Write new footer (the old one will be overwritten)
   old_fdbo = free_data_block_offset;
@@ -153,6 +153,9 @@ vhd_dyndisk_header_t;
 #pragma options align=reset
 #endif
 
+// number of block bitmaps kept in memory
+#define VPC_BITMAP_CACHE 16
+
 class vpc_image_t : public device_image_t
 {
   public:
@@ -163,6 +166,7 @@ class vpc_image_t : public device_image_t
     ssize_t write(const void* buf, size_t count);
 
     Bit32u get_capabilities();
+    int flush();
     static int check_format(int fd, Bit64u imgsize);
 
 #ifdef BXIMAGE
@@ -184,7 +188,7 @@ class vpc_image_t : public device_image_t
     Bit64u free_data_block_offset;
     int max_table_entries;
     Bit64u bat_offset;
-    Bit64u last_bitmap_offset;
+    hdimage_cache_c *bitmap_cache;
     Bit32u *pagetable;
 
     Bit32u block_size;
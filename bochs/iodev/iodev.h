@@ -88,6 +88,7 @@ class BOCHSAPI bx_devmodel_c : public logfunctions {
   virtual void reset(unsigned type) {}
   virtual void register_state(void) {}
   virtual void after_restore_state(void) {}
+  virtual void after_fork(bool child) {}
 #if BX_DEBUGGER
   virtual void debug_dump(int argc, char **argv) {}
 #endif
@@ -200,7 +201,7 @@ public:
   virtual bool bmdma_read_sector(Bit8u channel, Bit8u *buffer, Bit32u *sector_size) {
     STUBFUNC(HD, bmdma_read_sector); return 0;
   }
-  virtual bool bmdma_write_sector(Bit8u channel, Bit8u *buffer) {
+  virtual bool bmdma_write_sector(Bit8u channel, Bit8u *buffer, Bit32u *sector_size) {
     STUBFUNC(HD, bmdma_write_sector); return 0;
   }
   virtual void bmdma_complete(Bit8u channel) {
@@ -388,6 +389,8 @@ public:
   void exit(void);
   void register_state(void);
   void after_restore_state(void);
+  // Called in both processes after the simulation has been forked.
+  void after_fork(bool child);
   BX_MEM_C *mem;  // address space associated with these devices
   bool register_io_read_handler(void *this_ptr, bx_read_handler_t f,
                                 Bit32u addr, const char *name, Bit8u mask);
@@ -290,9 +290,10 @@ void bx_pci_ide_c::timer()
     BX_PIDE_THIS s.bmdma[channel].buffer_top += size;
     count = (int)(BX_PIDE_THIS s.bmdma[channel].buffer_top - BX_PIDE_THIS s.bmdma[channel].buffer_idx);
     while (count > 511) {
-      if (DEV_hd_bmdma_write_sector(channel, BX_PIDE_THIS s.bmdma[channel].buffer_idx)) {
-        BX_PIDE_THIS s.bmdma[channel].buffer_idx += 512;
-        count -= 512;
+      sector_size = count;
+      if (DEV_hd_bmdma_write_sector(channel, BX_PIDE_THIS s.bmdma[channel].buffer_idx, &sector_size)) {
+        BX_PIDE_THIS s.bmdma[channel].buffer_idx += sector_size;
+        count -= sector_size;
       } else {
         break;
       }
@@ -1012,8 +1012,9 @@ void scsi_device_t::seek_timer()
 
 void scsi_device_t::seek_complete(SCSIRequest *r)
 {
-  Bit32u i, n;
+  Bit32u n;
   int ret = 0;
+  bx_iovec_t iov;
 
   r->seek_pending = 0;
   if (!r->write_cmd) {
@@ -1023,27 +1024,15 @@ void scsi_device_t::seek_complete(SCSIRequest *r)
       n = SCSI_DMA_BUF_SIZE / block_size;
     r->buf_len = n * block_size;
     if (type == SCSIDEV_TYPE_CDROM) {
-      i = 0;
-      do {
-        ret = (int)cdrom->read_block(r->dma_buf + (i * 2048), (Bit32u)(r->sector + i), 2048);
-      } while ((++i < n) && (ret == 1));
+      ret = (int)cdrom->read_blocks(r->dma_buf, (Bit32u)r->sector, n, 2048);
       if (ret == 0) {
         scsi_command_complete(r, STATUS_CHECK_CONDITION, SENSE_MEDIUM_ERROR);
         return;
       }
     } else {
-      ret = (int)hdimage->lseek(r->sector * block_size, SEEK_SET);
-      if (ret < 0) {
-        BX_ERROR(("could not lseek() hard drive image file"));
-        scsi_command_complete(r, STATUS_CHECK_CONDITION, SENSE_HARDWARE_ERROR);
-        return;
-      }
-      i = 0;
-      do {
-        ret = (int)hdimage->read((bx_ptr_t)(r->dma_buf + (i * block_size)),
-                                 block_size);
-      } while ((++i < n) && (ret == block_size));
-      if (ret != block_size) {
+      iov.iov_base = r->dma_buf;
+      iov.iov_len = r->buf_len;
+      if (hdimage->readv((Bit64s)r->sector * block_size, &iov, 1) != (ssize_t)r->buf_len) {
         BX_ERROR(("could not read() hard drive image file"));
         scsi_command_complete(r, STATUS_CHECK_CONDITION, SENSE_HARDWARE_ERROR);
         return;
@@ -1056,17 +1045,9 @@ void scsi_device_t::seek_complete(SCSIRequest *r)
     bx_gui->statusbar_setitem(statusbar_id, 1, 1);
     n = r->buf_len / block_size;
     if (n) {
-      ret = (int)hdimage->lseek(r->sector * block_size, SEEK_SET);
-      if (ret < 0) {
-        BX_ERROR(("could not lseek() hard drive image file"));
-        scsi_command_complete(r, STATUS_CHECK_CONDITION, SENSE_HARDWARE_ERROR);
-      }
-      i = 0;
-      do {
-        ret = (int)hdimage->write((bx_ptr_t)(r->dma_buf + (i * block_size)),
-                                  block_size);
-      } while ((++i < n) && (ret == block_size));
-      if (ret != block_size) {
+      iov.iov_base = r->dma_buf;
+      iov.iov_len = n * block_size;
+      if (hdimage->writev((Bit64s)r->sector * block_size, &iov, 1) != (ssize_t)iov.iov_len) {
         BX_ERROR(("could not write() hard drive image file"));
         scsi_command_complete(r, STATUS_CHECK_CONDITION, SENSE_HARDWARE_ERROR);
         return;
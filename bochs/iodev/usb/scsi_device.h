@@ -87,6 +87,7 @@ public:
   Bit8u* scsi_get_buf(Bit32u tag);
   const char *get_serial_number() {return drive_serial_str;}
   void set_inserted(bool value);
+  void set_hdimage(device_image_t *_hdimage) {hdimage = _hdimage;}
   bool get_inserted() {return inserted;}
   bool get_locked() {return locked;}
   static void seek_timer_handler(void *);
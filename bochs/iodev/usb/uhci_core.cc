@@ -234,6 +234,15 @@ void bx_uhci_core_c::after_restore_state(void)
   }
 }
 
+void bx_uhci_core_c::after_fork(bool child)
+{
+  for (int j=0; j<USB_UHCI_PORTS; j++) {
+    if (hub.usb_port[j].device != NULL) {
+      hub.usb_port[j].device->after_fork(child);
+    }
+  }
+}
+
 void bx_uhci_core_c::update_irq()
 {
   bool level;
@@ -178,6 +178,7 @@ public:
   virtual void reset_uhci(unsigned);
   void    uhci_register_state(bx_list_c *parent);
   virtual void after_restore_state(void);
+  virtual void after_fork(bool child);
   virtual void set_port_device(int port, usb_device_c *dev);
   virtual void pci_write_handler(Bit8u address, Bit32u value, unsigned io_len);
 
@@ -185,6 +185,7 @@ public:
   void register_state(bx_list_c *parent);
   virtual void register_state_specific(bx_list_c *parent) {}
   virtual void after_restore_state() {}
+  virtual void after_fork(bool child) {}
   virtual void cancel_packet(USBPacket *p) {}
   virtual bool set_option(const char *option) {return 0;}
   virtual void runtime_config() {}
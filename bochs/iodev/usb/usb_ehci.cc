@@ -448,6 +448,16 @@ void bx_usb_ehci_c::after_restore_state(void)
   }
 }
 
+// The companion controllers only get the devices of the EHCI ports
+void bx_usb_ehci_c::after_fork(bool child)
+{
+  for (int i=0; i<USB_EHCI_PORTS; i++) {
+    if (BX_EHCI_THIS hub.usb_port[i].device != NULL) {
+      BX_EHCI_THIS hub.usb_port[i].device->after_fork(child);
+    }
+  }
+}
+
 void bx_usb_ehci_c::reset_hc()
 {
   int i;
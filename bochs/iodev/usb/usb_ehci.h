@@ -330,6 +330,7 @@ public:
   virtual void reset(unsigned);
   virtual void register_state(void);
   virtual void after_restore_state(void);
+  virtual void after_fork(bool child);
   virtual void pci_write_handler(Bit8u address, Bit32u value, unsigned io_len);
 
   void event_handler(int event, USBPacket *packet, int port);
@@ -1201,6 +1201,22 @@ void usb_floppy_device_c::copy_data(USBPacket *p)
   }
 }
 
+// The floppy image is shared by the processes of a forked simulation. Both
+// of them continue with a volatile redolog, like the ATA hard disks do.
+void usb_floppy_device_c::after_fork(bool child)
+{
+  if (!s.inserted || (s.hdimage == NULL) || s.wp)
+    return;
+  volatile_image_t *overlay = new volatile_image_t(NULL);
+  // only the parent process closes the base image, removing its lock
+  if (overlay->open(s.hdimage, s.fname, !child) < 0) {
+    BX_PANIC(("could not create redolog after fork"));
+    delete overlay;
+    return;
+  }
+  s.hdimage = overlay;
+}
+
 void usb_floppy_device_c::cancel_packet(USBPacket *p)
 {
   bx_pc_system.deactivate_timer(s.floppy_timer_index);
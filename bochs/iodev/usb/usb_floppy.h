@@ -62,6 +62,7 @@ public:
   virtual int handle_control(int request, int value, int index, int length, Bit8u *data);
   virtual int handle_data(USBPacket *p);
   virtual void register_state_specific(bx_list_c *parent);
+  virtual void after_fork(bool child);
   virtual void cancel_packet(USBPacket *p);
 
   static void floppy_timer_handler(void *);
@@ -323,6 +323,15 @@ void usb_hub_device_c::after_restore_state()
   }
 }
 
+void usb_hub_device_c::after_fork(bool child)
+{
+  for (int i=0; i<hub.n_ports; i++) {
+    if (hub.usb_port[i].device != NULL) {
+      hub.usb_port[i].device->after_fork(child);
+    }
+  }
+}
+
 void usb_hub_device_c::handle_reset()
 {
   int i;
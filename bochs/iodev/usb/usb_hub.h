@@ -49,6 +49,7 @@ public:
   virtual int handle_data(USBPacket *p);
   virtual void register_state_specific(bx_list_c *parent);
   virtual void after_restore_state();
+  virtual void after_fork(bool child);
   virtual void runtime_config();
   void restore_handler(bx_list_c *conf);
   void event_handler(int event, USBPacket *packet, int port);
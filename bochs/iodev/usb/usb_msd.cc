@@ -924,6 +924,23 @@ void usb_msd_device_c::command_complete(int reason, Bit32u tag, Bit32u arg)
   }
 }
 
+// The disk image is shared by the processes of a forked simulation. Both of
+// them continue with a volatile redolog, like the ATA hard disks do.
+void usb_msd_device_c::after_fork(bool child)
+{
+  if ((d.type != USB_MSD_TYPE_DISK) || (s.hdimage == NULL))
+    return;
+  volatile_image_t *overlay = new volatile_image_t(NULL);
+  // only the parent process closes the base image, removing its lock
+  if (overlay->open(s.hdimage, s.fname, !child) < 0) {
+    BX_PANIC(("could not create redolog after fork"));
+    delete overlay;
+    return;
+  }
+  s.hdimage = overlay;
+  s.scsi_dev->set_hdimage(overlay);
+}
+
 void usb_msd_device_c::cancel_packet(USBPacket *p)
 {
   s.scsi_dev->scsi_cancel_io(s.tag);
@@ -45,6 +45,7 @@ public:
   virtual int handle_control(int request, int value, int index, int length, Bit8u *data);
   virtual int handle_data(USBPacket *p);
   virtual void register_state_specific(bx_list_c *parent);
+  virtual void after_fork(bool child);
   virtual void cancel_packet(USBPacket *p);
   bool set_inserted(bool value);
   bool get_inserted();
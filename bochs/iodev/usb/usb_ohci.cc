@@ -487,6 +487,15 @@ void bx_usb_ohci_c::after_restore_state(void)
   }
 }
 
+void bx_usb_ohci_c::after_fork(bool child)
+{
+  for (int j=0; j<USB_OHCI_PORTS; j++) {
+    if (BX_OHCI_THIS hub.usb_port[j].device != NULL) {
+      BX_OHCI_THIS hub.usb_port[j].device->after_fork(child);
+    }
+  }
+}
+
 void bx_usb_ohci_c::init_device(Bit8u port, bx_list_c *portconf)
 {
   char pname[BX_PATHNAME_LEN];
@@ -980,6 +980,15 @@ void bx_usb_xhci_c::after_restore_state(void)
   }
 }
 
+void bx_usb_xhci_c::after_fork(bool child)
+{
+  for (int j=0; j<USB_XHCI_PORTS; j++) {
+    if (BX_XHCI_THIS hub.usb_port[j].device != NULL) {
+      BX_XHCI_THIS hub.usb_port[j].device->after_fork(child);
+    }
+  }
+}
+
 void bx_usb_xhci_c::init_device(Bit8u port, bx_list_c *portconf)
 {
   char pname[BX_PATHNAME_LEN];
@@ -0,0 +1,914 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+// Paravirtual virtio block device (transitional PCI device)
+//
+// The legacy interface is located in i/o BAR #0, the modern (virtio 1.0)
+// interface in memory BAR #1 and described by vendor specific PCI
+// capabilities. Both interfaces share the same device state. The requests
+// of a virtqueue are processed when the guest notifies the device, each
+// request with a single vectored access to the disk image.
+
+// Define BX_PLUGGABLE in files that can be compiled into plugins.  For
+// platforms that require a special tag on exported symbols, BX_PLUGGABLE
+// is used to know when we are exporting symbols and when we are importing.
+#define BX_PLUGGABLE
+
+#include "iodev.h"
+#if BX_SUPPORT_PCI && BX_SUPPORT_VIRTIO_BLK
+
+#include "pci.h"
+#include "hdimage/hdimage.h"
+#include "virtio_blk.h"
+
+#define LOG_THIS theVirtioBlk->
+
+bx_virtio_blk_c *theVirtioBlk = NULL;
+
+const Bit8u virtio_blk_iomask[64] = {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                                     7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                                     7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                                     7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7};
+
+const char virtio_blk_id[VIRTIO_BLK_ID_BYTES + 1] = "BXVIRTIO0001";
+
+// builtin configuration handling functions
+
+void virtio_blk_init_options(void)
+{
+  bx_param_c *pci = SIM->get_param("pci");
+  bx_list_c *menu = new bx_list_c(pci, "virtio_blk", "Virtio Block Device");
+  menu->set_options(menu->SHOW_PARENT);
+  bx_param_bool_c *enabled = new bx_param_bool_c(menu,
+    "enabled",
+    "Enable virtio block device",
+    "Enables the virtio block device emulation",
+    1);
+  bx_param_filename_c *path = new bx_param_filename_c(menu,
+    "path",
+    "Path of the disk image",
+    "Pathname of the disk image",
+    "", BX_PATHNAME_LEN);
+  path->set_extension("img");
+  bx_param_enum_c *mode = new bx_param_enum_c(menu,
+    "mode",
+    "Type of disk image",
+    "Mode of the disk image",
+    bx_hdimage_ctl.get_mode_names(),
+    0, 0);
+  bx_param_filename_c *journal = new bx_param_filename_c(menu,
+    "journal",
+    "Path of journal file",
+    "Pathname of the journal file",
+    "", BX_PATHNAME_LEN);
+  bx_param_num_c *queues = new bx_param_num_c(menu,
+    "queues",
+    "Number of request queues",
+    "Number of virtqueues the guest can use for requests",
+    1, VIRTIO_BLK_MAX_QUEUES,
+    1);
+  bx_list_c *deplist = new bx_list_c(NULL);
+  deplist->add(path);
+  deplist->add(mode);
+  deplist->add(journal);
+  deplist->add(queues);
+  enabled->set_dependent_list(deplist);
+}
+
+Bit32s virtio_blk_options_parser(const char *context, int num_params, char *params[])
+{
+  if (!strcmp(params[0], "virtio_blk")) {
+    bx_list_c *base = (bx_list_c*) SIM->get_param(BXPN_VIRTIO_BLK);
+    for (int i = 1; i < num_params; i++) {
+      if (SIM->parse_param_from_list(context, params[i], base) < 0) {
+        BX_ERROR(("%s: unknown parameter for virtio_blk ignored.", context));
+      }
+    }
+  } else {
+    BX_PANIC(("%s: unknown directive '%s'", context, params[0]));
+  }
+  return 0;
+}
+
+Bit32s virtio_blk_options_save(FILE *fp)
+{
+  return SIM->write_param_list(fp, (bx_list_c*) SIM->get_param(BXPN_VIRTIO_BLK), NULL, 0);
+}
+
+// device plugin entry point
+
+PLUGIN_ENTRY_FOR_MODULE(virtio_blk)
+{
+  if (mode == PLUGIN_INIT) {
+    theVirtioBlk = new bx_virtio_blk_c();
+    BX_REGISTER_DEVICE_DEVMODEL(plugin, type, theVirtioBlk, BX_PLUGIN_VIRTIO_BLK);
+    // add new configuration parameter for the config interface
+    virtio_blk_init_options();
+    // register add-on option for bochsrc and command line
+    SIM->register_addon_option("virtio_blk", virtio_blk_options_parser, virtio_blk_options_save);
+  } else if (mode == PLUGIN_FINI) {
+    SIM->unregister_addon_option("virtio_blk");
+    bx_list_c *menu = (bx_list_c*)SIM->get_param("pci");
+    menu->remove("virtio_blk");
+    delete theVirtioBlk;
+  } else if (mode == PLUGIN_PROBE) {
+    return (int)PLUGTYPE_OPTIONAL;
+  } else if (mode == PLUGIN_FLAGS) {
+    return PLUGFLAG_PCI;
+  }
+  return 0; // Success
+}
+
+// the device object
+
+bx_virtio_blk_c::bx_virtio_blk_c()
+{
+  put("virtio_blk", "VIRTIO");
+  memset(&s, 0, sizeof(bx_virtio_blk_t));
+  hdimage = NULL;
+  buffer = NULL;
+  buffer_size = 0;
+}
+
+bx_virtio_blk_c::~bx_virtio_blk_c()
+{
+  if (hdimage != NULL) {
+    hdimage->close();
+    delete hdimage;
+  }
+  if (buffer != NULL) {
+    delete [] buffer;
+  }
+  SIM->get_bochs_root()->remove("virtio_blk");
+  BX_DEBUG(("Exit"));
+}
+
+void bx_virtio_blk_c::init(void)
+{
+  bx_list_c *base;
+  const char *path, *image_mode;
+
+  // Read in values from config interface
+  base = (bx_list_c*) SIM->get_param(BXPN_VIRTIO_BLK);
+  path = SIM->get_param_string("path", base)->getptr();
+  // Check if the device is disabled or not configured
+  if (!SIM->get_param_bool("enabled", base)->get() || (strlen(path) == 0)) {
+    BX_INFO(("virtio block device disabled"));
+    // mark unused plugin for removal
+    ((bx_param_bool_c*)((bx_list_c*)SIM->get_param(BXPN_PLUGIN_CTRL))->get_by_name("virtio_blk"))->set(0);
+    return;
+  }
+
+  image_mode = SIM->get_param_enum("mode", base)->get_selected();
+  BX_VIRTIO_BLK_THIS hdimage = DEV_hdimage_init_image(image_mode, 0,
+    SIM->get_param_string("journal", base)->getptr());
+  if ((BX_VIRTIO_BLK_THIS hdimage == NULL) || (BX_VIRTIO_BLK_THIS hdimage->open(path) < 0)) {
+    BX_PANIC(("could not open hard drive image file '%s'", path));
+    return;
+  }
+  BX_VIRTIO_BLK_THIS s.num_queues = (Bit16u)SIM->get_param_num("queues", base)->get();
+
+  BX_VIRTIO_BLK_THIS s.devfunc = 0x00;
+  DEV_register_pci_handlers(this, &BX_VIRTIO_BLK_THIS s.devfunc, BX_PLUGIN_VIRTIO_BLK,
+                            "Virtio block device");
+
+  // initialize readonly registers
+  init_pci_conf(VIRTIO_PCI_VENDOR, VIRTIO_PCI_DEVICE_BLK, 0x00, 0x010000, 0x00, BX_PCI_INTA);
+  BX_VIRTIO_BLK_THIS pci_conf[0x2c] = (Bit8u)(VIRTIO_PCI_VENDOR & 0xff);
+  BX_VIRTIO_BLK_THIS pci_conf[0x2d] = (Bit8u)(VIRTIO_PCI_VENDOR >> 8);
+  BX_VIRTIO_BLK_THIS pci_conf[0x2e] = (Bit8u)(VIRTIO_PCI_SUBSYSTEM_BLK & 0xff);
+  BX_VIRTIO_BLK_THIS pci_conf[0x2f] = (Bit8u)(VIRTIO_PCI_SUBSYSTEM_BLK >> 8);
+  // capability list describing the modern interface
+  BX_VIRTIO_BLK_THIS pci_conf[0x34] = 0x40;
+  init_capability(0x40, 0x50, VIRTIO_PCI_CAP_COMMON_CFG, VIRTIO_PCI_COMMON_OFFSET,
+                  VIRTIO_COMMON_SIZE);
+  init_capability(0x50, 0x60, VIRTIO_PCI_CAP_ISR_CFG, VIRTIO_PCI_ISR_OFFSET, 1);
+  init_capability(0x60, 0x70, VIRTIO_PCI_CAP_DEVICE_CFG, VIRTIO_PCI_DEVICE_OFFSET,
+                  VIRTIO_BLK_CONFIG_SIZE);
+  init_capability(0x70, 0x00, VIRTIO_PCI_CAP_NOTIFY_CFG, VIRTIO_PCI_NOTIFY_OFFSET,
+                  BX_VIRTIO_BLK_THIS s.num_queues * VIRTIO_PCI_NOTIFY_MULT);
+
+  BX_VIRTIO_BLK_THIS init_bar_io(0, VIRTIO_PCI_IO_SIZE, read_handler, write_handler,
+                                 &virtio_blk_iomask[0]);
+  BX_VIRTIO_BLK_THIS init_bar_mem(1, VIRTIO_PCI_MEM_SIZE, mem_read_handler, mem_write_handler);
+
+  BX_VIRTIO_BLK_THIS s.host_features = (1 << VIRTIO_BLK_F_SIZE_MAX) |
+    (1 << VIRTIO_BLK_F_SEG_MAX) | (1 << VIRTIO_BLK_F_FLUSH) | (1 << VIRTIO_BLK_F_MQ) |
+    (1 << VIRTIO_RING_F_INDIRECT) | (1 << VIRTIO_RING_F_EVENT_IDX) |
+    BX_CONST64(1) << VIRTIO_F_VERSION_1;
+
+  BX_VIRTIO_BLK_THIS s.statusbar_id = bx_gui->register_statusitem("VIRTIO", 1);
+
+  BX_INFO(("virtio block device: path='%s', mode='%s', %d queue(s)", path,
+           image_mode, BX_VIRTIO_BLK_THIS s.num_queues));
+}
+
+void bx_virtio_blk_c::reset(unsigned type)
+{
+  unsigned i;
+
+  static const struct reset_vals_t {
+    unsigned      addr;
+    unsigned char val;
+  } reset_vals[] = {
+    { 0x04, 0x03 }, { 0x05, 0x00 }, // command io / memory
+    { 0x06, 0x10 }, { 0x07, 0x00 }, // status (capability list)
+    // address space 0x10 - 0x13
+    { 0x10, 0x01 }, { 0x11, 0x00 },
+    { 0x12, 0x00 }, { 0x13, 0x00 },
+    // address space 0x14 - 0x17
+    { 0x14, 0x00 }, { 0x15, 0x00 },
+    { 0x16, 0x00 }, { 0x17, 0x00 },
+    { 0x3c, 0x00 },                 // IRQ
+  };
+  for (i = 0; i < sizeof(reset_vals) / sizeof(*reset_vals); ++i) {
+    BX_VIRTIO_BLK_THIS pci_conf[reset_vals[i].addr] = reset_vals[i].val;
+  }
+
+  device_reset();
+}
+
+void bx_virtio_blk_c::register_state(void)
+{
+  char pname[16];
+
+  bx_list_c *list = new bx_list_c(SIM->get_bochs_root(), "virtio_blk", "Virtio Block Device State");
+  BXRS_HEX_PARAM_FIELD(list, host_features, BX_VIRTIO_BLK_THIS s.host_features);
+  BXRS_HEX_PARAM_FIELD(list, guest_features, BX_VIRTIO_BLK_THIS s.guest_features);
+  BXRS_HEX_PARAM_FIELD(list, dfselect, BX_VIRTIO_BLK_THIS s.dfselect);
+  BXRS_HEX_PARAM_FIELD(list, gfselect, BX_VIRTIO_BLK_THIS s.gfselect);
+  BXRS_HEX_PARAM_FIELD(list, status, BX_VIRTIO_BLK_THIS s.status);
+  BXRS_HEX_PARAM_FIELD(list, isr, BX_VIRTIO_BLK_THIS s.isr);
+  BXRS_DEC_PARAM_FIELD(list, config_generation, BX_VIRTIO_BLK_THIS s.config_generation);
+  BXRS_DEC_PARAM_FIELD(list, queue_sel, BX_VIRTIO_BLK_THIS s.queue_sel);
+  bx_list_c *queues = new bx_list_c(list, "queue", "");
+  for (unsigned i = 0; i < BX_VIRTIO_BLK_THIS s.num_queues; i++) {
+    sprintf(pname, "%d", i);
+    bx_list_c *vq = new bx_list_c(queues, pname, "");
+    BXRS_DEC_PARAM_FIELD(vq, size, BX_VIRTIO_BLK_THIS s.queue[i].size);
+    BXRS_PARAM_BOOL(vq, enabled, BX_VIRTIO_BLK_THIS s.queue[i].enabled);
+    BXRS_HEX_PARAM_FIELD(vq, pfn, BX_VIRTIO_BLK_THIS s.queue[i].pfn);
+    BXRS_HEX_PARAM_FIELD(vq, desc, BX_VIRTIO_BLK_THIS s.queue[i].desc);
+    BXRS_HEX_PARAM_FIELD(vq, avail, BX_VIRTIO_BLK_THIS s.queue[i].avail);
+    BXRS_HEX_PARAM_FIELD(vq, used, BX_VIRTIO_BLK_THIS s.queue[i].used);
+    BXRS_DEC_PARAM_FIELD(vq, last_avail_idx, BX_VIRTIO_BLK_THIS s.queue[i].last_avail_idx);
+    BXRS_DEC_PARAM_FIELD(vq, used_idx, BX_VIRTIO_BLK_THIS s.queue[i].used_idx);
+  }
+  register_pci_state(list);
+  if (BX_VIRTIO_BLK_THIS hdimage != NULL) {
+    BX_VIRTIO_BLK_THIS hdimage->register_state(list);
+  }
+}
+
+void bx_virtio_blk_c::after_restore_state(void)
+{
+  bx_pci_device_c::after_restore_pci_state(NULL);
+}
+
+void bx_virtio_blk_c::after_fork(bool child)
+{
+  if (BX_VIRTIO_BLK_THIS hdimage == NULL) return;
+  bx_list_c *base = (bx_list_c*) SIM->get_param(BXPN_VIRTIO_BLK);
+  volatile_image_t *overlay = new volatile_image_t(NULL);
+  // only the parent process closes the base image, removing its lock
+  if (overlay->open(BX_VIRTIO_BLK_THIS hdimage, SIM->get_param_string("path", base)->getptr(), !child) < 0) {
+    BX_PANIC(("could not create redolog after fork"));
+    delete overlay;
+    return;
+  }
+  BX_VIRTIO_BLK_THIS hdimage = overlay;
+}
+
+void bx_virtio_blk_c::set_irq_level(bool level)
+{
+  DEV_pci_set_irq(BX_VIRTIO_BLK_THIS s.devfunc, BX_VIRTIO_BLK_THIS pci_conf[0x3d], level);
+}
+
+void bx_virtio_blk_c::device_reset(void)
+{
+  BX_VIRTIO_BLK_THIS s.guest_features = 0;
+  BX_VIRTIO_BLK_THIS s.dfselect = 0;
+  BX_VIRTIO_BLK_THIS s.gfselect = 0;
+  BX_VIRTIO_BLK_THIS s.status = 0;
+  BX_VIRTIO_BLK_THIS s.isr = 0;
+  BX_VIRTIO_BLK_THIS s.queue_sel = 0;
+  memset(BX_VIRTIO_BLK_THIS s.queue, 0, sizeof(BX_VIRTIO_BLK_THIS s.queue));
+  for (unsigned i = 0; i < VIRTIO_BLK_MAX_QUEUES; i++) {
+    BX_VIRTIO_BLK_THIS s.queue[i].size = VIRTIO_BLK_QUEUE_SIZE;
+  }
+  set_irq_level(0);
+}
+
+void bx_virtio_blk_c::set_status(Bit8u value)
+{
+  if (value == 0) {
+    BX_DEBUG(("device reset"));
+    device_reset();
+  } else {
+    if ((value & VIRTIO_STATUS_FAILED) != 0) {
+      BX_ERROR(("driver reported failure"));
+    }
+    BX_VIRTIO_BLK_THIS s.status = value;
+  }
+}
+
+void bx_virtio_blk_c::init_capability(Bit8u offset, Bit8u next, Bit8u type,
+                                      Bit32u bar_offset, Bit32u length)
+{
+  Bit8u *cap = &BX_VIRTIO_BLK_THIS pci_conf[offset];
+
+  cap[0] = 0x09; // vendor specific
+  cap[1] = next;
+  cap[2] = (type == VIRTIO_PCI_CAP_NOTIFY_CFG) ? 20 : 16;
+  cap[3] = type;
+  cap[4] = 1;    // BAR number
+  WriteHostDWordToLittleEndian((Bit32u*)&cap[8], bar_offset);
+  WriteHostDWordToLittleEndian((Bit32u*)&cap[12], length);
+  if (type == VIRTIO_PCI_CAP_NOTIFY_CFG) {
+    WriteHostDWordToLittleEndian((Bit32u*)&cap[16], VIRTIO_PCI_NOTIFY_MULT);
+  }
+}
+
+void bx_virtio_blk_c::get_config(Bit8u *config)
+{
+  memset(config, 0, VIRTIO_BLK_CONFIG_SIZE);
+  // capacity in 512 byte sectors
+  WriteHostQWordToLittleEndian((Bit64u*)&config[0], BX_VIRTIO_BLK_THIS hdimage->hd_size >> 9);
+  WriteHostDWordToLittleEndian((Bit32u*)&config[8], VIRTIO_BLK_SIZE_MAX);
+  WriteHostDWordToLittleEndian((Bit32u*)&config[12], VIRTIO_BLK_SEG_MAX);
+  WriteHostDWordToLittleEndian((Bit32u*)&config[20], 512);
+  WriteHostWordToLittleEndian((Bit16u*)&config[34], BX_VIRTIO_BLK_THIS s.num_queues);
+}
+
+void bx_virtio_blk_c::get_common_config(Bit8u *config)
+{
+  virtio_queue_t *vq = NULL;
+  Bit32u value;
+
+  if (BX_VIRTIO_BLK_THIS s.queue_sel < BX_VIRTIO_BLK_THIS s.num_queues) {
+    vq = &BX_VIRTIO_BLK_THIS s.queue[BX_VIRTIO_BLK_THIS s.queue_sel];
+  }
+  memset(config, 0, VIRTIO_COMMON_SIZE);
+  WriteHostDWordToLittleEndian((Bit32u*)&config[VIRTIO_COMMON_DFSELECT], BX_VIRTIO_BLK_THIS s.dfselect);
+  value = 0;
+  if (BX_VIRTIO_BLK_THIS s.dfselect < 2) {
+    value = (Bit32u)(BX_VIRTIO_BLK_THIS s.host_features >> (BX_VIRTIO_BLK_THIS s.dfselect * 32));
+  }
+  WriteHostDWordToLittleEndian((Bit32u*)&config[VIRTIO_COMMON_DF], value);
+  WriteHostDWordToLittleEndian((Bit32u*)&config[VIRTIO_COMMON_GFSELECT], BX_VIRTIO_BLK_THIS s.gfselect);
+  value = 0;
+  if (BX_VIRTIO_BLK_THIS s.gfselect < 2) {
+    value = (Bit32u)(BX_VIRTIO_BLK_THIS s.guest_features >> (BX_VIRTIO_BLK_THIS s.gfselect * 32));
+  }
+  WriteHostDWordToLittleEndian((Bit32u*)&config[VIRTIO_COMMON_GF], value);
+  WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_MSIX], VIRTIO_NO_VECTOR);
+  WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_NUMQ], BX_VIRTIO_BLK_THIS s.num_queues);
+  config[VIRTIO_COMMON_STATUS] = BX_VIRTIO_BLK_THIS s.status;
+  config[VIRTIO_COMMON_CFGGEN] = BX_VIRTIO_BLK_THIS s.config_generation;
+  WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_Q_SELECT], BX_VIRTIO_BLK_THIS s.queue_sel);
+  WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_Q_MSIX], VIRTIO_NO_VECTOR);
+  if (vq != NULL) {
+    WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_Q_SIZE], vq->size);
+    WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_Q_ENABLE], vq->enabled);
+    WriteHostWordToLittleEndian((Bit16u*)&config[VIRTIO_COMMON_Q_NOFF], BX_VIRTIO_BLK_THIS s.queue_sel);
+    WriteHostQWordToLittleEndian((Bit64u*)&config[VIRTIO_COMMON_Q_DESCLO], vq->desc);
+    WriteHostQWordToLittleEndian((Bit64u*)&config[VIRTIO_COMMON_Q_AVAILLO], vq->avail);
+    WriteHostQWordToLittleEndian((Bit64u*)&config[VIRTIO_COMMON_Q_USEDLO], vq->used);
+  }
+}
+
+void bx_virtio_blk_c::write_common_config(Bit32u offset, Bit32u value, unsigned len)
+{
+  virtio_queue_t *vq = NULL;
+  Bit64u mask;
+
+  if (BX_VIRTIO_BLK_THIS s.queue_sel < BX_VIRTIO_BLK_THIS s.num_queues) {
+    vq = &BX_VIRTIO_BLK_THIS s.queue[BX_VIRTIO_BLK_THIS s.queue_sel];
+  }
+  switch (offset) {
+    case VIRTIO_COMMON_DFSELECT:
+      BX_VIRTIO_BLK_THIS s.dfselect = value;
+      break;
+    case VIRTIO_COMMON_GFSELECT:
+      BX_VIRTIO_BLK_THIS s.gfselect = value;
+      break;
+    case VIRTIO_COMMON_GF:
+      if (BX_VIRTIO_BLK_THIS s.gfselect < 2) {
+        mask = BX_CONST64(0xffffffff) << (BX_VIRTIO_BLK_THIS s.gfselect * 32);
+        BX_VIRTIO_BLK_THIS s.guest_features &= ~mask;
+        BX_VIRTIO_BLK_THIS s.guest_features |= ((Bit64u)value << (BX_VIRTIO_BLK_THIS s.gfselect * 32)) &
+                                               BX_VIRTIO_BLK_THIS s.host_features;
+      }
+      break;
+    case VIRTIO_COMMON_MSIX:
+    case VIRTIO_COMMON_Q_MSIX:
+      break;
+    case VIRTIO_COMMON_STATUS:
+      set_status((Bit8u)value);
+      break;
+    case VIRTIO_COMMON_Q_SELECT:
+      BX_VIRTIO_BLK_THIS s.queue_sel = (Bit16u)value;
+      break;
+    case VIRTIO_COMMON_Q_SIZE:
+      if ((vq != NULL) && (value > 0) && (value <= VIRTIO_BLK_QUEUE_SIZE)) {
+        vq->size = (Bit16u)value;
+      }
+      break;
+    case VIRTIO_COMMON_Q_ENABLE:
+      if (vq != NULL) {
+        vq->enabled = (value & 1);
+      }
+      break;
+    case VIRTIO_COMMON_Q_DESCLO:
+    case VIRTIO_COMMON_Q_AVAILLO:
+    case VIRTIO_COMMON_Q_USEDLO:
+    case VIRTIO_COMMON_Q_DESCHI:
+    case VIRTIO_COMMON_Q_AVAILHI:
+    case VIRTIO_COMMON_Q_USEDHI:
+      if (vq != NULL) {
+        Bit64u *addr = (offset < VIRTIO_COMMON_Q_AVAILLO) ? &vq->desc :
+                       (offset < VIRTIO_COMMON_Q_USEDLO) ? &vq->avail : &vq->used;
+        if (offset & 4) {
+          *addr = (*addr & BX_CONST64(0xffffffff)) | ((Bit64u)value << 32);
+        } else {
+          *addr = (*addr & BX_CONST64(0xffffffff00000000)) | value;
+        }
+      }
+      break;
+    default:
+      BX_DEBUG(("write to read-only common config register 0x%02x ignored", offset));
+  }
+}
+
+void bx_virtio_blk_c::set_queue_pfn(Bit32u pfn)
+{
+  virtio_queue_t *vq;
+
+  if (BX_VIRTIO_BLK_THIS s.queue_sel >= BX_VIRTIO_BLK_THIS s.num_queues)
+    return;
+  vq = &BX_VIRTIO_BLK_THIS s.queue[BX_VIRTIO_BLK_THIS s.queue_sel];
+  // the legacy layout: descriptors, available ring, aligned used ring
+  vq->pfn = pfn;
+  vq->size = VIRTIO_BLK_QUEUE_SIZE;
+  vq->desc = (Bit64u)pfn * VIRTIO_PCI_VRING_ALIGN;
+  vq->avail = vq->desc + vq->size * 16;
+  vq->used = (vq->avail + 2 * (3 + vq->size) + VIRTIO_PCI_VRING_ALIGN - 1) &
+             ~((Bit64u)VIRTIO_PCI_VRING_ALIGN - 1);
+  vq->enabled = (pfn != 0);
+  vq->last_avail_idx = 0;
+  vq->used_idx = 0;
+}
+
+// legacy interface
+
+Bit32u bx_virtio_blk_c::read_handler(void *this_ptr, Bit32u address, unsigned io_len)
+{
+  bx_virtio_blk_c *class_ptr = (bx_virtio_blk_c *) this_ptr;
+  return class_ptr->read(address, io_len);
+}
+
+Bit32u bx_virtio_blk_c::read(Bit32u address, unsigned io_len)
+{
+  Bit8u config[VIRTIO_BLK_CONFIG_SIZE];
+  Bit32u offset, value = 0;
+  bool valid = (BX_VIRTIO_BLK_THIS s.queue_sel < BX_VIRTIO_BLK_THIS s.num_queues);
+
+  offset = address - BX_VIRTIO_BLK_THIS pci_bar[0].addr;
+  if (offset >= VIRTIO_PCI_CONFIG) {
+    get_config(config);
+    offset -= VIRTIO_PCI_CONFIG;
+    for (unsigned i = 0; i < io_len; i++) {
+      if ((offset + i) < VIRTIO_BLK_CONFIG_SIZE) {
+        value |= (config[offset + i] << (i * 8));
+      }
+    }
+    return value;
+  }
+  switch (offset) {
+    case VIRTIO_PCI_HOST_FEATURES:
+      value = (Bit32u)BX_VIRTIO_BLK_THIS s.host_features;
+      break;
+    case VIRTIO_PCI_GUEST_FEATURES:
+      value = (Bit32u)BX_VIRTIO_BLK_THIS s.guest_features;
+      break;
+    case VIRTIO_PCI_QUEUE_PFN:
+      if (valid) value = BX_VIRTIO_BLK_THIS s.queue[BX_VIRTIO_BLK_THIS s.queue_sel].pfn;
+      break;
+    case VIRTIO_PCI_QUEUE_NUM:
+      if (valid) value = VIRTIO_BLK_QUEUE_SIZE;
+      break;
+    case VIRTIO_PCI_QUEUE_SEL:
+      value = BX_VIRTIO_BLK_THIS s.queue_sel;
+      break;
+    case VIRTIO_PCI_STATUS:
+      value = BX_VIRTIO_BLK_THIS s.status;
+      break;
+    case VIRTIO_PCI_ISR:
+      // reading the ISR status clears it
+      value = BX_VIRTIO_BLK_THIS s.isr;
+      BX_VIRTIO_BLK_THIS s.isr = 0;
+      set_irq_level(0);
+      break;
+    default:
+      BX_DEBUG(("unsupported i/o read from offset 0x%02x", offset));
+  }
+  return value;
+}
+
+void bx_virtio_blk_c::write_handler(void *this_ptr, Bit32u address, Bit32u value, unsigned io_len)
+{
+  bx_virtio_blk_c *class_ptr = (bx_virtio_blk_c *) this_ptr;
+  class_ptr->write(address, value, io_len);
+}
+
+void bx_virtio_blk_c::write(Bit32u address, Bit32u value, unsigned io_len)
+{
+  Bit32u offset = address - BX_VIRTIO_BLK_THIS pci_bar[0].addr;
+
+  switch (offset) {
+    case VIRTIO_PCI_GUEST_FEATURES:
+      BX_VIRTIO_BLK_THIS s.guest_features = value & (Bit32u)BX_VIRTIO_BLK_THIS s.host_features;
+      break;
+    case VIRTIO_PCI_QUEUE_PFN:
+      set_queue_pfn(value);
+      break;
+    case VIRTIO_PCI_QUEUE_SEL:
+      BX_VIRTIO_BLK_THIS s.queue_sel = (Bit16u)value;
+      break;
+    case VIRTIO_PCI_QUEUE_NOTIFY:
+      process_queue(value & 0xffff);
+      break;
+    case VIRTIO_PCI_STATUS:
+      set_status((Bit8u)value);
+      break;
+    default:
+      BX_DEBUG(("unsupported i/o write to offset 0x%02x", offset));
+  }
+}
+
+// modern interface
+
+bool bx_virtio_blk_c::mem_read_handler(bx_phy_address addr, unsigned len,
+                                       void *data, void *param)
+{
+  bx_virtio_blk_c *class_ptr = (bx_virtio_blk_c *) param;
+
+  return class_ptr->mem_read(addr, len, data);
+}
+
+bool bx_virtio_blk_c::mem_read(bx_phy_address addr, unsigned len, void *data)
+{
+  Bit8u config[VIRTIO_COMMON_SIZE];
+  Bit32u offset, region, size = 0;
+  Bit64u value = 0;
+
+  offset = (Bit32u)addr & (VIRTIO_PCI_MEM_SIZE - 1);
+  region = offset & ~0xfff;
+  offset &= 0xfff;
+  if (region == VIRTIO_PCI_COMMON_OFFSET) {
+    get_common_config(config);
+    size = VIRTIO_COMMON_SIZE;
+  } else if (region == VIRTIO_PCI_DEVICE_OFFSET) {
+    get_config(config);
+    size = VIRTIO_BLK_CONFIG_SIZE;
+  } else if ((region == VIRTIO_PCI_ISR_OFFSET) && (offset == 0)) {
+    // reading the ISR status clears it
+    config[0] = BX_VIRTIO_BLK_THIS s.isr;
+    BX_VIRTIO_BLK_THIS s.isr = 0;
+    set_irq_level(0);
+    size = 1;
+  }
+  for (unsigned i = 0; i < len; i++) {
+    if ((offset + i) < size) {
+      value |= ((Bit64u)config[offset + i] << (i * 8));
+    }
+  }
+  switch (len) {
+    case 1:
+      *((Bit8u*)data) = (Bit8u)value;
+      break;
+    case 2:
+      *((Bit16u*)data) = (Bit16u)value;
+      break;
+    case 4:
+      *((Bit32u*)data) = (Bit32u)value;
+      break;
+    case 8:
+      *((Bit64u*)data) = value;
+      break;
+    default:
+      memset(data, 0, len);
+  }
+  return 1;
+}
+
+bool bx_virtio_blk_c::mem_write_handler(bx_phy_address addr, unsigned len,
+                                        void *data, void *param)
+{
+  bx_virtio_blk_c *class_ptr = (bx_virtio_blk_c *) param;
+
+  return class_ptr->mem_write(addr, len, data);
+}
+
+bool bx_virtio_blk_c::mem_write(bx_phy_address addr, unsigned len, void *data)
+{
+  Bit32u offset, region, value;
+
+  switch (len) {
+    case 1:
+      value = *((Bit8u*)data);
+      break;
+    case 2:
+      value = *((Bit16u*)data);
+      break;
+    case 4:
+      value = *((Bit32u*)data);
+      break;
+    default:
+      BX_ERROR(("unsupported memory write with length %d", len));
+      return 1;
+  }
+  offset = (Bit32u)addr & (VIRTIO_PCI_MEM_SIZE - 1);
+  region = offset & ~0xfff;
+  offset &= 0xfff;
+  if (region == VIRTIO_PCI_COMMON_OFFSET) {
+    write_common_config(offset, value, len);
+  } else if (region == VIRTIO_PCI_NOTIFY_OFFSET) {
+    process_queue(offset / VIRTIO_PCI_NOTIFY_MULT);
+  }
+  return 1;
+}
+
+// request processing
+
+Bit16u bx_virtio_blk_c::read_guest16(bx_phy_address addr)
+{
+  Bit16u value;
+
+  DEV_MEM_READ_PHYSICAL_DMA(addr, 2, (Bit8u*)&value);
+  return ReadHostWordFromLittleEndian(&value);
+}
+
+void bx_virtio_blk_c::write_guest16(bx_phy_address addr, Bit16u value)
+{
+  Bit16u data;
+
+  WriteHostWordToLittleEndian(&data, value);
+  DEV_MEM_WRITE_PHYSICAL_DMA(addr, 2, (Bit8u*)&data);
+}
+
+int bx_virtio_blk_c::get_segments(virtio_queue_t *vq, Bit16u head)
+{
+  Bit8u desc[16];
+  bx_phy_address table = (bx_phy_address)vq->desc;
+  Bit32u table_size = vq->size, count = 0, len;
+  Bit16u index = head, flags;
+  bool indirect = 0;
+  int nsegs = 0;
+
+  // collect the buffers of a descriptor chain, following an indirect table
+  while (1) {
+    if (index >= table_size) {
+      BX_ERROR(("descriptor index %d out of range", index));
+      return -1;
+    }
+    DEV_MEM_READ_PHYSICAL_DMA(table + index * 16, 16, desc);
+    len = ReadHostDWordFromLittleEndian((Bit32u*)&desc[8]);
+    flags = ReadHostWordFromLittleEndian((Bit16u*)&desc[12]);
+    if (flags & VRING_DESC_F_INDIRECT) {
+      if (indirect || (nsegs > 0) || (len < 16) || ((len & 15) != 0)) {
+        BX_ERROR(("invalid indirect descriptor"));
+        return -1;
+      }
+      indirect = 1;
+      table = (bx_phy_address)ReadHostQWordFromLittleEndian((Bit64u*)&desc[0]);
+      table_size = len / 16;
+      index = 0;
+      continue;
+    }
+    if ((nsegs >= VIRTIO_BLK_QUEUE_SIZE) || (++count > table_size)) {
+      BX_ERROR(("descriptor chain too long"));
+      return -1;
+    }
+    BX_VIRTIO_BLK_THIS seg[nsegs].addr = (bx_phy_address)ReadHostQWordFromLittleEndian((Bit64u*)&desc[0]);
+    BX_VIRTIO_BLK_THIS seg[nsegs].len = len;
+    BX_VIRTIO_BLK_THIS seg[nsegs].write = ((flags & VRING_DESC_F_WRITE) != 0);
+    nsegs++;
+    if ((flags & VRING_DESC_F_NEXT) == 0)
+      break;
+    index = ReadHostWordFromLittleEndian((Bit16u*)&desc[14]);
+  }
+  return nsegs;
+}
+
+bool bx_virtio_blk_c::copy_segments(int nsegs, Bit32u offset, Bit8u *buf, Bit32u len,
+                                    bool to_guest)
+{
+  Bit32u count;
+
+  for (int i = 0; (i < nsegs) && (len > 0); i++) {
+    virtio_seg_t *sg = &BX_VIRTIO_BLK_THIS seg[i];
+    if (offset >= sg->len) {
+      offset -= sg->len;
+      continue;
+    }
+    // the device only writes to device-writable buffers and vice versa
+    if (sg->write != to_guest)
+      return 0;
+    count = sg->len - offset;
+    if (count > len) count = len;
+    if (to_guest) {
+      DEV_MEM_WRITE_PHYSICAL_DMA(sg->addr + offset, count, buf);
+    } else {
+      DEV_MEM_READ_PHYSICAL_DMA(sg->addr + offset, count, buf);
+    }
+    buf += count;
+    len -= count;
+    offset = 0;
+  }
+  return (len == 0);
+}
+
+Bit32u bx_virtio_blk_c::execute_request(int nsegs)
+{
+  Bit8u header[16], status = VIRTIO_BLK_S_OK;
+  Bit64u total = 0;
+  Bit64s offset;
+  Bit32u type, len, written = 0;
+  bx_iovec_t iov;
+
+  // the request header is followed by the data and the status byte
+  for (int i = 0; i < nsegs; i++) {
+    total += BX_VIRTIO_BLK_THIS seg[i].len;
+  }
+  if ((total < 17) || (total > ((Bit64u)VIRTIO_BLK_SEG_MAX * VIRTIO_BLK_SIZE_MAX + 17)) ||
+      !copy_segments(nsegs, 0, header, 16, 0)) {
+    BX_ERROR(("malformed request"));
+    if (total > 0) {
+      status = VIRTIO_BLK_S_IOERR;
+      copy_segments(nsegs, (Bit32u)(total - 1), &status, 1, 1);
+    }
+    return 0;
+  }
+  type = ReadHostDWordFromLittleEndian((Bit32u*)&header[0]);
+  offset = (Bit64s)(ReadHostQWordFromLittleEndian((Bit64u*)&header[8]) << 9);
+  len = (Bit32u)(total - 17);
+  switch (type) {
+    case VIRTIO_BLK_T_IN:
+    case VIRTIO_BLK_T_OUT:
+      if (((len & 511) != 0) || (offset < 0) ||
+          ((Bit64u)(offset + len) > BX_VIRTIO_BLK_THIS hdimage->hd_size)) {
+        BX_ERROR(("%s request out of range (offset=" FMT_LL "d, len=%d)",
+                  (type == VIRTIO_BLK_T_IN) ? "read" : "write", offset, len));
+        status = VIRTIO_BLK_S_IOERR;
+        break;
+      }
+      if (len > BX_VIRTIO_BLK_THIS buffer_size) {
+        if (BX_VIRTIO_BLK_THIS buffer != NULL) {
+          delete [] BX_VIRTIO_BLK_THIS buffer;
+        }
+        BX_VIRTIO_BLK_THIS buffer = new Bit8u[len];
+        BX_VIRTIO_BLK_THIS buffer_size = len;
+      }
+      bx_gui->statusbar_setitem(BX_VIRTIO_BLK_THIS s.statusbar_id, 1, (type == VIRTIO_BLK_T_OUT));
+      iov.iov_base = BX_VIRTIO_BLK_THIS buffer;
+      iov.iov_len = len;
+      if (type == VIRTIO_BLK_T_IN) {
+        if ((len > 0) && (BX_VIRTIO_BLK_THIS hdimage->readv(offset, &iov, 1) != (ssize_t)len)) {
+          BX_ERROR(("could not read %d bytes at offset " FMT_LL "d", len, offset));
+          status = VIRTIO_BLK_S_IOERR;
+        } else if (!copy_segments(nsegs, 16, BX_VIRTIO_BLK_THIS buffer, len, 1)) {
+          status = VIRTIO_BLK_S_IOERR;
+        } else {
+          written = len;
+        }
+      } else {
+        if (!copy_segments(nsegs, 16, BX_VIRTIO_BLK_THIS buffer, len, 0)) {
+          status = VIRTIO_BLK_S_IOERR;
+        } else if ((len > 0) && (BX_VIRTIO_BLK_THIS hdimage->writev(offset, &iov, 1) != (ssize_t)len)) {
+          BX_ERROR(("could not write %d bytes at offset " FMT_LL "d", len, offset));
+          status = VIRTIO_BLK_S_IOERR;
+        }
+      }
+      break;
+    case VIRTIO_BLK_T_FLUSH:
+      // write back the data the image format keeps cached
+      if (BX_VIRTIO_BLK_THIS hdimage->flush() < 0) {
+        BX_ERROR(("could not flush the disk image"));
+        status = VIRTIO_BLK_S_IOERR;
+      }
+      break;
+    case VIRTIO_BLK_T_GET_ID:
+      if (len > VIRTIO_BLK_ID_BYTES) len = VIRTIO_BLK_ID_BYTES;
+      if (!copy_segments(nsegs, 16, (Bit8u*)virtio_blk_id, len, 1)) {
+        status = VIRTIO_BLK_S_IOERR;
+      } else {
+        written = len;
+      }
+      break;
+    default:
+      BX_DEBUG(("unsupported request type %d", type));
+      status = VIRTIO_BLK_S_UNSUPP;
+  }
+  if (!copy_segments(nsegs, (Bit32u)(total - 1), &status, 1, 1)) {
+    BX_ERROR(("status byte not writable"));
+  }
+  return written + 1;
+}
+
+void bx_virtio_blk_c::process_queue(unsigned index)
+{
+  virtio_queue_t *vq;
+  Bit8u elem[8];
+  Bit16u head, avail_idx, old_used, used_event;
+  bool event_idx, notify;
+  int nsegs;
+  Bit32u written;
+
+  if (index >= BX_VIRTIO_BLK_THIS s.num_queues) {
+    BX_ERROR(("notify for invalid queue %d", index));
+    return;
+  }
+  vq = &BX_VIRTIO_BLK_THIS s.queue[index];
+  if (!vq->enabled)
+    return;
+
+  event_idx = ((BX_VIRTIO_BLK_THIS s.guest_features & (1 << VIRTIO_RING_F_EVENT_IDX)) != 0);
+  old_used = vq->used_idx;
+  avail_idx = read_guest16(vq->avail + 2);
+  while (vq->last_avail_idx != avail_idx) {
+    head = read_guest16(vq->avail + 4 + 2 * (vq->last_avail_idx % vq->size));
+    vq->last_avail_idx++;
+    written = 0;
+    nsegs = get_segments(vq, head);
+    if (nsegs > 0) {
+      written = execute_request(nsegs);
+    }
+    WriteHostDWordToLittleEndian((Bit32u*)&elem[0], head);
+    WriteHostDWordToLittleEndian((Bit32u*)&elem[4], written);
+    DEV_MEM_WRITE_PHYSICAL_DMA(vq->used + 4 + 8 * (vq->used_idx % vq->size), 8, elem);
+    vq->used_idx++;
+  }
+  if (event_idx) {
+    // the guest only needs to notify for requests after these
+    write_guest16(vq->used + 4 + 8 * vq->size, vq->last_avail_idx);
+  }
+  if (vq->used_idx == old_used)
+    return;
+  write_guest16(vq->used + 2, vq->used_idx);
+
+  // interrupt suppression
+  if (event_idx) {
+    used_event = read_guest16(vq->avail + 4 + 2 * vq->size);
+    notify = ((Bit16u)(vq->used_idx - used_event - 1) < (Bit16u)(vq->used_idx - old_used));
+  } else {
+    notify = ((read_guest16(vq->avail) & VRING_AVAIL_F_NO_INTERRUPT) == 0);
+  }
+  if (notify) {
+    BX_VIRTIO_BLK_THIS s.isr |= 1;
+    set_irq_level(1);
+  }
+}
+
+// pci configuration space write callback handler
+void bx_virtio_blk_c::pci_write_handler(Bit8u address, Bit32u value, unsigned io_len)
+{
+  Bit8u value8, oldval;
+
+  if ((address >= 0x18) && (address < 0x30))
+    return;
+
+  BX_DEBUG_PCI_WRITE(address, value, io_len);
+  for (unsigned i=0; i<io_len; i++) {
+    value8 = (value >> (i*8)) & 0xFF;
+    oldval = BX_VIRTIO_BLK_THIS pci_conf[address+i];
+    switch (address+i) {
+      case 0x04:
+        value8 &= 0x07;
+        break;
+      default:
+        value8 = oldval;
+    }
+    BX_VIRTIO_BLK_THIS pci_conf[address+i] = value8;
+  }
+}
+
+#endif // BX_SUPPORT_PCI && BX_SUPPORT_VIRTIO_BLK
@@ -0,0 +1,204 @@
+/////////////////////////////////////////////////////////////////////////
+// $Id$
+/////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (C) 2021  The Bochs Project
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef BX_IODEV_VIRTIO_BLK_H
+#define BX_IODEV_VIRTIO_BLK_H
+
+#define BX_VIRTIO_BLK_THIS this->
+#define BX_VIRTIO_BLK_THIS_PTR this
+
+// PCI IDs of a transitional virtio block device
+#define VIRTIO_PCI_VENDOR         0x1af4
+#define VIRTIO_PCI_DEVICE_BLK     0x1001
+#define VIRTIO_PCI_SUBSYSTEM_BLK  0x0002
+
+#define VIRTIO_BLK_MAX_QUEUES     8
+#define VIRTIO_BLK_QUEUE_SIZE     256
+// largest segment and number of data segments of a request
+#define VIRTIO_BLK_SIZE_MAX       0x10000
+#define VIRTIO_BLK_SEG_MAX        (VIRTIO_BLK_QUEUE_SIZE - 2)
+#define VIRTIO_BLK_ID_BYTES       20
+
+// legacy interface (i/o BAR #0)
+#define VIRTIO_PCI_HOST_FEATURES  0x00
+#define VIRTIO_PCI_GUEST_FEATURES 0x04
+#define VIRTIO_PCI_QUEUE_PFN      0x08
+#define VIRTIO_PCI_QUEUE_NUM      0x0c
+#define VIRTIO_PCI_QUEUE_SEL      0x0e
+#define VIRTIO_PCI_QUEUE_NOTIFY   0x10
+#define VIRTIO_PCI_STATUS         0x12
+#define VIRTIO_PCI_ISR            0x13
+#define VIRTIO_PCI_CONFIG         0x14
+#define VIRTIO_PCI_IO_SIZE        64
+#define VIRTIO_PCI_VRING_ALIGN    4096
+
+// modern interface (memory BAR #1), one 4k page per structure
+#define VIRTIO_PCI_MEM_SIZE       0x4000
+#define VIRTIO_PCI_COMMON_OFFSET  0x0000
+#define VIRTIO_PCI_ISR_OFFSET     0x1000
+#define VIRTIO_PCI_DEVICE_OFFSET  0x2000
+#define VIRTIO_PCI_NOTIFY_OFFSET  0x3000
+#define VIRTIO_PCI_NOTIFY_MULT    4
+
+// PCI capability types
+#define VIRTIO_PCI_CAP_COMMON_CFG 1
+#define VIRTIO_PCI_CAP_NOTIFY_CFG 2
+#define VIRTIO_PCI_CAP_ISR_CFG    3
+#define VIRTIO_PCI_CAP_DEVICE_CFG 4
+
+// common configuration structure
+#define VIRTIO_COMMON_DFSELECT    0x00
+#define VIRTIO_COMMON_DF          0x04
+#define VIRTIO_COMMON_GFSELECT    0x08
+#define VIRTIO_COMMON_GF          0x0c
+#define VIRTIO_COMMON_MSIX        0x10
+#define VIRTIO_COMMON_NUMQ        0x12
+#define VIRTIO_COMMON_STATUS      0x14
+#define VIRTIO_COMMON_CFGGEN      0x15
+#define VIRTIO_COMMON_Q_SELECT    0x16
+#define VIRTIO_COMMON_Q_SIZE      0x18
+#define VIRTIO_COMMON_Q_MSIX      0x1a
+#define VIRTIO_COMMON_Q_ENABLE    0x1c
+#define VIRTIO_COMMON_Q_NOFF      0x1e
+#define VIRTIO_COMMON_Q_DESCLO    0x20
+#define VIRTIO_COMMON_Q_DESCHI    0x24
+#define VIRTIO_COMMON_Q_AVAILLO   0x28
+#define VIRTIO_COMMON_Q_AVAILHI   0x2c
+#define VIRTIO_COMMON_Q_USEDLO    0x30
+#define VIRTIO_COMMON_Q_USEDHI    0x34
+#define VIRTIO_COMMON_SIZE        0x38
+#define VIRTIO_NO_VECTOR          0xffff
+
+// device status bits
+#define VIRTIO_STATUS_DRIVER_OK   0x04
+#define VIRTIO_STATUS_FAILED      0x80
+
+// feature bits
+#define VIRTIO_BLK_F_SIZE_MAX     1
+#define VIRTIO_BLK_F_SEG_MAX      2
+#define VIRTIO_BLK_F_FLUSH        9
+#define VIRTIO_BLK_F_MQ           12
+#define VIRTIO_RING_F_INDIRECT    28
+#define VIRTIO_RING_F_EVENT_IDX   29
+#define VIRTIO_F_VERSION_1        32
+
+// virtqueue descriptor and ring flags
+#define VRING_DESC_F_NEXT         1
+#define VRING_DESC_F_WRITE        2
+#define VRING_DESC_F_INDIRECT     4
+#define VRING_AVAIL_F_NO_INTERRUPT 1
+
+// request types and status
+#define VIRTIO_BLK_T_IN           0
+#define VIRTIO_BLK_T_OUT          1
+#define VIRTIO_BLK_T_FLUSH        4
+#define VIRTIO_BLK_T_GET_ID       8
+#define VIRTIO_BLK_S_OK           0
+#define VIRTIO_BLK_S_IOERR        1
+#define VIRTIO_BLK_S_UNSUPP       2
+
+// size of the device specific configuration
+#define VIRTIO_BLK_CONFIG_SIZE    36
+
+typedef struct {
+  Bit16u size;
+  bool   enabled;
+  Bit32u pfn;             // legacy interface only
+  Bit64u desc;
+  Bit64u avail;
+  Bit64u used;
+  Bit16u last_avail_idx;
+  Bit16u used_idx;
+} virtio_queue_t;
+
+// guest buffer of a request
+typedef struct {
+  bx_phy_address addr;
+  Bit32u len;
+  bool   write;
+} virtio_seg_t;
+
+typedef struct {
+  Bit64u host_features;
+  Bit64u guest_features;
+  Bit32u dfselect;
+  Bit32u gfselect;
+  Bit8u  status;
+  Bit8u  isr;
+  Bit8u  config_generation;
+  Bit16u queue_sel;
+  Bit16u num_queues;
+  virtio_queue_t queue[VIRTIO_BLK_MAX_QUEUES];
+
+  Bit8u devfunc;
+  int statusbar_id;
+} bx_virtio_blk_t;
+
+
+class bx_virtio_blk_c : public bx_pci_device_c {
+public:
+  bx_virtio_blk_c();
+  virtual ~bx_virtio_blk_c();
+  virtual void init(void);
+  virtual void reset(unsigned type);
+  virtual void register_state(void);
+  virtual void after_restore_state(void);
+  virtual void after_fork(bool child);
+
+  virtual void pci_write_handler(Bit8u address, Bit32u value, unsigned io_len);
+
+private:
+  bx_virtio_blk_t s;
+
+  device_image_t *hdimage;
+  Bit8u  *buffer;
+  Bit32u buffer_size;
+  virtio_seg_t seg[VIRTIO_BLK_QUEUE_SIZE];
+
+  void   set_irq_level(bool level);
+  void   device_reset(void);
+  void   set_status(Bit8u value);
+  void   init_capability(Bit8u offset, Bit8u next, Bit8u type, Bit32u bar_offset,
+                         Bit32u length);
+  void   get_config(Bit8u *config);
+  void   get_common_config(Bit8u *config);
+  void   write_common_config(Bit32u offset, Bit32u value, unsigned len);
+  void   set_queue_pfn(Bit32u pfn);
+
+  Bit16u read_guest16(bx_phy_address addr);
+  void   write_guest16(bx_phy_address addr, Bit16u value);
+  int    get_segments(virtio_queue_t *vq, Bit16u head);
+  bool   copy_segments(int nsegs, Bit32u offset, Bit8u *buf, Bit32u len, bool to_guest);
+  Bit32u execute_request(int nsegs);
+  void   process_queue(unsigned index);
+
+  static bool mem_read_handler(bx_phy_address addr, unsigned len, void *data, void *param);
+  static bool mem_write_handler(bx_phy_address addr, unsigned len, void *data, void *param);
+  bool mem_read(bx_phy_address addr, unsigned len, void *data);
+  bool mem_write(bx_phy_address addr, unsigned len, void *data);
+
+  static Bit32u read_handler(void *this_ptr, Bit32u address, unsigned io_len);
+  static void   write_handler(void *this_ptr, Bit32u address, Bit32u value, unsigned io_len);
+  Bit32u read(Bit32u address, unsigned io_len);
+  void   write(Bit32u address, Bit32u value, unsigned io_len);
+};
+
+#endif
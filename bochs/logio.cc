@@ -26,6 +26,9 @@
 #include "bxthread.h"
 #include "cpu/cpu.h"
 #include <assert.h>
+#if BX_HAVE_FORK
+#include <fcntl.h>
+#endif
 
 #if BX_WITH_CARBON
 #include <Carbon/Carbon.h>
@@ -182,6 +185,18 @@ void iofunctions::exit_log()
   }
 }
 
+// Both processes of a fork write to the log file. In append mode every write
+// goes to the end of the file, so they can't overwrite each other's output.
+void iofunctions::before_fork()
+{
+#if BX_HAVE_FORK
+  if (logfd != stderr) {
+    int fd = fileno(logfd);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_APPEND);
+  }
+#endif
+}
+
 // all other functions may use genlog safely.
 #define LOG_THIS genlog->
 
@@ -112,6 +112,7 @@ public:
   void init_log(int fd);
   void init_log(FILE *fs);
   void exit_log();
+  void before_fork();
   void set_log_prefix(const char *prefix);
   int get_n_logfns() const { return n_logfn; }
   logfunc_t *get_logfn(int index) { return logfn_list[index]; }
@@ -24,6 +24,9 @@
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
 #include "iodev/hdimage/hdimage.h"
+#if BX_SMP_HOST_THREADS
+#include "bxthread.h"
+#endif
 #if BX_NETWORKING
 #include "iodev/network/netmod.h"
 #endif
@@ -93,6 +96,9 @@ typedef BX_CPU_C *BX_CPU_C_PTR;
 #if BX_SUPPORT_SMP
 // multiprocessor simulation, we need an array of cpus
 BOCHSAPI BX_CPU_C_PTR *bx_cpu_array = NULL;
+#if BX_SMP_HOST_THREADS
+BOCHSAPI __thread BX_CPU_C *bx_current_cpu = NULL;
+#endif
 #else
 // single processor simulation, so there's one of everything
 BOCHSAPI BX_CPU_C bx_cpu;
@@ -245,7 +251,7 @@ void print_tree(bx_param_c *node, int level, bool xml)
         break;
       }
     case BXT_PARAM_DATA:
-      dbg_printf("'binary data size=%d'", ((bx_shadow_data_c*)node)->get_size());
+      dbg_printf("'binary data size=" FMT_LL "u'", ((bx_shadow_data_c*)node)->get_size());
       break;
     default:
       dbg_printf("(unknown parameter type)");
@@ -647,6 +653,9 @@ int bx_init_main(int argc, char *argv[])
 #if BX_SUPPORT_PCIDEV
           fprintf(stderr, "pcidev\n");
 #endif
+#if BX_SUPPORT_VIRTIO_BLK
+          fprintf(stderr, "virtio_blk\n");
+#endif
 #if BX_SUPPORT_NE2K
           fprintf(stderr, "ne2k\n");
 #endif
@@ -971,6 +980,58 @@ bool load_and_init_display_lib(void)
   return (bx_gui != NULL);
 }
 
+#if BX_SMP_HOST_THREADS
+
+// Synchronization point of the processor threads: the emulated time is
+// advanced by the last processor finishing its quantum while the others
+// wait for it
+static struct {
+  BX_MUTEX(lock);
+  pthread_cond_t cond;
+  unsigned arrived;
+  unsigned round;
+  Bit64u executed;
+  bool stop;
+} bx_smp_sync_point;
+
+// returns true when the simulation has to be stopped
+static bool bx_smp_sync(Bit32u executed)
+{
+  BX_LOCK(bx_smp_sync_point.lock);
+  bx_smp_sync_point.executed += executed;
+  if (++bx_smp_sync_point.arrived == BX_SMP_PROCESSORS) {
+    bx_pc_system.cpu_threads_running = 0;
+    BX_TICKN((Bit32u)(bx_smp_sync_point.executed / BX_SMP_PROCESSORS));
+    bx_smp_sync_point.executed %= BX_SMP_PROCESSORS;
+    bx_pc_system.handle_reset_request();
+    bx_smp_sync_point.stop = bx_pc_system.kill_bochs_request;
+    bx_pc_system.cpu_threads_running = !bx_smp_sync_point.stop;
+    bx_smp_sync_point.arrived = 0;
+    bx_smp_sync_point.round++;
+    pthread_cond_broadcast(&bx_smp_sync_point.cond);
+  }
+  else {
+    unsigned round = bx_smp_sync_point.round;
+    while (round == bx_smp_sync_point.round)
+      pthread_cond_wait(&bx_smp_sync_point.cond, &bx_smp_sync_point.lock);
+  }
+  bool stop = bx_smp_sync_point.stop;
+  BX_UNLOCK(bx_smp_sync_point.lock);
+  return stop;
+}
+
+static BX_THREAD_FUNC(bx_cpu_thread, arg)
+{
+  BX_CPU_C *cpu = (BX_CPU_C *) arg;
+  Bit32u quantum = SIM->get_param_num(BXPN_SMP_QUANTUM)->get();
+
+  bx_current_cpu = cpu;
+  while (! bx_smp_sync(cpu->cpu_run_quantum(quantum))) {}
+  BX_THREAD_EXIT;
+}
+
+#endif
+
 int bx_begin_simulation(int argc, char *argv[])
 {
   bx_user_quit = 0;
@@ -1054,7 +1115,36 @@ int bx_begin_simulation(int argc, char *argv[])
       // for one processor, the only reason for cpu_loop to return is
       // that kill_bochs_request was set by the GUI interface.
     }
-#if BX_SUPPORT_SMP
+#if BX_SMP_HOST_THREADS
+    else {
+      // SMP simulation: every processor runs in its own host thread and
+      // executes the quantum of instructions, then all of them wait for
+      // each other on the synchronization point of the emulated time.
+      pthread_t *cpu_threads = new pthread_t[BX_SMP_PROCESSORS];
+      unsigned processor;
+
+      BX_INIT_MUTEX(bx_smp_sync_point.lock);
+      pthread_cond_init(&bx_smp_sync_point.cond, NULL);
+      bx_smp_sync_point.arrived = 0;
+      bx_smp_sync_point.round = 0;
+      bx_smp_sync_point.executed = 0;
+      bx_smp_sync_point.stop = 0;
+
+      bx_pc_system.cpu_threads_running = 1;
+      for (processor = 0; processor < BX_SMP_PROCESSORS; processor++) {
+        BX_CPU(processor)->icount_last_sync = BX_CPU(processor)->get_icount();
+        BX_THREAD_CREATE(bx_cpu_thread, BX_CPU(processor), cpu_threads[processor]);
+      }
+      for (processor = 0; processor < BX_SMP_PROCESSORS; processor++) {
+        BX_THREAD_JOIN(cpu_threads[processor]);
+      }
+      bx_pc_system.cpu_threads_running = 0;
+
+      pthread_cond_destroy(&bx_smp_sync_point.cond);
+      BX_FINI_MUTEX(bx_smp_sync_point.lock);
+      delete [] cpu_threads;
+    }
+#elif BX_SUPPORT_SMP
     else {
       // SMP simulation: do a few instructions on each processor, then switch
       // to another.  Increasing quantum speeds up overall performance, but
@@ -1114,8 +1204,15 @@ void bx_stop_simulation(void)
   // the cpu loop will exit very soon after this condition is set.
 }
 
+void bx_sr_before_save_state(void)
+{
+  // finish the pending disk image requests
+  bx_hdimage_ctl.aio_flush();
+}
+
 void bx_sr_after_restore_state(void)
 {
+  bx_pc_system.after_restore_state();
 #if BX_SUPPORT_SMP == 0
   BX_CPU(0)->after_restore_state();
 #else
@@ -1126,6 +1223,20 @@ void bx_sr_after_restore_state(void)
   DEV_after_restore_state();
 }
 
+void bx_before_fork(void)
+{
+  io->before_fork();
+  bx_hdimage_ctl.before_fork();
+  BX_MEM(0)->before_fork();
+}
+
+void bx_after_fork(bool child)
+{
+  BX_MEM(0)->after_fork(child);
+  bx_hdimage_ctl.after_fork(child);
+  DEV_after_fork(child);
+}
+
 void bx_set_log_actions_by_device(bool panic_flag)
 {
   int id, l, m, val;
@@ -1188,7 +1299,9 @@ void bx_init_hardware()
 #endif
   BX_INFO(("IPS is set to %d", (Bit32u) SIM->get_param_num(BXPN_IPS)->get()));
   BX_INFO(("CPU configuration"));
-#if BX_SUPPORT_SMP
+#if BX_SMP_HOST_THREADS
+  BX_INFO(("  SMP support: yes, host threads, quantum=%d", SIM->get_param_num(BXPN_SMP_QUANTUM)->get()));
+#elif BX_SUPPORT_SMP
   BX_INFO(("  SMP support: yes, quantum=%d", SIM->get_param_num(BXPN_SMP_QUANTUM)->get()));
 #else
   BX_INFO(("  SMP support: no"));
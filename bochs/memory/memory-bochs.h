@@ -78,6 +78,18 @@ struct memory_handler_struct {
   memory_handler_t read_handler;
   memory_handler_t write_handler;
   memory_direct_access_handler_t da_handler;
+#if BX_ENABLE_STATISTICS
+  Bit64u hits;  // accesses dispatched to the handler
+#endif
+};
+
+// Memory handlers registered in one megabyte of physical address space.
+// The handlers never share 64K region, so single handler is found in the
+// 4K page granular index for any address. The index is rebuilt every time
+// a handler is registered or unregistered in the megabyte.
+struct memory_handler_bucket_struct {
+  struct memory_handler_struct *list;
+  struct memory_handler_struct *page[256];
 };
 
 #define SMRAM_CODE  1
@@ -85,7 +97,7 @@ struct memory_handler_struct {
 
 class BOCHSAPI BX_MEM_C : public logfunctions {
 private:
-  struct memory_handler_struct **memory_handlers;
+  struct memory_handler_bucket_struct **memory_handlers;
   bool pci_enabled;
   bool bios_write_enabled;
   bool smram_available;
@@ -108,13 +120,29 @@ private:
   Bit8u   flash_wsm_state;
 
   Bit32u used_blocks;
+  Bit32u *dirty_pages;  // RAM pages written since the last checkpoint, incremental save only
+  char    last_checkpoint[BX_PATHNAME_LEN]; // parent of the next incremental checkpoint
+#if BX_HAVE_SYS_MMAN_H
+  Bit64u  ram_mapping_len; // guest RAM mapped with mmap() if not zero
+
+  BX_MEM_SMF Bit8u* map_ram(Bit64u bytes, bool hugepages, const char *path);
+  BX_MEM_SMF void   unmap_ram(void);
+#endif
 #if BX_LARGE_RAMFILE
   static Bit8u * const swapped_out; // NULL; // (NULL - sizeof(Bit8u));
   Bit32u  next_swapout_idx;
   FILE    *overflow_file;
+  FILE    *fork_overflow_file; // copy of the overflow file for a forked child
 
   BX_MEM_SMF void   read_block(Bit32u block);
 #endif
+  BX_MEM_SMF void  rebuild_memory_handler_index(Bit32u page_idx);
+  BX_MEM_SMF BX_CPP_INLINE struct memory_handler_struct *find_memory_handler(bx_phy_address a20addr);
+  BX_MEM_SMF BX_CPP_INLINE void mark_dirty(bx_phy_address a20addr);
+  BX_MEM_SMF void  reset_dirty_pages(void);
+  // mapped guest RAM is saved as one data param unless saved incrementally
+  BX_MEM_SMF BX_CPP_INLINE bool ram_data_param(void);
+
   BX_MEM_SMF Bit8u flash_read(Bit32u addr);
   BX_MEM_SMF void  flash_write(Bit32u addr, Bit8u data);
 
@@ -175,10 +203,15 @@ public:
 #endif
 
   void register_state(void);
+  // the forked child process must not share the swapped out blocks
+  BX_MEM_SMF void before_fork(void);
+  BX_MEM_SMF void after_fork(bool child);
 
   friend void ramfile_save_handler(void *devptr, FILE *fp);
   friend Bit64s memory_param_save_handler(void *devptr, bx_param_c *param);
   friend void memory_param_restore_handler(void *devptr, bx_param_c *param, Bit64s val);
+  friend void ram_delta_save_handler(void *devptr, FILE *fp);
+  friend void ram_delta_restore_handler(void *devptr, FILE *fp);
 };
 
 BOCHSAPI extern BX_MEM_C bx_mem;
@@ -190,6 +223,42 @@ BX_CPP_INLINE Bit8u* BX_MEM_C::get_vector(bx_phy_address addr)
 }
 */
 
+BX_CPP_INLINE struct memory_handler_struct *BX_MEM_C::find_memory_handler(bx_phy_address a20addr)
+{
+  struct memory_handler_bucket_struct *bucket = BX_MEM_THIS memory_handlers[a20addr >> 20];
+  if (bucket == NULL)
+    return NULL;
+
+  struct memory_handler_struct *memory_handler = bucket->page[(a20addr >> 12) & 0xff];
+  // the handler might cover only part of the page
+  if (memory_handler && memory_handler->begin <= a20addr && memory_handler->end >= a20addr)
+    return memory_handler;
+
+  return NULL;
+}
+
+BX_CPP_INLINE bool BX_MEM_C::ram_data_param(void)
+{
+#if BX_HAVE_SYS_MMAN_H
+  return (BX_MEM_THIS ram_mapping_len != 0) && (BX_MEM_THIS dirty_pages == NULL);
+#else
+  return 0;
+#endif
+}
+
+// Remember RAM page modification for the next incremental checkpoint.
+BX_CPP_INLINE void BX_MEM_C::mark_dirty(bx_phy_address a20addr)
+{
+  if (BX_MEM_THIS dirty_pages != NULL && a20addr < BX_MEM_THIS len) {
+    Bit64u page = a20addr >> 12;
+#if BX_SMP_HOST_THREADS
+    __atomic_or_fetch(&BX_MEM_THIS dirty_pages[page >> 5], 1u << (page & 31), __ATOMIC_RELAXED);
+#else
+    BX_MEM_THIS dirty_pages[page >> 5] |= 1u << (page & 31);
+#endif
+  }
+}
+
 BX_CPP_INLINE Bit64u BX_MEM_C::get_memory_len(void)
 {
   return (BX_MEM_THIS len);
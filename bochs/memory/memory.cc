@@ -69,23 +69,25 @@ void BX_MEM_C::writePhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned le
     }
   }
 
-  memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->write_handler != NULL) {
-      if (memory_handler->begin <= a20addr &&
-          memory_handler->end >= a20addr &&
-          memory_handler->write_handler(a20addr, len, data, memory_handler->param))
-      {
-        return;
-      }
+  // the memory handlers belong to the devices shared by all the processors
+  BX_SIM_LOCK();
+  memory_handler = BX_MEM_THIS find_memory_handler(a20addr);
+  if (memory_handler && memory_handler->write_handler != NULL) {
+#if BX_ENABLE_STATISTICS
+    memory_handler->hits++;
+#endif
+    if (memory_handler->write_handler(a20addr, len, data, memory_handler->param)) {
+      BX_SIM_UNLOCK();
+      return;
     }
-    memory_handler = memory_handler->next;
   }
+  BX_SIM_UNLOCK();
 
 mem_write:
 
   // all memory access fits in single 4K page
   if ((a20addr < BX_MEM_THIS len) && !is_bios) {
+    BX_MEM_THIS mark_dirty(a20addr);
     // all of data is within limits of physical memory
     if (a20addr < 0x000a0000 || a20addr >= 0x00100000)
     {
@@ -181,7 +183,9 @@ mem_write:
         } else if ((area >= BX_MEM_AREA_E0000) && BX_MEM_THIS bios_write_enabled) {
           // volatile BIOS write support
           if (BX_MEM_THIS flash_type > 0) {
+            BX_SIM_LOCK();
             BX_MEM_THIS flash_write(BIOS_MAP_LAST128K(a20addr), *data_ptr);
+            BX_SIM_UNLOCK();
           } else {
             BX_MEM_THIS rom[BIOS_MAP_LAST128K(a20addr)] = *data_ptr;
           }
@@ -210,7 +214,9 @@ inc_one:
 #endif
     for (unsigned i = 0; i < len; i++) {
       if (BX_MEM_THIS flash_type > 0) {
+        BX_SIM_LOCK();
         BX_MEM_THIS flash_write(a20addr & BIOS_MASK, *data_ptr);
+        BX_SIM_UNLOCK();
       } else {
         BX_MEM_THIS rom[a20addr & BIOS_MASK] = *data_ptr;
       }
@@ -256,16 +262,19 @@ void BX_MEM_C::readPhysicalPage(BX_CPU_C *cpu, bx_phy_address addr, unsigned len
     }
   }
 
-  memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->begin <= a20addr &&
-          memory_handler->end >= a20addr &&
-          memory_handler->read_handler(a20addr, len, data, memory_handler->param))
-    {
+  // the memory handlers belong to the devices shared by all the processors
+  BX_SIM_LOCK();
+  memory_handler = BX_MEM_THIS find_memory_handler(a20addr);
+  if (memory_handler) {
+#if BX_ENABLE_STATISTICS
+    memory_handler->hits++;
+#endif
+    if (memory_handler->read_handler(a20addr, len, data, memory_handler->param)) {
+      BX_SIM_UNLOCK();
       return;
     }
-    memory_handler = memory_handler->next;
   }
+  BX_SIM_UNLOCK();
 
 mem_read:
 
@@ -348,7 +357,9 @@ mem_read:
           if ((a20addr & 0xfffe0000) == 0x000e0000) {
             // last 128K of BIOS ROM mapped to 0xE0000-0xFFFFF
             if (BX_MEM_THIS flash_type > 0) {
+              BX_SIM_LOCK();
               *data_ptr = BX_MEM_THIS flash_read(BIOS_MAP_LAST128K(a20addr));
+              BX_SIM_UNLOCK();
             } else {
               *data_ptr = BX_MEM_THIS rom[BIOS_MAP_LAST128K(a20addr)];
             }
@@ -403,7 +414,9 @@ inc_one:
     if (is_bios) {
       for (unsigned i = 0; i < len; i++) {
         if (BX_MEM_THIS flash_type > 0) {
+          BX_SIM_LOCK();
           *data_ptr = BX_MEM_THIS flash_read(a20addr & BIOS_MASK);
+          BX_SIM_UNLOCK();
         } else {
           *data_ptr = BX_MEM_THIS rom[a20addr & BIOS_MASK];
         }
@@ -28,6 +28,10 @@
 #include "iodev/iodev.h"
 #define LOG_THIS BX_MEM(0)->
 
+#if BX_HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
 // block size must be power of two
 BX_CPP_INLINE bool is_power_of_2(Bit64u x)
 {
@@ -60,12 +64,18 @@ BX_MEM_C::BX_MEM_C()
   blocks = NULL;
   len    = 0;
   used_blocks = 0;
+  dirty_pages = NULL;
+  last_checkpoint[0] = 0;
 
   memory_handlers = NULL;
 
+#if BX_HAVE_SYS_MMAN_H
+  ram_mapping_len = 0;
+#endif
 #if BX_LARGE_RAMFILE
   next_swapout_idx = 0;
   overflow_file = NULL;
+  fork_overflow_file = NULL;
 #endif
 }
 
@@ -88,6 +98,87 @@ Bit8u* BX_MEM_C::alloc_vector_aligned(Bit64u bytes, Bit64u alignment)
   return vector;
 }
 
+#if BX_HAVE_SYS_MMAN_H
+// Map guest RAM into the host address space. The pages are allocated by the
+// host kernel on first touch and could be paged out by it. When a file is
+// specified it is mapped copy-on-write: the guest sees the file contents as
+// initial RAM contents, its writes never reach the file and the unmodified
+// pages are shared between all processes mapping the same file.
+Bit8u* BX_MEM_C::map_ram(Bit64u bytes, bool hugepages, const char *path)
+{
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+  flags |= MAP_NORESERVE;
+#endif
+  void *ptr = MAP_FAILED;
+
+  if ((Bit64u)(size_t) bytes != bytes) return NULL;
+
+#ifdef MAP_HUGETLB
+  // hugetlbfs pages cannot be replaced by file mapping, the pages must be
+  // reserved at mmap() time otherwise the first access beyond the available
+  // pool would be fatal
+  if (hugepages && (path == NULL || *path == 0)) {
+    ptr = mmap(NULL, (size_t) bytes, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED)
+      BX_INFO(("hugetlbfs pages not available, trying transparent huge pages"));
+  }
+#endif
+  if (ptr == MAP_FAILED) {
+    ptr = mmap(NULL, (size_t) bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (ptr == MAP_FAILED) return NULL;
+#ifdef MADV_HUGEPAGE
+    if (hugepages)
+      madvise(ptr, (size_t) bytes, MADV_HUGEPAGE);
+#endif
+  }
+
+  if (path != NULL && *path != 0) {
+    int fd = open(path, O_RDONLY
+#ifdef O_BINARY
+                  | O_BINARY
+#endif
+              );
+    if (fd < 0) {
+      BX_PANIC(("could not open guest RAM image file '%s'", path));
+      munmap(ptr, (size_t) bytes);
+      return NULL;
+    }
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf)) {
+      BX_PANIC(("could not fstat() guest RAM image file '%s'", path));
+      close(fd);
+      munmap(ptr, (size_t) bytes);
+      return NULL;
+    }
+    // the rest of the RAM beyond the end of the file stays anonymous
+    Bit64u file_len = ((Bit64u) stat_buf.st_size + 0xfff) & ~BX_CONST64(0xfff);
+    if (file_len > bytes) {
+      BX_INFO(("guest RAM image file '%s' is larger than guest RAM", path));
+      file_len = bytes;
+    }
+    if (file_len > 0 && mmap(ptr, (size_t) file_len, PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+      BX_PANIC(("could not map guest RAM image file '%s'", path));
+    }
+    close(fd);
+    BX_INFO(("guest RAM initialized from '%s'", path));
+  }
+
+  BX_MEM_THIS ram_mapping_len = bytes;
+  return (Bit8u *) ptr;
+}
+
+void BX_MEM_C::unmap_ram(void)
+{
+  if (BX_MEM_THIS ram_mapping_len) {
+    munmap(BX_MEM_THIS vector, (size_t) BX_MEM_THIS ram_mapping_len);
+    BX_MEM_THIS ram_mapping_len = 0;
+  }
+}
+#endif
+
 BX_MEM_C::~BX_MEM_C()
 {
 #if BX_LARGE_RAMFILE
@@ -101,6 +192,8 @@ BX_MEM_C::~BX_MEM_C()
 void BX_MEM_C::init_memory(Bit64u guest, Bit64u host, Bit32u block_size)
 {
   unsigned i, idx;
+  Bit8u *rom_vector = NULL;
+  bool ram_mapped = false;
 
   // accept only memory size which is multiply of 1M
   BX_ASSERT((host & 0xfffff) == 0);
@@ -110,21 +203,72 @@ void BX_MEM_C::init_memory(Bit64u guest, Bit64u host, Bit32u block_size)
     BX_PANIC(("Block size %d is not power of two !", block_size));
   }
 
+#if BX_LARGE_RAMFILE
+  if (SIM->get_param_bool(BXPN_MEM_INCREMENTAL_SAVE)->get() && (host < guest)) {
+    // modifications of swapped out blocks could not be tracked
+    BX_INFO(("incremental save enabled, allocating all guest memory"));
+    host = guest;
+  }
+#if BX_SMP_HOST_THREADS
+  if (host < guest) {
+    // the processor threads access the blocks without the simulator lock
+    BX_INFO(("processors run in host threads, allocating all guest memory"));
+    host = guest;
+  }
+#endif
+#endif
+
   if (BX_MEM_THIS actual_vector != NULL) {
     BX_INFO(("freeing existing memory vector"));
+#if BX_HAVE_SYS_MMAN_H
+    unmap_ram();
+#endif
     delete [] BX_MEM_THIS actual_vector;
     BX_MEM_THIS actual_vector = NULL;
     BX_MEM_THIS vector = NULL;
     BX_MEM_THIS blocks = NULL;
   }
-  BX_MEM_THIS vector = alloc_vector_aligned(host + BIOSROMSZ + EXROMSIZE + 4096, BX_MEM_VECTOR_ALIGN);
-  BX_INFO(("allocated memory at %p. after alignment, vector=%p, block_size = %dK",
-        BX_MEM_THIS actual_vector, BX_MEM_THIS vector, block_size/1024));
+#if BX_HAVE_SYS_MMAN_H
+  if (SIM->get_param_bool(BXPN_MEM_MMAP)->get()) {
+    BX_MEM_THIS vector = map_ram(guest, SIM->get_param_bool(BXPN_MEM_HUGEPAGES)->get(),
+                                 SIM->get_param_string(BXPN_MEM_FILE)->getptr());
+    if (BX_MEM_THIS vector != NULL) {
+      // all guest memory is mapped, the host kernel allocates it on demand
+      host = guest;
+      ram_mapped = true;
+      rom_vector = alloc_vector_aligned(BIOSROMSZ + EXROMSIZE + 4096, BX_MEM_VECTOR_ALIGN);
+      BX_INFO(("mapped guest memory at %p, block_size = %dK", BX_MEM_THIS vector, block_size/1024));
+    }
+    else {
+      BX_ERROR(("could not map guest memory, allocating it from the heap"));
+    }
+  }
+#else
+  if (SIM->get_param_bool(BXPN_MEM_MMAP)->get()) {
+    BX_ERROR(("mapping guest memory is not supported on this host"));
+  }
+#endif
+  if (BX_MEM_THIS vector == NULL) {
+    BX_MEM_THIS vector = alloc_vector_aligned(host + BIOSROMSZ + EXROMSIZE + 4096, BX_MEM_VECTOR_ALIGN);
+    rom_vector = &BX_MEM_THIS vector[host];
+    BX_INFO(("allocated memory at %p. after alignment, vector=%p, block_size = %dK",
+          BX_MEM_THIS actual_vector, BX_MEM_THIS vector, block_size/1024));
+  }
 
   BX_MEM_THIS len = guest;
   BX_MEM_THIS allocated = host;
-  BX_MEM_THIS rom = &BX_MEM_THIS vector[host];
-  BX_MEM_THIS bogus = &BX_MEM_THIS vector[host + BIOSROMSZ + EXROMSIZE];
+  pageWriteStampTable.alloc(guest);
+  delete [] BX_MEM_THIS dirty_pages;
+  BX_MEM_THIS dirty_pages = NULL;
+  if (SIM->get_param_bool(BXPN_MEM_INCREMENTAL_SAVE)->get()) {
+    Bit64u words = ((guest >> 12) + 31) >> 5;
+    BX_MEM_THIS dirty_pages = new Bit32u[words];
+    // nothing saved yet, the first checkpoint stores the whole RAM anyway
+    memset(BX_MEM_THIS dirty_pages, 0xff, words * sizeof(Bit32u));
+  }
+  BX_MEM_THIS last_checkpoint[0] = 0;
+  BX_MEM_THIS rom = rom_vector;
+  BX_MEM_THIS bogus = &rom_vector[BIOSROMSZ + EXROMSIZE];
   memset(BX_MEM_THIS rom, 0xff, BIOSROMSZ + EXROMSIZE + 4096);
 
   BX_MEM_THIS block_size = block_size;
@@ -135,7 +279,7 @@ void BX_MEM_C::init_memory(Bit64u guest, Bit64u host, Bit32u block_size)
   BX_INFO(("%.2fMB", (float)(BX_MEM_THIS len / (1024.0*1024.0))));
   BX_INFO(("mem block size = 0x%08x, blocks=%u", BX_MEM_THIS block_size, num_blocks));
   BX_MEM_THIS blocks = new Bit8u* [num_blocks];
-  if (0) {
+  if (ram_mapped) {
     // all guest memory is allocated, just map it
     for (idx = 0; idx < num_blocks; idx++) {
       BX_MEM_THIS blocks[idx] = BX_MEM_THIS vector + (idx * BX_MEM_THIS block_size);
@@ -150,7 +294,7 @@ void BX_MEM_C::init_memory(Bit64u guest, Bit64u host, Bit32u block_size)
     BX_MEM_THIS used_blocks = 0;
   }
 
-  BX_MEM_THIS memory_handlers = new struct memory_handler_struct *[BX_MEM_HANDLERS];
+  BX_MEM_THIS memory_handlers = new struct memory_handler_bucket_struct *[BX_MEM_HANDLERS];
   for (idx = 0; idx < BX_MEM_HANDLERS; idx++)
     BX_MEM_THIS memory_handlers[idx] = NULL;
 
@@ -183,7 +327,16 @@ Bit8u* BX_MEM_C::get_vector(bx_phy_address addr)
 #else
   if (!BX_MEM_THIS blocks[block])
 #endif
+  {
+#if BX_SMP_HOST_THREADS
+    BX_SIM_LOCK_SCOPE();
+    // another processor thread might have allocated the block meanwhile
+    if (!BX_MEM_THIS blocks[block])
+      allocate_block(block);
+#else
     allocate_block(block);
+#endif
+  }
 
   return BX_MEM_THIS blocks[block] + (Bit32u)(addr & (BX_MEM_THIS block_size-1));
 }
@@ -269,6 +422,12 @@ void BX_MEM_C::allocate_block(Bit32u block)
   }
   BX_DEBUG(("allocate_block: used_blocks=0x%x of 0x%x", BX_MEM_THIS used_blocks, max_blocks));
 #endif
+
+  // contents of the new block are not in the previous checkpoint
+  if (BX_MEM_THIS dirty_pages != NULL) {
+    for (Bit32u offset = 0; offset < BX_MEM_THIS block_size; offset += 4096)
+      BX_MEM_THIS mark_dirty((bx_phy_address) block * BX_MEM_THIS block_size + offset);
+  }
 }
 
 #if BX_LARGE_RAMFILE
@@ -326,7 +485,198 @@ void memory_param_restore_handler(void *devptr, bx_param_c *param, Bit64s val)
       }
       BX_MEM(0)->blocks[blk_index] = BX_MEM(0)->vector + val * BX_MEM_THIS block_size;
 #if BX_LARGE_RAMFILE
-      BX_MEM(0)->read_block(blk_index);
+      // incremental save writes the pages to the blocks after the mapping is
+      // restored, mapped RAM is restored as a whole
+      if ((BX_MEM(0)->dirty_pages == NULL) && !BX_MEM(0)->ram_data_param())
+        BX_MEM(0)->read_block(blk_index);
+#endif
+  }
+}
+
+// Incremental RAM save file layout (all fields little endian):
+//   header: magic "BXRAMDLT", version, page size, RAM length and length of
+//           the parent checkpoint path followed by the path itself
+//   chunks: first page, number of pages and the page data
+// The chunk with zero pages terminates the file. The checkpoint without
+// parent contains all allocated RAM pages, every other one only the pages
+// modified since its parent was saved.
+#define BX_RAM_DELTA_MAGIC     "BXRAMDLT"
+#define BX_RAM_DELTA_VERSION   1
+#define BX_RAM_DELTA_MAX_CHAIN 1024
+
+static bool ram_delta_read_header(FILE *fp, Bit64u *len, char *parent)
+{
+  Bit64u header[4];
+  Bit8u *ptr = (Bit8u *) header;
+
+  if (fread(header, sizeof(header), 1, fp) != 1)
+    return 0;
+  if (memcmp(ptr, BX_RAM_DELTA_MAGIC, 8) ||
+      ReadHostDWordFromLittleEndian((Bit32u *)(ptr + 8)) != BX_RAM_DELTA_VERSION ||
+      ReadHostDWordFromLittleEndian((Bit32u *)(ptr + 12)) != 4096)
+    return 0;
+  *len = ReadHostQWordFromLittleEndian((Bit64u *)(ptr + 16));
+  Bit32u parent_len = ReadHostDWordFromLittleEndian((Bit32u *)(ptr + 24));
+  if (parent_len >= BX_PATHNAME_LEN)
+    return 0;
+  if (parent_len > 0 && fread(parent, parent_len, 1, fp) != 1)
+    return 0;
+  parent[parent_len] = 0;
+  return 1;
+}
+
+// Check if the checkpoint about to be written is one of the ancestors
+// of the previous checkpoint and therefore could not be its parent.
+static bool ram_delta_in_chain(const char *parent, const char *path)
+{
+  char name[BX_PATHNAME_LEN+16], next[BX_PATHNAME_LEN];
+  Bit64u len;
+
+  strcpy(next, parent);
+  for (unsigned depth = 0; next[0] != 0; depth++) {
+    if (!strcmp(next, path) || depth >= BX_RAM_DELTA_MAX_CHAIN)
+      return 1;
+    sprintf(name, "%s/memory.ram", next);
+    FILE *fp = fopen(name, "rb");
+    if (fp == NULL)
+      return 1;
+    bool valid = ram_delta_read_header(fp, &len, next);
+    fclose(fp);
+    if (! valid)
+      return 1;
+  }
+  return 0;
+}
+
+void ram_delta_save_handler(void *devptr, FILE *fp)
+{
+  const char *path = SIM->get_param_string(BXPN_RESTORE_PATH)->getptr();
+  const char *parent = BX_MEM(0)->last_checkpoint;
+  Bit64u num_pages = BX_MEM(0)->len >> 12, saved = 0;
+  Bit64u header[4], chunk[2];
+  Bit8u *ptr = (Bit8u *) header;
+
+  if (ram_delta_in_chain(parent, path))
+    parent = "";
+  bool full = (parent[0] == 0);
+
+  Bit32u parent_len = (Bit32u) strlen(parent);
+  memcpy(ptr, BX_RAM_DELTA_MAGIC, 8);
+  WriteHostDWordToLittleEndian((Bit32u *)(ptr + 8), BX_RAM_DELTA_VERSION);
+  WriteHostDWordToLittleEndian((Bit32u *)(ptr + 12), 4096);
+  WriteHostQWordToLittleEndian((Bit64u *)(ptr + 16), BX_MEM(0)->len);
+  WriteHostDWordToLittleEndian((Bit32u *)(ptr + 24), parent_len);
+  WriteHostDWordToLittleEndian((Bit32u *)(ptr + 28), 0);
+  if (fwrite(header, sizeof(header), 1, fp) != 1 ||
+      (parent_len > 0 && fwrite(parent, parent_len, 1, fp) != 1))
+    BX_PANIC(("FATAL ERROR: Could not write RAM save file header!"));
+
+  Bit32u pages_per_block = BX_MEM(0)->block_size >> 12;
+  Bit64u page = 0;
+  while (page < num_pages) {
+    // pages of the blocks never allocated were not accessed by the guest at all
+    if (BX_MEM(0)->blocks[page / pages_per_block] == NULL) {
+      page += pages_per_block;
+      continue;
+    }
+    if (! full && !(BX_MEM(0)->dirty_pages[page >> 5] & (1u << (page & 31)))) {
+      page++;
+      continue;
+    }
+    Bit64u first = page;
+    while (++page < num_pages) {
+      if (BX_MEM(0)->blocks[page / pages_per_block] == NULL) break;
+      if (! full && !(BX_MEM(0)->dirty_pages[page >> 5] & (1u << (page & 31)))) break;
+    }
+    WriteHostQWordToLittleEndian(&chunk[0], first);
+    WriteHostQWordToLittleEndian(&chunk[1], page - first);
+    if (fwrite(chunk, sizeof(chunk), 1, fp) != 1)
+      BX_PANIC(("FATAL ERROR: Could not write RAM save file!"));
+    for (Bit64u n = first; n < page; n++) {
+      if (fwrite(BX_MEM(0)->get_vector(n << 12), 4096, 1, fp) != 1)
+        BX_PANIC(("FATAL ERROR: Could not write page 0x" FMT_LL "x to RAM save file!", n));
+    }
+    saved += page - first;
+  }
+  chunk[0] = chunk[1] = 0;
+  if (fwrite(chunk, sizeof(chunk), 1, fp) != 1)
+    BX_PANIC(("FATAL ERROR: Could not write RAM save file!"));
+
+  if (full)
+    BX_INFO(("saved " FMT_LL "u of " FMT_LL "u RAM pages", saved, num_pages));
+  else
+    BX_INFO(("saved " FMT_LL "u of " FMT_LL "u RAM pages, parent checkpoint '%s'", saved, num_pages, parent));
+
+  // this checkpoint is the parent of the next one
+  strncpy(BX_MEM(0)->last_checkpoint, path, BX_PATHNAME_LEN - 1);
+  BX_MEM(0)->last_checkpoint[BX_PATHNAME_LEN - 1] = 0;
+  BX_MEM(0)->reset_dirty_pages();
+}
+
+static void ram_delta_apply(FILE *fp, const char *name, unsigned depth)
+{
+  char parent[BX_PATHNAME_LEN], parent_name[BX_PATHNAME_LEN+16];
+  Bit64u len, chunk[2];
+
+  if (! ram_delta_read_header(fp, &len, parent) || (len != BX_MEM(0)->get_memory_len()))
+    BX_PANIC(("'%s' is not incremental RAM save file of this configuration", name));
+
+  // the parent checkpoint provides the pages not modified since
+  if (parent[0] != 0) {
+    if (depth >= BX_RAM_DELTA_MAX_CHAIN)
+      BX_PANIC(("too many parent checkpoints of '%s'", name));
+    sprintf(parent_name, "%s/memory.ram", parent);
+    FILE *parent_fp = fopen(parent_name, "rb");
+    if (parent_fp == NULL)
+      BX_PANIC(("could not open parent checkpoint RAM file '%s'", parent_name));
+    ram_delta_apply(parent_fp, parent_name, depth + 1);
+    fclose(parent_fp);
+  }
+
+  while (1) {
+    if (fread(chunk, sizeof(chunk), 1, fp) != 1)
+      BX_PANIC(("unexpected end of RAM save file '%s'", name));
+    Bit64u page = ReadHostQWordFromLittleEndian(&chunk[0]);
+    Bit64u count = ReadHostQWordFromLittleEndian(&chunk[1]);
+    if (count == 0) break;
+    if ((page + count) > (len >> 12))
+      BX_PANIC(("corrupted RAM save file '%s'", name));
+    for (; count > 0; count--, page++) {
+      if (fread(BX_MEM(0)->get_vector(page << 12), 4096, 1, fp) != 1)
+        BX_PANIC(("unexpected end of RAM save file '%s'", name));
+    }
+  }
+}
+
+void ram_delta_restore_handler(void *devptr, FILE *fp)
+{
+  const char *path = SIM->get_param_string(BXPN_RESTORE_PATH)->getptr();
+
+  ram_delta_apply(fp, "memory.ram", 0);
+  // the restored checkpoint is the parent of the next one
+  strncpy(BX_MEM(0)->last_checkpoint, path, BX_PATHNAME_LEN - 1);
+  BX_MEM(0)->last_checkpoint[BX_PATHNAME_LEN - 1] = 0;
+  BX_MEM(0)->reset_dirty_pages();
+}
+
+void BX_MEM_C::reset_dirty_pages(void)
+{
+  Bit64u words = ((BX_MEM_THIS len >> 12) + 31) >> 5;
+  memset(BX_MEM_THIS dirty_pages, 0, words * sizeof(Bit32u));
+
+  // Host pointers given out for writing have to be requested again, so
+  // modifications done through them are tracked.
+  for (int i=0; i<BX_SMP_PROCESSORS; i++) {
+    BX_CPU(i)->TLB_flush();
+#if BX_SUPPORT_VMX
+    // VMCS is accessed through the host pointer cached by VMPTRLD
+    if (BX_CPU(i)->vmcshostptr)
+      BX_MEM_THIS mark_dirty(A20ADDR(BX_CPU(i)->vmcsptr));
+#endif
+#if BX_SUPPORT_SVM
+    // same for VMCB cached by VMRUN
+    if (BX_CPU(i)->vmcbhostptr)
+      BX_MEM_THIS mark_dirty(A20ADDR(BX_CPU(i)->vmcbptr));
 #endif
   }
 }
@@ -337,12 +687,23 @@ void BX_MEM_C::register_state()
 
   bx_list_c *list = new bx_list_c(SIM->get_bochs_root(), "memory", "Memory State");
   Bit32u num_blocks = (Bit32u)(BX_MEM_THIS len / BX_MEM_THIS block_size);
+  bool incremental_save = (BX_MEM_THIS dirty_pages != NULL);
+  if (ram_data_param()) {
+    // all guest memory is mapped and never swapped out
+    bx_shadow_data_c *ram = new bx_shadow_data_c(list, "ram", BX_MEM_THIS vector, BX_MEM_THIS len);
+    // hugetlbfs pages cannot be replaced by a file mapping
+    if (! SIM->get_param_bool(BXPN_MEM_HUGEPAGES)->get())
+      ram->set_mappable(1);
+  }
 #if BX_LARGE_RAMFILE
-  bx_shadow_filedata_c *ramfile = new bx_shadow_filedata_c(list, "ram", &(BX_MEM_THIS overflow_file));
-  ramfile->set_sr_handlers(this, ramfile_save_handler, (filedata_restore_handler)NULL);
+  else if (! incremental_save) {
+    bx_shadow_filedata_c *ramfile = new bx_shadow_filedata_c(list, "ram", &(BX_MEM_THIS overflow_file));
+    ramfile->set_sr_handlers(this, ramfile_save_handler, (filedata_restore_handler)NULL);
+  }
   BXRS_DEC_PARAM_FIELD(list, next_swapout_idx, BX_MEM_THIS next_swapout_idx);
 #else
-  new bx_shadow_data_c(list, "ram", BX_MEM_THIS vector, BX_MEM_THIS allocated);
+  else if (! incremental_save)
+    new bx_shadow_data_c(list, "ram", BX_MEM_THIS vector, BX_MEM_THIS allocated);
 #endif
   BXRS_DEC_PARAM_FIELD(list, used_blocks, BX_MEM_THIS used_blocks);
 
@@ -353,6 +714,11 @@ void BX_MEM_C::register_state()
     param->set_base(BASE_DEC);
     param->set_sr_handlers(this, memory_param_save_handler, memory_param_restore_handler);
   }
+  if (incremental_save) {
+    // restored after the block mapping, no backing store
+    bx_shadow_filedata_c *ramfile = new bx_shadow_filedata_c(list, "ram", NULL);
+    ramfile->set_sr_handlers(this, ram_delta_save_handler, ram_delta_restore_handler);
+  }
   bx_list_c *memtype = new bx_list_c(list, "memtype");
   for (int i = 0; i <= BX_MEM_AREA_F0000; i++) {
     sprintf(param_name, "%d_r", i);
@@ -364,11 +730,51 @@ void BX_MEM_C::register_state()
   BXRS_DEC_PARAM_FIELD(list, flash_wsm_state, BX_MEM_THIS flash_wsm_state);
 }
 
+void BX_MEM_C::before_fork(void)
+{
+#if BX_LARGE_RAMFILE
+  // copy the swapped out blocks while the simulation is stopped
+  if (BX_MEM_THIS overflow_file != NULL) {
+    BX_MEM_THIS fork_overflow_file = tmpfile64();
+    if (BX_MEM_THIS fork_overflow_file == NULL) {
+      BX_PANIC(("Unable to allocate memory overflow file for the forked process"));
+      return;
+    }
+    Bit8u *buffer = new Bit8u[4096];
+    fseeko64(BX_MEM_THIS overflow_file, 0, SEEK_SET);
+    while (!feof(BX_MEM_THIS overflow_file)) {
+      size_t chars = fread(buffer, 1, 4096, BX_MEM_THIS overflow_file);
+      fwrite(buffer, 1, chars, BX_MEM_THIS fork_overflow_file);
+    }
+    delete [] buffer;
+    fflush(BX_MEM_THIS fork_overflow_file);
+  }
+#endif
+}
+
+void BX_MEM_C::after_fork(bool child)
+{
+#if BX_LARGE_RAMFILE
+  if (BX_MEM_THIS fork_overflow_file != NULL) {
+    if (child) {
+      fclose(BX_MEM_THIS overflow_file);
+      BX_MEM_THIS overflow_file = BX_MEM_THIS fork_overflow_file;
+    } else {
+      fclose(BX_MEM_THIS fork_overflow_file);
+    }
+    BX_MEM_THIS fork_overflow_file = NULL;
+  }
+#endif
+}
+
 void BX_MEM_C::cleanup_memory()
 {
   unsigned idx;
 
   if (BX_MEM_THIS vector != NULL) {
+#if BX_HAVE_SYS_MMAN_H
+    unmap_ram();
+#endif
     delete [] BX_MEM_THIS actual_vector;
     BX_MEM_THIS actual_vector = NULL;
     BX_MEM_THIS vector = NULL;
@@ -377,18 +783,28 @@ void BX_MEM_C::cleanup_memory()
     delete [] BX_MEM_THIS blocks;
     BX_MEM_THIS blocks = 0;
     BX_MEM_THIS used_blocks = 0;
+    delete [] BX_MEM_THIS dirty_pages;
+    BX_MEM_THIS dirty_pages = NULL;
     if (BX_MEM_THIS memory_handlers != NULL) {
       for (idx = 0; idx < BX_MEM_HANDLERS; idx++) {
-        struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[idx];
+        if (BX_MEM_THIS memory_handlers[idx] == NULL) continue;
+        struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[idx]->list;
         struct memory_handler_struct *prev = NULL;
         while (memory_handler) {
           prev = memory_handler;
           memory_handler = memory_handler->next;
           delete prev;
         }
+        delete BX_MEM_THIS memory_handlers[idx];
       }
       delete [] BX_MEM_THIS memory_handlers;
       BX_MEM_THIS memory_handlers = NULL;
+#if BX_ENABLE_STATISTICS
+      // the access counters of the handlers are gone
+      bx_list_c *stats = SIM->get_statistics_root();
+      if (stats != NULL)
+        stats->remove("memory_handlers");
+#endif
     }
   }
 }
@@ -614,16 +1030,9 @@ bool BX_MEM_C::dbg_fetch_mem(BX_CPU_C *cpu, bx_phy_address addr, unsigned len, B
       use_smram = 1;
   }
 
-  memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->begin <= a20addr && memory_handler->end >= a20addr)
-    {
-      if (!use_smram) {
-        use_memory_handler = 1;
-        break;
-      }
-    }
-    memory_handler = memory_handler->next;
+  memory_handler = BX_MEM_THIS find_memory_handler(a20addr);
+  if (memory_handler && !use_smram) {
+    use_memory_handler = 1;
   }
 
   for (; len>0; len--) {
@@ -713,16 +1122,9 @@ bool BX_MEM_C::dbg_set_mem(BX_CPU_C *cpu, bx_phy_address addr, unsigned len, Bit
       use_smram = 1;
   }
 
-  memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->begin <= a20addr && memory_handler->end >= a20addr)
-    {
-      if (!use_smram) {
-        use_memory_handler = 1;
-        break;
-      }
-    }
-    memory_handler = memory_handler->next;
+  memory_handler = BX_MEM_THIS find_memory_handler(a20addr);
+  if (memory_handler && !use_smram) {
+    use_memory_handler = 1;
   }
 
   for (; len>0; len--) {
@@ -735,6 +1137,7 @@ bool BX_MEM_C::dbg_set_mem(BX_CPU_C *cpu, bx_phy_address addr, unsigned len, Bit
       if (area > BX_MEM_AREA_F0000) area = BX_MEM_AREA_F0000;
       if (BX_MEM_THIS memory_type[area][1] == 1) {
         // Write to ShadowRAM
+        BX_MEM_THIS mark_dirty(a20addr);
         *(BX_MEM_THIS get_vector(a20addr)) = *buf;
       } else {
         // Ignore write to ROM
@@ -743,6 +1146,7 @@ bool BX_MEM_C::dbg_set_mem(BX_CPU_C *cpu, bx_phy_address addr, unsigned len, Bit
 #endif  // #if BX_SUPPORT_PCI
     else if ((a20addr < 0x000c0000 || a20addr >= 0x00100000) && !is_bios)
     {
+      BX_MEM_THIS mark_dirty(a20addr);
       *(BX_MEM_THIS get_vector(a20addr)) = *buf;
     }
     buf++;
@@ -825,16 +1229,16 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
   }
 #endif
 
-  struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[a20addr >> 20];
-  while (memory_handler) {
-    if (memory_handler->begin <= a20addr &&
-        memory_handler->end >= a20addr) {
+  {
+    // the memory handlers belong to the devices shared by all the processors
+    BX_SIM_LOCK_SCOPE();
+    struct memory_handler_struct *memory_handler = BX_MEM_THIS find_memory_handler(a20addr);
+    if (memory_handler) {
       if (memory_handler->da_handler)
         return memory_handler->da_handler(a20addr, rw, memory_handler->param);
       else
         return(NULL); // Vetoed! memory handler for i/o apic, vram, mmio and PCI PnP
     }
-    memory_handler = memory_handler->next;
   }
 
   if (! write) {
@@ -906,6 +1310,8 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
     else
     {
       if (a20addr < 0x000c0000 || a20addr >= 0x00100000) {
+        // the page might be modified through the returned pointer
+        BX_MEM_THIS mark_dirty(a20addr);
         return BX_MEM_THIS get_vector(a20addr);
       }
       else {
@@ -915,6 +1321,45 @@ Bit8u *BX_MEM_C::getHostMemAddr(BX_CPU_C *cpu, bx_phy_address addr, unsigned rw)
   }
 }
 
+#if BX_ENABLE_STATISTICS
+// The handler access counters are listed in the statistics by the first
+// address the handler covers in the megabyte of physical address space.
+static bx_list_c *memory_handler_stats(struct memory_handler_struct *memory_handler,
+                                       Bit32u page_idx, char *name)
+{
+  bx_list_c *root = SIM->get_statistics_root();
+  if (root == NULL)
+    return NULL;
+
+  bx_list_c *list = (bx_list_c*) root->get_by_name("memory_handlers");
+  if (list == NULL)
+    list = new bx_list_c(root, "memory_handlers", "Memory handlers accesses");
+
+  bx_phy_address base = (bx_phy_address) page_idx << 20;
+  sprintf(name, "0x" FMT_PHY_ADDRX, (memory_handler->begin > base) ? memory_handler->begin : base);
+  return list;
+}
+#endif
+
+void BX_MEM_C::rebuild_memory_handler_index(Bit32u page_idx)
+{
+  struct memory_handler_bucket_struct *bucket = BX_MEM_THIS memory_handlers[page_idx];
+  bx_phy_address base = (bx_phy_address) page_idx << 20;
+  unsigned n;
+
+  for (n = 0; n < 256; n++)
+    bucket->page[n] = NULL;
+
+  for (struct memory_handler_struct *memory_handler = bucket->list; memory_handler; memory_handler = memory_handler->next) {
+    unsigned first = (memory_handler->begin > base) ? (unsigned)((memory_handler->begin - base) >> 12) : 0;
+    unsigned last = (memory_handler->end < (base + 0xfffff)) ? (unsigned)((memory_handler->end - base) >> 12) : 255;
+    for (n = first; n <= last; n++) {
+      if (bucket->page[n] == NULL)
+        bucket->page[n] = memory_handler;
+    }
+  }
+}
+
 /*
  * One needs to provide both a read_handler and a write_handler.
  */
@@ -936,17 +1381,23 @@ BX_MEM_C::registerMemoryHandlers(void *param, memory_handler_t read_handler,
     if (end_addr < ((page_idx + 1) << 20)) {
       bitmap &= (0xffff >> (0x0f - ((end_addr >> 16) & 0xf)));
     }
-    if (BX_MEM_THIS memory_handlers[page_idx] != NULL) {
-      if ((bitmap & BX_MEM_THIS memory_handlers[page_idx]->bitmap) != 0) {
+    struct memory_handler_bucket_struct *bucket = BX_MEM_THIS memory_handlers[page_idx];
+    if (bucket == NULL) {
+      bucket = new struct memory_handler_bucket_struct;
+      bucket->list = NULL;
+      BX_MEM_THIS memory_handlers[page_idx] = bucket;
+    }
+    if (bucket->list != NULL) {
+      if ((bitmap & bucket->list->bitmap) != 0) {
         BX_ERROR(("Register failed: overlapping memory handlers!"));
         return 0;
       } else {
-        bitmap |= BX_MEM_THIS memory_handlers[page_idx]->bitmap;
+        bitmap |= bucket->list->bitmap;
       }
     }
     struct memory_handler_struct *memory_handler = new struct memory_handler_struct;
-    memory_handler->next = BX_MEM_THIS memory_handlers[page_idx];
-    BX_MEM_THIS memory_handlers[page_idx] = memory_handler;
+    memory_handler->next = bucket->list;
+    bucket->list = memory_handler;
     memory_handler->read_handler = read_handler;
     memory_handler->write_handler = write_handler;
     memory_handler->da_handler = da_handler;
@@ -954,6 +1405,14 @@ BX_MEM_C::registerMemoryHandlers(void *param, memory_handler_t read_handler,
     memory_handler->begin = begin_addr;
     memory_handler->end = end_addr;
     memory_handler->bitmap = bitmap;
+#if BX_ENABLE_STATISTICS
+    memory_handler->hits = 0;
+    char name[32];
+    bx_list_c *stats = memory_handler_stats(memory_handler, page_idx, name);
+    if (stats != NULL)
+      new bx_shadow_num_c(stats, name, &memory_handler->hits);
+#endif
+    rebuild_memory_handler_index(page_idx);
   }
   return 1;
 }
@@ -971,7 +1430,8 @@ BX_MEM_C::unregisterMemoryHandlers(void *param, bx_phy_address begin_addr, bx_ph
     if (end_addr < ((page_idx + 1) << 20)) {
       bitmap &= (0xffff >> (0x0f - ((end_addr >> 16) & 0xf)));
     }
-    struct memory_handler_struct *memory_handler = BX_MEM_THIS memory_handlers[page_idx];
+    struct memory_handler_bucket_struct *bucket = BX_MEM_THIS memory_handlers[page_idx];
+    struct memory_handler_struct *memory_handler = bucket ? bucket->list : NULL;
     struct memory_handler_struct *prev = NULL;
     while (memory_handler &&
          memory_handler->param != param &&
@@ -989,8 +1449,21 @@ BX_MEM_C::unregisterMemoryHandlers(void *param, bx_phy_address begin_addr, bx_ph
     if (prev)
       prev->next = memory_handler->next;
     else
-      BX_MEM_THIS memory_handlers[page_idx] = memory_handler->next;
+      bucket->list = memory_handler->next;
+#if BX_ENABLE_STATISTICS
+    char name[32];
+    bx_list_c *stats = memory_handler_stats(memory_handler, page_idx, name);
+    if (stats != NULL)
+      stats->remove(name);
+#endif
     delete memory_handler;
+    if (bucket->list == NULL) {
+      delete bucket;
+      BX_MEM_THIS memory_handlers[page_idx] = NULL;
+    }
+    else {
+      rebuild_memory_handler_index(page_idx);
+    }
   }
   return ret;
 }
@@ -1143,6 +1616,11 @@ bool BX_MEM_C::is_monitor(bx_phy_address begin_addr, unsigned len)
 
 void BX_MEM_C::check_monitor(bx_phy_address begin_addr, unsigned len)
 {
+#if BX_SMP_HOST_THREADS
+  // the monitored processors are woken up under the simulator lock
+  if (! is_monitor(begin_addr, len)) return;
+  BX_SIM_LOCK_SCOPE();
+#endif
   for (int i=0; i<BX_SMP_PROCESSORS;i++) {
     BX_CPU(i)->check_monitor(begin_addr, len);
   }
@@ -45,6 +45,8 @@
 #include "iodev/hdimage/vmware4.h"
 #include "iodev/hdimage/vpc.h"
 #include "iodev/hdimage/vbox.h"
+#include "iodev/hdimage/dedup.h"
+#include "iodev/hdimage/compressed.h"
 
 #define BXIMAGE_FUNC_NULL            0
 #define BXIMAGE_FUNC_CREATE_IMAGE    1
@@ -97,9 +99,9 @@ const unsigned fdsize_sectors[] = { 320, 360, 640, 720, 1440, 2400, 2880, 3360,
 int fdsize_n_choices = 10;
 
 // menu data for choosing disk mode
-const char *hdmode_menu = "\nWhat kind of image should I create?\nPlease type flat, sparse, growing, vpc or vmware4. ";
-const char *hdmode_choices[] = {"flat", "sparse", "growing", "vpc", "vmware4" };
-int hdmode_n_choices = 5;
+const char *hdmode_menu = "\nWhat kind of image should I create?\nPlease type flat, sparse, growing, vpc, vmware4, dedup or compressed. ";
+const char *hdmode_choices[] = {"flat", "sparse", "growing", "vpc", "vmware4", "dedup", "compressed" };
+int hdmode_n_choices = 7;
 
 // menu data for choosing hard disk sector size
 const char *sectsize_menu = "\nChoose the size of hard disk sectors.\nPlease type 512, 1024 or 4096. ";
@@ -331,6 +333,10 @@ device_image_t* init_image(const char *imgmode)
     hdimage = new vpc_image_t();
   } else if (!strcmp(imgmode, "vbox")) {
     hdimage = new vbox_image_t();
+  } else if (!strcmp(imgmode, "dedup")) {
+    hdimage = new dedup_image_t();
+  } else if (!strcmp(imgmode, "compressed")) {
+    hdimage = new compressed_image_t();
   } else {
     fatal("unsupported disk image mode");
   }
@@ -413,6 +419,10 @@ device_image_t* create_hard_disk_image(const char *filename, const char *imgmode
     hdimage->create_image(filename, size);
   } else if(!strcmp(imgmode, "vmware4")) {
     hdimage->create_image(filename, size);
+  } else if(!strcmp(imgmode, "dedup")) {
+    hdimage->create_image(filename, size);
+  } else if(!strcmp(imgmode, "compressed")) {
+    hdimage->create_image(filename, size);
   } else {
     fatal("image mode not implemented yet");
   }
@@ -422,13 +432,14 @@ device_image_t* create_hard_disk_image(const char *filename, const char *imgmode
 void convert_image(const char *newimgmode, Bit64u newsize)
 {
   device_image_t *source_image, *dest_image;
-  Bit64u i, sc, s;
-  char buffer[512], null_sector[512];
+  hdimage_copy_c *copy;
+  bx_iovec_t iov;
+  Bit64u i, len;
+  int percent, last = 0;
   const char *imgmode = NULL;
   bool error = false;
 
   printf("\n");
-  memset(null_sector, 0, 512);
   if (newsize == 0) {
     if (!strncmp(bx_filename_1, "concat:", 7)) {
       imgmode = "concat";
@@ -466,27 +477,28 @@ void convert_image(const char *newimgmode, Bit64u newsize)
 
   printf("\nConverting image file: [  0%%]");
 
-  sc = source_image->hd_size / 512;
-  s = 0;
-  for (i = 0; i < source_image->hd_size; i+=512) {
-    printf("\x8\x8\x8\x8\x8%3d%%]", (int)((s+1)*100/sc));
-    fflush(stdout);
-    if (source_image->lseek(i, SEEK_SET) < 0) {
+  // the source is read in large blocks, the sectors containing data are
+  // written to the destination image by a separate thread
+  copy = new hdimage_copy_c(dest_image, 1);
+  for (i = 0; i < source_image->hd_size; i += len) {
+    len = source_image->hd_size - i;
+    if (len > HDIMAGE_COPY_BUFFER_SIZE) len = HDIMAGE_COPY_BUFFER_SIZE;
+    iov.iov_base = copy->get_buffer();
+    iov.iov_len = (size_t)len;
+    if (source_image->readv(i, &iov, 1) != (ssize_t)len) {
       error = true;
       break;
     }
-    if ((source_image->read(buffer, 512) == 512) &&
-        (memcmp(buffer, null_sector, 512) != 0)) {
-      if (dest_image->lseek(i, SEEK_SET) < 0) {
-        error = true;
-        break;
-      }
-      if (dest_image->write(buffer, 512) < 0) {
-        error = true;
-        break;
-      }
+    copy->put_buffer(i, (Bit32u)len);
+    percent = (int)((i + len) * 100 / source_image->hd_size);
+    if (percent != last) {
+      printf("\x8\x8\x8\x8\x8%3d%%]", percent);
+      fflush(stdout);
+      last = percent;
     }
-    s++;
+  }
+  if (copy->finish() < 0) {
+    error = true;
   }
 
   source_image->close();
@@ -495,9 +507,12 @@ void convert_image(const char *newimgmode, Bit64u newsize)
   delete source_image;
 
   if (error) {
+    delete copy;
     fatal("image conversion failed");
   } else {
     printf(" Done.\n");
+    copy->report("image conversion");
+    delete copy;
   }
 }
 
@@ -535,7 +550,7 @@ void commit_redolog()
   if (ret < 0) {
     fatal("redolog commit failed");
   } else {
-    printf(" Done.\n\n");
+    printf("Done.\n\n");
   }
 }
 
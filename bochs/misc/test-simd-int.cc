@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////
+//
+// test-simd-int.cc
+// $Id$
+//
+// This program checks that the host intrinsic implementations of the
+// packed integer helpers in cpu/simd_int.h produce bit-exact the same
+// results as the portable scalar code. The header is included twice,
+// once with the host intrinsics disabled, and every helper which has an
+// intrinsic version is called with the same random and boundary operands.
+//
+// Compile in a configured build directory with:
+//   c++ -O2 -msse4.1 -I. -I<srcdir> -Iinstrument/stubs \
+//       -o test-simd-int <srcdir>/misc/test-simd-int.cc
+// Use -msse2 or -mssse3 to test the other intrinsic levels. Then run
+// "test-simd-int" and see how it goes. If mismatches=0, the intrinsic
+// code is good.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "bochs.h"
+#include "cpu/cpu.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+// portable scalar code
+namespace scalar {
+#define BX_HOST_SIMD_SSE2 0
+#include "cpu/simd_int.h"
+}
+
+#undef BX_SIMD_INT_FUNCTIONS_H
+#undef BX_HOST_SIMD_SSE2
+#undef BX_HOST_SIMD_SSSE3
+#undef BX_HOST_SIMD_SSE4_1
+
+// host intrinsics selected by the compiler flags
+namespace host {
+#include "cpu/simd_int.h"
+}
+
+#define TEST_ITERATIONS 20000
+
+// helpers taking the destination and one source operand
+#define TEST_BINARY_OPS(X) \
+  X(pminsb) X(pminub) X(pminsw) X(pminuw) X(pminsd) X(pminud) \
+  X(pmaxsb) X(pmaxub) X(pmaxsw) X(pmaxuw) X(pmaxsd) X(pmaxud) \
+  X(unpcklps) X(unpckhps) X(unpcklpd) X(unpckhpd) \
+  X(punpcklbw) X(punpckhbw) X(punpcklwd) X(punpckhwd) \
+  X(packuswb) X(packsswb) X(packusdw) X(packssdw) \
+  X(psignb) X(psignw) X(psignd) \
+  X(andps) X(andnps) X(orps) X(xorps) \
+  X(paddb) X(paddw) X(paddd) X(paddq) X(psubb) X(psubw) X(psubd) X(psubq) \
+  X(paddsb) X(paddsw) X(paddusb) X(paddusw) \
+  X(psubsb) X(psubsw) X(psubusb) X(psubusw) \
+  X(phaddw) X(phaddd) X(phaddsw) X(phsubw) X(phsubd) X(phsubsw) \
+  X(pavgb) X(pavgw) X(pmullw) X(pmulhw) X(pmulhuw) X(pmulld) \
+  X(pmuldq) X(pmuludq) X(pmulhrsw) X(pmaddubsw) X(pmaddwd) X(psadbw)
+
+// helpers taking the destination and two source operands
+#define TEST_TERNARY_OPS(X) \
+  X(pblendvb) X(blendvps) X(blendvpd) X(pselect)
+
+#define TEST_UNARY_OPS(X) \
+  X(pabsb) X(pabsw) X(pabsd)
+
+#define TEST_MASK_OPS(X) \
+  X(pmovmskb) X(pmovmskd) X(pmovmskq)
+
+#define TEST_SHIFT_OPS(X) \
+  X(psraw) X(psrad) X(psrlw) X(psrld) X(psllw) X(pslld) X(psllq)
+
+static Bit64u rnd_state = BX_CONST64(0x2545f4914f6cdd1d);
+
+static Bit64u rnd(void)
+{
+  rnd_state ^= rnd_state << 13;
+  rnd_state ^= rnd_state >> 7;
+  rnd_state ^= rnd_state << 17;
+  return rnd_state;
+}
+
+// random operand, every other one built from boundary byte values which
+// hit the saturation, sign and rounding corner cases
+static void random_operand(BxPackedXmmRegister *op, unsigned n)
+{
+  static const Bit8u special[] = { 0x00, 0x01, 0x7f, 0x80, 0x81, 0xfe, 0xff };
+
+  op->xmm64u(0) = rnd();
+  op->xmm64u(1) = rnd();
+  if (n & 1) {
+    for (unsigned b=0; b < 16; b++) {
+      if (rnd() & 1)
+        op->xmmubyte(b) = special[rnd() % sizeof(special)];
+    }
+  }
+}
+
+static unsigned total = 0, mismatches = 0;
+
+static void check(const char *name, const void *r1, const void *r2, unsigned len,
+                  const BxPackedXmmRegister *op1, const BxPackedXmmRegister *op2)
+{
+  total++;
+  if (memcmp(r1, r2, len) != 0) {
+    if (mismatches++ < 20) {
+      printf("%s MISMATCH op1=%08x%08x%08x%08x op2=%08x%08x%08x%08x\n", name,
+        op1->xmm32u(3), op1->xmm32u(2), op1->xmm32u(1), op1->xmm32u(0),
+        op2->xmm32u(3), op2->xmm32u(2), op2->xmm32u(1), op2->xmm32u(0));
+    }
+  }
+}
+
+int main()
+{
+  BxPackedXmmRegister op1, op2, op3, r1, r2;
+
+  printf("host intrinsics: SSE2=%d SSSE3=%d SSE4.1=%d\n",
+    BX_HOST_SIMD_SSE2, BX_HOST_SIMD_SSSE3, BX_HOST_SIMD_SSE4_1);
+
+  for (unsigned n=0; n < TEST_ITERATIONS; n++) {
+    random_operand(&op1, n);
+    random_operand(&op2, n);
+    random_operand(&op3, n);
+
+#define X(name) \
+    r1 = op1; scalar::xmm_##name(&r1); \
+    r2 = op1; host::xmm_##name(&r2);   \
+    check(#name, &r1, &r2, sizeof(r1), &op1, &op1);
+    TEST_UNARY_OPS(X)
+#undef X
+
+#define X(name) \
+    r1 = op1; scalar::xmm_##name(&r1, &op2); \
+    r2 = op1; host::xmm_##name(&r2, &op2);   \
+    check(#name, &r1, &r2, sizeof(r1), &op1, &op2);
+    TEST_BINARY_OPS(X)
+#undef X
+
+#define X(name) \
+    r1 = op1; scalar::xmm_##name(&r1, &op2, &op3); \
+    r2 = op1; host::xmm_##name(&r2, &op2, &op3);   \
+    check(#name, &r1, &r2, sizeof(r1), &op1, &op2);
+    TEST_TERNARY_OPS(X)
+#undef X
+
+    // pshufb writes a separate destination
+    scalar::xmm_pshufb(&r1, &op1, &op2);
+    host::xmm_pshufb(&r2, &op1, &op2);
+    check("pshufb", &r1, &r2, sizeof(r1), &op1, &op2);
+
+#define X(name) { \
+    Bit32u m1 = scalar::xmm_##name(&op1); \
+    Bit32u m2 = host::xmm_##name(&op1);   \
+    check(#name, &m1, &m2, sizeof(m1), &op1, &op1); }
+    TEST_MASK_OPS(X)
+#undef X
+
+    // shift counts in and beyond the element width
+    Bit64u shift = (n & 3) ? (rnd() % 70) : rnd();
+#define X(name) \
+    r1 = op1; scalar::xmm_##name(&r1, shift); \
+    r2 = op1; host::xmm_##name(&r2, shift);   \
+    check(#name, &r1, &r2, sizeof(r1), &op1, &op1);
+    TEST_SHIFT_OPS(X)
+#undef X
+
+    r1 = op1; scalar::xmm_pbroadcastb(&r1, op2.xmmubyte(0));
+    r2 = op1; host::xmm_pbroadcastb(&r2, op2.xmmubyte(0));
+    check("pbroadcastb", &r1, &r2, sizeof(r1), &op1, &op2);
+    r1 = op1; scalar::xmm_pbroadcastw(&r1, op2.xmm16u(0));
+    r2 = op1; host::xmm_pbroadcastw(&r2, op2.xmm16u(0));
+    check("pbroadcastw", &r1, &r2, sizeof(r1), &op1, &op2);
+    r1 = op1; scalar::xmm_pbroadcastd(&r1, op2.xmm32u(0));
+    r2 = op1; host::xmm_pbroadcastd(&r2, op2.xmm32u(0));
+    check("pbroadcastd", &r1, &r2, sizeof(r1), &op1, &op2);
+  }
+
+  printf("mismatches=%u\n", mismatches);
+  printf("total=%u\n", total);
+  return (mismatches != 0);
+}
@@ -35,12 +35,14 @@
 #define BXPN_DEBUG_RUNNING               "general.debug_running"
 #define BXPN_PLUGIN_CTRL                 "general.plugin_ctrl"
 #define BXPN_UNLOCK_IMAGES               "general.unlock_images"
+#define BXPN_SAVE_FORMAT                 "general.save_format"
 #define BXPN_CPU_NPROCESSORS             "cpu.n_processors"
 #define BXPN_CPU_NCORES                  "cpu.n_cores"
 #define BXPN_CPU_NTHREADS                "cpu.n_threads"
 #define BXPN_CPU_MODEL                   "cpu.model"
 #define BXPN_IPS                         "cpu.ips"
 #define BXPN_SMP_QUANTUM                 "cpu.quantum"
+#define BXPN_ICACHE_SIZE                 "cpu.icache_size"
 #define BXPN_RESET_ON_TRIPLE_FAULT       "cpu.reset_on_triple_fault"
 #define BXPN_IGNORE_BAD_MSRS             "cpu.ignore_bad_msrs"
 #define BXPN_CONFIGURABLE_MSRS_PATH      "cpu.msrs"
@@ -82,6 +84,10 @@
 #define BXPN_MEM_SIZE                    "memory.standard.ram.size"
 #define BXPN_HOST_MEM_SIZE               "memory.standard.ram.host_size"
 #define BXPN_MEM_BLOCK_SIZE              "memory.standard.ram.block_size"
+#define BXPN_MEM_MMAP                    "memory.standard.ram.mmap"
+#define BXPN_MEM_HUGEPAGES               "memory.standard.ram.hugepages"
+#define BXPN_MEM_FILE                    "memory.standard.ram.file"
+#define BXPN_MEM_INCREMENTAL_SAVE        "memory.standard.ram.incremental_save"
 #define BXPN_ROMIMAGE                    "memory.standard.rom"
 #define BXPN_ROM_PATH                    "memory.standard.rom.file"
 #define BXPN_ROM_ADDRESS                 "memory.standard.rom.address"
@@ -101,6 +107,7 @@
 #define BXPN_PCI_ADV_OPTS                "pci.advopts"
 #define BXPN_PCIDEV_VENDOR               "pci.pcidev.vendor"
 #define BXPN_PCIDEV_DEVICE               "pci.pcidev.device"
+#define BXPN_VIRTIO_BLK                  "pci.virtio_blk"
 #define BXPN_SEL_DISPLAY_LIBRARY         "display.display_library"
 #define BXPN_DISPLAYLIB_OPTIONS          "display.displaylib_options"
 #define BXPN_PRIVATE_COLORMAP            "display.private_colormap"
@@ -23,6 +23,9 @@
 #include "bochs.h"
 #include "cpu/cpu.h"
 #include "iodev/iodev.h"
+#if BX_SMP_HOST_THREADS
+#include "bxthread.h"
+#endif
 #define LOG_THIS bx_pc_system.
 
 #if defined(PROVIDE_M_IPS)
@@ -55,6 +58,10 @@ bx_pc_system_c::bx_pc_system_c()
   timer[0].funct      = nullTimer;
   timer[0].this_ptr   = this;
   numTimers = 1; // So far, only the nullTimer.
+
+  timerHeap[0] = 0;
+  timer[0].heapIndex = 0;
+  timerHeapSize = 1;
 }
 
 void bx_pc_system_c::initialize(Bit32u ips)
@@ -68,10 +75,16 @@ void bx_pc_system_c::initialize(Bit32u ips)
   triggeredTimer = 0;
   HRQ = 0;
   kill_bochs_request = 0;
+#if BX_SMP_HOST_THREADS
+  cpu_threads_running = 0;
+  reset_request = 0;
+#endif
 
   // parameter 'ips' is the processor speed in Instructions-Per-Second
   m_ips = double(ips) / 1000000.0L;
 
+  rebuildTimerHeap();
+
   BX_DEBUG(("ips = %u", (unsigned) ips));
 }
 
@@ -79,7 +92,11 @@ void bx_pc_system_c::set_HRQ(bool val)
 {
   HRQ = val;
   if (val)
+#if BX_SMP_HOST_THREADS
+    BX_CPU(0)->signal_async_event();
+#else
     BX_CPU(0)->async_event = 1;
+#endif
 }
 
 void bx_pc_system_c::raise_INTR(void)
@@ -105,7 +122,9 @@ void bx_pc_system_c::clear_INTR(void)
   Bit32u BX_CPP_AttrRegparmN(2)
 bx_pc_system_c::inp(Bit16u addr, unsigned io_len)
 {
+  BX_SIM_LOCK();
   Bit32u ret = bx_devices.inp(addr, io_len);
+  BX_SIM_UNLOCK();
   return ret;
 }
 
@@ -116,7 +135,9 @@ bx_pc_system_c::inp(Bit16u addr, unsigned io_len)
   void BX_CPP_AttrRegparmN(3)
 bx_pc_system_c::outp(Bit16u addr, Bit32u value, unsigned io_len)
 {
+  BX_SIM_LOCK();
   bx_devices.outp(addr, value, io_len);
+  BX_SIM_UNLOCK();
 }
 
 void bx_pc_system_c::set_enable_a20(bool value)
@@ -173,18 +194,83 @@ bool bx_pc_system_c::get_enable_a20(void)
 
 void bx_pc_system_c::MemoryMappingChanged(void)
 {
-  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++)
+  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SMP_HOST_THREADS
+    if (BX_CPU(i)->is_running_remotely()) {
+      BX_CPU(i)->post_remote_request(BX_REMOTE_REQUEST_TLB_FLUSH);
+      continue;
+    }
+#endif
     BX_CPU(i)->TLB_flush();
+  }
 }
 
 void bx_pc_system_c::invlpg(bx_address addr)
 {
-  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++)
+  for (unsigned i=0; i<BX_SMP_PROCESSORS; i++) {
+#if BX_SMP_HOST_THREADS
+    // the remote processor flushes its whole TLB
+    if (BX_CPU(i)->is_running_remotely()) {
+      BX_CPU(i)->post_remote_request(BX_REMOTE_REQUEST_TLB_FLUSH);
+      continue;
+    }
+#endif
     BX_CPU(i)->TLB_invlpg(addr);
+  }
 }
 
+#if BX_SMP_HOST_THREADS
+
+static BX_MUTEX(sim_mutex) = PTHREAD_MUTEX_INITIALIZER;
+// nesting level of the simulator lock held by the calling thread
+static __thread unsigned sim_lock_depth = 0;
+
+void bx_pc_system_c::sim_lock(void)
+{
+  if (sim_lock_depth++ == 0) {
+    BX_LOCK(sim_mutex);
+  }
+}
+
+void bx_pc_system_c::sim_unlock(void)
+{
+  BX_ASSERT(sim_lock_depth > 0);
+  if (--sim_lock_depth == 0) {
+    BX_UNLOCK(sim_mutex);
+  }
+}
+
+void bx_pc_system_c::sim_unlock_all(void)
+{
+  if (sim_lock_depth > 0) {
+    sim_lock_depth = 0;
+    BX_UNLOCK(sim_mutex);
+  }
+}
+
+// called on the synchronization point, all the processor threads wait
+void bx_pc_system_c::handle_reset_request(void)
+{
+  unsigned type = reset_request;
+  if (type) {
+    reset_request = 0;
+    Reset(type);
+  }
+}
+
+#endif
+
 int bx_pc_system_c::Reset(unsigned type)
 {
+#if BX_SMP_HOST_THREADS
+  if (cpu_threads_running) {
+    // the processors could not be reset while running, stop them first
+    // and keep the hardware reset when both kinds are requested
+    if (type > reset_request) reset_request = type;
+    return(0);
+  }
+#endif
+
   // type is BX_RESET_HARDWARE or BX_RESET_SOFTWARE
   BX_INFO(("bx_pc_system_c::Reset(%s) called",type==BX_RESET_HARDWARE?"HARDWARE":"SOFTWARE"));
 
@@ -212,6 +298,7 @@ void bx_pc_system_c::exit(void)
 {
   // delete all registered timers (exception: null timer and APIC timer)
   numTimers = 1 + BX_SUPPORT_APIC;
+  rebuildTimerHeap();
   bx_devices.exit();
   if (bx_gui) {
     bx_gui->cleanup();
@@ -245,6 +332,11 @@ void bx_pc_system_c::register_state(void)
   }
 }
 
+void bx_pc_system_c::after_restore_state(void)
+{
+  rebuildTimerHeap();
+}
+
 // ================================================
 // Bochs internal timer delivery framework features
 // ================================================
@@ -298,8 +390,10 @@ int bx_pc_system_c::register_timer_ticks(void* this_ptr, bx_timer_handler_t func
   strncpy(timer[i].id, id, BxMaxTimerIDLen);
   timer[i].id[BxMaxTimerIDLen-1] = 0; // Null terminate if not already.
   timer[i].param      = 0;
+  timer[i].heapIndex  = BX_MAX_TIMERS;
 
   if (active) {
+    timerHeapUpdate(i);
     if (ticks < Bit64u(currCountdown)) {
       // This new timer needs to fire before the current countdown.
       // Skew the current countdown and countdown period to be smaller
@@ -320,9 +414,8 @@ int bx_pc_system_c::register_timer_ticks(void* this_ptr, bx_timer_handler_t func
 
 void bx_pc_system_c::countdownEvent(void)
 {
-  unsigned i, first = numTimers, last = 0;
-  Bit64u   minTimeToFire;
-  bool  triggered[BX_MAX_TIMERS];
+  unsigned i, n, numTriggered = 0;
+  unsigned triggered[BX_MAX_TIMERS];
 
   // The countdown decremented to 0.  We need to service all the active
   // timers, and invoke callbacks from those timers which have fired.
@@ -334,36 +427,27 @@ void bx_pc_system_c::countdownEvent(void)
   // Increment global ticks counter by number of ticks which have
   // elapsed since the last update.
   ticksTotal += Bit64u(currCountdownPeriod);
-  minTimeToFire = (Bit64u) -1;
 
-  for (i = 0; i < numTimers; i++) {
-    triggered[i] = 0; // Reset triggered flag.
-    if (timer[i].active) {
+  // The timers ready to fire are on top of the timer heap, they are taken
+  // in the order of their indices. The null timer is always active, so the
+  // heap is never empty.
+  while (timer[timerHeap[0]].timeToFire <= ticksTotal) {
+    i = timerHeap[0];
 #if BX_TIMER_DEBUG
-      if (ticksTotal > timer[i].timeToFire)
-        BX_PANIC(("countdownEvent: ticksTotal > timeToFire[%u], D " FMT_LL "u", i,
-                  timer[i].timeToFire-ticksTotal));
+    if (ticksTotal > timer[i].timeToFire)
+      BX_PANIC(("countdownEvent: ticksTotal > timeToFire[%u], D " FMT_LL "u", i,
+                ticksTotal-timer[i].timeToFire));
 #endif
-      if (ticksTotal == timer[i].timeToFire) {
-        // This timer is ready to fire.
-        triggered[i] = 1;
-
-        if (timer[i].continuous==0) {
-          // If triggered timer is one-shot, deactive.
-          timer[i].active = 0;
-        } else {
-          // Continuous timer, increment time-to-fire by period.
-          timer[i].timeToFire += timer[i].period;
-          if (timer[i].timeToFire < minTimeToFire)
-            minTimeToFire = timer[i].timeToFire;
-        }
-        if (i < first) first = i;
-        last = i;
-      } else {
-        // This timer is not ready to fire yet.
-        if (timer[i].timeToFire < minTimeToFire)
-          minTimeToFire = timer[i].timeToFire;
-      }
+    triggered[numTriggered++] = i;
+
+    if (timer[i].continuous==0) {
+      // If triggered timer is one-shot, deactive.
+      timer[i].active = 0;
+      timerHeapRemove(i);
+    } else {
+      // Continuous timer, increment time-to-fire by period.
+      timer[i].timeToFire += timer[i].period;
+      timerHeapSiftDown(0);
     }
   }
 
@@ -371,12 +455,13 @@ void bx_pc_system_c::countdownEvent(void)
   // any of the callbacks, as they may call timer features, which need
   // to be advanced to the next countdown cycle.
   currCountdown = currCountdownPeriod =
-      Bit32u(minTimeToFire - ticksTotal);
+      Bit32u(timer[timerHeap[0]].timeToFire - ticksTotal);
 
-  for (i = first; i <= last; i++) {
+  for (n = 0; n < numTriggered; n++) {
     // Call requested timer function.  It may request a different
     // timer period or deactivate etc.
-    if (triggered[i] && (timer[i].funct != NULL)) {
+    i = triggered[n];
+    if (timer[i].funct != NULL) {
       triggeredTimer = i;
       timer[i].funct(timer[i].this_ptr);
       triggeredTimer = 0;
@@ -384,6 +469,86 @@ void bx_pc_system_c::countdownEvent(void)
   }
 }
 
+void bx_pc_system_c::timerHeapSiftUp(unsigned pos)
+{
+  unsigned id = timerHeap[pos];
+
+  while (pos > 0) {
+    unsigned parent = (pos - 1) / 2;
+    if (! timerFiresBefore(id, timerHeap[parent])) break;
+    timerHeap[pos] = timerHeap[parent];
+    timer[timerHeap[pos]].heapIndex = pos;
+    pos = parent;
+  }
+
+  timerHeap[pos] = id;
+  timer[id].heapIndex = pos;
+}
+
+void bx_pc_system_c::timerHeapSiftDown(unsigned pos)
+{
+  unsigned id = timerHeap[pos];
+
+  for (;;) {
+    unsigned child = 2 * pos + 1;
+    if (child >= timerHeapSize) break;
+    if (child + 1 < timerHeapSize && timerFiresBefore(timerHeap[child + 1], timerHeap[child]))
+      child++;
+    if (! timerFiresBefore(timerHeap[child], id)) break;
+    timerHeap[pos] = timerHeap[child];
+    timer[timerHeap[pos]].heapIndex = pos;
+    pos = child;
+  }
+
+  timerHeap[pos] = id;
+  timer[id].heapIndex = pos;
+}
+
+// insert active timer into the heap or fix its position after the time to
+// fire was changed
+void bx_pc_system_c::timerHeapUpdate(unsigned i)
+{
+  unsigned pos = timer[i].heapIndex;
+
+  if (pos >= timerHeapSize || timerHeap[pos] != i) {
+    pos = timerHeapSize++;
+    timerHeap[pos] = i;
+  }
+
+  timerHeapSiftUp(pos);
+  timerHeapSiftDown(timer[i].heapIndex);
+}
+
+void bx_pc_system_c::timerHeapRemove(unsigned i)
+{
+  unsigned pos = timer[i].heapIndex;
+
+  if (pos >= timerHeapSize || timerHeap[pos] != i) return; // not in the heap
+
+  timer[i].heapIndex = BX_MAX_TIMERS;
+
+  if (pos != --timerHeapSize) {
+    unsigned moved = timerHeap[timerHeapSize];
+    timerHeap[pos] = moved;
+    timerHeapSiftUp(pos);
+    timerHeapSiftDown(timer[moved].heapIndex);
+  }
+}
+
+void bx_pc_system_c::rebuildTimerHeap(void)
+{
+  timerHeapSize = 0;
+
+  for (unsigned i = 0; i < numTimers; i++) {
+    timer[i].heapIndex = BX_MAX_TIMERS;
+    if (timer[i].active) {
+      unsigned pos = timerHeapSize++;
+      timerHeap[pos] = i;
+      timerHeapSiftUp(pos);
+    }
+  }
+}
+
 void bx_pc_system_c::nullTimer(void* this_ptr)
 {
   // This function is always inserted in timer[0].  It is sort of
@@ -494,6 +659,7 @@ void bx_pc_system_c::activate_timer_ticks(unsigned i, Bit64u ticks, bool continu
   timer[i].timeToFire = (ticksTotal + Bit64u(currCountdownPeriod-currCountdown)) + ticks;
   timer[i].active     = 1;
   timer[i].continuous = continuous;
+  timerHeapUpdate(i);
 
   if (ticks < Bit64u(currCountdown)) {
     // This new timer needs to fire before the current countdown.
@@ -569,6 +735,7 @@ void bx_pc_system_c::deactivate_timer(unsigned i)
 #endif
 
   timer[i].active = 0;
+  timerHeapRemove(i);
 }
 
 bool bx_pc_system_c::unregisterTimer(unsigned timerIndex)
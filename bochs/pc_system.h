@@ -54,9 +54,15 @@ private:
 #define BxMaxTimerIDLen 32
     char id[BxMaxTimerIDLen];  // String ID of timer.
     Bit32u param;              // Device-specific value assigned to timer (optional)
+    unsigned heapIndex;        // Position in the timerHeap if active.
   } timer[BX_MAX_TIMERS];
 
   unsigned   numTimers;  // Number of currently allocated timers.
+
+  // Active timers are kept in a binary min-heap ordered by time to fire
+  // (ties broken by timer index), the next timer to expire is on top.
+  unsigned   timerHeap[BX_MAX_TIMERS];
+  unsigned   timerHeapSize;
   unsigned   triggeredTimer;  // ID of the actually triggered timer.
   Bit32u     currCountdown; // Current countdown ticks value (decrements to 0).
   Bit32u     currCountdownPeriod; // Length of current countdown period.
@@ -82,6 +88,16 @@ private:
   // ticks finds that an event has occurred.
   void   countdownEvent(void);
 
+  BX_CPP_INLINE bool timerFiresBefore(unsigned a, unsigned b) const {
+    return (timer[a].timeToFire < timer[b].timeToFire) ||
+           (timer[a].timeToFire == timer[b].timeToFire && a < b);
+  }
+  void   timerHeapSiftUp(unsigned pos);
+  void   timerHeapSiftDown(unsigned pos);
+  void   timerHeapUpdate(unsigned timerID);
+  void   timerHeapRemove(unsigned timerID);
+  void   rebuildTimerHeap(void);
+
 public:
 
   // ==============================
@@ -108,7 +124,19 @@ public:
       bx_pc_system.countdownEvent();
     }
   }
+#if BX_SUPPORT_DBT
+  // translated code decrements the countdown inline and calls tick1()
+  // only when the countdown is about to expire
+  static BX_CPP_INLINE Bit32u *getCountdownPtr(void) {
+    return &bx_pc_system.currCountdown;
+  }
+#endif
   static BX_CPP_INLINE void tickn(Bit32u n) {
+#if BX_SMP_HOST_THREADS
+    // the repeated string instructions advance the time from the
+    // processor threads as well
+    bx_pc_system.sim_lock();
+#endif
     while (n >= bx_pc_system.currCountdown) {
       n -= bx_pc_system.currCountdown;
       bx_pc_system.currCountdown = 0;
@@ -118,6 +146,9 @@ public:
     // 'n' is not (or no longer) >= the countdown size.  We can just decrement
     // the remaining requested ticks and continue.
     bx_pc_system.currCountdown -= n;
+#if BX_SMP_HOST_THREADS
+    bx_pc_system.sim_unlock();
+#endif
   }
 
   int register_timer_ticks(void* this_ptr, bx_timer_handler_t, Bit64u ticks,
@@ -128,8 +159,18 @@ public:
   Bit64u time_nsec();
   Bit64u time_usec_sequential();
   static BX_CPP_INLINE Bit64u time_ticks() {
+#if BX_SMP_HOST_THREADS
+    // the countdown is adjusted by the timer functions of the devices
+    // running in the other processor threads
+    bx_pc_system.sim_lock();
+    Bit64u ticks = bx_pc_system.ticksTotal +
+      Bit64u(bx_pc_system.currCountdownPeriod - bx_pc_system.currCountdown);
+    bx_pc_system.sim_unlock();
+    return ticks;
+#else
     return bx_pc_system.ticksTotal +
       Bit64u(bx_pc_system.currCountdownPeriod - bx_pc_system.currCountdown);
+#endif
   }
 
   static BX_CPP_INLINE Bit32u  getNumCpuTicksLeftNextEvent(void) {
@@ -167,6 +208,27 @@ public:
 
   volatile bool kill_bochs_request;
 
+#if BX_SMP_HOST_THREADS
+  // ======================================
+  // Processors running in the host threads
+  // ======================================
+
+  // The devices, the timers and the local APICs are shared by all the
+  // processor threads and protected by one recursive simulator lock
+  void sim_lock(void);
+  void sim_unlock(void);
+  // release the lock still held by the thread after an exception
+  void sim_unlock_all(void);
+
+  // set while the processors are running in parallel, between two
+  // synchronization points of the emulated time
+  volatile bool cpu_threads_running;
+  // system reset requested while the processors were running, it is
+  // done on the next synchronization point
+  volatile unsigned reset_request;
+  void handle_reset_request(void);
+#endif
+
   void set_HRQ(bool val);  // set the Hold ReQuest line
 
   void raise_INTR(void);
@@ -186,8 +248,26 @@ public:
   void    invlpg(bx_address addr);    // flush TLB page in all CPUs
   void    exit(void);
   void    register_state(void);
+  void    after_restore_state(void);
+};
+
+#if BX_SMP_HOST_THREADS
+// holds the simulator lock until the end of the enclosing scope
+class bx_sim_lock_guard_c {
+public:
+  bx_sim_lock_guard_c() { bx_pc_system.sim_lock(); }
+ ~bx_sim_lock_guard_c() { bx_pc_system.sim_unlock(); }
 };
 
+#define BX_SIM_LOCK()               bx_pc_system.sim_lock()
+#define BX_SIM_UNLOCK()             bx_pc_system.sim_unlock()
+#define BX_SIM_LOCK_SCOPE()         bx_sim_lock_guard_c sim_lock_guard
+#else
+#define BX_SIM_LOCK()
+#define BX_SIM_UNLOCK()
+#define BX_SIM_LOCK_SCOPE()
+#endif
+
 #define BX_TICK1()                  bx_pc_system.tick1()
 #define BX_TICKN(n)                 bx_pc_system.tickn(n)
 #define BX_INTR                     bx_pc_system.INTR
@@ -952,6 +952,22 @@ void bx_plugins_after_restore_state()
   }
 }
 
+/**************************************************************************/
+/* Plugin system: Notify all plugin devices that the simulation is forked */
+/**************************************************************************/
+
+void bx_plugins_after_fork(bool child)
+{
+  device_t *device;
+
+  for (device = core_devices; device; device = device->next) {
+    device->devmodel->after_fork(child);
+  }
+  for (device = devices; device; device = device->next) {
+    device->devmodel->after_fork(child);
+  }
+}
+
 #if !BX_PLUGINS
 
 // Special code for handling modules when plugin support is turned off.
@@ -1062,6 +1078,9 @@ plugin_t bx_builtin_plugins[] = {
 #if BX_SUPPORT_USB_XHCI
   BUILTIN_OPTPCI_PLUGIN_ENTRY(usb_xhci),
 #endif
+#if BX_SUPPORT_VIRTIO_BLK
+  BUILTIN_OPTPCI_PLUGIN_ENTRY(virtio_blk),
+#endif
 #if BX_SUPPORT_SOUNDLOW
   BUILTIN_SND_PLUGIN_ENTRY(dummy),
   BUILTIN_SND_PLUGIN_ENTRY(file),
@@ -1121,6 +1140,8 @@ plugin_t bx_builtin_plugins[] = {
   BUILTIN_IMG_PLUGIN_ENTRY(vbox),
   BUILTIN_IMG_PLUGIN_ENTRY(vpc),
   BUILTIN_IMG_PLUGIN_ENTRY(vvfat),
+  BUILTIN_IMG_PLUGIN_ENTRY(dedup),
+  BUILTIN_IMG_PLUGIN_ENTRY(compressed),
   {"NULL", PLUGTYPE_NULL, 0, NULL, 0}
 };
 
@@ -75,6 +75,7 @@ extern "C" {
 #define BX_PLUGIN_IOAPIC    "ioapic"
 #define BX_PLUGIN_HPET      "hpet"
 #define BX_PLUGIN_VOODOO    "voodoo"
+#define BX_PLUGIN_VIRTIO_BLK "virtio_blk"
 
 
 #define BX_REGISTER_DEVICE_DEVMODEL(a,b,c,d) pluginRegisterDeviceDevmodel(a,b,c,d)
@@ -141,6 +142,7 @@ extern "C" {
 #define DEV_reset_devices(type) {bx_devices.reset(type); }
 #define DEV_register_state() {bx_devices.register_state(); }
 #define DEV_after_restore_state() {bx_devices.after_restore_state(); }
+#define DEV_after_fork(a) {bx_devices.after_fork(a); }
 #define DEV_register_timer(a,b,c,d,e,f) bx_pc_system.register_timer(a,b,c,d,e,f)
 
 ///////// Removable devices macros
@@ -181,7 +183,7 @@ extern "C" {
 #define DEV_hd_write_handler(a, b, c, d) \
     (bx_devices.pluginHardDrive->virt_write_handler(b, c, d))
 #define DEV_hd_bmdma_read_sector(a,b,c) bx_devices.pluginHardDrive->bmdma_read_sector(a,b,c)
-#define DEV_hd_bmdma_write_sector(a,b) bx_devices.pluginHardDrive->bmdma_write_sector(a,b)
+#define DEV_hd_bmdma_write_sector(a,b,c) bx_devices.pluginHardDrive->bmdma_write_sector(a,b,c)
 #define DEV_hd_bmdma_complete(a) bx_devices.pluginHardDrive->bmdma_complete(a)
 
 #define DEV_bulk_io_quantum_requested() (bx_devices.bulkIOQuantumsRequested)
@@ -349,6 +351,7 @@ extern void bx_reset_plugins(unsigned);
 extern void bx_unload_plugins(void);
 extern void bx_plugins_register_state(void);
 extern void bx_plugins_after_restore_state(void);
+extern void bx_plugins_after_fork(bool child);
 
 #if !BX_PLUGINS
 extern plugin_t bx_builtin_plugins[];
@@ -441,6 +444,7 @@ PLUGIN_ENTRY_FOR_MODULE(iodebug);
 PLUGIN_ENTRY_FOR_MODULE(ioapic);
 PLUGIN_ENTRY_FOR_MODULE(hpet);
 PLUGIN_ENTRY_FOR_MODULE(voodoo);
+PLUGIN_ENTRY_FOR_MODULE(virtio_blk);
 // config interface plugins
 PLUGIN_ENTRY_FOR_MODULE(textconfig);
 PLUGIN_ENTRY_FOR_MODULE(win32config);
@@ -488,6 +492,8 @@ PLUGIN_ENTRY_FOR_IMG_MODULE(vmware4);
 PLUGIN_ENTRY_FOR_IMG_MODULE(vbox);
 PLUGIN_ENTRY_FOR_IMG_MODULE(vpc);
 PLUGIN_ENTRY_FOR_IMG_MODULE(vvfat);
+PLUGIN_ENTRY_FOR_IMG_MODULE(dedup);
+PLUGIN_ENTRY_FOR_IMG_MODULE(compressed);
 
 #endif
 